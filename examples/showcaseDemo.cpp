@@ -12,7 +12,7 @@ void loadSponzaScene(Raz::Entity& mesh, Raz::RenderSystem& render) {
 
   auto& meshTrans = mesh.getComponent<Raz::Transform>();
   meshTrans.setPosition(0.f, -1.f, 0.f);
-  meshTrans.setRotation(Raz::Mat4f::identity());
+  meshTrans.setRotation(Raz::Quaternionf::identity());
   meshTrans.setScale(0.01f);
 }
 
@@ -28,7 +28,7 @@ void loadBallScene(Raz::Entity& mesh, Raz::RenderSystem& render) {
 
   auto& meshTrans = mesh.getComponent<Raz::Transform>();
   meshTrans.setPosition(0.f, 0.f, 0.f);
-  meshTrans.setRotation(Raz::Mat4f::identity());
+  meshTrans.setRotation(Raz::Quaternionf::identity());
   meshTrans.setScale(1.f);
 }
 
@@ -60,7 +60,7 @@ void loadCerberusScene(Raz::Entity& mesh, Raz::RenderSystem& render) {
 
   auto& meshTrans = mesh.getComponent<Raz::Transform>();
   meshTrans.setPosition(0.f, 0.f, 0.f);
-  meshTrans.setRotation(Raz::Mat4f::identity());
+  meshTrans.setRotation(Raz::Quaternionf::identity());
   meshTrans.setScale(2.5f);
 }
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef RAZ_BATCH_HPP
+#define RAZ_BATCH_HPP
+
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+/// Array of 3D vectors, stored as three separate streams of X, Y & Z components (structure of arrays).
+/// This layout allows the batch functions to process several vectors at once with SIMD instructions.
+class Vec3fArray {
+public:
+  Vec3fArray() = default;
+  explicit Vec3fArray(std::size_t size) : m_xValues(size), m_yValues(size), m_zValues(size) {}
+  explicit Vec3fArray(const std::vector<Vec3f>& vectors);
+
+  std::size_t getSize() const { return m_xValues.size(); }
+  const std::vector<float>& getX() const { return m_xValues; }
+  std::vector<float>& getX() { return m_xValues; }
+  const std::vector<float>& getY() const { return m_yValues; }
+  std::vector<float>& getY() { return m_yValues; }
+  const std::vector<float>& getZ() const { return m_zValues; }
+  std::vector<float>& getZ() { return m_zValues; }
+
+  /// Creates an array from a member of each given element (for example the positions of a list of vertices).
+  /// \tparam T Type of the elements to gather the vectors from.
+  /// \param elements Elements to gather the vectors from.
+  /// \param member Pointer to the member to be gathered.
+  /// \return Array containing each element's member.
+  template <typename T> static Vec3fArray gather(const std::vector<T>& elements, Vec3f T::* member);
+
+  bool isEmpty() const { return m_xValues.empty(); }
+  void resize(std::size_t size);
+  void reserve(std::size_t size);
+  void clear() { resize(0); }
+  void add(const Vec3f& vec);
+  void set(std::size_t index, const Vec3f& vec);
+
+  /// Element fetching operator given its index.
+  /// Since the components are stored separately, the vector is recomposed & returned by value.
+  /// \param index Element's index.
+  /// \return Recomposed vector.
+  Vec3f operator[](std::size_t index) const { return Vec3f({ m_xValues[index], m_yValues[index], m_zValues[index] }); }
+
+private:
+  std::vector<float> m_xValues {};
+  std::vector<float> m_yValues {};
+  std::vector<float> m_zValues {};
+};
+
+/// Batch functions, processing whole arrays of vectors at once.
+/// Unless stated otherwise, the result array may be the same as an input one to process it in-place.
+namespace Batch {
+
+/// Transforms points by a matrix; the points are considered as having a homogeneous coordinate of 1.
+/// The matrix is applied the same way as with Vec4f * Mat4f (the points are assumed to be horizontal).
+/// The resulting homogeneous coordinate is discarded, which is only exact for affine transformations.
+/// \param points Points to be transformed.
+/// \param matrix Transformation matrix.
+/// \param result Transformed points. Resized if necessary.
+void transformPoints(const Vec3fArray& points, const Mat4f& matrix, Vec3fArray& result);
+/// Transforms directions by a matrix; the directions are considered as having a homogeneous coordinate of 0, ignoring any translation.
+/// \param directions Directions to be transformed.
+/// \param matrix Transformation matrix.
+/// \param result Transformed directions. Resized if necessary.
+void transformDirections(const Vec3fArray& directions, const Mat4f& matrix, Vec3fArray& result);
+/// Transforms normals by a matrix & normalizes the results.
+/// To remain orthogonal to their surface, normals must be transformed by the inverse transpose of the model matrix.
+/// \param normals Normals to be transformed.
+/// \param normalMatrix Inverse transpose of the transformation matrix.
+/// \param result Transformed normals. Resized if necessary.
+void transformNormals(const Vec3fArray& normals, const Mat4f& normalMatrix, Vec3fArray& result);
+/// Normalizes in-place all the vectors of the array.
+/// As with Vector::normalize(), null vectors are not handled & will result in NaNs.
+/// \param vectors Vectors to be normalized.
+void normalize(Vec3fArray& vectors);
+/// Normalizes in-place all the vectors of the array, using an approximated inverse square root; see Simd::fastRsqrt() for its error.
+/// \param vectors Vectors to be normalized.
+void normalizeFast(Vec3fArray& vectors);
+/// Computes the dot products between each pair of vectors at the same index in the two arrays.
+/// \param firstVectors First vectors.
+/// \param secondVectors Second vectors; must be of the same size as the first ones.
+/// \param result Dot products. Resized if necessary.
+void computeDotProducts(const Vec3fArray& firstVectors, const Vec3fArray& secondVectors, std::vector<float>& result);
+/// Computes the cross products between each pair of vectors at the same index in the two arrays.
+/// \param firstVectors First vectors.
+/// \param secondVectors Second vectors; must be of the same size as the first ones.
+/// \param result Cross products. Resized if necessary.
+void computeCrossProducts(const Vec3fArray& firstVectors, const Vec3fArray& secondVectors, Vec3fArray& result);
+/// Computes the bounds of a set of points, reducing them to their minimal & maximal components.
+/// If the array is empty, the minimal point is set to the highest float value & the maximal one to the lowest.
+/// \param points Points to compute the bounds of.
+/// \param minPoint Point having the lowest values on all axes.
+/// \param maxPoint Point having the highest values on all axes.
+void computeBounds(const Vec3fArray& points, Vec3f& minPoint, Vec3f& maxPoint);
+
+} // namespace Batch
+
+} // namespace Raz
+
+#include "RaZ/Math/Batch.inl"
+
+#endif // RAZ_BATCH_HPP
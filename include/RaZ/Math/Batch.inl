@@ -0,0 +1,18 @@
+namespace Raz {
+
+template <typename T>
+Vec3fArray Vec3fArray::gather(const std::vector<T>& elements, Vec3f T::* member) {
+  Vec3fArray res(elements.size());
+
+  for (std::size_t i = 0; i < elements.size(); ++i) {
+    const Vec3f& vec = elements[i].*member;
+
+    res.m_xValues[i] = vec[0];
+    res.m_yValues[i] = vec[1];
+    res.m_zValues[i] = vec[2];
+  }
+
+  return res;
+}
+
+} // namespace Raz
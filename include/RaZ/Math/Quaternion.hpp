@@ -21,6 +21,20 @@ public:
   Quaternion(const Quaternion&) = default;
   Quaternion(Quaternion&&) noexcept = default;
 
+  T getReal() const { return m_real; }
+  const Vec3<T>& getComplexes() const { return m_complexes; }
+
+  /// Creates a quaternion directly from its components.
+  /// \param real Real component (w).
+  /// \param complexX First complex component (x).
+  /// \param complexY Second complex component (y).
+  /// \param complexZ Third complex component (z).
+  /// \return Created quaternion.
+  static Quaternion fromComponents(T real, T complexX, T complexY, T complexZ);
+  /// Identity quaternion creation, representing no rotation at all.
+  /// \return Identity quaternion.
+  static Quaternion identity() { return fromComponents(1, 0, 0, 0); }
+
   /// Computes the norm of the quaternion.
   /// Calculating the actual norm requires a square root operation to be involved, which is expensive.
   /// As such, this function should be used if actual length is needed; otherwise, prefer computeSquaredNorm().
@@ -31,6 +45,11 @@ public:
   /// This calculation does not involve a square root; it is then to be preferred over computeNorm() for faster operations.
   /// \return Quaternion's squared norm.
   T computeSquaredNorm() const { return (m_real * m_real + m_complexes.computeSquaredLength()); }
+  /// Computes the dot product between the current quaternion & the given one.
+  /// On unit quaternions, the returned value is the cosine of half the angle between both rotations.
+  /// \param quat Quaternion to compute the dot product with.
+  /// \return Dot product value.
+  T dot(const Quaternion& quat) const { return (m_real * quat.m_real + m_complexes.dot(quat.m_complexes)); }
   /// Computes the normalized quaternion to make it a unit one.
   /// A unit quaternion is also called a <a href="https://en.wikipedia.org/wiki/Versor">versor</a>.
   /// \return Normalized quaternion.
@@ -43,8 +62,23 @@ public:
   /// Inversing a quaternion consists of dividing the components of the conjugate by the squared norm.
   /// \return Quaternion's inverse.
   Quaternion<T> inverse() const;
+  /// Computes the normalized linear interpolation between the current quaternion & the given one.
+  /// This is cheaper than slerp() & commutative, but the rotation speed is not constant along the interpolation.
+  /// The shortest path is always taken, negating the given quaternion if necessary.
+  /// \param quat Quaternion to interpolate towards.
+  /// \param coeff Interpolation coefficient, between 0 (current quaternion) & 1 (given quaternion).
+  /// \return Normalized interpolated quaternion.
+  Quaternion<T> nlerp(const Quaternion& quat, T coeff) const;
+  /// Computes the spherical linear interpolation between the current quaternion & the given one.
+  /// The interpolated rotation evolves at a constant angular speed; both quaternions are assumed to be normalized.
+  /// The shortest path is always taken, negating the given quaternion if necessary.
+  /// \param quat Quaternion to interpolate towards.
+  /// \param coeff Interpolation coefficient, between 0 (current quaternion) & 1 (given quaternion).
+  /// \return Interpolated quaternion.
+  Quaternion<T> slerp(const Quaternion& quat, T coeff) const;
   /// Computes the rotation matrix represented by the quaternion.
   /// This operation automatically scales the matrix so that it returns a unit one.
+  /// Applying this matrix to a horizontal vector (vec * mat) is equivalent to rotating the vector with the quaternion.
   /// \return Rotation matrix.
   Mat4<T> computeMatrix() const;
 
@@ -54,8 +88,34 @@ public:
   /// Default move assignment operator.
   /// \return Reference to the moved quaternion.
   Quaternion& operator=(Quaternion&&) noexcept = default;
+  /// Quaternion-quaternion multiplication operator (Hamilton product).
+  /// The resulting quaternion represents the given rotation, followed by the current one.
+  /// \param quat Quaternion to be multiplied by.
+  /// \return Result of the multiplied quaternions.
+  Quaternion operator*(const Quaternion& quat) const;
+  /// Quaternion-quaternion multiplication assignment operator (Hamilton product).
+  /// \param quat Quaternion to be multiplied by.
+  /// \return Reference to the modified original quaternion.
+  Quaternion& operator*=(const Quaternion& quat);
+  /// Quaternion-vector multiplication operator, rotating the vector by the quaternion.
+  /// The quaternion is assumed to be normalized; this is cheaper than converting it to a matrix for a single vector.
+  /// \param vec Vector to be rotated.
+  /// \return Rotated vector.
+  Vec3<T> operator*(const Vec3<T>& vec) const;
+  /// Quaternion equality comparison operator.
+  /// Uses a near-equality check to take floating-point errors into account.
+  /// \param quat Quaternion to be compared with.
+  /// \return True if quaternions are [nearly] equal, false otherwise.
+  bool operator==(const Quaternion& quat) const;
+  /// Quaternion unequality comparison operator.
+  /// Uses a near-equality check to take floating-point errors into account.
+  /// \param quat Quaternion to be compared with.
+  /// \return True if quaternions are different, false otherwise.
+  bool operator!=(const Quaternion& quat) const { return !(*this == quat); }
 
 private:
+  Quaternion() = default;
+
   T m_real {};
   Vec3<T> m_complexes {};
 };
@@ -11,6 +11,16 @@ Quaternion<T>::Quaternion(T angleDegrees, const Vec3<T>& axis) {
   m_complexes = axis * val;
 }
 
+template <typename T>
+Quaternion<T> Quaternion<T>::fromComponents(T real, T complexX, T complexY, T complexZ) {
+  Quaternion<T> res;
+
+  res.m_real      = real;
+  res.m_complexes = Vec3<T>({ complexX, complexY, complexZ });
+
+  return res;
+}
+
 template <typename T>
 Quaternion<T> Quaternion<T>::normalize() const {
   Quaternion<T> res = *this;
@@ -49,21 +59,65 @@ Quaternion<T> Quaternion<T>::inverse() const {
   return res;
 }
 
+template <typename T>
+Quaternion<T> Quaternion<T>::nlerp(const Quaternion& quat, T coeff) const {
+  // Negating the target quaternion if needed, so that the shortest path is taken (q & -q represent the same rotation)
+  const T targetSign = (dot(quat) < 0 ? -1 : 1);
+  const T currCoeff  = 1 - coeff;
+
+  Quaternion<T> res;
+  res.m_real      = m_real * currCoeff + quat.m_real * targetSign * coeff;
+  res.m_complexes = m_complexes * currCoeff + quat.m_complexes * (targetSign * coeff);
+
+  return res.normalize();
+}
+
+template <typename T>
+Quaternion<T> Quaternion<T>::slerp(const Quaternion& quat, T coeff) const {
+  T cosAngle = dot(quat);
+  T targetSign = 1;
+
+  if (cosAngle < 0) {
+    cosAngle   = -cosAngle;
+    targetSign = -1;
+  }
+
+  // If both quaternions are almost identical, the sine below tends towards 0; a linear interpolation is then precise enough
+  if (cosAngle > static_cast<T>(0.9995))
+    return nlerp(quat, coeff);
+
+  const T angle     = std::acos(cosAngle);
+  const T invSin    = 1 / std::sin(angle);
+  const T currCoeff = std::sin((1 - coeff) * angle) * invSin;
+  const T quatCoeff = std::sin(coeff * angle) * invSin * targetSign;
+
+  Quaternion<T> res;
+  res.m_real      = m_real * currCoeff + quat.m_real * quatCoeff;
+  res.m_complexes = m_complexes * currCoeff + quat.m_complexes * quatCoeff;
+
+  return res;
+}
+
 template <typename T>
 Mat4<T> Quaternion<T>::computeMatrix() const {
-  const T invSqNorm = 1 / computeSquaredNorm();
+  // Folding the factor 2 & the normalization into a single scale, so that each term only requires two multiplications
+  const T scale = 2 / computeSquaredNorm();
+
+  const T scaledX = m_complexes[0] * scale;
+  const T scaledY = m_complexes[1] * scale;
+  const T scaledZ = m_complexes[2] * scale;
 
-  const T xx = (2 * m_complexes[0] * m_complexes[0]) * invSqNorm;
-  const T yy = (2 * m_complexes[1] * m_complexes[1]) * invSqNorm;
-  const T zz = (2 * m_complexes[2] * m_complexes[2]) * invSqNorm;
+  const T xx = m_complexes[0] * scaledX;
+  const T yy = m_complexes[1] * scaledY;
+  const T zz = m_complexes[2] * scaledZ;
 
-  const T xy = (2 * m_complexes[0] * m_complexes[1]) * invSqNorm;
-  const T xz = (2 * m_complexes[0] * m_complexes[2]) * invSqNorm;
-  const T yz = (2 * m_complexes[1] * m_complexes[2]) * invSqNorm;
+  const T xy = m_complexes[0] * scaledY;
+  const T xz = m_complexes[0] * scaledZ;
+  const T yz = m_complexes[1] * scaledZ;
 
-  const T xw = (2 * m_complexes[0] * m_real) * invSqNorm;
-  const T yw = (2 * m_complexes[1] * m_real) * invSqNorm;
-  const T zw = (2 * m_complexes[2] * m_real) * invSqNorm;
+  const T xw = m_real * scaledX;
+  const T yw = m_real * scaledY;
+  const T zw = m_real * scaledZ;
 
   return Mat4<T>({{ 1 - yy - zz,     xy + zw,     xz - yw, 0.f },
                   {     xy - zw, 1 - xx - zz,     yz + xw, 0.f },
@@ -71,4 +125,32 @@ Mat4<T> Quaternion<T>::computeMatrix() const {
                   {         0.f,         0.f,         0.f, 1.f }});
 }
 
+template <typename T>
+Quaternion<T> Quaternion<T>::operator*(const Quaternion& quat) const {
+  Quaternion<T> res;
+
+  res.m_real      = m_real * quat.m_real - m_complexes.dot(quat.m_complexes);
+  res.m_complexes = quat.m_complexes * m_real + m_complexes * quat.m_real + m_complexes.cross(quat.m_complexes);
+
+  return res;
+}
+
+template <typename T>
+Quaternion<T>& Quaternion<T>::operator*=(const Quaternion& quat) {
+  *this = *this * quat;
+  return *this;
+}
+
+template <typename T>
+Vec3<T> Quaternion<T>::operator*(const Vec3<T>& vec) const {
+  // Optimized form of q * v * q^-1 for a unit quaternion: v + 2w(u x v) + 2u x (u x v)
+  const Vec3<T> doubledCross = m_complexes.cross(vec) * 2;
+  return vec + doubledCross * m_real + m_complexes.cross(doubledCross);
+}
+
+template <typename T>
+bool Quaternion<T>::operator==(const Quaternion& quat) const {
+  return (FloatUtils::checkNearEquality(m_real, quat.m_real) && m_complexes == quat.m_complexes);
+}
+
 } // namespace Raz
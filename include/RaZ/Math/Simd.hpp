@@ -0,0 +1,225 @@
+#pragma once
+
+#ifndef RAZ_SIMD_HPP
+#define RAZ_SIMD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "RaZ/Utils/FloatUtils.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace Raz {
+
+/// Thin wrapper over the widest SIMD float register available at compile time.
+/// AVX (8 floats) is used if enabled, SSE (4 floats) otherwise; if none is available, operations fall back to single floats.
+/// Batch algorithms can then be written once, processing Simd::Width elements per iteration.
+/// Comparisons return masks, which can be combined with andMasks() & turned into one bit per element (the first being the lowest) with getMaskBits().
+namespace Simd {
+
+#if defined(__AVX__)
+
+using Float = __m256;
+constexpr std::size_t Width = 8;
+
+inline Float load(const float* values) { return _mm256_loadu_ps(values); }
+inline void store(float* values, Float vals) { _mm256_storeu_ps(values, vals); }
+inline Float set(float value) { return _mm256_set1_ps(value); }
+inline Float add(Float vals1, Float vals2) { return _mm256_add_ps(vals1, vals2); }
+inline Float sub(Float vals1, Float vals2) { return _mm256_sub_ps(vals1, vals2); }
+inline Float mul(Float vals1, Float vals2) { return _mm256_mul_ps(vals1, vals2); }
+inline Float div(Float vals1, Float vals2) { return _mm256_div_ps(vals1, vals2); }
+inline Float min(Float vals1, Float vals2) { return _mm256_min_ps(vals1, vals2); }
+inline Float max(Float vals1, Float vals2) { return _mm256_max_ps(vals1, vals2); }
+inline Float sqrt(Float vals) { return _mm256_sqrt_ps(vals); }
+inline Float abs(Float vals) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), vals); }
+inline Float round(Float vals) { return _mm256_round_ps(vals, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+inline Float floor(Float vals) { return _mm256_floor_ps(vals); }
+inline Float lessThan(Float vals1, Float vals2) { return _mm256_cmp_ps(vals1, vals2, _CMP_LT_OQ); }
+inline Float lessOrEqual(Float vals1, Float vals2) { return _mm256_cmp_ps(vals1, vals2, _CMP_LE_OQ); }
+inline Float andMasks(Float mask1, Float mask2) { return _mm256_and_ps(mask1, mask2); }
+inline unsigned int getMaskBits(Float mask) { return static_cast<unsigned int>(_mm256_movemask_ps(mask)); }
+inline Float select(Float mask, Float trueVals, Float falseVals) { return _mm256_blendv_ps(falseVals, trueVals, mask); }
+inline Float rsqrtEstimate(Float vals) { return _mm256_rsqrt_ps(vals); }
+inline Float reciprocalEstimate(Float vals) { return _mm256_rcp_ps(vals); }
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+using Float = __m128;
+constexpr std::size_t Width = 4;
+
+inline Float load(const float* values) { return _mm_loadu_ps(values); }
+inline void store(float* values, Float vals) { _mm_storeu_ps(values, vals); }
+inline Float set(float value) { return _mm_set1_ps(value); }
+inline Float add(Float vals1, Float vals2) { return _mm_add_ps(vals1, vals2); }
+inline Float sub(Float vals1, Float vals2) { return _mm_sub_ps(vals1, vals2); }
+inline Float mul(Float vals1, Float vals2) { return _mm_mul_ps(vals1, vals2); }
+inline Float div(Float vals1, Float vals2) { return _mm_div_ps(vals1, vals2); }
+inline Float min(Float vals1, Float vals2) { return _mm_min_ps(vals1, vals2); }
+inline Float max(Float vals1, Float vals2) { return _mm_max_ps(vals1, vals2); }
+inline Float sqrt(Float vals) { return _mm_sqrt_ps(vals); }
+inline Float abs(Float vals) { return _mm_andnot_ps(_mm_set1_ps(-0.f), vals); }
+inline Float round(Float vals) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(vals)); } // Only valid for values fitting in a 32-bit integer
+inline Float floor(Float vals) { // Only valid for values fitting in a 32-bit integer
+  // Truncation rounds negative values up; 1 is then removed wherever the truncated value is above the original one
+  const Float truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(vals));
+  return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, vals), _mm_set1_ps(1.f)));
+}
+inline Float lessThan(Float vals1, Float vals2) { return _mm_cmplt_ps(vals1, vals2); }
+inline Float lessOrEqual(Float vals1, Float vals2) { return _mm_cmple_ps(vals1, vals2); }
+inline Float andMasks(Float mask1, Float mask2) { return _mm_and_ps(mask1, mask2); }
+inline unsigned int getMaskBits(Float mask) { return static_cast<unsigned int>(_mm_movemask_ps(mask)); }
+inline Float select(Float mask, Float trueVals, Float falseVals) { return _mm_or_ps(_mm_and_ps(mask, trueVals), _mm_andnot_ps(mask, falseVals)); }
+inline Float rsqrtEstimate(Float vals) { return _mm_rsqrt_ps(vals); }
+inline Float reciprocalEstimate(Float vals) { return _mm_rcp_ps(vals); }
+
+#else
+
+using Float = float;
+constexpr std::size_t Width = 1;
+
+inline Float load(const float* values) { return *values; }
+inline void store(float* values, Float vals) { *values = vals; }
+inline Float set(float value) { return value; }
+inline Float add(Float vals1, Float vals2) { return vals1 + vals2; }
+inline Float sub(Float vals1, Float vals2) { return vals1 - vals2; }
+inline Float mul(Float vals1, Float vals2) { return vals1 * vals2; }
+inline Float div(Float vals1, Float vals2) { return vals1 / vals2; }
+inline Float min(Float vals1, Float vals2) { return std::min(vals1, vals2); }
+inline Float max(Float vals1, Float vals2) { return std::max(vals1, vals2); }
+inline Float sqrt(Float vals) { return std::sqrt(vals); }
+inline Float abs(Float vals) { return std::abs(vals); }
+inline Float round(Float vals) { return std::nearbyint(vals); }
+inline Float floor(Float vals) { return std::floor(vals); }
+inline Float lessThan(Float vals1, Float vals2) { return (vals1 < vals2 ? 1.f : 0.f); }
+inline Float lessOrEqual(Float vals1, Float vals2) { return (vals1 <= vals2 ? 1.f : 0.f); }
+inline Float andMasks(Float mask1, Float mask2) { return (mask1 != 0.f && mask2 != 0.f ? 1.f : 0.f); }
+inline unsigned int getMaskBits(Float mask) { return (mask != 0.f ? 1u : 0u); }
+inline Float select(Float mask, Float trueVals, Float falseVals) { return (mask != 0.f ? trueVals : falseVals); }
+// Without hardware estimates, the full scalar approximations are used directly; the refinement steps below are then harmless
+inline Float rsqrtEstimate(Float vals) { return FloatUtils::fastRsqrt(vals); }
+inline Float reciprocalEstimate(Float vals) { return FloatUtils::fastReciprocal(vals); }
+
+#endif
+
+/// Computes the lowest value held by a register.
+/// \param vals Register to reduce.
+/// \return Minimal value.
+inline float reduceMin(Float vals) {
+  std::array<float, Width> values {};
+  store(values.data(), vals);
+  return *std::min_element(values.cbegin(), values.cend());
+}
+
+/// Computes the highest value held by a register.
+/// \param vals Register to reduce.
+/// \return Maximal value.
+inline float reduceMax(Float vals) {
+  std::array<float, Width> values {};
+  store(values.data(), vals);
+  return *std::max_element(values.cbegin(), values.cend());
+}
+
+/// Computes an approximation of the inverse square root of each value, refined by one Newton-Raphson iteration.
+/// The relative error is below 3e-7 with SSE or AVX. Otherwise, FloatUtils::fastRsqrt() being refined once more, it is below 5e-6.
+/// \param vals Strictly positive values to compute the inverse square root of.
+/// \return Approximated inverse square roots.
+inline Float fastRsqrt(Float vals) {
+  const Float estimates   = rsqrtEstimate(vals);
+  const Float sqEstimates = mul(estimates, estimates);
+  return mul(estimates, sub(set(1.5f), mul(mul(set(0.5f), vals), sqEstimates)));
+}
+
+/// Computes an approximation of the reciprocal of each value, refined by one Newton-Raphson iteration.
+/// The relative error is below 3e-7 with SSE or AVX. Otherwise, FloatUtils::fastReciprocal() being refined once more, it is below 1e-5.
+/// \param vals Non-zero values to compute the reciprocal of.
+/// \return Approximated reciprocals.
+inline Float fastReciprocal(Float vals) {
+  const Float estimates = reciprocalEstimate(vals);
+  return mul(estimates, sub(set(2.f), mul(vals, estimates)));
+}
+
+/// Evaluates the sine polynomial on angles reduced to [-pi/2; pi/2], negating the results where the number of removed half turns is odd.
+/// \param reduced Reduced angles in radians.
+/// \param halfTurns Number of half turns removed from each original angle.
+/// \return Approximated sines of the original angles.
+inline Float computeReducedSin(Float reduced, Float halfTurns) {
+  using namespace FloatUtils::FastMathCoeffs;
+
+  const Float sqReduced = mul(reduced, reduced);
+
+  Float poly = add(set(Sin9), mul(sqReduced, set(Sin11)));
+  poly = add(set(Sin7), mul(sqReduced, poly));
+  poly = add(set(Sin5), mul(sqReduced, poly));
+  poly = add(set(Sin3), mul(sqReduced, poly));
+
+  const Float res = add(reduced, mul(mul(reduced, sqReduced), poly));
+
+  // Without any integer operation, the parity is given by k - 2 * round(k / 2), which is either 0 or +/-1
+  const Float parity = abs(sub(halfTurns, mul(set(2.f), round(mul(halfTurns, set(0.5f))))));
+  return mul(res, sub(set(1.f), mul(set(2.f), parity)));
+}
+
+/// Computes an approximation of the sine of each angle; see FloatUtils::fastSin() for the error bounds.
+/// \param angles Angles in radians.
+/// \return Approximated sines.
+inline Float fastSin(Float angles) {
+  using namespace FloatUtils::FastMathCoeffs;
+
+  const Float halfTurns = round(mul(angles, set(InvPi)));
+  const Float reduced   = sub(sub(angles, mul(halfTurns, set(PiHigh))), mul(halfTurns, set(PiLow)));
+
+  return computeReducedSin(reduced, halfTurns);
+}
+
+/// Computes an approximation of the cosine of each angle; see FloatUtils::fastCos() for the error bounds.
+/// \param angles Angles in radians.
+/// \return Approximated cosines.
+inline Float fastCos(Float angles) {
+  using namespace FloatUtils::FastMathCoeffs;
+
+  const Float halfTurns = round(add(mul(angles, set(InvPi)), set(0.5f)));
+  const Float offset    = sub(halfTurns, set(0.5f));
+  const Float reduced   = sub(sub(angles, mul(offset, set(PiHigh))), mul(offset, set(PiLow)));
+
+  return computeReducedSin(reduced, halfTurns);
+}
+
+/// Computes an approximation of the arctangent of each y / x; see FloatUtils::fastAtan2() for the error bounds.
+/// \param yVals Ordinates of the points.
+/// \param xVals Abscissas of the points.
+/// \return Approximated angles in radians, in [-pi; pi].
+inline Float fastAtan2(Float yVals, Float xVals) {
+  using namespace FloatUtils::FastMathCoeffs;
+
+  const Float absX = abs(xVals);
+  const Float absY = abs(yVals);
+
+  const Float ratio   = div(min(absX, absY), max(max(absX, absY), set(std::numeric_limits<float>::min())));
+  const Float sqRatio = mul(ratio, ratio);
+
+  Float poly = add(set(Atan9), mul(sqRatio, set(Atan11)));
+  poly = add(set(Atan7), mul(sqRatio, poly));
+  poly = add(set(Atan5), mul(sqRatio, poly));
+  poly = add(set(Atan3), mul(sqRatio, poly));
+  poly = add(set(Atan1), mul(sqRatio, poly));
+
+  Float res = mul(ratio, poly);
+  res = select(lessThan(absX, absY), sub(set(HalfPi), res), res);
+  res = select(lessThan(xVals, set(0.f)), sub(set(2 * HalfPi), res), res);
+  return select(lessThan(yVals, set(0.f)), sub(set(0.f), res), res);
+}
+
+} // namespace Simd
+
+} // namespace Raz
+
+#endif // RAZ_SIMD_HPP
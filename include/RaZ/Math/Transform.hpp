@@ -10,30 +10,39 @@
 
 namespace Raz {
 
+class AABB;
+class Sphere;
+
 class Transform : public Component {
 public:
-  explicit Transform(const Vec3f& position = Vec3f(0.f), const Mat4f& rotation = Mat4f::identity(), const Vec3f& scale = Vec3f(1.f))
-    : m_position{ position }, m_rotation{ rotation }, m_scale{ scale } {}
+  explicit Transform(const Vec3f& position = Vec3f(0.f), const Quaternionf& rotation = Quaternionf::identity(), const Vec3f& scale = Vec3f(1.f))
+    : m_position{ position }, m_rotation{ rotation }, m_scale{ scale } { updateMatrices(); }
 
   const Vec3f& getPosition() const { return m_position; }
-  Vec3f& getPosition() { return m_position; }
-  const Mat4f& getRotation() const { return m_rotation; }
-  Mat4f& getRotation() { return m_rotation; }
+  const Quaternionf& getRotation() const { return m_rotation; }
   const Vec3f& getScale() const { return m_scale; }
-  Vec3f& getScale() { return m_scale; }
   bool hasUpdated() const { return m_updated; }
+  /// Gets the transform (model) matrix, applying in order the scale, the rotation & the translation.
+  /// The matrix is stored & recomputed as soon as the position, rotation or scale changes, so that it can be read from several threads at once.
+  /// \return Reference to the stored transform matrix.
+  const Mat4f& getTransformMatrix() const { return m_transformMatrix; }
+  /// Gets the normal matrix, which is the inverse transpose of the transform matrix.
+  /// Normals must be transformed by it to remain orthogonal to their surface under a non-uniform scale. It holds no translation.
+  /// The matrix is recomputed alongside the transform one; the scale is assumed to have no null component.
+  /// \return Reference to the stored normal matrix.
+  const Mat4f& getNormalMatrix() const { return m_normalMatrix; }
 
   void setPosition(const Vec3f& position);
   void setPosition(float x, float y, float z) { setPosition(Vec3f({ x, y, z })); }
-  void setRotation(const Mat4f& rotation);
-  void setRotation(float angle, const Vec3f& axis) { setRotation(Quaternionf(angle, axis).computeMatrix()); }
+  void setRotation(const Quaternionf& rotation);
+  void setRotation(float angle, const Vec3f& axis) { setRotation(Quaternionf(angle, axis)); }
   void setScale(const Vec3f& scale);
   void setScale(float val) { setScale(val, val, val); }
   void setScale(float x, float y, float z) { setScale(Vec3f({ x, y, z })); }
   void setUpdated(bool updated) { m_updated = updated; }
 
   void move(float x, float y, float z) { move(Vec3f({ x, y, z })); }
-  void move(const Vec3f& displacement) { translate(displacement * Mat3f(m_rotation)); }
+  void move(const Vec3f& displacement) { translate(m_rotation * displacement); }
   void translate(float x, float y, float z);
   void translate(const Vec3f& values) { translate(values[0], values[1], values[2]); }
   void rotate(float xAngle, float yAngle, float zAngle);
@@ -42,13 +51,30 @@ public:
   void scale(float val) { scale(val, val, val); }
   void scale(const Vec3f& values) { scale(values[0], values[1], values[2]); }
   Mat4f computeTranslationMatrix(bool inverseTranslation = false) const;
+  Mat4f computeRotationMatrix() const { return m_rotation.computeMatrix(); }
   Mat4f computeTransformMatrix() const;
+  /// Computes the world-space box bounding a model-space one, from the stored transform matrix.
+  /// \param box Box to be transformed, such as a mesh's bounding box.
+  /// \return Box bounding the transformed one.
+  AABB computeTransformedBox(const AABB& box) const;
+  /// Computes the world-space sphere bounding a model-space one, from the stored transform matrix.
+  /// Its radius is scaled by the largest scale component, so that it remains bounding under a non-uniform scale.
+  /// \param sphere Sphere to be transformed, such as a mesh's bounding sphere.
+  /// \return Sphere bounding the transformed one.
+  Sphere computeTransformedSphere(const Sphere& sphere) const;
 
 private:
+  /// Marks the transform as modified & recomputes its matrices.
+  /// The position, rotation & scale are only modifiable through the setters & transformation functions, which all call this.
+  void updateMatrices();
+
   Vec3f m_position;
-  Mat4f m_rotation;
+  Quaternionf m_rotation;
   Vec3f m_scale;
   bool m_updated = true;
+
+  Mat4f m_transformMatrix {};
+  Mat4f m_normalMatrix {};
 };
 
 } // namespace Raz
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <iostream>
 #include <initializer_list>
+#include <type_traits>
 
 namespace Raz {
 
@@ -59,6 +60,11 @@ public:
   /// Normalizing a vector makes it of length 1.
   /// \return Normalized vector.
   Vector normalize() const;
+  /// Computes the normalized vector, using an approximated inverse square root instead of a square root & a division. Only available on float vectors.
+  /// The resulting length is 1 with a relative error below FloatUtils::FastRsqrtMaxError, which is 3e-7 when SSE is available & 2e-3 otherwise
+  ///  (see FloatUtils::fastRsqrt()); normalize() should be preferred if exactness matters.
+  /// \return Approximately normalized vector.
+  Vector normalizeFast() const;
   /// Computes the length of the vector.
   /// Calculating the actual length requires a square root operation to be involved, which is expensive.
   /// As such, this function should be used if actual length is needed; otherwise, prefer computeSquaredLength().
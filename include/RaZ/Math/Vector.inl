@@ -63,6 +63,15 @@ Vector<T, Size> Vector<T, Size>::normalize() const {
   return res;
 }
 
+template <typename T, std::size_t Size>
+Vector<T, Size> Vector<T, Size>::normalizeFast() const {
+  static_assert(std::is_same<T, float>::value, "Error: Fast normalization is only available on float vectors.");
+
+  Vector<T, Size> res = *this;
+  res *= FloatUtils::fastRsqrt(computeSquaredLength());
+  return res;
+}
+
 template <typename T, std::size_t Size>
 std::size_t Vector<T, Size>::hash(std::size_t seed) const {
   for (const auto& elt : m_data)
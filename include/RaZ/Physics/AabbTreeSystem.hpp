@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef RAZ_AABBTREESYSTEM_HPP
+#define RAZ_AABBTREESYSTEM_HPP
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Physics/DynamicAabbTree.hpp"
+#include "RaZ/System.hpp"
+
+namespace Raz {
+
+class Camera;
+
+/// System keeping the bounding boxes of entities in a dynamic tree, to find those located in a given area.
+/// Entities are taken into account if they hold an AABB, expressed in local coordinates if they also hold a Transform.
+/// On update, only the entities whose transform has changed since the previous one are moved in the tree.
+/// The AABB component itself is assumed not to change; refreshEntity() must otherwise be called.
+class AabbTreeSystem : public System {
+public:
+  /// Creates the system.
+  /// \param margin Distance by which the entities' boxes are enlarged in the tree, allowing small moves without modifying it.
+  explicit AabbTreeSystem(float margin = 0.1f);
+
+  const DynamicAabbTree& getTree() const { return m_tree; }
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  void update(float deltaTime) override;
+  /// Recomputes an entity's box in the tree, to be called after its AABB component has been modified.
+  /// \param entity Entity to be refreshed.
+  void refreshEntity(const Entity& entity);
+  /// Finds the enabled entities whose boxes may overlap with a given box.
+  /// \param aabb Box to find the overlapping entities of, in world coordinates.
+  /// \param entities Overlapping entities. The list is cleared beforehand.
+  void queryOverlaps(const AABB& aabb, std::vector<Entity*>& entities) const;
+  /// Finds the enabled entities whose boxes may be hit by a ray.
+  /// \param ray Ray to be cast, in world coordinates.
+  /// \param entities Hit entities. The list is cleared beforehand.
+  /// \param maxDistance Distance from the ray's origin beyond which boxes are ignored.
+  void queryRay(const Ray& ray, std::vector<Entity*>& entities, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the enabled entities whose boxes may be visible from a camera.
+  /// \param camera Camera to find the visible entities of. Its view & projection matrices must be up to date.
+  /// \param entities Visible entities. The list is cleared beforehand.
+  void queryFrustum(const Camera& camera, std::vector<Entity*>& entities) const;
+
+private:
+  struct Proxy {
+    std::uint32_t index {};
+    Mat4f transform = Mat4f::identity();
+  };
+
+  /// Computes an entity's box in world coordinates, saving the transformation it has been computed with.
+  AABB computeWorldBox(const Entity& entity, Proxy& proxy) const;
+  void collectEntities(const std::vector<std::uint32_t>& proxyIndices, std::vector<Entity*>& entities) const;
+
+  DynamicAabbTree m_tree;
+  std::unordered_map<const Entity*, Proxy> m_entityProxies {};
+  std::vector<Entity*> m_proxyEntities {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_AABBTREESYSTEM_HPP
@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef RAZ_BROADPHASESYSTEM_HPP
+#define RAZ_BROADPHASESYSTEM_HPP
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Physics/SweepAndPrune.hpp"
+#include "RaZ/System.hpp"
+
+namespace Raz {
+
+/// System finding the pairs of entities whose bounding boxes overlap, as a first step to detect collisions or trigger volumes.
+/// Entities are taken into account if they hold an AABB, expressed in local coordinates if they also hold a Transform.
+class BroadphaseSystem : public System {
+public:
+  using EntityPair = std::pair<Entity*, Entity*>;
+
+  BroadphaseSystem();
+
+  const SweepAndPrune& getSweepAndPrune() const { return m_sweepAndPrune; }
+  /// Gets the pairs of enabled entities whose boxes overlapped during the last update.
+  const std::vector<EntityPair>& getOverlappingPairs() const { return m_pairs; }
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  void update(float deltaTime) override;
+
+private:
+  AABB computeWorldBox(const Entity& entity) const;
+
+  SweepAndPrune m_sweepAndPrune {};
+  std::unordered_map<const Entity*, std::uint32_t> m_entityProxies {};
+  std::vector<Entity*> m_proxyEntities {};
+  std::vector<EntityPair> m_pairs {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_BROADPHASESYSTEM_HPP
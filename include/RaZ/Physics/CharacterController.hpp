@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef RAZ_CHARACTERCONTROLLER_HPP
+#define RAZ_CHARACTERCONTROLLER_HPP
+
+#include <cstddef>
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class Transform;
+class TriangleBvh;
+
+/// Kinematic character controller, moving a sphere through static triangle geometry with the collide & slide method.
+/// The sphere is swept along the requested displacement & stopped at its first contact; the remaining displacement is then projected
+///  onto the touched surface, & the process repeated. The character thus slides along walls & slopes instead of stopping or tunneling.
+/// The sphere is centered on the position of the transform being moved, & kept a small skin width away from the surfaces.
+class CharacterController {
+public:
+  /// Outcome of a movement.
+  struct MoveResult {
+    /// Displacement actually applied to the transform.
+    Vec3f displacement {};
+    /// True if any surface has been touched.
+    bool hasCollided = false;
+    /// True if a surface flat enough to stand on has been touched.
+    bool isGrounded = false;
+  };
+
+  explicit CharacterController(float radius) : m_radius{ radius } {}
+
+  float getRadius() const { return m_radius; }
+  float getSkinWidth() const { return m_skinWidth; }
+  std::size_t getMaxSlideCount() const { return m_maxSlideCount; }
+  const Vec3f& getUpDirection() const { return m_upDirection; }
+
+  void setRadius(float radius) { m_radius = radius; }
+  /// Sets the distance kept between the sphere & the surfaces, preventing the next movement from starting in contact.
+  /// \param skinWidth Distance to the surfaces; must be small compared to the radius.
+  void setSkinWidth(float skinWidth) { m_skinWidth = skinWidth; }
+  /// Sets the maximum number of times the sphere can be stopped & redirected in a single movement, any remaining displacement being dropped.
+  /// \param maxSlideCount Maximum number of slides.
+  void setMaxSlideCount(std::size_t maxSlideCount) { m_maxSlideCount = maxSlideCount; }
+  /// Sets the direction considered as up, to find whether the character stands on the ground.
+  /// \param upDirection Normalized up direction.
+  void setUpDirection(const Vec3f& upDirection) { m_upDirection = upDirection; }
+  /// Sets the steepest slope considered as ground.
+  /// \param maxSlopeAngleDegrees Maximum angle between the up direction & a surface's normal, in degrees.
+  void setMaxSlopeAngle(float maxSlopeAngleDegrees);
+
+  /// Moves a transform, sliding along the surfaces met on the way.
+  /// Surfaces the sphere initially overlaps only stop it if it moves towards them, letting it escape them.
+  /// \param transform Transform to be moved.
+  /// \param displacement Requested displacement, in world coordinates.
+  /// \param bvh Hierarchy of the static geometry, in world coordinates.
+  /// \return Outcome of the movement.
+  MoveResult move(Transform& transform, const Vec3f& displacement, const TriangleBvh& bvh) const;
+
+private:
+  float m_radius {};
+  float m_skinWidth = 0.001f;
+  std::size_t m_maxSlideCount = 4;
+  Vec3f m_upDirection = Axis::Y;
+  /// Minimum cosine of the angle between the up direction & a surface's normal for it to be considered as ground; 45° by default.
+  float m_minGroundCosine = 0.70710678f;
+};
+
+} // namespace Raz
+
+#endif // RAZ_CHARACTERCONTROLLER_HPP
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef RAZ_COLLIDER_HPP
+#define RAZ_COLLIDER_HPP
+
+#include <memory>
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+enum class ColliderType {
+  SPHERE,
+  BOX,
+  PLANE
+};
+
+/// Geometry with which an entity collides in the PhysicsSystem.
+/// The shape is expressed in local coordinates: if the entity holds a Transform, it is scaled, rotated & translated by it.
+/// Boxes are thus oriented by the transform's rotation. Planes are infinite & can only be static.
+class Collider : public Component {
+public:
+  explicit Collider(const Sphere& sphere) : m_type{ ColliderType::SPHERE }, m_shape{ std::make_unique<Sphere>(sphere) } {}
+  explicit Collider(const AABB& box) : m_type{ ColliderType::BOX }, m_shape{ std::make_unique<AABB>(box) } {}
+  explicit Collider(const Plane& plane) : m_type{ ColliderType::PLANE }, m_shape{ std::make_unique<Plane>(plane) } {}
+
+  ColliderType getType() const { return m_type; }
+  const Shape& getShape() const { return *m_shape; }
+  /// Gets the shape as its actual type, which must correspond to the collider's.
+  /// \tparam ShapeT Type of the shape: Sphere, AABB or Plane.
+  /// \return Reference to the shape.
+  template <typename ShapeT> const ShapeT& getShape() const { return static_cast<const ShapeT&>(*m_shape); }
+
+private:
+  ColliderType m_type {};
+  std::unique_ptr<Shape> m_shape {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_COLLIDER_HPP
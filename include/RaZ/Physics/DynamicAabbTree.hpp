@@ -0,0 +1,104 @@
+#pragma once
+
+#ifndef RAZ_DYNAMICAABBTREE_HPP
+#define RAZ_DYNAMICAABBTREE_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Bounding volume hierarchy of boxes which can be inserted, moved & removed at any time, without ever rebuilding the whole tree.
+/// Each box is stored enlarged by a margin (a "fat" box): as long as the object it bounds stays inside, moving it leaves the tree untouched.
+/// Otherwise, its leaf is removed & reinserted where it increases the least the nodes' surface areas, the ancestors being rotated to keep the tree balanced.
+class DynamicAabbTree {
+public:
+  static constexpr std::uint32_t NullIndex = std::numeric_limits<std::uint32_t>::max();
+
+  /// Node of the tree. A leaf has no children; the index of a leaf is the index of the proxy it holds.
+  struct Node {
+    Vec3f minBounds {};
+    Vec3f maxBounds {};
+    /// Index of the parent node, or of the next free node if unused.
+    std::uint32_t parentIndex = NullIndex;
+    std::uint32_t leftChildIndex = NullIndex;
+    std::uint32_t rightChildIndex = NullIndex;
+    /// Height of the subtree, 0 for a leaf & -1 if unused.
+    int height = -1;
+
+    bool isLeaf() const { return (leftChildIndex == NullIndex); }
+  };
+
+  /// Creates a tree.
+  /// \param margin Distance by which the boxes are enlarged on each side.
+  explicit DynamicAabbTree(float margin = 0.1f) : m_margin{ margin } {}
+
+  float getMargin() const { return m_margin; }
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+  std::uint32_t getRootIndex() const { return m_rootIndex; }
+  std::size_t getProxyCount() const { return m_proxyCount; }
+  /// Gets the height of the tree, which is 0 if it holds at most a single proxy.
+  std::size_t getHeight() const { return (m_rootIndex == NullIndex ? 0 : static_cast<std::size_t>(m_nodes[m_rootIndex].height)); }
+  bool isEmpty() const { return (m_rootIndex == NullIndex); }
+  bool isProxyValid(std::size_t proxyIndex) const { return (proxyIndex < m_nodes.size() && m_nodes[proxyIndex].height == 0); }
+  /// Gets the enlarged box stored for a proxy.
+  /// \param proxyIndex Index of the proxy to get the box of.
+  /// \return Proxy's fat box.
+  AABB getFatBox(std::uint32_t proxyIndex) const;
+
+  /// Adds a box to the tree.
+  /// \param aabb Box to be added.
+  /// \return Index of the proxy representing the box, which remains valid until removed; indices of removed proxies are reused.
+  std::uint32_t insertProxy(const AABB& aabb);
+  /// Removes a box from the tree.
+  /// \param proxyIndex Index of the proxy to be removed.
+  void removeProxy(std::uint32_t proxyIndex);
+  /// Changes the box represented by a proxy. The tree is only modified if the new box exceeds the proxy's fat one.
+  /// \param proxyIndex Index of the proxy to be moved.
+  /// \param aabb New box.
+  /// \param displacement Expected displacement until the next move, by which the fat box is also extended to anticipate it.
+  /// \return True if the proxy has been reinserted, false if its fat box still contained the new one.
+  bool moveProxy(std::uint32_t proxyIndex, const AABB& aabb, const Vec3f& displacement = Vec3f(0.f));
+  /// Finds the proxies whose fat boxes overlap with a given box.
+  /// \param aabb Box to find the overlapping proxies of.
+  /// \param proxyIndices Indices of the overlapping proxies, appended to the given list.
+  void queryOverlaps(const AABB& aabb, std::vector<std::uint32_t>& proxyIndices) const;
+  /// Finds the proxies whose fat boxes are hit by a ray.
+  /// \param ray Ray to be cast.
+  /// \param proxyIndices Indices of the hit proxies, appended to the given list.
+  /// \param maxDistance Distance from the ray's origin beyond which boxes are ignored.
+  void queryRay(const Ray& ray, std::vector<std::uint32_t>& proxyIndices, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the proxies whose fat boxes are at least partly contained by a convex volume, such as a camera's frustum.
+  /// \param planes Planes delimiting the volume, their normals pointing inwards.
+  /// \param proxyIndices Indices of the contained proxies, appended to the given list.
+  void queryFrustum(const std::array<Plane, 6>& planes, std::vector<std::uint32_t>& proxyIndices) const;
+
+private:
+  std::uint32_t allocateNode();
+  void freeNode(std::uint32_t nodeIndex);
+  void insertLeaf(std::uint32_t leafIndex);
+  void removeLeaf(std::uint32_t leafIndex);
+  /// Refits & rebalances all ancestors of a node, from its parent up to the root.
+  void refitAncestors(std::uint32_t nodeIndex);
+  /// Rotates a node with the child whose subtree is the highest, if the heights of both children differ by more than 1.
+  /// \return Index of the node now at the given node's place.
+  std::uint32_t balance(std::uint32_t nodeIndex);
+  void replaceChild(std::uint32_t parentIndex, std::uint32_t oldChildIndex, std::uint32_t newChildIndex);
+  void updateNode(std::uint32_t nodeIndex);
+
+  float m_margin {};
+  std::vector<Node> m_nodes {};
+  std::uint32_t m_rootIndex = NullIndex;
+  std::uint32_t m_freeIndex = NullIndex;
+  std::size_t m_proxyCount = 0;
+};
+
+} // namespace Raz
+
+#endif // RAZ_DYNAMICAABBTREE_HPP
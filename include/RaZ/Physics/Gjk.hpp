@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef RAZ_GJK_HPP
+#define RAZ_GJK_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class Shape;
+
+/// Narrow phase collision detection between any two convex shapes, only relying on their support points (see Shape::computeSupportPoint()).
+/// The Gilbert-Johnson-Keerthi algorithm finds if the Minkowski difference of both shapes contains the origin, in which case they intersect;
+/// the Expanding Polytope Algorithm then grows the resulting simplex towards the difference's surface to find the penetration depth.
+/// Both work on fixed-size storage & never allocate memory. Planes, being infinite, have no support point & are not supported.
+namespace Gjk {
+
+/// Contact information between two intersecting shapes.
+struct Contact {
+  /// Direction from the first shape towards the second, along which the second must be moved to separate them.
+  Vec3f normal {};
+  /// Distance along the normal by which the shapes overlap.
+  float depth {};
+  /// Point of the first shape which is the deepest inside the second.
+  Vec3f firstPoint {};
+  /// Point of the second shape which is the deepest inside the first.
+  Vec3f secondPoint {};
+};
+
+/// Checks if two convex shapes intersect each other. Shapes touching each other are considered intersecting.
+/// \param firstShape First shape to be checked.
+/// \param secondShape Second shape to be checked.
+/// \return True if both shapes intersect each other, false otherwise.
+bool intersects(const Shape& firstShape, const Shape& secondShape);
+
+/// Checks if two convex shapes intersect each other, computing the contact between them if so.
+/// If the shapes are flat & coplanar, or touching each other, the depth is 0.
+/// \param firstShape First shape to be checked.
+/// \param secondShape Second shape to be checked.
+/// \param contact Contact between both shapes. Left untouched if they don't intersect.
+/// \return True if both shapes intersect each other, false otherwise.
+bool computeContact(const Shape& firstShape, const Shape& secondShape, Contact& contact);
+
+} // namespace Gjk
+
+} // namespace Raz
+
+#endif // RAZ_GJK_HPP
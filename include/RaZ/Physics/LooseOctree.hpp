@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef RAZ_LOOSEOCTREE_HPP
+#define RAZ_LOOSEOCTREE_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Octree in which each node's bounds are loosened to twice the size of its cell, to find the objects located in a given area.
+/// An object is stored in the node of the deepest level whose cells are at least as large as the object, in the cell containing its center:
+/// its node is then directly found from its bounds, without descending the tree. Nodes are identified by a key encoding their level &
+/// position, giving access to any of them in constant time; moving an object within its cell doesn't even require to look for it.
+/// Objects out of the octree's bounds are kept in the root node, which is always traversed.
+class LooseOctree {
+public:
+  static constexpr std::uint32_t NullIndex = std::numeric_limits<std::uint32_t>::max();
+  /// Maximum depth an octree can have, for node keys to fit on 64 bits.
+  static constexpr std::size_t MaxDepth = 20;
+
+  /// Node of the octree. Its objects are linked to each other, the node only referencing the first one.
+  struct Node {
+    Vec3f center {};
+    /// Half the size of the node's cell; its loose bounds extend by twice as much on each side of its center.
+    float halfSize {};
+    std::uint64_t key {};
+    std::uint32_t parentIndex = NullIndex;
+    std::array<std::uint32_t, 8> childIndices {{ NullIndex, NullIndex, NullIndex, NullIndex, NullIndex, NullIndex, NullIndex, NullIndex }};
+    std::uint32_t childCount {};
+    std::uint32_t firstObjectIndex = NullIndex;
+    std::uint32_t objectCount {};
+  };
+
+  /// Creates an octree.
+  /// \param center Center of the octree's root cell.
+  /// \param halfSize Half the size of the octree's root cell. Objects should ideally all be located in it.
+  /// \param maxDepth Maximum depth of the octree, at which the cells are the smallest. Must not be greater than MaxDepth.
+  LooseOctree(const Vec3f& center, float halfSize, std::size_t maxDepth = 8);
+
+  std::size_t getObjectCount() const { return m_objectCount; }
+  /// Gets the number of nodes currently used, the root included.
+  std::size_t getNodeCount() const { return m_nodeIndices.size(); }
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+  bool isObjectValid(std::size_t objectIndex) const { return (objectIndex < m_objects.size() && m_objects[objectIndex].nodeIndex != NullIndex); }
+  /// Gets the index of the node holding an object.
+  /// \param objectIndex Index of the object to get the node of.
+  /// \return Index of the object's node.
+  std::uint32_t getObjectNodeIndex(std::uint32_t objectIndex) const { return m_objects[objectIndex].nodeIndex; }
+
+  /// Adds an object to the octree.
+  /// \param aabb Object's bounds.
+  /// \return Index of the object, which remains valid until removed; indices of removed objects are reused.
+  std::uint32_t addObject(const AABB& aabb);
+  /// Removes an object from the octree.
+  /// \param objectIndex Index of the object to be removed.
+  void removeObject(std::uint32_t objectIndex);
+  /// Changes the bounds of an object, relocating it to another node if needed.
+  /// \param objectIndex Index of the object to be moved.
+  /// \param aabb New bounds of the object.
+  /// \return True if the object has changed node, false otherwise.
+  bool moveObject(std::uint32_t objectIndex, const AABB& aabb);
+  /// Finds the objects whose bounds are at least partly within a given distance from a point.
+  /// \param center Point to find the objects around.
+  /// \param radius Maximum distance from the point.
+  /// \param objectIndices Indices of the found objects, appended to the given list.
+  void queryRadius(const Vec3f& center, float radius, std::vector<std::uint32_t>& objectIndices) const;
+  /// Finds the objects whose bounds overlap with a given box.
+  /// \param aabb Box to find the overlapping objects of.
+  /// \param objectIndices Indices of the found objects, appended to the given list.
+  void queryBox(const AABB& aabb, std::vector<std::uint32_t>& objectIndices) const;
+  /// Finds the objects within a given distance from each of several points.
+  /// \param centers Points to find the objects around.
+  /// \param radius Maximum distance from each point.
+  /// \param objectIndices Indices of the found objects for all points one after the other. The list is cleared beforehand.
+  /// \param queryOffsets Offsets in the indices list of each point's results, followed by the total count. The list is cleared beforehand.
+  void queryRadius(const std::vector<Vec3f>& centers, float radius,
+                   std::vector<std::uint32_t>& objectIndices, std::vector<std::size_t>& queryOffsets) const;
+  /// Finds the objects overlapping with each of several boxes.
+  /// \param aabbs Boxes to find the overlapping objects of.
+  /// \param objectIndices Indices of the found objects for all boxes one after the other. The list is cleared beforehand.
+  /// \param queryOffsets Offsets in the indices list of each box's results, followed by the total count. The list is cleared beforehand.
+  void queryBox(const std::vector<AABB>& aabbs, std::vector<std::uint32_t>& objectIndices, std::vector<std::size_t>& queryOffsets) const;
+
+private:
+  struct Object {
+    Vec3f minBounds {};
+    Vec3f maxBounds {};
+    /// Index of the node holding the object, or NullIndex if unused.
+    std::uint32_t nodeIndex = NullIndex;
+    std::uint32_t prevIndex = NullIndex;
+    /// Index of the next object in the same node, or of the next free object if unused.
+    std::uint32_t nextIndex = NullIndex;
+  };
+
+  /// Computes the key of the node in which an object with the given bounds must be stored.
+  std::uint64_t computeNodeKey(const Vec3f& minBounds, const Vec3f& maxBounds) const;
+  std::uint32_t findOrCreateNode(std::uint64_t key);
+  void linkObject(std::uint32_t objectIndex, std::uint32_t nodeIndex);
+  /// Unlinks an object from its node, removing the node & its ancestors if they are left empty.
+  void unlinkObject(std::uint32_t objectIndex);
+  template <typename NodeTestT, typename ObjectTestT>
+  void query(const NodeTestT& testNode, const ObjectTestT& testObject, std::vector<std::uint32_t>& objectIndices) const;
+
+  std::size_t m_maxDepth {};
+  std::vector<Node> m_nodes {};
+  std::uint32_t m_freeNodeIndex = NullIndex;
+  std::unordered_map<std::uint64_t, std::uint32_t> m_nodeIndices {};
+  std::vector<Object> m_objects {};
+  std::uint32_t m_freeObjectIndex = NullIndex;
+  std::size_t m_objectCount = 0;
+};
+
+} // namespace Raz
+
+#endif // RAZ_LOOSEOCTREE_HPP
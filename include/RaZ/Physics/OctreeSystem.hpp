@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef RAZ_OCTREESYSTEM_HPP
+#define RAZ_OCTREESYSTEM_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Physics/LooseOctree.hpp"
+#include "RaZ/System.hpp"
+
+namespace Raz {
+
+/// System keeping the bounding boxes of entities in a loose octree, to find those located around a point or in a given box.
+/// Entities are taken into account if they hold an AABB, expressed in local coordinates if they also hold a Transform.
+/// On update, only the entities whose transform has changed since the previous one are moved in the octree.
+/// The AABB component itself is assumed not to change; refreshEntity() must otherwise be called.
+class OctreeSystem : public System {
+public:
+  /// Creates the system.
+  /// \param center Center of the octree's root cell.
+  /// \param halfSize Half the size of the octree's root cell, which should ideally contain all entities.
+  /// \param maxDepth Maximum depth of the octree.
+  OctreeSystem(const Vec3f& center, float halfSize, std::size_t maxDepth = 8);
+
+  const LooseOctree& getOctree() const { return m_octree; }
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  void update(float deltaTime) override;
+  /// Recomputes an entity's bounds in the octree, to be called after its AABB component has been modified.
+  /// \param entity Entity to be refreshed.
+  void refreshEntity(const Entity& entity);
+  /// Finds the enabled entities whose boxes are at least partly within a given distance from a point.
+  /// \param center Point to find the entities around, in world coordinates.
+  /// \param radius Maximum distance from the point.
+  /// \param entities Found entities. The list is cleared beforehand.
+  void queryRadius(const Vec3f& center, float radius, std::vector<Entity*>& entities) const;
+  /// Finds the enabled entities whose boxes overlap with a given box.
+  /// \param aabb Box to find the overlapping entities of, in world coordinates.
+  /// \param entities Found entities. The list is cleared beforehand.
+  void queryBox(const AABB& aabb, std::vector<Entity*>& entities) const;
+
+private:
+  struct Object {
+    std::uint32_t index {};
+    Mat4f transform = Mat4f::identity();
+  };
+
+  /// Computes an entity's box in world coordinates, saving the transformation it has been computed with.
+  AABB computeWorldBox(const Entity& entity, Object& object) const;
+  void collectEntities(const std::vector<std::uint32_t>& objectIndices, std::vector<Entity*>& entities) const;
+
+  LooseOctree m_octree;
+  std::unordered_map<const Entity*, Object> m_entityObjects {};
+  std::vector<Entity*> m_objectEntities {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_OCTREESYSTEM_HPP
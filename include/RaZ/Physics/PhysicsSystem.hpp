@@ -0,0 +1,168 @@
+#pragma once
+
+#ifndef RAZ_PHYSICSSYSTEM_HPP
+#define RAZ_PHYSICSSYSTEM_HPP
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/SweepAndPrune.hpp"
+#include "RaZ/System.hpp"
+
+namespace Raz {
+
+/// System simulating rigid bodies, taking into account entities holding a Collider and/or a RigidBody, as well as a Transform.
+/// Entities without a RigidBody, or with a null mass, are static. Each body's center of mass is its collider's center.
+/// The simulation advances by fixed time steps, each one:
+/// - finding the pairs of colliders whose boxes overlap with a sweep & prune, then computing their contacts in parallel;
+/// - grouping the bodies touching each other into islands, which are independent & thus solved in parallel;
+/// - solving each island's contacts with sequential impulses, warm started from the previous step's ones;
+/// - putting to sleep the islands whose bodies have all barely moved for a while. A sleeping body is woken up when touched by an awake one.
+/// The bodies' states are kept as a structure of arrays, read from the components before stepping & written back to them afterwards.
+class PhysicsSystem : public System {
+public:
+  PhysicsSystem();
+
+  const Vec3f& getGravity() const { return m_gravity; }
+  float getTimeStep() const { return m_timeStep; }
+  std::size_t getMaxStepCount() const { return m_maxStepCount; }
+  std::size_t getVelocityIterationCount() const { return m_velocityIterationCount; }
+  std::size_t getBodyCount() const { return m_bodyEntities.size(); }
+  /// Gets the number of pairs of bodies which were in contact during the last step.
+  /// \return Number of contacting pairs.
+  std::size_t getContactCount() const { return m_manifolds.size(); }
+  /// Gets the number of islands solved during the last step; sleeping islands are not counted.
+  /// \return Number of awake islands.
+  std::size_t getIslandCount() const { return m_islandCount; }
+
+  void setGravity(const Vec3f& gravity) { m_gravity = gravity; }
+  /// Sets the fixed duration by which the simulation advances at each step.
+  /// \param timeStep Duration of a step, in seconds.
+  void setTimeStep(float timeStep) { m_timeStep = timeStep; }
+  /// Sets the maximum number of steps executed in a single update; the remaining time is dropped, slowing the simulation down instead of stalling.
+  /// \param maxStepCount Maximum number of steps per update.
+  void setMaxStepCount(std::size_t maxStepCount) { m_maxStepCount = maxStepCount; }
+  /// Sets the number of iterations over all contacts of an island; more iterations give stiffer stacks.
+  /// \param velocityIterationCount Number of solver iterations.
+  void setVelocityIterationCount(std::size_t velocityIterationCount) { m_velocityIterationCount = velocityIterationCount; }
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  void update(float deltaTime) override;
+
+private:
+  enum class BodyState : std::uint8_t {
+    STATIC,
+    AWAKE,
+    SLEEPING,
+    DISABLED
+  };
+
+  /// Collider in world coordinates.
+  struct WorldCollider {
+    bool isEnabled = false;
+    ColliderType type {};
+    /// Sphere's or box's center, or the plane's normal.
+    Vec3f vector {};
+    /// Sphere's radius or plane's distance.
+    float scalar {};
+    std::array<Vec3f, 3> axes {};
+    Vec3f halfExtents {};
+  };
+
+  struct ContactPoint {
+    Vec3f position {};
+    float depth {};
+    Vec3f firstArm {};
+    Vec3f secondArm {};
+    /// Changes of both bodies' angular velocities for a unit impulse along the normal & both tangents, to avoid any matrix product while iterating.
+    std::array<Vec3f, 3> firstAngularDeltas {};
+    std::array<Vec3f, 3> secondAngularDeltas {};
+    /// Inverses of the effective masses along the normal & both tangents.
+    std::array<float, 3> effectiveMasses {};
+    float velocityBias {};
+    float normalImpulse {};
+    std::array<float, 2> tangentImpulses {};
+  };
+
+  struct ContactManifold {
+    /// Identifier of the pair of bodies across steps, made of both entities' IDs; these must thus fit on 32 bits.
+    std::uint64_t key {};
+    std::uint32_t firstBody {};
+    std::uint32_t secondBody {};
+    Vec3f normal {};
+    std::array<Vec3f, 2> tangents {};
+    float friction {};
+    float restitution {};
+    std::uint32_t pointCount {};
+    std::array<ContactPoint, 4> points {};
+  };
+
+  void readComponents();
+  void writeComponents();
+  void step(float timeStep);
+  void computeWorldColliders();
+  void findContacts();
+  /// Computes the contact points between two bodies, warm starting them with the impulses of the previous step's matching contacts.
+  /// \param firstBody Index of the first body; its collider's type must not come after the second one's.
+  /// \param secondBody Index of the second body.
+  /// \param manifold Manifold to be filled; it holds no point if the bodies don't touch.
+  void computeManifold(std::uint32_t firstBody, std::uint32_t secondBody, ContactManifold& manifold) const;
+  void buildIslands();
+  void solveIsland(std::size_t islandIndex, float timeStep);
+
+  Vec3f m_gravity = Vec3f({ 0.f, -9.81f, 0.f });
+  float m_timeStep = 1.f / 60.f;
+  std::size_t m_maxStepCount = 4;
+  std::size_t m_velocityIterationCount = 10;
+  float m_remainingTime = 0.f;
+
+  SweepAndPrune m_sweepAndPrune {};
+  std::vector<std::uint32_t> m_proxyBodies {};
+  std::unordered_map<const Entity*, std::uint32_t> m_entityBodies {};
+
+  // Bodies' states, as a structure of arrays
+  std::vector<Entity*> m_bodyEntities {};
+  std::vector<std::uint32_t> m_proxies {};
+  std::vector<BodyState> m_states {};
+  std::vector<Vec3f> m_positions {};
+  std::vector<Quaternionf> m_orientations {};
+  /// Positions of the colliders' centers relative to their transform, scaled but not rotated.
+  std::vector<Vec3f> m_centerOffsets {};
+  std::vector<Vec3f> m_linearVelocities {};
+  std::vector<Vec3f> m_angularVelocities {};
+  std::vector<float> m_inverseMasses {};
+  std::vector<Vec3f> m_localInverseInertias {};
+  std::vector<Mat3f> m_worldInverseInertias {};
+  std::vector<float> m_restitutions {};
+  std::vector<float> m_frictions {};
+  std::vector<float> m_linearDampings {};
+  std::vector<float> m_angularDampings {};
+  std::vector<float> m_sleepTimes {};
+  std::vector<WorldCollider> m_colliders {};
+
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> m_candidatePairs {};
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> m_sleepingPairs {};
+  std::vector<ContactManifold> m_manifolds {};
+  std::vector<ContactManifold> m_prevManifolds {};
+  /// Keys of the previous step's contacts with their indices, sorted to be searched when warm starting.
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> m_prevManifoldKeys {};
+
+  std::size_t m_islandCount = 0;
+  std::vector<std::uint32_t> m_islandBodyOffsets {};
+  std::vector<std::uint32_t> m_islandBodies {};
+  std::vector<std::uint32_t> m_islandManifoldOffsets {};
+  std::vector<std::uint32_t> m_islandManifolds {};
+  std::vector<std::uint32_t> m_islandOrder {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_PHYSICSSYSTEM_HPP
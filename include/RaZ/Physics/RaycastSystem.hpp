@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef RAZ_RAYCASTSYSTEM_HPP
+#define RAZ_RAYCASTSYSTEM_HPP
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/InstanceBvh.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+namespace Raz {
+
+class Camera;
+class Mesh;
+
+/// Information about the intersection between a ray & an entity's mesh.
+struct RaycastHit : public RayHit {
+  Entity* entity {};
+  std::size_t submeshIndex {};
+};
+
+/// System casting rays against the meshes of the entities holding a Mesh & a Transform.
+/// A triangle hierarchy is built once for each entity's submesh, & instanced according to the entity's transform in a top-level hierarchy.
+/// The latter is rebuilt on update when entities have been added, removed or moved; queries reflect the state of the last update.
+class RaycastSystem : public System {
+public:
+  RaycastSystem();
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  void update(float) override { refresh(); }
+  /// Updates the hierarchies according to the entities' current state. Only what has changed since the last refresh is recomputed.
+  void refresh();
+  /// Rebuilds the triangle hierarchies of an entity's mesh, to be called after its vertices or indices have been modified.
+  /// Replacing the entity's Mesh component does not require it, the hierarchies being rebuilt on the next refresh.
+  /// \param entity Entity to rebuild the hierarchies of.
+  void refreshMesh(const Entity& entity);
+  /// Finds the closest entity hit by the ray.
+  /// \param ray Ray to be cast, in world coordinates.
+  /// \param hit Information about the closest hit. Left untouched if nothing has been hit.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if an entity is hit within the given distance, false otherwise.
+  bool raycast(const Ray& ray, RaycastHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the entity visible at a given position on the screen.
+  /// \param camera Camera through which the scene is seen. Its inverse view & projection matrices must be up to date.
+  /// \param screenPos Position on the screen in pixels, from the top left corner (as given by the window's cursor position).
+  /// \param screenSize Size of the screen in pixels.
+  /// \param hit Information about the closest hit. Left untouched if nothing has been hit.
+  /// \return True if an entity is visible at the given position, false otherwise.
+  bool pick(const Camera& camera, const Vec2f& screenPos, const Vec2f& screenSize, RaycastHit& hit) const;
+
+private:
+  /// Triangle hierarchies of an entity's submeshes.
+  struct MeshBvhs {
+    const Mesh* mesh {}; // Mesh the hierarchies have been built from, to detect its replacement
+    std::vector<TriangleBvh> submeshBvhs {};
+  };
+
+  struct InstanceInfo {
+    Entity* entity {};
+    std::size_t submeshIndex {};
+  };
+
+  void rebuildInstances();
+
+  std::unordered_map<const Entity*, MeshBvhs> m_meshBvhs {};
+  InstanceBvh m_instanceBvh {};
+  std::vector<InstanceInfo> m_instanceInfos {};
+  std::vector<Entity*> m_instancedEntities {};
+  bool m_instancesOutdated = true;
+};
+
+} // namespace Raz
+
+#endif // RAZ_RAYCASTSYSTEM_HPP
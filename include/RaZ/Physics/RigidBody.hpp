@@ -0,0 +1,64 @@
+#pragma once
+
+#ifndef RAZ_RIGIDBODY_HPP
+#define RAZ_RIGIDBODY_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+/// Dynamic properties of an entity simulated by the PhysicsSystem, which also needs a Transform to move it.
+/// A body with a null mass is static: it collides with others but is never moved by the simulation.
+/// Without a Collider, the body still falls under gravity but never collides.
+class RigidBody : public Component {
+  friend class PhysicsSystem;
+
+public:
+  explicit RigidBody(float mass = 1.f, float restitution = 0.f, float friction = 0.5f)
+    : m_mass{ mass }, m_restitution{ restitution }, m_friction{ friction } {}
+
+  float getMass() const { return m_mass; }
+  bool isStatic() const { return (m_mass <= 0.f); }
+  float getRestitution() const { return m_restitution; }
+  float getFriction() const { return m_friction; }
+  float getLinearDamping() const { return m_linearDamping; }
+  float getAngularDamping() const { return m_angularDamping; }
+  const Vec3f& getLinearVelocity() const { return m_linearVelocity; }
+  const Vec3f& getAngularVelocity() const { return m_angularVelocity; }
+  /// Checks if the body has been put to sleep by the simulation, after having barely moved for a while.
+  /// A sleeping body isn't simulated until something wakes it up.
+  /// \return True if the body is sleeping, false otherwise.
+  bool isSleeping() const { return m_isSleeping; }
+
+  /// Sets the body's mass; a null mass makes it static.
+  /// \param mass Mass of the body, in kilograms.
+  void setMass(float mass) { m_mass = mass; wakeUp(); }
+  /// Sets how much of the velocity along a contact's normal is kept when bouncing off it.
+  /// \param restitution Coefficient of restitution, between 0 (no bounce) & 1 (perfectly elastic).
+  void setRestitution(float restitution) { m_restitution = restitution; }
+  /// Sets the Coulomb friction coefficient; the coefficient of a contact is the geometric mean of both bodies' ones.
+  /// \param friction Friction coefficient.
+  void setFriction(float friction) { m_friction = friction; }
+  void setLinearDamping(float linearDamping) { m_linearDamping = linearDamping; }
+  void setAngularDamping(float angularDamping) { m_angularDamping = angularDamping; }
+  void setLinearVelocity(const Vec3f& linearVelocity) { m_linearVelocity = linearVelocity; wakeUp(); }
+  /// Sets the angular velocity.
+  /// \param angularVelocity Rotation axis in world coordinates, scaled by the rotation speed in radians per second.
+  void setAngularVelocity(const Vec3f& angularVelocity) { m_angularVelocity = angularVelocity; wakeUp(); }
+  void wakeUp() { m_isSleeping = false; }
+
+private:
+  float m_mass {};
+  float m_restitution {};
+  float m_friction {};
+  float m_linearDamping = 0.05f;
+  float m_angularDamping = 0.05f;
+  Vec3f m_linearVelocity {};
+  Vec3f m_angularVelocity {};
+  bool m_isSleeping = false;
+};
+
+} // namespace Raz
+
+#endif // RAZ_RIGIDBODY_HPP
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef RAZ_SPATIALHASHGRID_HPP
+#define RAZ_SPATIALHASHGRID_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+/// Uniform grid of cubic cells, to find the points located around a given one. Best suited to many small moving objects, such as particles or crowds.
+/// The grid is unbounded: cells are hashed into a fixed number of buckets, several cells possibly sharing the same one.
+/// It is fully rebuilt from the points' positions, typically at each frame: points are sorted by bucket with a parallel counting sort,
+/// their positions being copied in that order so that the points of a bucket are contiguous in memory. The order of the points within a bucket
+/// is unspecified, & may change from a rebuild to another.
+/// Queries are restricted to radii up to the cell size, & thus only scan the cells around their center: 27 of them, or up to 64 due to rounding.
+class SpatialHashGrid {
+public:
+  /// Creates a grid.
+  /// \param cellSize Size of the cells, which is the maximum radius of the queries. It should be close to the usual query radius.
+  /// \param bucketCount Number of buckets the cells are hashed into, rounded up to a power of 2. If 0, the point count is used at each rebuild.
+  explicit SpatialHashGrid(float cellSize, std::size_t bucketCount = 0);
+
+  float getCellSize() const { return m_cellSize; }
+  std::size_t getPointCount() const { return m_sortedIndices.size(); }
+  /// Gets the number of buckets used by the last rebuild.
+  /// \return Number of buckets.
+  std::size_t getBucketCount() const { return m_bucketMask + 1; }
+
+  /// Sets the size of the cells; the grid must then be rebuilt.
+  /// \param cellSize Size of the cells.
+  void setCellSize(float cellSize);
+  /// Rebuilds the grid from the positions of the points, given as a structure of arrays.
+  /// \param xPositions X coordinates of the points.
+  /// \param yPositions Y coordinates of the points; must have the same size as the X ones.
+  /// \param zPositions Z coordinates of the points; must have the same size as the X ones.
+  void rebuild(const std::vector<float>& xPositions, const std::vector<float>& yPositions, const std::vector<float>& zPositions);
+  /// Rebuilds the grid from the positions of the points.
+  /// \param positions Positions of the points.
+  void rebuild(const std::vector<Vec3f>& positions);
+  /// Finds the points within a given distance from a point. Their order is unspecified.
+  /// \param center Point to find the points around.
+  /// \param radius Maximum distance from the point; must not exceed the cell size.
+  /// \param pointIndices Indices of the found points, appended to the given list.
+  void queryRadius(const Vec3f& center, float radius, std::vector<std::uint32_t>& pointIndices) const;
+  /// Finds in parallel the points within a given distance from each of several points.
+  /// \param centers Points to find the points around.
+  /// \param radius Maximum distance from each point; must not exceed the cell size.
+  /// \param pointIndices Indices of the found points for all centers one after the other. The list is cleared beforehand.
+  /// \param queryOffsets Offsets in the indices list of each center's results, followed by the total count. The list is cleared beforehand.
+  void queryRadius(const std::vector<Vec3f>& centers, float radius, std::vector<std::uint32_t>& pointIndices, std::vector<std::size_t>& queryOffsets) const;
+
+private:
+  std::uint32_t computeBucket(const Vec3f& position) const;
+  template <typename PositionGetterT> void rebuild(std::size_t pointCount, const PositionGetterT& getPosition);
+  template <typename ActionT> void forEachPointAround(const Vec3f& center, float radius, const ActionT& action) const;
+
+  float m_cellSize {};
+  float m_invCellSize {};
+  std::size_t m_fixedBucketCount {};
+  std::uint32_t m_bucketMask {};
+
+  /// Points per bucket, then insertion cursor of each bucket while sorting the points.
+  std::unique_ptr<std::atomic<std::uint32_t>[]> m_bucketCounters {};
+  std::size_t m_bucketCounterCapacity = 0;
+  std::vector<std::uint32_t> m_pointBuckets {};
+  /// Offset of each bucket's first point in the sorted lists, followed by the point count.
+  std::vector<std::uint32_t> m_bucketOffsets {};
+
+  // Points sorted by bucket, as a structure of arrays
+  std::vector<std::uint32_t> m_sortedIndices {};
+  std::vector<float> m_sortedXPositions {};
+  std::vector<float> m_sortedYPositions {};
+  std::vector<float> m_sortedZPositions {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_SPATIALHASHGRID_HPP
@@ -0,0 +1,70 @@
+#pragma once
+
+#ifndef RAZ_SWEEPANDPRUNE_HPP
+#define RAZ_SWEEPANDPRUNE_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Broad phase collision detection with the sweep & prune (or sort & sweep) method, finding all pairs of overlapping boxes.
+/// Boxes are swept along the axis on which they are the most spread, only the ones overlapping on this axis being tested on the other two.
+/// They are kept sorted by their lower bound on this axis only; as objects only move a little between frames, the order is updated with an
+/// insertion sort, in nearly linear time. The sweep axis changes when the boxes become clearly more spread along another one, requiring a full sort.
+class SweepAndPrune {
+public:
+  using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+  std::size_t getProxyCount() const { return m_proxyCount; }
+  /// Gets the pairs of overlapping boxes found by the last update. In each pair, the first index is the lowest.
+  const std::vector<Pair>& getOverlappingPairs() const { return m_pairs; }
+  bool isProxyValid(std::size_t proxyIndex) const { return (proxyIndex < m_validProxies.size() && m_validProxies[proxyIndex]); }
+
+  /// Adds a box to be checked for overlaps.
+  /// \param aabb Box to be added.
+  /// \return Index of the proxy representing the box, which remains valid until removed; indices of removed proxies are reused.
+  std::uint32_t addProxy(const AABB& aabb);
+  /// Changes the box represented by a proxy.
+  /// \param proxyIndex Index of the proxy to be updated.
+  /// \param aabb New box.
+  void updateProxy(std::uint32_t proxyIndex, const AABB& aabb);
+  /// Removes a box.
+  /// \param proxyIndex Index of the proxy to be removed.
+  void removeProxy(std::uint32_t proxyIndex);
+  /// Sorts the boxes & finds all overlapping pairs.
+  void update();
+
+private:
+  struct Endpoint {
+    float value {};
+    std::uint32_t proxyIndex {};
+  };
+
+  void sortEndpoints();
+  /// Selects the axis along which the boxes are to be swept, keeping the current one unless another is significantly better.
+  std::size_t selectSweepAxis() const;
+
+  std::array<std::vector<float>, 3> m_minBounds {};
+  std::array<std::vector<float>, 3> m_maxBounds {};
+  std::vector<bool> m_validProxies {};
+  std::vector<std::uint32_t> m_freeProxies {};
+  std::size_t m_proxyCount = 0;
+  /// Number of endpoints added or moved since the last sort, which may be far from their place.
+  std::size_t m_displacedEndpointCount = 0;
+
+  std::size_t m_sweepAxis = 0;
+  /// Lower bounds of the boxes on the sweep axis, sorted by the last update.
+  std::vector<Endpoint> m_endpoints {};
+  /// Index in the endpoints of each proxy, allowing to remove them in constant time.
+  std::vector<std::uint32_t> m_endpointIndices {};
+  std::vector<Pair> m_pairs {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_SWEEPANDPRUNE_HPP
@@ -9,11 +9,25 @@
 #include "Entity.hpp"
 #include "Component.hpp"
 #include "World.hpp"
+#include "Math/Batch.hpp"
 #include "Math/Constants.hpp"
 #include "Math/Matrix.hpp"
 #include "Math/Quaternion.hpp"
 #include "Math/Transform.hpp"
 #include "Math/Vector.hpp"
+#include "Physics/AabbTreeSystem.hpp"
+#include "Physics/BroadphaseSystem.hpp"
+#include "Physics/CharacterController.hpp"
+#include "Physics/Collider.hpp"
+#include "Physics/DynamicAabbTree.hpp"
+#include "Physics/Gjk.hpp"
+#include "Physics/LooseOctree.hpp"
+#include "Physics/OctreeSystem.hpp"
+#include "Physics/PhysicsSystem.hpp"
+#include "Physics/RaycastSystem.hpp"
+#include "Physics/RigidBody.hpp"
+#include "Physics/SpatialHashGrid.hpp"
+#include "Physics/SweepAndPrune.hpp"
 #include "Render/Camera.hpp"
 #include "Render/Cubemap.hpp"
 #include "Render/Framebuffer.hpp"
@@ -22,19 +36,34 @@
 #include "Render/Light.hpp"
 #include "Render/Material.hpp"
 #include "Render/Mesh.hpp"
+#include "Render/Occluder.hpp"
+#include "Render/OcclusionCuller.hpp"
+#include "Render/PathTracer.hpp"
 #include "Render/Shader.hpp"
 #include "Render/ShaderProgram.hpp"
 #include "Render/Submesh.hpp"
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
+#include "Utils/BitMask.hpp"
 #include "Utils/Bitset.hpp"
+#include "Utils/ConvexHull.hpp"
 #include "Utils/FileUtils.hpp"
 #include "Utils/Image.hpp"
 #include "Utils/Input.hpp"
+#include "Utils/InstanceBvh.hpp"
+#include "Utils/KdTree.hpp"
+#include "Utils/NavMesh.hpp"
+#include "Utils/NavMeshQuery.hpp"
 #include "Utils/Overlay.hpp"
+#include "Utils/PackUtils.hpp"
 #include "Utils/Ray.hpp"
+#include "Utils/RayPacket.hpp"
 #include "Utils/Shape.hpp"
+#include "Utils/ShapeArray.hpp"
+#include "Utils/SignedDistanceField.hpp"
 #include "Utils/StrUtils.hpp"
+#include "Utils/Threading.hpp"
+#include "Utils/TriangleBvh.hpp"
 #include "Utils/Window.hpp"
 
 #endif // RAZ_RAZ_HPP
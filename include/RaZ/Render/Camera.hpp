@@ -3,12 +3,15 @@
 #ifndef RAZ_CAMERA_HPP
 #define RAZ_CAMERA_HPP
 
+#include <array>
 #include <memory>
 
 #include "RaZ/Component.hpp"
 #include "RaZ/Math/Constants.hpp"
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
@@ -51,6 +54,15 @@ public:
   /// Inverse projection matrix computation.
   /// \return Reference to the computed inverse projection matrix.
   const Mat4f& computeInverseProjectionMatrix();
+  /// Computes the ray starting from the camera's near plane & passing through the given point of the screen.
+  /// Both inverse view & projection matrices must be up to date, which is the case after the render system's update.
+  /// \param ndcPos Point on the screen in normalized device coordinates, from [ -1; -1 ] (bottom left) to [ 1; 1 ] (top right).
+  /// \return Ray in world coordinates.
+  Ray computeRay(const Vec2f& ndcPos) const;
+  /// Computes the planes delimiting the camera's view volume, extracted from the view & projection matrices, which must be up to date.
+  /// Their normals point towards the inside of the volume: a point is contained if, for every plane, normal.dot(point) >= distance.
+  /// \return Left, right, bottom, top, near & far planes, in world coordinates.
+  std::array<Plane, 6> computeFrustumPlanes() const;
 
 private:
   float m_frameRatio;
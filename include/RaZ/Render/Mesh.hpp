@@ -31,6 +31,12 @@ public:
   std::vector<MaterialPtr>& getMaterials() { return m_materials; }
   std::size_t recoverVertexCount() const;
   std::size_t recoverTriangleCount() const;
+  /// Computes the box bounding all the submeshes, from their cached bounding boxes.
+  /// \return Mesh's bounding box.
+  AABB computeBoundingBox() const;
+  /// Computes a sphere bounding all the submeshes, from their cached bounding spheres. It is centered on the mesh's bounding box's center.
+  /// \return Mesh's bounding sphere.
+  Sphere computeBoundingSphere() const;
 
   template <typename... Args> static MeshPtr create(Args&&... args) { return std::make_unique<Mesh>(std::forward<Args>(args)...); }
   static void drawUnitQuad();
@@ -40,6 +46,12 @@ public:
   void setMaterial(MaterialPreset materialPreset, float roughnessFactor);
   void addSubmesh(SubmeshPtr submesh) { m_submeshes.emplace_back(std::move(submesh)); }
   void addMaterial(MaterialPtr material) { m_materials.emplace_back(std::move(material)); }
+  /// Computes the outdated bounds of all the submeshes, in parallel. This is done after importing a mesh or creating it from a shape.
+  void computeBounds() const;
+  /// Computes the convex hulls of all the submeshes, in parallel. This is done after importing a mesh.
+  /// \param maxVertexCount Maximum number of vertices each hull can have; 0 if unlimited.
+  /// \param tolerance Distance under which vertices outside of a hull are considered to be on it. The higher, the simpler the hulls will be.
+  void computeConvexHulls(std::size_t maxVertexCount = ConvexHull::DefaultMaxVertexCount, float tolerance = 0.f) const;
   void load() const;
   void load(const ShaderProgram& program) const;
   void draw() const;
@@ -0,0 +1,38 @@
+#pragma once
+
+#ifndef RAZ_OCCLUDER_HPP
+#define RAZ_OCCLUDER_HPP
+
+#include <vector>
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class AABB;
+class Mesh;
+
+/// Simplified geometry of an entity hiding others behind it, rasterized by the RenderSystem's occlusion culling.
+/// The geometry must not extend beyond the entity's visible one, lest objects be wrongly culled.
+class Occluder : public Component {
+public:
+  Occluder(std::vector<Vec3f> positions, std::vector<unsigned int> indices) : m_positions{ std::move(positions) }, m_indices{ std::move(indices) } {}
+  /// Creates an occluder from a box, made of its 12 triangles.
+  /// \param box Box to create the occluder from.
+  explicit Occluder(const AABB& box);
+  /// Creates an occluder from all of a mesh's triangles. A lower-detail mesh should be preferred, the rasterization's cost depending on it.
+  /// \param mesh Mesh to create the occluder from.
+  explicit Occluder(const Mesh& mesh);
+
+  const std::vector<Vec3f>& getPositions() const { return m_positions; }
+  const std::vector<unsigned int>& getIndices() const { return m_indices; }
+
+private:
+  std::vector<Vec3f> m_positions {};
+  std::vector<unsigned int> m_indices {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_OCCLUDER_HPP
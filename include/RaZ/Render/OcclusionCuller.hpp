@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef RAZ_OCCLUSIONCULLER_HPP
+#define RAZ_OCCLUSIONCULLER_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class AABB;
+class Occluder;
+
+/// Software occlusion culling, entirely computed on the CPU.
+/// Occluders' triangles are rasterized into a low-resolution depth buffer, split into tiles filled in parallel & several pixels at once with SIMD.
+/// A hierarchical depth (Hi-Z) pyramid is then built from it, each texel holding the furthest depth of the 2x2 ones below.
+/// An object is occluded if the nearest depth of its screen-space bounds is further than the furthest depth they cover in the pyramid.
+/// Depths are those of the normalized device coordinates, going from 0 on the near plane to 1 on the far one.
+class OcclusionCuller {
+public:
+  static constexpr unsigned int TileWidth  = 32;
+  static constexpr unsigned int TileHeight = 16;
+
+  /// Level of the depth pyramid, the first one being the depth buffer itself.
+  struct DepthLevel {
+    unsigned int width {};
+    unsigned int height {};
+    std::vector<float> depths {};
+  };
+
+  /// Creates an occlusion culler. Its buffer's resolution is independent from the window's, being usually much lower.
+  /// \param width Width of the depth buffer; rounded up to a multiple of the tile width.
+  /// \param height Height of the depth buffer; rounded up to a multiple of the tile height.
+  explicit OcclusionCuller(unsigned int width = 256, unsigned int height = 128) { resize(width, height); }
+
+  unsigned int getWidth() const { return m_levels.front().width; }
+  unsigned int getHeight() const { return m_levels.front().height; }
+  std::size_t getLevelCount() const { return m_levels.size(); }
+  const DepthLevel& getLevel(std::size_t levelIndex) const { return m_levels[levelIndex]; }
+  const std::vector<float>& getDepthBuffer() const { return m_levels.front().depths; }
+  std::size_t getTriangleCount() const { return m_triangles.size(); }
+
+  /// Changes the depth buffer's resolution, clearing it.
+  /// \param width New width; rounded up to a multiple of the tile width.
+  /// \param height New height; rounded up to a multiple of the tile height.
+  void resize(unsigned int width, unsigned int height);
+  /// Resets the depth buffer & pyramid to the far plane's depth, and removes all added occluders.
+  void clear();
+  /// Projects & bins an occluder's triangles into the tiles they overlap, for them to be rasterized later.
+  /// Triangles crossing the near plane are discarded, which can only lead to fewer objects being culled.
+  /// This function is not thread-safe: occluders must be added sequentially.
+  /// \param positions Occluder's vertices' positions, in model space.
+  /// \param indices Indices of the vertices of each triangle.
+  /// \param modelViewProjMat Model-view-projection matrix to transform the vertices with.
+  void addOccluder(const std::vector<Vec3f>& positions, const std::vector<unsigned int>& indices, const Mat4f& modelViewProjMat);
+  /// Projects & bins an occluder's triangles into the tiles they overlap, for them to be rasterized later.
+  /// \param occluder Occluder to be added.
+  /// \param modelViewProjMat Model-view-projection matrix to transform the occluder with.
+  void addOccluder(const Occluder& occluder, const Mat4f& modelViewProjMat);
+  /// Rasterizes the added occluders, each tile being processed in parallel, then builds the depth pyramid from the resulting buffer.
+  void rasterize();
+  /// Checks if a box is hidden by the rasterized occluders.
+  /// A box crossing the near plane is never considered occluded, its screen-space bounds being undefined.
+  /// \param box Box to be checked, in world space.
+  /// \param viewProjMat View-projection matrix the occluders have been rasterized with.
+  /// \return True if the box is entirely hidden, false otherwise.
+  bool isOccluded(const AABB& box, const Mat4f& viewProjMat) const;
+
+private:
+  /// Triangle set up for rasterization: each edge function & the depth are planes evaluated at pixels' centers.
+  struct ScreenTriangle {
+    std::array<float, 3> edgeStepsX {};
+    std::array<float, 3> edgeStepsY {};
+    std::array<float, 3> edgeOffsets {};
+    float depthStepX {};
+    float depthStepY {};
+    float depthOffset {};
+    int minX {};
+    int minY {};
+    int maxX {};
+    int maxY {};
+  };
+
+  void rasterizeTile(std::size_t tileIndex);
+  void buildPyramid();
+
+  std::vector<DepthLevel> m_levels = std::vector<DepthLevel>(1);
+  unsigned int m_tileCountX {};
+  unsigned int m_tileCountY {};
+  std::vector<ScreenTriangle> m_triangles {};
+  std::vector<std::vector<std::uint32_t>> m_tileTriangles {};
+  std::vector<Vec4f> m_clipPositions {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_OCCLUSIONCULLER_HPP
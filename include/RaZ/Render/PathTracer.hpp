@@ -0,0 +1,173 @@
+#pragma once
+
+#ifndef RAZ_PATHTRACER_HPP
+#define RAZ_PATHTRACER_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/InstanceBvh.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+namespace Raz {
+
+class Material;
+class Mesh;
+class Submesh;
+class Transform;
+class World;
+
+/// CPU path tracer, rendering a scene without any GPU to produce reference images or bake lighting.
+/// The image is split into tiles, dynamically distributed among threads; each pixel's samples are drawn from a sequence depending only
+///  on its position & the sample's index, so that the result does not depend on the number of threads nor on their scheduling.
+/// Rendering is progressive: each call to render() adds samples to every pixel, the image converging towards the scene's actual lighting.
+/// Surfaces are shaded with the same Cook-Torrance BRDF as the rasterizer, lights being sampled directly at each bounce. Texture maps,
+///  only available on the GPU, are ignored: materials are defined by their base color, metallic & roughness factors.
+class PathTracer {
+public:
+  static constexpr unsigned int TileSize = 16;
+
+  /// Properties of a surface, matching those of MaterialCookTorrance.
+  struct Surface {
+    Vec3f baseColor = Vec3f(1.f);
+    float metallicFactor  = 0.f;
+    float roughnessFactor = 1.f;
+    /// Radiance emitted by the surface, which is only found by the paths hitting it & thus converges slowly if small & bright.
+    Vec3f emission = Vec3f(0.f);
+  };
+
+  PathTracer(unsigned int width, unsigned int height);
+
+  unsigned int getWidth() const { return m_width; }
+  unsigned int getHeight() const { return m_height; }
+  /// Gets the number of samples accumulated by each pixel since the last reset.
+  /// \return Number of samples per pixel.
+  unsigned int getSampleCount() const { return m_sampleCount; }
+  unsigned int getMaxBounceCount() const { return m_maxBounceCount; }
+  const Vec3f& getBackgroundColor() const { return m_backgroundColor; }
+  std::size_t getGeometryCount() const { return m_geometries.size(); }
+  std::size_t getInstanceCount() const { return m_instances.size(); }
+  std::size_t getLightCount() const { return m_lights.size(); }
+
+  /// Sets the maximal number of times a path can bounce off surfaces; 0 only renders the direct lighting. Resets the accumulation.
+  /// \param maxBounceCount Maximal number of bounces.
+  void setMaxBounceCount(unsigned int maxBounceCount) { m_maxBounceCount = maxBounceCount; resetAccumulation(); }
+  /// Sets the radiance of the environment, received by the paths escaping the scene. Resets the accumulation.
+  /// \param color Background radiance.
+  void setBackgroundColor(const Vec3f& color) { m_backgroundColor = color; resetAccumulation(); }
+  /// Sets the number of threads rendering the tiles. Doesn't change the result.
+  /// \param threadCount Number of threads, the calling one included; if 0, the system's thread count is used.
+  void setThreadCount(unsigned int threadCount) { m_threadCount = threadCount; }
+  /// Sets the camera to render the scene from. Resets the accumulation.
+  /// \param camera Camera whose view & inverse view matrices are up to date, as required for Camera::computeRay().
+  void setCamera(const Camera& camera);
+  /// Sets the camera to render the scene from, its view matrices being computed from the given transform. Resets the accumulation.
+  /// \param camera Camera to render the scene from.
+  /// \param cameraTransform Camera's transform, as used by the RenderSystem.
+  void setCamera(const Camera& camera, const Transform& cameraTransform);
+
+  /// Adds triangles to the scene, to be placed with addInstance(). Their data is copied.
+  /// \param vertices Vertices of the triangles, whose normals are interpolated for shading.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3.
+  /// \return Index of the geometry.
+  std::size_t addGeometry(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+  /// Places a geometry in the scene. Resets the accumulation.
+  /// \param geometryIndex Index of the geometry, as returned by addGeometry().
+  /// \param transform Matrix transforming the geometry's local coordinates into world ones.
+  /// \param surface Surface properties of the instance.
+  void addInstance(std::size_t geometryIndex, const Mat4f& transform, const Surface& surface);
+  /// Places all submeshes of a mesh in the scene, with their respective materials. Submeshes already added are not duplicated.
+  /// \param mesh Mesh to be added. Its submeshes must be kept alive as long as the scene is not cleared, as they identify the geometries.
+  /// \param transform Matrix transforming the mesh's local coordinates into world ones.
+  void addMesh(const Mesh& mesh, const Mat4f& transform);
+  /// Adds a light to the scene. Spot lights are rendered as point lights, as done by the rasterizer. Resets the accumulation.
+  /// \param light Light to be added.
+  /// \param position Light's position in world coordinates; ignored for directional lights.
+  void addLight(const Light& light, const Vec3f& position);
+  /// Replaces the scene by the content of a world: all enabled entities having a transform & either a mesh or a light are added.
+  /// The first enabled entity having both a camera & a transform, if any, becomes the camera.
+  /// \param world World to render.
+  void loadWorld(const World& world);
+  /// Removes all geometries, instances & lights. Resets the accumulation.
+  void clearScene();
+  /// Discards all the samples accumulated so far.
+  void resetAccumulation();
+  /// Renders more samples for every pixel, adding them to the previous ones.
+  /// \param sampleCount Number of samples per pixel to be added.
+  void render(unsigned int sampleCount = 1);
+  /// Gets the average radiance received by a pixel.
+  /// \param x Pixel's horizontal index, from the left.
+  /// \param y Pixel's vertical index, from the bottom.
+  /// \return Pixel's radiance; null if no sample has been rendered yet.
+  Vec3f getPixelRadiance(unsigned int x, unsigned int y) const;
+  /// Creates an RGB image from the rendered pixels, rows being stored from the bottom to the top.
+  /// \param toneMapped True to map the radiance to displayable bytes as the rasterizer does (Reinhard tone mapping & gamma correction),
+  ///   false to keep the raw radiance as floats.
+  /// \return Rendered image.
+  Image computeImage(bool toneMapped = true) const;
+  /// Saves the tone mapped image to a file.
+  /// \param filePath Path to the file to be written; must be a PNG file.
+  void saveImage(const std::string& filePath) const;
+
+private:
+  struct Geometry {
+    std::vector<Vertex> vertices {};
+    std::vector<unsigned int> indices {};
+    TriangleBvh bvh {};
+  };
+
+  struct Instance {
+    std::size_t geometryIndex {};
+    Mat4f transform {};
+    Mat4f normalMatrix {};
+    Surface surface {};
+  };
+
+  struct LightSource {
+    bool isDirectional {};
+    Vec3f position {};
+    Vec3f direction {};
+    Vec3f radiance {};
+  };
+
+  static Surface recoverSurface(const Material& material);
+
+  /// Builds the hierarchies of the new geometries, then the top-level one over all instances.
+  void prepareScene();
+  /// Traces a path from the camera, returning the radiance it brings back.
+  /// \param ray Primary ray.
+  /// \param seed Seed of the random numbers drawn along the path.
+  /// \return Radiance received along the ray.
+  Vec3f traceRay(const Ray& ray, std::uint32_t seed) const;
+  void renderTile(std::size_t tileIndex, unsigned int sampleCount);
+
+  unsigned int m_width {};
+  unsigned int m_height {};
+  unsigned int m_maxBounceCount = 4;
+  unsigned int m_threadCount = 0;
+  Vec3f m_backgroundColor = Vec3f(0.f);
+  CameraPtr m_camera {};
+
+  std::vector<Geometry> m_geometries {};
+  std::vector<Instance> m_instances {};
+  std::vector<LightSource> m_lights {};
+  std::unordered_map<const Submesh*, std::size_t> m_submeshGeometries {};
+  InstanceBvh m_instanceBvh {};
+  bool m_sceneOutdated = true;
+
+  /// Sum of the radiance samples of each pixel, rows being stored from the bottom to the top.
+  std::vector<Vec3f> m_accumulatedRadiance {};
+  unsigned int m_sampleCount = 0;
+};
+
+} // namespace Raz
+
+#endif // RAZ_PATHTRACER_HPP
@@ -7,6 +7,7 @@
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Render/Cubemap.hpp"
+#include "RaZ/Render/OcclusionCuller.hpp"
 #include "RaZ/Render/UniformBuffer.hpp"
 #include "RaZ/System.hpp"
 #include "RaZ/Utils/Window.hpp"
@@ -23,9 +24,17 @@ public:
   Entity& getCameraEntity() { return m_camera; }
   const ShaderProgram& getProgram() const { return m_program; }
   const CubemapPtr& getCubemap() const { return m_cubemap; }
+  const OcclusionCuller& getOcclusionCuller() const { return m_occlusionCuller; }
+  OcclusionCuller& getOcclusionCuller() { return m_occlusionCuller; }
+  bool isOcclusionCullingEnabled() const { return m_isOcclusionCullingEnabled; }
 
   void setProgram(ShaderProgram&& program) { m_program = std::move(program); }
   void setCubemap(CubemapPtr cubemap) { m_cubemap = std::move(cubemap); }
+  /// Enables or disables occlusion culling. When enabled, the entities holding an Occluder are rasterized on the CPU each frame, and those
+  ///  whose transformed box is hidden behind them are not drawn. This box is the entity's AABB if it has one, or its mesh's bounding box.
+  /// \param enabled True if occlusion culling should be enabled, false otherwise.
+  void enableOcclusionCulling(bool enabled = true) { m_isOcclusionCullingEnabled = enabled; }
+  void disableOcclusionCulling() { enableOcclusionCulling(false); }
 
   void linkEntity(const EntityPtr& entity) override;
   void update(float deltaTime) override;
@@ -41,6 +50,9 @@ public:
   void updateLights() const;
   void removeCubemap() { m_cubemap.reset(); }
   void updateShaders() const;
+  /// Rasterizes the enabled entities' occluders from the camera's point of view.
+  /// \param viewProjMat Camera's view-projection matrix.
+  void rasterizeOccluders(const Mat4f& viewProjMat);
   void destroy() override { m_window.setShouldClose(); }
 
 private:
@@ -49,6 +61,8 @@ private:
   ShaderProgram m_program {};
   CubemapPtr m_cubemap {};
   UniformBuffer m_cameraUbo = UniformBuffer(sizeof(Mat4f) * 5 + sizeof(Vec4f), 0);
+  OcclusionCuller m_occlusionCuller {};
+  bool m_isOcclusionCullingEnabled = false;
 };
 
 } // namespace Raz
@@ -6,6 +6,8 @@
 #include <memory>
 
 #include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/ConvexHull.hpp"
+#include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
@@ -19,30 +21,63 @@ public:
   const VertexArray& getVao() const { return m_vao; }
   VertexArray& getVao() { return m_vao; }
   const VertexBuffer& getVbo() const { return m_vbo; }
-  VertexBuffer& getVbo() { return m_vbo; }
+  VertexBuffer& getVbo() { invalidateBounds(); return m_vbo; }
   const ElementBuffer& getEbo() const { return m_vao.getEbo(); }
   ElementBuffer& getEbo() { return m_vao.getEbo(); }
   const std::vector<Vertex>& getVertices() const { return m_vbo.getVertices(); }
-  std::vector<Vertex>& getVertices() { return m_vbo.getVertices(); }
+  std::vector<Vertex>& getVertices() { invalidateBounds(); return m_vbo.getVertices(); }
   const std::vector<unsigned int>& getIndices() const { return m_vao.getEbo().getIndices(); }
   std::vector<unsigned int>& getIndices() { return m_vao.getEbo().getIndices(); }
   std::size_t getMaterialIndex() const { return m_materialIndex; }
   std::size_t getVertexCount() const { return m_vbo.getVertices().size(); }
   std::size_t getIndexCount() const { return getEbo().getIndices().size(); }
+  /// Gets the box bounding all the vertices.
+  /// The bounds are cached & only recomputed when the vertices may have changed since the last call.
+  /// Recomputing them is not thread-safe; computeBounds() must be called beforehand if the submesh is to be read from several threads.
+  /// \return Reference to the cached bounding box.
+  const AABB& getBoundingBox() const;
+  /// Gets the sphere bounding all the vertices, centered on the bounding box's center.
+  /// The bounds are cached & only recomputed when the vertices may have changed since the last call.
+  /// Recomputing them is not thread-safe; computeBounds() must be called beforehand if the submesh is to be read from several threads.
+  /// \return Reference to the cached bounding sphere.
+  const Sphere& getBoundingSphere() const;
+  /// Gets the convex hull of the vertices, to be used as a collision proxy.
+  /// The hull is cached & only recomputed when the vertices may have changed since the last computation, with the same parameters as the latter.
+  /// Until computeConvexHull() is called, the default parameters are used. Like the bounds', the hull's recomputation is not thread-safe.
+  /// \return Reference to the cached convex hull.
+  const ConvexHull& getConvexHull() const;
 
   template <typename... Args>
   static SubmeshPtr create(Args&&... args) { return std::make_unique<Submesh>(std::forward<Args>(args)...); }
 
   void setMaterialIndex(std::size_t materialIndex) { m_materialIndex = materialIndex; }
 
+  /// Computes the bounding box & sphere of the vertices, if they may have changed since the last computation.
+  void computeBounds() const;
+  /// Computes the convex hull of the vertices, replacing the cached one. The parameters are kept for the hull's later recomputations.
+  /// \param maxVertexCount Maximum number of vertices the hull can have; 0 if unlimited.
+  /// \param tolerance Distance under which vertices outside of the hull are considered to be on it. The higher, the simpler the hull will be.
+  void computeConvexHull(std::size_t maxVertexCount = ConvexHull::DefaultMaxVertexCount, float tolerance = 0.f) const;
   void load() const;
   void draw() const;
 
 private:
+  /// Flags the bounds & convex hull as outdated. Non-const accesses to the vertices do so as well, since the returned references allow
+  ///  external modifications; code only reading them must thus access them through a constant submesh to keep the caches.
+  void invalidateBounds() { m_boundsOutdated = true; m_convexHullOutdated = true; }
+
   VertexArray m_vao {};
   VertexBuffer m_vbo {};
 
   std::size_t m_materialIndex {};
+
+  mutable AABB m_boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
+  mutable Sphere m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
+  mutable ConvexHull m_convexHull {};
+  mutable std::size_t m_convexHullMaxVertexCount = ConvexHull::DefaultMaxVertexCount;
+  mutable float m_convexHullTolerance = 0.f;
+  mutable bool m_boundsOutdated = true;
+  mutable bool m_convexHullOutdated = true;
 };
 
 } // namespace Raz
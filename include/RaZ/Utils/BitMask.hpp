@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef RAZ_BITMASK_HPP
+#define RAZ_BITMASK_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace Raz {
+
+/// Fixed-size set of bits packed in 64-bit words, typically holding the results of a batch of tests.
+/// Unlike Bitset, whole groups of bits can be written at once, as SIMD comparisons produce them.
+class BitMask {
+public:
+  static constexpr std::size_t WordBitCount = 64;
+
+  BitMask() = default;
+  explicit BitMask(std::size_t bitCount) { reset(bitCount); }
+
+  std::size_t getSize() const { return m_bitCount; }
+  const std::vector<std::uint64_t>& getWords() const { return m_words; }
+
+  /// Resizes the mask, disabling all of its bits.
+  /// \param bitCount New number of bits.
+  void reset(std::size_t bitCount);
+  bool isSet(std::size_t index) const { return ((m_words[index / WordBitCount] >> (index % WordBitCount)) & 1u); }
+  void setBit(std::size_t index, bool value = true);
+  /// Enables several consecutive bits at once. The group must not span over two words, which is always the case if
+  /// the first index is a multiple of the group's size & the latter is a power of 2 no greater than 64 (such as Simd::Width).
+  /// \param firstIndex Index of the first bit to be set.
+  /// \param bits Bits to be enabled, the lowest one being written at the first index.
+  void enableBits(std::size_t firstIndex, std::uint64_t bits) { m_words[firstIndex / WordBitCount] |= bits << (firstIndex % WordBitCount); }
+  std::size_t getEnabledBitCount() const;
+  /// Gets the indices of all the enabled bits.
+  /// \param indices Indices of the enabled bits, in increasing order. The list is cleared beforehand.
+  void getEnabledIndices(std::vector<std::uint32_t>& indices) const;
+
+private:
+  std::vector<std::uint64_t> m_words {};
+  std::size_t m_bitCount {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_BITMASK_HPP
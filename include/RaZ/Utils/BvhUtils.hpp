@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef RAZ_BVHUTILS_HPP
+#define RAZ_BVHUTILS_HPP
+
+#include <limits>
+#include <utility>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+/// Operations shared by the bounding volume hierarchies' traversals, whether over triangles or instances.
+namespace BvhUtils {
+
+/// Computes the distance at which a ray enters a node's box, using the slab method.
+/// \tparam NodeT Type of the node, holding its box's minBounds & maxBounds.
+/// \param node Node whose box is to be entered.
+/// \param origin Ray's origin.
+/// \param invDirection Ray's inverse direction.
+/// \param maxDistance Distance from the origin beyond which the box is considered missed.
+/// \return Entry distance, or the maximal float value if the box is missed or is entered beyond the given maximal distance.
+template <typename NodeT>
+inline float computeEntryDistance(const NodeT& node, const Vec3f& origin, const Vec3f& invDirection, float maxDistance) {
+  float minDist = 0.f;
+  float maxDist = maxDistance;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    float firstDist  = (node.minBounds[axis] - origin[axis]) * invDirection[axis];
+    float secondDist = (node.maxBounds[axis] - origin[axis]) * invDirection[axis];
+
+    if (firstDist > secondDist)
+      std::swap(firstDist, secondDist);
+
+    // Comparisons are ordered so that NaNs, appearing when the ray lies exactly on a slab's plane, leave the distances untouched
+    minDist = (firstDist > minDist ? firstDist : minDist);
+    maxDist = (secondDist < maxDist ? secondDist : maxDist);
+  }
+
+  return (minDist <= maxDist ? minDist : std::numeric_limits<float>::max());
+}
+
+/// Transforms a point, the matrix being applied on the right of a row vector.
+/// \param point Point to be transformed.
+/// \param matrix Transformation matrix.
+/// \return Transformed point.
+inline Vec3f transformPoint(const Vec3f& point, const Mat4f& matrix) {
+  return Vec3f({ point[0] * matrix[0] + point[1] * matrix[4] + point[2] * matrix[8] + matrix[12],
+                 point[0] * matrix[1] + point[1] * matrix[5] + point[2] * matrix[9] + matrix[13],
+                 point[0] * matrix[2] + point[1] * matrix[6] + point[2] * matrix[10] + matrix[14] });
+}
+
+/// Transforms a direction, ignoring the translation.
+/// \param direction Direction to be transformed.
+/// \param matrix Transformation matrix.
+/// \return Transformed direction.
+inline Vec3f transformDirection(const Vec3f& direction, const Mat4f& matrix) {
+  return Vec3f({ direction[0] * matrix[0] + direction[1] * matrix[4] + direction[2] * matrix[8],
+                 direction[0] * matrix[1] + direction[1] * matrix[5] + direction[2] * matrix[9],
+                 direction[0] * matrix[2] + direction[1] * matrix[6] + direction[2] * matrix[10] });
+}
+
+} // namespace BvhUtils
+
+} // namespace Raz
+
+#endif // RAZ_BVHUTILS_HPP
@@ -0,0 +1,126 @@
+#pragma once
+
+#ifndef RAZ_CONVEXHULL_HPP
+#define RAZ_CONVEXHULL_HPP
+
+#include <vector>
+
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Convex polyhedron enclosing a set of points, made of triangular faces whose normals point outwards.
+/// It is computed with the Quickhull algorithm, which repeatedly adds the point furthest outside of the current hull; stopping early
+///  or ignoring points close to the hull thus gives a simplified hull keeping the most significant vertices.
+/// Being convex, it can be used as a collision proxy for far more detailed meshes, its support points being all that GJK needs.
+/// Input points lying in a plane or on a line give a flat or linear hull, respectively without volume & faces; the vertex limit & tolerance
+///  only apply to hulls having a volume.
+class ConvexHull : public Shape {
+public:
+  static constexpr std::size_t DefaultMaxVertexCount = 64;
+
+  ConvexHull() = default;
+  /// Computes the convex hull of a set of points.
+  /// \param points Points to compute the hull of.
+  /// \param maxVertexCount Maximum number of vertices the hull can have; 0 if unlimited. The hull always has at least 4 vertices if not flat.
+  /// \param tolerance Distance under which points outside of the hull are considered to be on it. The higher, the simpler the hull will be.
+  ///   A minimal tolerance, relative to the points' extent, is always applied to handle floating-point imprecision.
+  explicit ConvexHull(const std::vector<Vec3f>& points, std::size_t maxVertexCount = 0, float tolerance = 0.f) { compute(points, maxVertexCount, tolerance); }
+  /// Computes the convex hull of a set of vertices' positions.
+  /// \param vertices Vertices to compute the hull of.
+  /// \param maxVertexCount Maximum number of vertices the hull can have; 0 if unlimited.
+  /// \param tolerance Distance under which points outside of the hull are considered to be on it.
+  explicit ConvexHull(const std::vector<Vertex>& vertices, std::size_t maxVertexCount = 0, float tolerance = 0.f) {
+    compute(vertices, maxVertexCount, tolerance);
+  }
+
+  const std::vector<Vec3f>& getVertices() const { return m_vertices; }
+  /// Gets the indices of the vertices of each face, defined counterclockwise when seen from outside of the hull.
+  /// \return Faces' indices, by groups of 3.
+  const std::vector<unsigned int>& getIndices() const { return m_indices; }
+  /// Gets the planes in which the faces lie, their normals pointing outwards.
+  /// \return Faces' planes, in the same order as the faces.
+  const std::vector<Plane>& getFacePlanes() const { return m_facePlanes; }
+  std::size_t getVertexCount() const { return m_vertices.size(); }
+  std::size_t getFaceCount() const { return m_facePlanes.size(); }
+  bool isEmpty() const { return m_vertices.empty(); }
+  /// Checks if the hull is flat, its vertices lying in a plane. A flat hull has faces on a single side, which are not oriented.
+  /// \return True if the hull is flat, false otherwise.
+  bool isFlat() const { return m_isFlat; }
+
+  /// Computes the convex hull of a set of points, replacing the current one.
+  /// \param points Points to compute the hull of.
+  /// \param maxVertexCount Maximum number of vertices the hull can have; 0 if unlimited.
+  /// \param tolerance Distance under which points outside of the hull are considered to be on it.
+  void compute(const std::vector<Vec3f>& points, std::size_t maxVertexCount = 0, float tolerance = 0.f);
+  /// Computes the convex hull of a set of vertices' positions, replacing the current one.
+  /// \param vertices Vertices to compute the hull of.
+  /// \param maxVertexCount Maximum number of vertices the hull can have; 0 if unlimited.
+  /// \param tolerance Distance under which points outside of the hull are considered to be on it.
+  void compute(const std::vector<Vertex>& vertices, std::size_t maxVertexCount = 0, float tolerance = 0.f);
+  /// Point containment check.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the hull or on its surface, false otherwise.
+  bool contains(const Vec3f& point) const override;
+  /// Hull-line intersection check.
+  /// \param line Line to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Line& line) const override;
+  /// Hull-plane intersection check.
+  /// \param plane Plane to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Plane& plane) const override;
+  /// Hull-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Sphere& sphere) const override;
+  /// Hull-triangle intersection check.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Triangle& triangle) const override;
+  /// Hull-quad intersection check.
+  /// \param quad Quad to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Quad& quad) const override;
+  /// Hull-AABB intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const AABB& aabb) const override;
+  /// Hull-hull intersection check.
+  /// \param hull Hull to check if there is an intersection with.
+  /// \return True if both hulls intersect each other, false otherwise.
+  bool intersects(const ConvexHull& hull) const;
+  /// Computes the projection of a point (closest point) onto the hull.
+  /// \param point Point to compute the projection from.
+  /// \return The point itself if inside the hull, its closest point on the hull's surface otherwise.
+  Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the hull's support point, which is its furthest vertex in a given direction.
+  /// \param direction Direction in which to find the furthest point. Doesn't need to be normalized.
+  /// \return Computed support point; the origin if the hull is empty.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
+  /// Computes the hull's centroid, which is its center of mass if not flat.
+  /// \return Computed centroid.
+  Vec3f computeCentroid() const override;
+  /// Computes the box bounding the hull's vertices.
+  /// \return Hull's bounding box.
+  AABB computeBoundingBox() const;
+  /// Computes the hull transformed by a given matrix, such as its entity's transform one.
+  /// \param transform Transformation matrix to apply to the vertices.
+  /// \return Transformed hull.
+  ConvexHull computeTransformed(const Mat4f& transform) const;
+
+private:
+  void computeFlat(const std::vector<Vec3f>& points, const Vec3f& normal);
+  void computeFacePlanes();
+
+  std::vector<Vec3f> m_vertices {};
+  std::vector<unsigned int> m_indices {};
+  std::vector<Plane> m_facePlanes {};
+  float m_epsilon {};
+  bool m_isFlat = false;
+};
+
+} // namespace Raz
+
+#endif // RAZ_CONVEXHULL_HPP
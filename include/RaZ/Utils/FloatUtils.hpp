@@ -5,9 +5,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
 namespace Raz {
 
 namespace FloatUtils {
@@ -23,6 +29,147 @@ inline bool checkNearEquality(T val1, T val2) {
   return (absDiff <= std::numeric_limits<T>::epsilon() * std::max({ static_cast<T>(1), std::abs(val1), std::abs(val2) }));
 }
 
+// Fast approximate math functions
+// These trade some precision for speed, & are meant to be explicitly opted into in hot paths; the standard functions remain the default.
+// The given error bounds have been measured over the whole valid domain of each function.
+// SIMD equivalents, processing several values at once, are available in the Simd namespace (see Simd.hpp).
+
+/// Coefficients of the polynomials used by the fast trigonometric functions, shared with their SIMD equivalents.
+namespace FastMathCoeffs {
+
+// Odd Taylor polynomial of degree 11 for sin(x), used on [-pi/2; pi/2]
+constexpr float Sin3  = -1.f / 6.f;
+constexpr float Sin5  = 1.f / 120.f;
+constexpr float Sin7  = -1.f / 5040.f;
+constexpr float Sin9  = 1.f / 362880.f;
+constexpr float Sin11 = -1.f / 39916800.f;
+
+// Odd minimax polynomial of degree 11 for atan(x), used on [0; 1]
+constexpr float Atan1  = 0.99997726f;
+constexpr float Atan3  = -0.33262347f;
+constexpr float Atan5  = 0.19354346f;
+constexpr float Atan7  = -0.11643287f;
+constexpr float Atan9  = 0.05265332f;
+constexpr float Atan11 = -0.01172120f;
+
+// Pi split in two parts for a more precise range reduction (Cody-Waite): the high part's product with small integers is exact
+constexpr float PiHigh = 3.140625f;
+constexpr float PiLow  = 9.67653589793e-4f;
+constexpr float InvPi  = 0.318309886f;
+constexpr float HalfPi = 1.57079632f;
+
+} // namespace FastMathCoeffs
+
+#if defined(__SSE__) || defined(_M_X64)
+/// Upper bound of the relative error of fastRsqrt(), refining the hardware estimate.
+constexpr float FastRsqrtMaxError = 3e-7f;
+#else
+/// Upper bound of the relative error of fastRsqrt(), refining an estimate computed from the value's bits.
+constexpr float FastRsqrtMaxError = 2e-3f;
+#endif
+
+/// Computes an approximation of the inverse square root (1 / sqrt(val)), refined by one Newton-Raphson iteration.
+/// The relative error is below 3e-7 when SSE is available, using the hardware estimate, & below 2e-3 otherwise; see FastRsqrtMaxError.
+/// \param val Strictly positive value to compute the inverse square root of.
+/// \return Approximated inverse square root.
+inline float fastRsqrt(float val) {
+#if defined(__SSE__) || defined(_M_X64)
+  const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(val)));
+#else
+  // Approximating the logarithm from the value's bits: https://en.wikipedia.org/wiki/Fast_inverse_square_root
+  std::uint32_t bits {};
+  std::memcpy(&bits, &val, sizeof(float));
+  bits = 0x5F375A86 - (bits >> 1);
+
+  float estimate {};
+  std::memcpy(&estimate, &bits, sizeof(float));
+#endif
+
+  return estimate * (1.5f - 0.5f * val * estimate * estimate);
+}
+
+/// Computes an approximation of the reciprocal (1 / val), refined by one Newton-Raphson iteration.
+/// The relative error is below 3e-7 when SSE is available, using the hardware estimate, & below 3e-3 otherwise.
+/// \param val Non-zero value to compute the reciprocal of.
+/// \return Approximated reciprocal.
+inline float fastReciprocal(float val) {
+#if defined(__SSE__) || defined(_M_X64)
+  const float estimate = _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(val)));
+  return estimate * (2.f - val * estimate);
+#else
+  std::uint32_t bits {};
+  std::memcpy(&bits, &val, sizeof(float));
+  bits = 0x7EF311C7 - bits;
+
+  float estimate {};
+  std::memcpy(&estimate, &bits, sizeof(float));
+
+  // The bitwise estimate being much coarser than the hardware one, a second iteration is required to reach a similar precision
+  estimate *= 2.f - val * estimate;
+  return estimate * (2.f - val * estimate);
+#endif
+}
+
+/// Computes an approximation of the sine of the given angle, using a polynomial after a reduction to [-pi/2; pi/2].
+/// The absolute error is below 5e-7 for angles in [-1000; 1000]; it then slowly grows with the angle's magnitude.
+/// \param angle Angle in radians.
+/// \return Approximated sine.
+inline float fastSin(float angle) {
+  using namespace FastMathCoeffs;
+
+  // sin(x) = (-1)^k * sin(x - k * pi), with k chosen so that the reduced angle lies in [-pi/2; pi/2]
+  const float halfTurns = std::nearbyint(angle * InvPi);
+  const float reduced   = (angle - halfTurns * PiHigh) - halfTurns * PiLow;
+  const float sqReduced = reduced * reduced;
+
+  const float res = reduced + reduced * sqReduced * (Sin3 + sqReduced * (Sin5 + sqReduced * (Sin7 + sqReduced * (Sin9 + sqReduced * Sin11))));
+  return (std::fmod(halfTurns, 2.f) == 0.f ? res : -res);
+}
+
+/// Computes an approximation of the cosine of the given angle, using a polynomial after a reduction to [-pi/2; pi/2].
+/// The absolute error is below 5e-7 for angles in [-1000; 1000]; it then slowly grows with the angle's magnitude.
+/// \param angle Angle in radians.
+/// \return Approximated cosine.
+inline float fastCos(float angle) {
+  using namespace FastMathCoeffs;
+
+  // cos(x) = sin(x + pi/2); the offset is applied on the number of half turns rather than on the angle, which would lose precision
+  // cos(x) = (-1)^k * sin(x - (k - 1/2) * pi), with k chosen so that the reduced angle lies in [-pi/2; pi/2]
+  const float halfTurns = std::nearbyint(angle * InvPi + 0.5f);
+  const float offset    = halfTurns - 0.5f;
+  const float reduced   = (angle - offset * PiHigh) - offset * PiLow;
+  const float sqReduced = reduced * reduced;
+
+  const float res = reduced + reduced * sqReduced * (Sin3 + sqReduced * (Sin5 + sqReduced * (Sin7 + sqReduced * (Sin9 + sqReduced * Sin11))));
+  return (std::fmod(halfTurns, 2.f) == 0.f ? res : -res);
+}
+
+/// Computes an approximation of the arctangent of y / x, using the signs of both values to determine the quadrant.
+/// The absolute error is below 2e-6 radians. Contrary to std::atan2(), infinite values are not handled.
+/// \param y Ordinate of the point.
+/// \param x Abscissa of the point.
+/// \return Approximated angle in radians, in [-pi; pi].
+inline float fastAtan2(float y, float x) {
+  using namespace FastMathCoeffs;
+
+  const float absX = std::abs(x);
+  const float absY = std::abs(y);
+
+  // Computing the arctangent of a ratio in [0; 1], where the polynomial is precise, then deducing the actual angle by symmetry
+  const float ratio   = std::min(absX, absY) / std::max({ absX, absY, std::numeric_limits<float>::min() });
+  const float sqRatio = ratio * ratio;
+
+  float res = ratio * (Atan1 + sqRatio * (Atan3 + sqRatio * (Atan5 + sqRatio * (Atan7 + sqRatio * (Atan9 + sqRatio * Atan11)))));
+
+  if (absY > absX)
+    res = HalfPi - res;
+
+  if (x < 0.f)
+    res = 2 * HalfPi - res;
+
+  return (y < 0.f ? -res : res);
+}
+
 } // namespace FloatUtils
 
 } // namespace Raz
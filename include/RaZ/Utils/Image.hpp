@@ -72,12 +72,17 @@ class Image {
 public:
   Image() = default;
   explicit Image(const std::string& fileName, bool reverse = false) { read(fileName, reverse); }
+  /// Creates an image with the given properties, its data being zero-initialized to be filled afterward through getDataPtr().
+  /// Rows are stored from the bottom to the top, as images read without being reversed are.
+  Image(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataType dataType = ImageDataType::BYTE);
 
   unsigned int getWidth() const { return m_width; }
   unsigned int getHeight() const { return m_height; }
   ImageColorspace getColorspace() const { return m_colorspace; }
   ImageDataType getDataType() const { return m_data->getDataType(); }
+  uint8_t getChannelCount() const { return m_channelCount; }
   const void* getDataPtr() const { return m_data->getDataPtr(); }
+  void* getDataPtr() { return m_data->getDataPtr(); }
 
   template <typename... Args> static ImagePtr create(Args&&... args) { return std::make_unique<Image>(std::forward<Args>(args)...); }
 
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef RAZ_INSTANCEBVH_HPP
+#define RAZ_INSTANCEBVH_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+namespace Raz {
+
+/// Two-level bounding volume hierarchy: triangle hierarchies are instanced in the world with a transformation matrix,
+/// the instances' world bounds being themselves organized in a hierarchy.
+/// Moving an instance only requires rebuilding the top-level hierarchy, which is cheap as it only holds a few nodes per instance.
+class InstanceBvh {
+public:
+  /// Triangle hierarchy placed in the world.
+  struct Instance {
+    const TriangleBvh* bvh {};
+    Mat4f transform = Mat4f::identity();
+    Mat4f invTransform = Mat4f::identity();
+    Vec3f minBounds {};
+    Vec3f maxBounds {};
+  };
+
+  /// Node of the top-level hierarchy, laid out as TriangleBvh::Node: a leaf stores the index of its first instance reference.
+  struct Node {
+    Vec3f minBounds {};
+    std::uint32_t offset {};
+    Vec3f maxBounds {};
+    std::uint32_t instanceCount {};
+
+    bool isLeaf() const { return (instanceCount > 0); }
+  };
+
+  const std::vector<Instance>& getInstances() const { return m_instances; }
+  std::size_t getInstanceCount() const { return m_instances.size(); }
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+  bool isEmpty() const { return m_nodes.empty(); }
+
+  /// Adds an instance of a triangle hierarchy. build() must then be called for it to be taken into account.
+  /// \param bvh Triangle hierarchy to be instanced. Must be kept alive & unchanged as long as it is referenced.
+  /// \param transform Matrix transforming the hierarchy's local coordinates into world ones.
+  /// \return Index of the added instance, which remains valid until clear() is called.
+  std::size_t addInstance(const TriangleBvh& bvh, const Mat4f& transform);
+  /// Changes an instance's transformation. build() must then be called for it to be taken into account.
+  /// \param instanceIndex Index of the instance to be moved.
+  /// \param transform New matrix transforming the hierarchy's local coordinates into world ones.
+  void setInstanceTransform(std::size_t instanceIndex, const Mat4f& transform);
+  /// Removes all instances & the hierarchy.
+  void clear();
+  /// Builds the top-level hierarchy over the instances' world bounds, replacing any previous one.
+  void build();
+  /// Checks if the ray hits any triangle of any instance, stopping as soon as one is found.
+  /// \param ray Ray to be cast, in world coordinates.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if a triangle is hit within the given distance, false otherwise.
+  bool intersects(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the closest triangle hit by the ray among all instances.
+  /// \param ray Ray to be cast, in world coordinates.
+  /// \param hit Information about the closest hit, in world coordinates. Left untouched if nothing has been hit.
+  /// \param instanceIndex Index of the instance that has been hit. Left untouched if nothing has been hit.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if a triangle is hit within the given distance, false otherwise.
+  bool intersect(const Ray& ray, RayHit& hit, std::size_t& instanceIndex, float maxDistance = std::numeric_limits<float>::max()) const;
+
+private:
+  std::uint32_t buildNode(std::uint32_t beginIndex, std::uint32_t endIndex);
+
+  std::vector<Instance> m_instances {};
+  std::vector<std::uint32_t> m_instanceIndices {};
+  std::vector<Node> m_nodes {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_INSTANCEBVH_HPP
@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef RAZ_KDTREE_HPP
+#define RAZ_KDTREE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+class Submesh;
+
+/// Implicit k-d tree over a set of points, such as a mesh's vertices, to find the closest ones to a given position.
+/// The points are recursively split in halves at their median along the axis of largest extent, down to small leaves;
+/// as every leaf lies at the same depth, the ranges of points are deduced from the nodes' indices & only the splitting planes are stored.
+/// The points are reordered so that those of a leaf are contiguous, their coordinates being stored in separate arrays to be scanned with SIMD.
+class KdTree {
+public:
+  /// Point found by a query.
+  struct Neighbor {
+    /// Index of the point in the list the tree has been built from.
+    std::uint32_t index {};
+    float sqDistance {};
+  };
+
+  /// Plane splitting the points of a node.
+  struct Node {
+    float splitValue {};
+    std::uint32_t splitAxis {};
+  };
+
+  KdTree() = default;
+  explicit KdTree(const std::vector<Vec3f>& points) { build(points); }
+  explicit KdTree(const std::vector<Vertex>& vertices) { build(vertices); }
+  explicit KdTree(const Submesh& submesh);
+
+  std::size_t getPointCount() const { return m_indices.size(); }
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+  bool isEmpty() const { return m_indices.empty(); }
+
+  /// Builds the tree over the given points, replacing any previous one. Nodes of a same level are built in parallel.
+  /// \param points Points to be organized.
+  void build(const std::vector<Vec3f>& points);
+  /// Builds the tree over the given vertices' positions, replacing any previous one.
+  /// \param vertices Vertices to be organized.
+  void build(const std::vector<Vertex>& vertices);
+  /// Finds the closest point to a position.
+  /// \param position Position to find the closest point of.
+  /// \param neighbor Closest point found. Left untouched if none has been found.
+  /// \param maxDistance Distance from the position beyond which points are ignored.
+  /// \return True if a point has been found within the given distance, false otherwise.
+  bool findNearest(const Vec3f& position, Neighbor& neighbor, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the given number of closest points to a position.
+  /// \param position Position to find the closest points of.
+  /// \param count Number of points to be found.
+  /// \param neighbors Closest points found, sorted from the closest to the furthest. The list is cleared beforehand.
+  /// \param maxDistance Distance from the position beyond which points are ignored.
+  void findNearest(const Vec3f& position, std::size_t count, std::vector<Neighbor>& neighbors,
+                   float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds all points within a given distance from a position.
+  /// \param position Position to find the points around.
+  /// \param radius Maximum distance from the position.
+  /// \param neighbors Points found, in no particular order. The list is cleared beforehand.
+  void findInRadius(const Vec3f& position, float radius, std::vector<Neighbor>& neighbors) const;
+
+private:
+  template <typename PositionGetterT>
+  void build(std::size_t pointCount, const PositionGetterT& getPosition);
+  template <typename LeafFuncT>
+  void traverse(const Vec3f& position, const float& maxSqDistance, const LeafFuncT& processLeaf) const;
+  void computeSquaredDistances(const Vec3f& position, std::size_t beginIndex, std::size_t pointCount, float* sqDistances) const;
+
+  std::vector<Node> m_nodes {};
+  std::size_t m_depth {};
+  std::vector<float> m_xPositions {};
+  std::vector<float> m_yPositions {};
+  std::vector<float> m_zPositions {};
+  std::vector<std::uint32_t> m_indices {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_KDTREE_HPP
@@ -0,0 +1,158 @@
+#pragma once
+
+#ifndef RAZ_NAVMESH_HPP
+#define RAZ_NAVMESH_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+class AABB;
+class Mesh;
+
+/// Parameters of a navigation mesh's generation, mostly describing the agents meant to walk on it. Distances are in world units.
+struct NavMeshSettings {
+  /// Horizontal size of the voxels the geometry is rasterized into. Smaller voxels give a more precise mesh, but take longer to process.
+  float cellSize = 0.3f;
+  /// Vertical size of the voxels.
+  float cellHeight = 0.2f;
+  /// Minimum height under which agents can pass.
+  float agentHeight = 2.f;
+  /// Radius of the agents, by which the walkable area is shrunk away from walls & ledges.
+  float agentRadius = 0.6f;
+  /// Maximum height of the steps agents can climb.
+  float agentMaxClimb = 0.9f;
+  /// Maximum slope agents can walk on, in degrees.
+  float agentMaxSlope = 45.f;
+  /// Number of voxels along each horizontal side of a tile, the unit in which the mesh is built & rebuilt.
+  std::size_t tileCellCount = 64;
+  /// Maximum distance by which the polygons' outlines may deviate from the walkable area's one.
+  float maxEdgeError = 0.4f;
+  /// Minimum number of voxels of an isolated walkable area for it to be kept, small spots such as tables' tops being discarded.
+  std::size_t minRegionCellCount = 8;
+};
+
+/// Navigation mesh, made of convex polygons covering the area on which agents can walk. Paths are searched on it with a NavMeshQuery.
+/// The mesh is generated from triangles in several steps, as popularized by Recast:
+/// - the triangles are rasterized into columns of voxels, agents being able to stand on the top of the walkable ones with enough clearance;
+/// - the walkable area is shrunk by the agents' radius, then partitioned into monotone regions, which have no holes;
+/// - each region's outline is traced & simplified, then triangulated, its triangles being merged into convex polygons.
+/// The horizontal plane is split into square tiles built independently & in parallel, so that modifying the geometry only requires rebuilding
+///   the tiles around the modification. Tiles are then stitched together by connecting the polygons whose edges touch along their borders.
+/// Polygons are connected to each other by links, stored in a compact adjacency array alongside the portal they share.
+class NavMesh {
+  friend class NavMeshQuery;
+
+public:
+  static constexpr std::size_t MaxPolygonVertexCount = 6;
+  /// Neighbor of a polygon's edge bordering no walkable area.
+  static constexpr std::uint32_t NoNeighbor = 0xFFFFFFFF;
+  /// Flag of a polygon's edge lying on its tile's border, combined with the border's side: 0 for -X, 1 for +Z, 2 for +X & 3 for -Z.
+  static constexpr std::uint32_t ExternalEdge = 0x80000000;
+
+  /// Convex polygon of a tile, referencing the tile's vertices in counter-clockwise order when seen from above.
+  struct Polygon {
+    std::array<std::uint32_t, MaxPolygonVertexCount> vertexIndices {};
+    /// Index in the tile of the polygon beyond each edge, which starts at the vertex of the same index. See NoNeighbor & ExternalEdge.
+    std::array<std::uint32_t, MaxPolygonVertexCount> neighbors {};
+    std::uint32_t vertexCount {};
+  };
+
+  struct Tile {
+    std::vector<Vec3f> vertices {};
+    std::vector<Polygon> polygons {};
+  };
+
+  NavMesh() = default;
+  /// Builds the navigation mesh of a mesh.
+  /// \param mesh Mesh to build the navigation mesh of, all its submeshes being taken into account.
+  /// \param settings Generation parameters.
+  explicit NavMesh(const Mesh& mesh, const NavMeshSettings& settings = NavMeshSettings()) { build(mesh, settings); }
+  /// Builds the navigation mesh of a set of triangles.
+  /// \param vertices Vertices of the triangles.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3.
+  /// \param settings Generation parameters.
+  NavMesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const NavMeshSettings& settings = NavMeshSettings()) {
+    build(vertices, indices, settings);
+  }
+
+  const NavMeshSettings& getSettings() const { return m_settings; }
+  /// Gets the tiles, ordered along the X axis first.
+  /// \return Tiles of the navigation mesh.
+  const std::vector<Tile>& getTiles() const { return m_tiles; }
+  std::size_t getTileCount() const { return m_tiles.size(); }
+  std::size_t getPolygonCount() const { return m_polygonCenters.size(); }
+  /// Gets the number of connections between polygons, each pair of adjacent polygons being connected in both directions.
+  /// \return Number of links.
+  std::size_t getLinkCount() const { return m_links.size(); }
+  bool isEmpty() const { return m_polygonCenters.empty(); }
+
+  /// Builds the navigation mesh of a mesh, replacing the current one.
+  /// \param mesh Mesh to build the navigation mesh of, all its submeshes being taken into account.
+  /// \param settings Generation parameters.
+  void build(const Mesh& mesh, const NavMeshSettings& settings = NavMeshSettings());
+  /// Builds the navigation mesh of a set of triangles, replacing the current one. Tiles cover the triangles' horizontal bounding box.
+  /// Triangles are expected to be in counter-clockwise order; those facing downwards are not walkable, but still block agents.
+  /// \param vertices Vertices of the triangles.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3. Any remaining index is ignored.
+  /// \param settings Generation parameters.
+  void build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const NavMeshSettings& settings = NavMeshSettings());
+  /// Rebuilds the tiles affected by a modification of the mesh it has been built from.
+  /// \param mesh Modified mesh.
+  /// \param area Box containing all the modifications, both before & after them.
+  /// \return Number of tiles rebuilt.
+  std::size_t rebuild(const Mesh& mesh, const AABB& area);
+  /// Rebuilds the tiles affected by a modification of the triangles it has been built from, then reconnects their polygons & their neighbors'.
+  /// Tiles keep their initial layout: any geometry added beyond the initial horizontal bounds is ignored.
+  /// \param vertices Vertices of the modified triangles.
+  /// \param indices Indices of the vertices forming the modified triangles, 3 by 3.
+  /// \param area Box containing all the modifications, both before & after them.
+  /// \return Number of tiles rebuilt.
+  std::size_t rebuild(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const AABB& area);
+  /// Computes the vertices of a polygon, in counter-clockwise order when seen from above.
+  /// \param polygonIndex Index of the polygon in the whole mesh, tiles' polygons following each other.
+  /// \return Positions of the polygon's vertices.
+  std::vector<Vec3f> computePolygonVertices(std::size_t polygonIndex) const;
+
+private:
+  /// Connection from a polygon to an adjacent one, through a portal.
+  /// The portal's left & right ends are seen from the polygon the link starts from, looking towards the adjacent one.
+  struct Link {
+    std::uint32_t polygonIndex {};
+    Vec3f leftPos {};
+    Vec3f rightPos {};
+  };
+
+  /// Builds the tiles of the given indices in parallel from the triangles overlapping them.
+  void buildTiles(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<std::size_t>& tileIndices);
+  /// Gathers the tiles' polygons & connects them, within tiles & across their borders.
+  /// Only the rebuilt tiles & their direct neighbors are relinked; the other tiles' polygons & links are kept.
+  /// \param rebuiltTileIndices Indices of the tiles which have been rebuilt since the last call.
+  void linkTiles(const std::vector<std::size_t>& rebuiltTileIndices);
+  /// Calls a function on each link starting from a polygon, in a deterministic order.
+  template <typename LinkFunc> void forEachLink(std::size_t tileIndex, std::size_t polygonIndex, LinkFunc&& linkFunc) const;
+
+  NavMeshSettings m_settings {};
+  Vec3f m_minBounds {};
+  std::size_t m_tileCountX {};
+  std::size_t m_tileCountZ {};
+  std::vector<Tile> m_tiles {};
+
+  /// Index of each tile's first polygon in the whole mesh, followed by the polygon count.
+  std::vector<std::uint32_t> m_tilePolygonOffsets {};
+  std::vector<Vec3f> m_polygonCenters {};
+  std::vector<Vec3f> m_polygonMinBounds {};
+  std::vector<Vec3f> m_polygonMaxBounds {};
+  /// Index of each polygon's first link, followed by the link count.
+  std::vector<std::uint32_t> m_linkOffsets {};
+  std::vector<Link> m_links {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_NAVMESH_HPP
@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef RAZ_NAVMESHQUERY_HPP
+#define RAZ_NAVMESHQUERY_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class NavMesh;
+
+/// Path finder on a navigation mesh. Paths are searched with A* over the polygons' links, then straightened by string pulling.
+/// A query holds the search's nodes & open list, which are reused from one search to the next instead of being reallocated.
+/// Queries are thus not thread-safe, but are cheap to create: many agents can find their paths in parallel by having a query per thread.
+/// The navigation mesh must outlive the query, & must not be modified while searching.
+class NavMeshQuery {
+public:
+  explicit NavMeshQuery(const NavMesh& navMesh) : m_navMesh{ &navMesh } {}
+
+  const NavMesh& getNavMesh() const { return *m_navMesh; }
+
+  /// Finds the polygon closest to a point, searching in the tile containing it & the surrounding ones.
+  /// \param position Point to find the closest polygon of.
+  /// \param closestPos Point of the polygon closest to the given one.
+  /// \return Index of the closest polygon, or the navigation mesh's polygon count if there is none around.
+  std::size_t findClosestPolygon(const Vec3f& position, Vec3f& closestPos) const;
+  /// Finds the polygons crossed by the shortest path between two points.
+  /// \param startPolygon Index of the polygon containing the start.
+  /// \param startPos Start of the path.
+  /// \param endPolygon Index of the polygon containing the end.
+  /// \param endPos End of the path.
+  /// \param polygonPath Indices of the polygons crossed, from the start's to the end's. The list is cleared beforehand.
+  /// \return True if the end can be reached, false otherwise.
+  bool findPolygonPath(std::size_t startPolygon, const Vec3f& startPos, std::size_t endPolygon, const Vec3f& endPos, std::vector<std::size_t>& polygonPath);
+  /// Finds the shortest path between two points, turning only at the corners of the polygons crossed.
+  /// \param startPos Start of the path; the closest point on the navigation mesh is used.
+  /// \param endPos End of the path; the closest point on the navigation mesh is used.
+  /// \param path Points of the path, from start to end. The list is cleared beforehand.
+  /// \return True if a path has been found, false if either point is too far from the navigation mesh or if the end can't be reached.
+  bool findPath(const Vec3f& startPos, const Vec3f& endPos, std::vector<Vec3f>& path);
+
+private:
+  /// Search state of a polygon, reached at the middle of the portal it has been entered through.
+  struct Node {
+    Vec3f position {};
+    float cost {};
+    float totalCost {};
+    std::uint32_t parentPolygon {};
+    std::uint32_t parentLink {};
+    std::uint32_t heapIndex {};
+    /// Index of the search which last reached the node; nodes of any previous search are considered unvisited.
+    std::uint32_t searchIndex {};
+    bool isOpen {};
+  };
+
+  /// Searches the shortest sequence of links from a polygon to another with A*.
+  /// \return True if the end polygon can be reached, the links crossed being stored in order.
+  bool searchLinks(std::uint32_t startPolygon, const Vec3f& startPos, std::uint32_t endPolygon, const Vec3f& endPos);
+  void pushOpenNode(std::uint32_t polygonIndex);
+  std::uint32_t popOpenNode();
+  void moveUpOpenNode(std::uint32_t heapIndex);
+  void moveDownOpenNode(std::uint32_t heapIndex);
+
+  const NavMesh* m_navMesh {};
+
+  std::vector<Node> m_nodes {};
+  /// Polygons to be explored, as a binary heap ordered by their nodes' total cost.
+  std::vector<std::uint32_t> m_openHeap {};
+  std::uint32_t m_searchIndex = 0;
+  std::vector<std::uint32_t> m_pathLinks {};
+  /// Left & right ends of the portals to be crossed, the start & end being degenerate portals.
+  std::vector<std::pair<Vec3f, Vec3f>> m_portals {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_NAVMESHQUERY_HPP
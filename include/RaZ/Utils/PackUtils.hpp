@@ -0,0 +1,231 @@
+#pragma once
+
+#ifndef RAZ_PACKUTILS_HPP
+#define RAZ_PACKUTILS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Raz {
+
+class Vec3fArray;
+
+/// Conversions between 32-bit floats & compact numeric formats, to reduce the memory footprint of vertices, images or any serialized data.
+/// Normalized integers are rounded to the nearest value, ties to even, so that the scalar & batch functions give identical results.
+namespace PackUtils {
+
+/// Converts a float to an IEEE 754 half-precision float (binary16), rounding to the nearest representable value (ties to even).
+/// Values too large to be represented become infinite; NaNs are kept as quiet NaNs.
+/// \param value Float to be converted.
+/// \return Bits of the half-precision float.
+inline std::uint16_t packHalf(float value) {
+#if defined(__F16C__)
+  return static_cast<std::uint16_t>(_cvtss_sh(value, 0));
+#else
+  // Bit manipulations from https://gist.github.com/rygorous/2156668
+  constexpr std::uint32_t signMask          = 0x80000000u;
+  constexpr std::uint32_t floatInfinityBits = 255u << 23;
+  constexpr std::uint32_t halfOverflowBits  = (127u + 16u) << 23;
+  constexpr std::uint32_t halfNormalBits    = 113u << 23;
+  constexpr std::uint32_t denormMagicBits   = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+  std::uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+
+  const std::uint32_t sign = bits & signMask;
+  bits ^= sign;
+
+  std::uint16_t res {};
+
+  if (bits >= halfOverflowBits) { // Infinity or NaN
+    res = (bits > floatInfinityBits ? 0x7E00 : 0x7C00);
+  } else if (bits < halfNormalBits) { // Subnormal half or zero
+    // Adding a magic value aligns the 10 mantissa bits at the bottom of the float, the FPU taking care of the rounding
+    float absValue {};
+    std::memcpy(&absValue, &bits, sizeof(float));
+
+    float denormMagic {};
+    std::memcpy(&denormMagic, &denormMagicBits, sizeof(float));
+    absValue += denormMagic;
+
+    std::memcpy(&bits, &absValue, sizeof(float));
+    res = static_cast<std::uint16_t>(bits - denormMagicBits);
+  } else {
+    const std::uint32_t oddMantissa = (bits >> 13) & 1u;
+
+    // Rebiasing the exponent & rounding to nearest even; a carry from the mantissa correctly overflows into the exponent
+    bits += ((15u - 127u) << 23) + 0xFFFu + oddMantissa;
+    res = static_cast<std::uint16_t>(bits >> 13);
+  }
+
+  return static_cast<std::uint16_t>(res | (sign >> 16));
+#endif
+}
+
+/// Converts an IEEE 754 half-precision float (binary16) to a float. The conversion is exact.
+/// \param half Bits of the half-precision float.
+/// \return Converted float.
+inline float unpackHalf(std::uint16_t half) {
+#if defined(__F16C__)
+  return _cvtsh_ss(half);
+#else
+  constexpr std::uint32_t shiftedExponentMask = 0x7C00u << 13;
+  constexpr std::uint32_t magicBits           = 113u << 23;
+
+  std::uint32_t bits = static_cast<std::uint32_t>(half & 0x7FFFu) << 13;
+  const std::uint32_t exponent = bits & shiftedExponentMask;
+  bits += (127u - 15u) << 23;
+
+  if (exponent == shiftedExponentMask) { // Infinity or NaN
+    bits += (128u - 16u) << 23;
+  } else if (exponent == 0) { // Subnormal or zero, renormalized by the FPU
+    bits += 1u << 23;
+
+    float value {};
+    std::memcpy(&value, &bits, sizeof(float));
+
+    float magic {};
+    std::memcpy(&magic, &magicBits, sizeof(float));
+    value -= magic;
+
+    std::memcpy(&bits, &value, sizeof(float));
+  }
+
+  bits |= static_cast<std::uint32_t>(half & 0x8000u) << 16;
+
+  float res {};
+  std::memcpy(&res, &bits, sizeof(float));
+  return res;
+#endif
+}
+
+/// Converts a float in [-1; 1] to a signed normalized 8-bit integer; values outside of this range are clamped.
+/// \param value Float to be converted.
+/// \return Signed normalized integer, in [-127; 127].
+inline std::int8_t packSnorm8(float value) { return static_cast<std::int8_t>(std::nearbyint(std::min(std::max(value, -1.f), 1.f) * 127.f)); }
+
+/// Converts a signed normalized 8-bit integer to a float in [-1; 1].
+/// Both -128 & -127 map to -1, so that 0 can be exactly represented.
+/// \param value Signed normalized integer to be converted.
+/// \return Converted float.
+inline float unpackSnorm8(std::int8_t value) { return std::max(static_cast<float>(value) / 127.f, -1.f); }
+
+/// Converts a float in [-1; 1] to a signed normalized 16-bit integer; values outside of this range are clamped.
+/// \param value Float to be converted.
+/// \return Signed normalized integer, in [-32767; 32767].
+inline std::int16_t packSnorm16(float value) { return static_cast<std::int16_t>(std::nearbyint(std::min(std::max(value, -1.f), 1.f) * 32767.f)); }
+
+/// Converts a signed normalized 16-bit integer to a float in [-1; 1].
+/// Both -32768 & -32767 map to -1, so that 0 can be exactly represented.
+/// \param value Signed normalized integer to be converted.
+/// \return Converted float.
+inline float unpackSnorm16(std::int16_t value) { return std::max(static_cast<float>(value) / 32767.f, -1.f); }
+
+/// Converts a float in [0; 1] to an unsigned normalized 8-bit integer; values outside of this range are clamped.
+/// \param value Float to be converted.
+/// \return Unsigned normalized integer, in [0; 255].
+inline std::uint8_t packUnorm8(float value) { return static_cast<std::uint8_t>(std::nearbyint(std::min(std::max(value, 0.f), 1.f) * 255.f)); }
+
+/// Converts an unsigned normalized 8-bit integer to a float in [0; 1].
+/// \param value Unsigned normalized integer to be converted.
+/// \return Converted float.
+inline float unpackUnorm8(std::uint8_t value) { return static_cast<float>(value) / 255.f; }
+
+/// Converts a float in [0; 1] to an unsigned normalized 16-bit integer; values outside of this range are clamped.
+/// \param value Float to be converted.
+/// \return Unsigned normalized integer, in [0; 65535].
+inline std::uint16_t packUnorm16(float value) { return static_cast<std::uint16_t>(std::nearbyint(std::min(std::max(value, 0.f), 1.f) * 65535.f)); }
+
+/// Converts an unsigned normalized 16-bit integer to a float in [0; 1].
+/// \param value Unsigned normalized integer to be converted.
+/// \return Converted float.
+inline float unpackUnorm16(std::uint16_t value) { return static_cast<float>(value) / 65535.f; }
+
+/// Encodes a unit vector into 2 components, projecting it onto an octahedron which is then unfolded onto a square.
+/// See: http://jcgt.org/published/0003/02/01/
+/// \param normal Normalized vector to be encoded.
+/// \return Encoded vector, both components being in [-1; 1].
+inline Vec2f encodeOctahedral(const Vec3f& normal) {
+  const float l1Norm = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+
+  const float projX = normal[0] / l1Norm;
+  const float projY = normal[1] / l1Norm;
+
+  if (normal[2] >= 0.f)
+    return Vec2f({ projX, projY });
+
+  // Folding the lower hemisphere over the upper one's diagonals
+  return Vec2f({ (1.f - std::abs(projY)) * (projX >= 0.f ? 1.f : -1.f), (1.f - std::abs(projX)) * (projY >= 0.f ? 1.f : -1.f) });
+}
+
+/// Decodes a unit vector from its octahedral representation.
+/// \param encoded Encoded vector, both components being in [-1; 1].
+/// \return Decoded normalized vector.
+inline Vec3f decodeOctahedral(const Vec2f& encoded) {
+  Vec3f normal({ encoded[0], encoded[1], 1.f - std::abs(encoded[0]) - std::abs(encoded[1]) });
+
+  // Unfolding the lower hemisphere if needed
+  const float offset = std::max(-normal[2], 0.f);
+  normal[0] += (normal[0] >= 0.f ? -offset : offset);
+  normal[1] += (normal[1] >= 0.f ? -offset : offset);
+
+  return normal.normalize();
+}
+
+/// Packs a unit vector into 32 bits, encoding it as octahedral & storing both components as signed normalized 16-bit integers.
+/// The angular error is below 0.005 degree, which is enough for normals & tangents.
+/// \param normal Normalized vector to be packed.
+/// \return Packed vector, the first component being in the lowest bits.
+inline std::uint32_t packOctahedral(const Vec3f& normal) {
+  const Vec2f encoded = encodeOctahedral(normal);
+  return (static_cast<std::uint32_t>(static_cast<std::uint16_t>(packSnorm16(encoded[0])))
+        | static_cast<std::uint32_t>(static_cast<std::uint16_t>(packSnorm16(encoded[1]))) << 16);
+}
+
+/// Unpacks a unit vector previously packed with packOctahedral().
+/// \param packed Packed vector.
+/// \return Unpacked normalized vector.
+inline Vec3f unpackOctahedral(std::uint32_t packed) {
+  return decodeOctahedral(Vec2f({ unpackSnorm16(static_cast<std::int16_t>(packed & 0xFFFFu)),
+                                  unpackSnorm16(static_cast<std::int16_t>(packed >> 16)) }));
+}
+
+/// Converts floats to half-precision floats, using F16C instructions if available.
+/// \param values Floats to be converted.
+/// \param result Bits of the half-precision floats. Resized if necessary.
+void packHalves(const std::vector<float>& values, std::vector<std::uint16_t>& result);
+/// Converts half-precision floats to floats, using F16C instructions if available.
+/// \param halves Bits of the half-precision floats to be converted.
+/// \param result Converted floats. Resized if necessary.
+void unpackHalves(const std::vector<std::uint16_t>& halves, std::vector<float>& result);
+/// Converts floats in [-1; 1] to signed normalized 16-bit integers; values outside of this range are clamped.
+/// \param values Floats to be converted.
+/// \param result Signed normalized integers. Resized if necessary.
+void packSnorms16(const std::vector<float>& values, std::vector<std::int16_t>& result);
+/// Converts signed normalized 16-bit integers to floats in [-1; 1].
+/// \param values Signed normalized integers to be converted.
+/// \param result Converted floats. Resized if necessary.
+void unpackSnorms16(const std::vector<std::int16_t>& values, std::vector<float>& result);
+/// Packs unit vectors into 32 bits each, as with packOctahedral(). The octahedral encoding is made with SIMD instructions.
+/// \param normals Normalized vectors to be packed.
+/// \param result Packed vectors. Resized if necessary.
+void packOctahedrals(const Vec3fArray& normals, std::vector<std::uint32_t>& result);
+/// Unpacks unit vectors previously packed with packOctahedral() or packOctahedrals().
+/// \param packed Packed vectors.
+/// \param result Unpacked normalized vectors. Resized if necessary.
+void unpackOctahedrals(const std::vector<std::uint32_t>& packed, Vec3fArray& result);
+
+} // namespace PackUtils
+
+} // namespace Raz
+
+#endif // RAZ_PACKUTILS_HPP
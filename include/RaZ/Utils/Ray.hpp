@@ -3,18 +3,36 @@
 #ifndef RAZ_RAY_HPP
 #define RAZ_RAY_HPP
 
+#include <limits>
+
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
+/// Information about the intersection between a ray & a geometric element.
+/// The normal is the geometric one of the hit surface. The barycentric coordinates, relative to the second & third vertices,
+/// are only filled when a triangle has been hit, & the triangle index only when a triangle mesh has been hit.
+struct RayHit {
+  Vec3f position {};
+  Vec3f normal {};
+  float distance = std::numeric_limits<float>::max();
+  Vec2f barycentricCoords {};
+  std::size_t triangleIndex {};
+};
+
 /// Ray defined by an origin and a normalized direction.
+/// The inverse of the direction is precomputed, as it is needed by every ray-box test.
 class Ray {
 public:
-  Ray(const Vec3f& origin, const Vec3f& direction) : m_origin{ origin }, m_direction{ direction } {}
+  Ray(const Vec3f& origin, const Vec3f& direction)
+    : m_origin{ origin },
+      m_direction{ direction },
+      m_invDirection({ 1.f / direction[0], 1.f / direction[1], 1.f / direction[2] }) {}
 
   const Vec3f& getOrigin() const { return m_origin; }
   const Vec3f& getDirection() const { return m_direction; }
+  const Vec3f& getInverseDirection() const { return m_invDirection; }
 
   /// Ray-point intersection check.
   /// \param point Point to check if there is an intersection with.
@@ -46,6 +64,48 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if the ray intersects the AABB, false otherwise.
   bool intersects(const AABB& aabb) const;
+  /// Ray-line intersection computation.
+  /// The normal is perpendicular to the line & points towards the ray's origin, or opposes the ray's direction if both are aligned.
+  /// \param line Line to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the line within the given distance, false otherwise.
+  bool intersect(const Line& line, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-plane intersection computation.
+  /// The normal is the plane's one, whichever side has been hit.
+  /// \param plane Plane to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the plane within the given distance, false otherwise.
+  bool intersect(const Plane& plane, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-sphere intersection computation.
+  /// If the ray's origin is inside the sphere, the hit is located where the ray exits it. The normal always points outwards.
+  /// \param sphere Sphere to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the sphere within the given distance, false otherwise.
+  bool intersect(const Sphere& sphere, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-triangle intersection computation.
+  /// The normal follows the triangle's winding order, & the barycentric coordinates are filled.
+  /// \param triangle Triangle to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the triangle within the given distance, false otherwise.
+  bool intersect(const Triangle& triangle, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-quad intersection computation.
+  /// The quad is considered as two triangles, split along its left top to right bottom diagonal; the normal follows its winding order.
+  /// \param quad Quad to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the quad within the given distance, false otherwise.
+  bool intersect(const Quad& quad, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-AABB intersection computation.
+  /// If the ray's origin is inside the box, the hit is located where the ray exits it. The normal is the hit face's outward one.
+  /// \param aabb AABB to compute the intersection with.
+  /// \param hit Information about the hit. Left untouched if there is no intersection.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if the ray intersects the AABB within the given distance, false otherwise.
+  bool intersect(const AABB& aabb, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
   /// Computes the projection of a point (closest point) onto the ray.
   /// The projected point is necessarily located between the ray's origin and towards infinity in the ray's direction.
   /// \param point Point to compute the projection from.
@@ -55,6 +115,7 @@ public:
 private:
   Vec3f m_origin {};
   Vec3f m_direction {};
+  Vec3f m_invDirection {};
 };
 
 } // namespace Raz
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef RAZ_RAYPACKET_HPP
+#define RAZ_RAYPACKET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "RaZ/Utils/Ray.hpp"
+
+namespace Raz {
+
+/// Group of rays cast together, stored as a structure of arrays so that all of them can be tested at once with SIMD instructions.
+/// A 4-ray packet uses SSE, an 8-ray one AVX if available (2 SSE registers otherwise); without any, rays are tested one by one.
+/// Packets are most efficient when their rays are coherent, having close origins & directions (picking a screen region, baking, ...).
+/// \tparam Size Number of rays in the packet; only 4 & 8 are supported.
+template <std::size_t Size>
+class RayPacket {
+  static_assert(Size == 4 || Size == 8, "Error: A ray packet can only contain 4 or 8 rays.");
+
+public:
+  using Distances = std::array<float, Size>;
+
+  RayPacket() = default;
+  explicit RayPacket(const std::array<Ray, Size>& rays);
+
+  static constexpr std::size_t getSize() { return Size; }
+  const std::array<float, Size>& getOriginsX() const { return m_originsX; }
+  const std::array<float, Size>& getOriginsY() const { return m_originsY; }
+  const std::array<float, Size>& getOriginsZ() const { return m_originsZ; }
+  const std::array<float, Size>& getDirectionsX() const { return m_directionsX; }
+  const std::array<float, Size>& getDirectionsY() const { return m_directionsY; }
+  const std::array<float, Size>& getDirectionsZ() const { return m_directionsZ; }
+  Ray getRay(std::size_t index) const;
+
+  /// Replaces a ray of the packet, precomputing its inverse direction.
+  /// \param index Index of the ray to be replaced.
+  /// \param ray New ray.
+  void setRay(std::size_t index, const Ray& ray);
+  /// Ray packet-AABB intersection check, using the slab method.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param entryDistances Distances from each ray's origin to its entry point in the box, 0 if it starts inside. Only set for hit rays.
+  /// \return Mask of the rays hitting the box, the N-th bit being set if the N-th ray does.
+  std::uint32_t intersects(const AABB& aabb, Distances& entryDistances) const;
+  /// Ray packet-AABB intersection check, using the slab method.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param maxDistances Distances from each ray's origin beyond which the box is considered missed.
+  /// \param entryDistances Distances from each ray's origin to its entry point in the box, 0 if it starts inside. Only set for hit rays.
+  /// \return Mask of the rays hitting the box within their maximum distance, the N-th bit being set if the N-th ray does.
+  std::uint32_t intersects(const AABB& aabb, const Distances& maxDistances, Distances& entryDistances) const;
+  /// Ray packet-triangle intersection computation, using the Möller-Trumbore algorithm.
+  /// Meant to find the closest hits among several triangles: only the hits closer than the given distances are kept.
+  /// \param triangle Triangle to compute the intersection with.
+  /// \param distances Current closest hit distances, replaced by the new ones for the rays hitting the triangle closer.
+  /// \return Mask of the rays hitting the triangle closer than their given distance, the N-th bit being set if the N-th ray does.
+  std::uint32_t intersect(const Triangle& triangle, Distances& distances) const;
+
+private:
+  std::array<float, Size> m_originsX {};
+  std::array<float, Size> m_originsY {};
+  std::array<float, Size> m_originsZ {};
+  std::array<float, Size> m_directionsX {};
+  std::array<float, Size> m_directionsY {};
+  std::array<float, Size> m_directionsZ {};
+  std::array<float, Size> m_invDirectionsX {};
+  std::array<float, Size> m_invDirectionsY {};
+  std::array<float, Size> m_invDirectionsZ {};
+};
+
+using RayPacket4 = RayPacket<4>;
+using RayPacket8 = RayPacket<8>;
+
+extern template class RayPacket<4>;
+extern template class RayPacket<8>;
+
+} // namespace Raz
+
+#endif // RAZ_RAYPACKET_HPP
@@ -4,6 +4,7 @@
 #define RAZ_SHAPE_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 
 namespace Raz {
@@ -49,6 +50,11 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
   virtual Vec3f computeProjection(const Vec3f& point) const = 0;
+  /// Computes the shape's support point, which is its furthest point in a given direction.
+  /// Convex shapes being entirely described by this function, it is all that GJK needs to check their intersection (see Gjk.hpp).
+  /// \param direction Direction in which to find the furthest point. Doesn't need to be normalized.
+  /// \return Computed support point.
+  virtual Vec3f computeSupportPoint(const Vec3f& direction) const = 0;
   /// Computes the shape's centroid.
   /// \return Computed centroid.
   virtual Vec3f computeCentroid() const = 0;
@@ -95,6 +101,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the line.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the line's support point, which is the extremity the furthest in the given direction.
+  /// \param direction Direction in which to find the furthest point.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the line's centroid, which is the point lying directly between the two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_beginPos + m_endPos) / 2.f; }
@@ -157,6 +167,8 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the plane.
   Vec3f computeProjection(const Vec3f& point) const override { return point - m_normal * (m_normal.dot(point) - m_distance); }
+  /// A plane being infinite, it has no support point; this function always throws.
+  Vec3f computeSupportPoint(const Vec3f&) const override { throw std::runtime_error("Error: A plane has no support point."); }
   /// Computes the plane's centroid, which is the point lying onto the plane at its distance from the center in its normal direction.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_normal * m_distance; }
@@ -207,6 +219,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto/into the sphere.
   Vec3f computeProjection(const Vec3f& point) const override { return (point - m_centerPos).normalize() * m_radius + m_centerPos; }
+  /// Computes the sphere's support point, which is the point of its surface in the given direction from its center.
+  /// \param direction Direction in which to find the furthest point.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the sphere's centroid, which is its center. Strictly equivalent to getCenterPos().
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_centerPos; }
@@ -242,7 +258,7 @@ public:
   /// \param sphere Sphere to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const Sphere& sphere) const override { return sphere.intersects(*this); }
-  /// Triangle-triangle intersection check.
+  /// Triangle-triangle intersection check, using Möller's interval overlap test.
   /// \param triangle Triangle to check if there is an intersection with.
   /// \return True if both triangles intersect each other, false otherwise.
   bool intersects(const Triangle& triangle) const override;
@@ -259,6 +275,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the triangle.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the triangle's support point, which is the vertex the furthest in the given direction.
+  /// \param direction Direction in which to find the furthest point.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the triangle's centroid, which is the point lying directly between its three points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_firstPos + m_secondPos + m_thirdPos) / 3.f; }
@@ -313,6 +333,11 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the quad.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the quad's support point, which is the vertex the furthest in the given direction.
+  /// The quad is assumed to be planar & convex.
+  /// \param direction Direction in which to find the furthest point.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the quad's centroid, which is the point lying directly between its four points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_leftTopPos + m_rightTopPos + m_rightBottomPos + m_leftBottomPos) / 4.f; }
@@ -392,6 +417,10 @@ public:
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
   Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the AABB's support point, which is the corner the furthest in the given direction.
+  /// \param direction Direction in which to find the furthest point.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the AABB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_rightTopFrontPos + m_leftBottomBackPos) / 2.f; }
@@ -409,6 +438,11 @@ public:
   ///       -----------------------
   /// \return AABB's half extents.
   Vec3f computeHalfExtents() const { return (m_rightTopFrontPos - m_leftBottomBackPos) / 2.f; }
+  /// Computes the box enclosing this one once transformed, such as to get an entity's world bounds from its local ones.
+  /// The result is exact for translations & scales; with rotations, it is the tightest axis-aligned box around the transformed one.
+  /// \param transform Transformation matrix, applied on the right of row vectors (as Transform::getTransformMatrix()).
+  /// \return Transformed AABB.
+  AABB computeTransformed(const Mat4f& transform) const;
 
 private:
   Vec3f m_rightTopFrontPos {};
@@ -0,0 +1,129 @@
+#pragma once
+
+#ifndef RAZ_SHAPEARRAY_HPP
+#define RAZ_SHAPEARRAY_HPP
+
+#include <array>
+#include <vector>
+
+#include "RaZ/Utils/BitMask.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Array of axis-aligned boxes, stored as separate streams of each of their bounds' components (structure of arrays).
+/// This layout allows the batch intersection functions to test several boxes at once with SIMD instructions.
+class AABBArray {
+public:
+  AABBArray() = default;
+  explicit AABBArray(std::size_t size) { resize(size); }
+  explicit AABBArray(const std::vector<AABB>& aabbs);
+
+  std::size_t getSize() const { return m_minX.size(); }
+  const std::vector<float>& getMinX() const { return m_minX; }
+  const std::vector<float>& getMinY() const { return m_minY; }
+  const std::vector<float>& getMinZ() const { return m_minZ; }
+  const std::vector<float>& getMaxX() const { return m_maxX; }
+  const std::vector<float>& getMaxY() const { return m_maxY; }
+  const std::vector<float>& getMaxZ() const { return m_maxZ; }
+
+  bool isEmpty() const { return m_minX.empty(); }
+  void resize(std::size_t size);
+  void reserve(std::size_t size);
+  void clear() { resize(0); }
+  void add(const AABB& aabb);
+  void set(std::size_t index, const AABB& aabb);
+
+  /// Element fetching operator given its index.
+  /// Since the components are stored separately, the box is recomposed & returned by value.
+  /// \param index Element's index.
+  /// \return Recomposed box.
+  AABB operator[](std::size_t index) const {
+    return AABB(Vec3f({ m_maxX[index], m_maxY[index], m_maxZ[index] }), Vec3f({ m_minX[index], m_minY[index], m_minZ[index] }));
+  }
+
+private:
+  std::vector<float> m_minX {};
+  std::vector<float> m_minY {};
+  std::vector<float> m_minZ {};
+  std::vector<float> m_maxX {};
+  std::vector<float> m_maxY {};
+  std::vector<float> m_maxZ {};
+};
+
+/// Array of spheres, stored as separate streams of their centers' components & radii (structure of arrays).
+/// This layout allows the batch intersection functions to test several spheres at once with SIMD instructions.
+class SphereArray {
+public:
+  SphereArray() = default;
+  explicit SphereArray(std::size_t size) { resize(size); }
+  explicit SphereArray(const std::vector<Sphere>& spheres);
+
+  std::size_t getSize() const { return m_centerX.size(); }
+  const std::vector<float>& getCenterX() const { return m_centerX; }
+  const std::vector<float>& getCenterY() const { return m_centerY; }
+  const std::vector<float>& getCenterZ() const { return m_centerZ; }
+  const std::vector<float>& getRadii() const { return m_radii; }
+
+  bool isEmpty() const { return m_centerX.empty(); }
+  void resize(std::size_t size);
+  void reserve(std::size_t size);
+  void clear() { resize(0); }
+  void add(const Sphere& sphere);
+  void set(std::size_t index, const Sphere& sphere);
+
+  /// Element fetching operator given its index.
+  /// Since the components are stored separately, the sphere is recomposed & returned by value.
+  /// \param index Element's index.
+  /// \return Recomposed sphere.
+  Sphere operator[](std::size_t index) const { return Sphere(Vec3f({ m_centerX[index], m_centerY[index], m_centerZ[index] }), m_radii[index]); }
+
+private:
+  std::vector<float> m_centerX {};
+  std::vector<float> m_centerY {};
+  std::vector<float> m_centerZ {};
+  std::vector<float> m_radii {};
+};
+
+/// Batch intersection functions, testing one shape against a whole array of others at once.
+/// Each element's result gives the same answer as the matching Shape::intersects() overload, touching shapes being considered intersecting.
+/// The result masks are resized to the arrays' size, the bit of each intersecting element being enabled.
+namespace Batch {
+
+/// Checks which boxes intersect a sphere.
+/// \param sphere Sphere to be checked.
+/// \param aabbs Boxes to be checked against the sphere.
+/// \param result Mask of the intersecting boxes.
+void intersects(const Sphere& sphere, const AABBArray& aabbs, BitMask& result);
+/// Checks which spheres intersect a sphere.
+/// \param sphere Sphere to be checked.
+/// \param spheres Spheres to be checked against the sphere.
+/// \param result Mask of the intersecting spheres.
+void intersects(const Sphere& sphere, const SphereArray& spheres, BitMask& result);
+/// Checks which boxes intersect a box.
+/// \param aabb Box to be checked.
+/// \param aabbs Boxes to be checked against the box.
+/// \param result Mask of the intersecting boxes.
+void intersects(const AABB& aabb, const AABBArray& aabbs, BitMask& result);
+/// Checks which spheres intersect a box.
+/// \param aabb Box to be checked.
+/// \param spheres Spheres to be checked against the box.
+/// \param result Mask of the intersecting spheres.
+void intersects(const AABB& aabb, const SphereArray& spheres, BitMask& result);
+/// Checks which boxes are at least partly inside a frustum. As a box is only rejected if entirely behind one of the planes,
+/// a few boxes outside of the frustum near its corners may be reported as intersecting; none inside it can be missed.
+/// \param frustumPlanes Planes bounding the frustum, whose normals point inwards (see Camera::computeFrustumPlanes()).
+/// \param aabbs Boxes to be checked against the frustum.
+/// \param result Mask of the boxes which may be inside the frustum.
+void intersects(const std::array<Plane, 6>& frustumPlanes, const AABBArray& aabbs, BitMask& result);
+/// Checks which spheres are at least partly inside a frustum, with the same conservative test as for boxes.
+/// \param frustumPlanes Planes bounding the frustum, whose normals point inwards (see Camera::computeFrustumPlanes()).
+/// \param spheres Spheres to be checked against the frustum.
+/// \param result Mask of the spheres which may be inside the frustum.
+void intersects(const std::array<Plane, 6>& frustumPlanes, const SphereArray& spheres, BitMask& result);
+
+} // namespace Batch
+
+} // namespace Raz
+
+#endif // RAZ_SHAPEARRAY_HPP
@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef RAZ_SIGNEDDISTANCEFIELD_HPP
+#define RAZ_SIGNEDDISTANCEFIELD_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "RaZ/Math/Batch.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+class Mesh;
+
+/// Grid of signed distances to a closed mesh, negative inside of it, allowing distances & normals to be queried in constant time.
+/// The grid is made of bricks of BrickSize^3 cells. The distances at all bricks' corners are always stored, forming a coarse grid;
+///  only the bricks near the surface also store the distances at each of their cells' corners, the others being interpolated from the former.
+/// Distances are computed with a TriangleBvh; their sign is given by the angle-weighted pseudonormal of the closest feature (face, edge
+///  or vertex), which is reliable for closed meshes. Open meshes are handled, but their sign may flip around their borders.
+/// Any distance is trilinearly interpolated from the 8 corners of the cell containing the point; points outside of the grid are
+///  projected onto it, their distance to the grid being added.
+class SignedDistanceField {
+public:
+  static constexpr std::size_t BrickSize = 8;
+
+  SignedDistanceField() = default;
+  /// Bakes the distance field of a mesh.
+  /// \param mesh Mesh to bake the distance field of, all its submeshes being taken into account.
+  /// \param cellSize Size of the grid's cells. The smaller, the more precise, but the more memory is needed.
+  /// \param bandWidth Distance to the surface within which bricks are stored at full resolution, on top of those the surface crosses.
+  SignedDistanceField(const Mesh& mesh, float cellSize, float bandWidth = 0.f) { bake(mesh, cellSize, bandWidth); }
+  /// Bakes the distance field of a set of triangles.
+  /// \param vertices Vertices of the triangles.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3.
+  /// \param cellSize Size of the grid's cells.
+  /// \param bandWidth Distance to the surface within which bricks are stored at full resolution, on top of those the surface crosses.
+  SignedDistanceField(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, float cellSize, float bandWidth = 0.f) {
+    bake(vertices, indices, cellSize, bandWidth);
+  }
+
+  const Vec3f& getMinBounds() const { return m_minBounds; }
+  Vec3f getMaxBounds() const;
+  float getCellSize() const { return m_cellSize; }
+  /// Gets the number of cells along each axis, always a multiple of BrickSize.
+  /// \return Grid's resolution.
+  const std::array<std::size_t, 3>& getCellCounts() const { return m_cellCounts; }
+  std::size_t getBrickCount() const { return m_brickIndices.size(); }
+  /// Gets the number of bricks stored at full resolution.
+  /// \return Number of fine bricks.
+  std::size_t getFineBrickCount() const { return m_brickDistances.size() / BrickSampleCount; }
+  bool isEmpty() const { return m_brickIndices.empty(); }
+
+  /// Bakes the distance field of a mesh, replacing the current one.
+  /// \param mesh Mesh to bake the distance field of, all its submeshes being taken into account.
+  /// \param cellSize Size of the grid's cells. Must be strictly positive.
+  /// \param bandWidth Distance to the surface within which bricks are stored at full resolution, on top of those the surface crosses.
+  void bake(const Mesh& mesh, float cellSize, float bandWidth = 0.f);
+  /// Bakes the distance field of a set of triangles, replacing the current one.
+  /// The grid covers the triangles' bounding box, expanded by the band width & a cell on each side.
+  /// \param vertices Vertices of the triangles.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3. Any remaining index is ignored.
+  /// \param cellSize Size of the grid's cells. Must be strictly positive.
+  /// \param bandWidth Distance to the surface within which bricks are stored at full resolution, on top of those the surface crosses.
+  void bake(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, float cellSize, float bandWidth = 0.f);
+  /// Computes the signed distance from a point to the surface.
+  /// \param point Point to compute the distance from.
+  /// \return Interpolated signed distance, negative if inside of the mesh; the maximal float value if the field is empty.
+  float computeDistance(const Vec3f& point) const;
+  /// Computes the signed distance from a point to the surface, along with the surface's normal, which is the field's gradient.
+  /// \param point Point to compute the distance & normal from.
+  /// \param normal Normalized gradient of the field at the given point, pointing away from the surface; null where the field is flat.
+  /// \return Interpolated signed distance, negative if inside of the mesh; the maximal float value if the field is empty.
+  float computeDistance(const Vec3f& point, Vec3f& normal) const;
+  /// Computes the normal of the surface closest to a point, which is the field's normalized gradient.
+  /// \param point Point to compute the normal from.
+  /// \return Normal pointing away from the surface; null where the field is flat or empty.
+  Vec3f computeNormal(const Vec3f& point) const;
+  /// Computes the signed distances from several points at once, with SIMD instructions.
+  /// \param points Points to compute the distance from.
+  /// \param distances Signed distances, resized to the number of points.
+  void computeDistances(const Vec3fArray& points, std::vector<float>& distances) const;
+  /// Computes the signed distances from several points at once, along with the surface's normals, with SIMD instructions.
+  /// \param points Points to compute the distance from.
+  /// \param distances Signed distances, resized to the number of points.
+  /// \param normals Normalized gradients of the field, resized to the number of points.
+  void computeDistances(const Vec3fArray& points, std::vector<float>& distances, Vec3fArray& normals) const;
+
+private:
+  static constexpr std::size_t BrickSampleCount = (BrickSize + 1) * (BrickSize + 1) * (BrickSize + 1);
+
+  /// Recovers the distances at the 8 corners of a cell, in the order of increasing X, then Y, then Z.
+  /// \param cellX Cell's X index.
+  /// \param cellY Cell's Y index.
+  /// \param cellZ Cell's Z index.
+  /// \param distances Distances at the cell's corners.
+  void fetchCellDistances(std::size_t cellX, std::size_t cellY, std::size_t cellZ, std::array<float, 8>& distances) const;
+  float sample(const Vec3f& point, Vec3f* gradient) const;
+  void sampleBatch(const Vec3fArray& points, std::vector<float>& distances, Vec3fArray* normals) const;
+
+  Vec3f m_minBounds {};
+  float m_cellSize {};
+  float m_invCellSize {};
+  std::array<std::size_t, 3> m_cellCounts {};
+  std::array<std::size_t, 3> m_brickCounts {};
+  /// Distances at the corners of all bricks, X-major.
+  std::vector<float> m_coarseDistances {};
+  /// Index of each brick's fine distances, or the maximal index if only interpolated from the coarse ones.
+  std::vector<std::uint32_t> m_brickIndices {};
+  /// Distances at all cells' corners of the fine bricks, BrickSampleCount per brick, X-major.
+  std::vector<float> m_brickDistances {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_SIGNEDDISTANCEFIELD_HPP
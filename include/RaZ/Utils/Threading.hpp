@@ -0,0 +1,47 @@
+#pragma once
+
+#ifndef RAZ_THREADING_HPP
+#define RAZ_THREADING_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+
+namespace Raz {
+
+namespace Threading {
+
+/// Gets the number of threads the system can run concurrently.
+/// \return Number of concurrent threads; at least 1, even if the system can't tell.
+unsigned int getSystemThreadCount();
+
+/// Calls a function in parallel over a range of indices, split into contiguous chunks of roughly equal size.
+/// The chunks are executed by a pool of threads created once for the whole program, the calling thread processing the last chunk itself &
+///  helping with the others until all have been processed. If any chunk throws an exception, the first one is rethrown once all have completed.
+/// \param beginIndex First index of the range.
+/// \param endIndex Index past the last one of the range.
+/// \param action Function to be called for each chunk, taking the chunk's first index & the index past its last one.
+/// \param threadCount Maximum number of chunks the range is split into, thus of threads used at once. If 0, the system's thread count is used.
+void parallelize(std::size_t beginIndex, std::size_t endIndex,
+                 const std::function<void(std::size_t, std::size_t)>& action,
+                 unsigned int threadCount = 0);
+
+/// Calls a function in parallel for each index of a range, each thread fetching the next unprocessed index as soon as it is done with one.
+/// Unlike parallelize(), which assigns fixed chunks, this balances the load when indices take very uneven times to be processed, at the cost
+///  of an atomic increment per index. The calling thread takes part in the processing; the first exception thrown by any call is rethrown.
+/// \param indexCount Number of indices to be processed, from 0 to the one before it.
+/// \param action Function to be called for each index, taking the index & that of the thread calling it, lower than the thread count.
+///   Per-thread data can thus be accessed without synchronization.
+/// \param threadCount Maximum number of threads to be used at once. If 0, the system's thread count is used.
+void parallelizeDynamic(std::size_t indexCount, const std::function<void(std::size_t, std::size_t)>& action, unsigned int threadCount = 0);
+
+/// Calls each given function in parallel on the thread pool, the last one being executed by the calling thread.
+/// This function returns once all the given functions have returned, rethrowing the first exception thrown by any of them.
+/// \param actions Functions to be called in parallel.
+void parallelize(std::initializer_list<std::function<void()>> actions);
+
+} // namespace Threading
+
+} // namespace Raz
+
+#endif // RAZ_THREADING_HPP
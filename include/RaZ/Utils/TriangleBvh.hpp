@@ -0,0 +1,138 @@
+#pragma once
+
+#ifndef RAZ_TRIANGLEBVH_HPP
+#define RAZ_TRIANGLEBVH_HPP
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/Ray.hpp"
+
+namespace Raz {
+
+class AABB;
+class Sphere;
+class Submesh;
+
+/// Bounding volume hierarchy over the triangles of a mesh, allowing rays to be cast against it in logarithmic time.
+/// Two hierarchies can also be checked against each other, traversing both simultaneously to find their intersecting triangles.
+/// The hierarchy is built top-down with a binned surface area heuristic (SAH), the biggest subtrees being built in parallel.
+class TriangleBvh {
+public:
+  /// Node of the hierarchy, packed into 32 bytes so that two of them fit into a cache line.
+  /// Nodes are stored in depth-first order: an inner node's left child immediately follows it, & its right child's index is stored.
+  /// A leaf stores the index of its first triangle instead, its triangles being contiguous.
+  struct Node {
+    Vec3f minBounds {};
+    std::uint32_t offset {};
+    Vec3f maxBounds {};
+    std::uint32_t triangleCount {};
+
+    bool isLeaf() const { return (triangleCount > 0); }
+  };
+
+  /// Triangle stored in the hierarchy's order, with its edges precomputed for the intersection tests.
+  struct Triangle {
+    Vec3f firstPos {};
+    Vec3f firstEdge {};
+    Vec3f secondEdge {};
+    std::uint32_t index {};
+  };
+
+  /// Point of the hierarchy's triangles closest to a given position.
+  struct ClosestPoint {
+    Vec3f position {};
+    float distance = std::numeric_limits<float>::max();
+    /// Index of the triangle on which the point lies, in the order of the indices the hierarchy has been built from.
+    std::size_t triangleIndex {};
+  };
+
+  /// First contact of a shape moving along a displacement with the hierarchy's triangles.
+  struct SweepHit {
+    /// Fraction of the displacement travelled before the contact, between 0 & 1. It is 0 if the shape initially overlaps a triangle.
+    float time = std::numeric_limits<float>::max();
+    /// Normalized contact normal, pointing from the triangle towards the shape.
+    Vec3f normal {};
+    /// Index of the triangle touched, in the order of the indices the hierarchy has been built from.
+    std::size_t triangleIndex {};
+  };
+
+  /// Indices of two intersecting triangles, the first one from this hierarchy & the second one from the other, in the order of the indices
+  /// each hierarchy has been built from.
+  using TrianglePair = std::pair<std::size_t, std::size_t>;
+
+  TriangleBvh() = default;
+  TriangleBvh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) { build(vertices, indices); }
+  explicit TriangleBvh(const Submesh& submesh);
+
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+  const std::vector<Triangle>& getTriangles() const { return m_triangles; }
+  std::size_t getTriangleCount() const { return m_triangles.size(); }
+  bool isEmpty() const { return m_nodes.empty(); }
+
+  /// Builds the hierarchy over the given triangles, replacing any previous one.
+  /// \param vertices Vertices of the mesh.
+  /// \param indices Indices of the vertices forming the triangles, 3 by 3. Any remaining index is ignored.
+  void build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+  /// Checks if the ray hits any triangle of the hierarchy, stopping as soon as one is found.
+  /// This is cheaper than intersect() when the closest hit is not needed, such as for line of sight or shadow queries.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if a triangle is hit within the given distance, false otherwise.
+  bool intersects(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the closest triangle hit by the ray.
+  /// \param ray Ray to be cast.
+  /// \param hit Information about the closest hit. Left untouched if nothing has been hit.
+  /// \param maxDistance Distance from the ray's origin beyond which hits are ignored.
+  /// \return True if a triangle is hit within the given distance, false otherwise.
+  bool intersect(const Ray& ray, RayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the point of the triangles closest to a given position.
+  /// Any known upper bound of the distance, such as the distance to the closest vertex given by a KdTree, greatly speeds up the search.
+  /// \param position Position to find the closest point of.
+  /// \param closestPoint Closest point found. Left untouched if none has been found.
+  /// \param maxDistance Distance from the position beyond which triangles are ignored.
+  /// \return True if a point has been found within the given distance, false otherwise.
+  bool findClosestPoint(const Vec3f& position, ClosestPoint& closestPoint, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the first triangle touched by a sphere moving along a straight line, so that fast objects cannot tunnel through thin geometry.
+  /// The sphere's center at the time of impact is `center + displacement * time`, & the contact point lies `radius` away along -normal.
+  /// Triangles the sphere initially overlaps are hit at time 0, unless it moves away from them, so that it can always escape them.
+  /// \param sphere Sphere at the beginning of its movement.
+  /// \param displacement Movement of the sphere.
+  /// \param hit Information about the first contact. Left untouched if nothing has been hit.
+  /// \return True if a triangle is touched along the displacement, false otherwise.
+  bool sweep(const Sphere& sphere, const Vec3f& displacement, SweepHit& hit) const;
+  /// Finds the first triangle touched by an axis-aligned box moving along a straight line.
+  /// The time of impact is exactly found with the separating axis theorem, applied over time on the 13 axes able to separate them.
+  /// Triangles the box initially overlaps are hit at time 0 with the normal of least penetration, unless it moves away from them.
+  /// \param box Box at the beginning of its movement.
+  /// \param displacement Movement of the box.
+  /// \param hit Information about the first contact. Left untouched if nothing has been hit.
+  /// \return True if a triangle is touched along the displacement, false otherwise.
+  bool sweep(const AABB& box, const Vec3f& displacement, SweepHit& hit) const;
+  /// Checks if any triangle of another hierarchy intersects any of this one, stopping as soon as one pair is found.
+  /// The hierarchies are traversed simultaneously, the node pairs near the roots being split into subtrees checked in parallel.
+  /// \param bvh Other hierarchy to be checked against.
+  /// \param transform Transformation from the other hierarchy's space into this one's, applied on the right of row vectors.
+  ///   Given both meshes' model matrices, this is `otherModel * thisModel.inverse()`.
+  /// \return True if both hierarchies intersect each other, false otherwise.
+  bool intersects(const TriangleBvh& bvh, const Mat4f& transform = Mat4f::identity()) const;
+  /// Finds all pairs of intersecting triangles between this hierarchy & another one.
+  /// \param bvh Other hierarchy to be checked against.
+  /// \param trianglePairs Pairs of intersecting triangles, sorted by their first then second index. The list is cleared beforehand.
+  /// \param transform Transformation from the other hierarchy's space into this one's, applied on the right of row vectors.
+  /// \return True if any pair has been found, false otherwise.
+  bool intersect(const TriangleBvh& bvh, std::vector<TrianglePair>& trianglePairs, const Mat4f& transform = Mat4f::identity()) const;
+
+private:
+  std::vector<Node> m_nodes {};
+  std::vector<Triangle> m_triangles {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_TRIANGLEBVH_HPP
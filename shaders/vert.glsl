@@ -6,6 +6,7 @@ layout (location = 2) in vec3 vertNormal;
 layout (location = 3) in vec3 vertTangent;
 
 uniform mat4 uniModelMatrix;
+uniform mat4 uniNormalMatrix;
 uniform mat4 uniMvpMatrix;
 
 out MeshInfo {
@@ -18,10 +19,8 @@ void main() {
   fragMeshInfo.vertPosition  = (uniModelMatrix * vec4(vertPosition, 1.0)).xyz;
   fragMeshInfo.vertTexcoords = vertTexcoords;
 
-  mat3 modelMat = mat3(uniModelMatrix);
-
-  vec3 tangent   = normalize(modelMat * vertTangent);
-  vec3 normal    = normalize(modelMat * vertNormal);
+  vec3 tangent   = normalize(mat3(uniModelMatrix) * vertTangent);
+  vec3 normal    = normalize(mat3(uniNormalMatrix) * vertNormal);
   vec3 bitangent = cross(normal, tangent);
   fragMeshInfo.vertTBNMatrix = mat3(tangent, bitangent, normal);
 
@@ -0,0 +1,276 @@
+#include <cassert>
+#include <limits>
+
+#include "RaZ/Math/Batch.hpp"
+#include "RaZ/Math/Simd.hpp"
+
+namespace Raz {
+
+namespace {
+
+template <bool IsPoint>
+void transformVectors(const Vec3fArray& vectors, const Mat4f& matrix, Vec3fArray& result) {
+  const std::size_t size = vectors.getSize();
+  result.resize(size);
+
+  const float* xValues = vectors.getX().data();
+  const float* yValues = vectors.getY().data();
+  const float* zValues = vectors.getZ().data();
+
+  float* resXValues = result.getX().data();
+  float* resYValues = result.getY().data();
+  float* resZValues = result.getZ().data();
+
+  // Broadcasting each matrix element used into its own register
+  // Vectors are considered horizontal: the result's X component is the dot product of the input with the matrix's first column, and so on
+  Simd::Float matCols[12];
+  for (std::size_t i = 0; i < 12; ++i)
+    matCols[i] = Simd::set(matrix[i]);
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float xVals = Simd::load(xValues + index);
+    const Simd::Float yVals = Simd::load(yValues + index);
+    const Simd::Float zVals = Simd::load(zValues + index);
+
+    Simd::Float resX = Simd::add(Simd::add(Simd::mul(xVals, matCols[0]), Simd::mul(yVals, matCols[4])), Simd::mul(zVals, matCols[8]));
+    Simd::Float resY = Simd::add(Simd::add(Simd::mul(xVals, matCols[1]), Simd::mul(yVals, matCols[5])), Simd::mul(zVals, matCols[9]));
+    Simd::Float resZ = Simd::add(Simd::add(Simd::mul(xVals, matCols[2]), Simd::mul(yVals, matCols[6])), Simd::mul(zVals, matCols[10]));
+
+    if (IsPoint) {
+      resX = Simd::add(resX, Simd::set(matrix[12]));
+      resY = Simd::add(resY, Simd::set(matrix[13]));
+      resZ = Simd::add(resZ, Simd::set(matrix[14]));
+    }
+
+    Simd::store(resXValues + index, resX);
+    Simd::store(resYValues + index, resY);
+    Simd::store(resZValues + index, resZ);
+  }
+
+  // Processing the remaining elements which could not fill a whole register
+  for (; index < size; ++index) {
+    const float xVal = xValues[index];
+    const float yVal = yValues[index];
+    const float zVal = zValues[index];
+
+    resXValues[index] = xVal * matrix[0] + yVal * matrix[4] + zVal * matrix[8]  + (IsPoint ? matrix[12] : 0.f);
+    resYValues[index] = xVal * matrix[1] + yVal * matrix[5] + zVal * matrix[9]  + (IsPoint ? matrix[13] : 0.f);
+    resZValues[index] = xVal * matrix[2] + yVal * matrix[6] + zVal * matrix[10] + (IsPoint ? matrix[14] : 0.f);
+  }
+}
+
+} // namespace
+
+Vec3fArray::Vec3fArray(const std::vector<Vec3f>& vectors) : Vec3fArray(vectors.size()) {
+  for (std::size_t i = 0; i < vectors.size(); ++i)
+    set(i, vectors[i]);
+}
+
+void Vec3fArray::resize(std::size_t size) {
+  m_xValues.resize(size);
+  m_yValues.resize(size);
+  m_zValues.resize(size);
+}
+
+void Vec3fArray::reserve(std::size_t size) {
+  m_xValues.reserve(size);
+  m_yValues.reserve(size);
+  m_zValues.reserve(size);
+}
+
+void Vec3fArray::add(const Vec3f& vec) {
+  m_xValues.push_back(vec[0]);
+  m_yValues.push_back(vec[1]);
+  m_zValues.push_back(vec[2]);
+}
+
+void Vec3fArray::set(std::size_t index, const Vec3f& vec) {
+  m_xValues[index] = vec[0];
+  m_yValues[index] = vec[1];
+  m_zValues[index] = vec[2];
+}
+
+namespace Batch {
+
+void transformPoints(const Vec3fArray& points, const Mat4f& matrix, Vec3fArray& result) {
+  transformVectors<true>(points, matrix, result);
+}
+
+void transformDirections(const Vec3fArray& directions, const Mat4f& matrix, Vec3fArray& result) {
+  transformVectors<false>(directions, matrix, result);
+}
+
+void transformNormals(const Vec3fArray& normals, const Mat4f& normalMatrix, Vec3fArray& result) {
+  transformVectors<false>(normals, normalMatrix, result);
+  normalize(result);
+}
+
+void normalize(Vec3fArray& vectors) {
+  const std::size_t size = vectors.getSize();
+
+  float* xValues = vectors.getX().data();
+  float* yValues = vectors.getY().data();
+  float* zValues = vectors.getZ().data();
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float xVals = Simd::load(xValues + index);
+    const Simd::Float yVals = Simd::load(yValues + index);
+    const Simd::Float zVals = Simd::load(zValues + index);
+
+    const Simd::Float sqLengths = Simd::add(Simd::add(Simd::mul(xVals, xVals), Simd::mul(yVals, yVals)), Simd::mul(zVals, zVals));
+    const Simd::Float lengths   = Simd::sqrt(sqLengths);
+
+    Simd::store(xValues + index, Simd::div(xVals, lengths));
+    Simd::store(yValues + index, Simd::div(yVals, lengths));
+    Simd::store(zValues + index, Simd::div(zVals, lengths));
+  }
+
+  for (; index < size; ++index) {
+    const float length = std::sqrt(xValues[index] * xValues[index] + yValues[index] * yValues[index] + zValues[index] * zValues[index]);
+
+    xValues[index] /= length;
+    yValues[index] /= length;
+    zValues[index] /= length;
+  }
+}
+
+void normalizeFast(Vec3fArray& vectors) {
+  const std::size_t size = vectors.getSize();
+
+  float* xValues = vectors.getX().data();
+  float* yValues = vectors.getY().data();
+  float* zValues = vectors.getZ().data();
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float xVals = Simd::load(xValues + index);
+    const Simd::Float yVals = Simd::load(yValues + index);
+    const Simd::Float zVals = Simd::load(zValues + index);
+
+    const Simd::Float sqLengths  = Simd::add(Simd::add(Simd::mul(xVals, xVals), Simd::mul(yVals, yVals)), Simd::mul(zVals, zVals));
+    const Simd::Float invLengths = Simd::fastRsqrt(sqLengths);
+
+    Simd::store(xValues + index, Simd::mul(xVals, invLengths));
+    Simd::store(yValues + index, Simd::mul(yVals, invLengths));
+    Simd::store(zValues + index, Simd::mul(zVals, invLengths));
+  }
+
+  for (; index < size; ++index) {
+    const float invLength = FloatUtils::fastRsqrt(xValues[index] * xValues[index] + yValues[index] * yValues[index] + zValues[index] * zValues[index]);
+
+    xValues[index] *= invLength;
+    yValues[index] *= invLength;
+    zValues[index] *= invLength;
+  }
+}
+
+void computeDotProducts(const Vec3fArray& firstVectors, const Vec3fArray& secondVectors, std::vector<float>& result) {
+  assert("Error: Both vector arrays must be of the same size to compute dot products." && firstVectors.getSize() == secondVectors.getSize());
+
+  const std::size_t size = firstVectors.getSize();
+  result.resize(size);
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float xProducts = Simd::mul(Simd::load(firstVectors.getX().data() + index), Simd::load(secondVectors.getX().data() + index));
+    const Simd::Float yProducts = Simd::mul(Simd::load(firstVectors.getY().data() + index), Simd::load(secondVectors.getY().data() + index));
+    const Simd::Float zProducts = Simd::mul(Simd::load(firstVectors.getZ().data() + index), Simd::load(secondVectors.getZ().data() + index));
+
+    Simd::store(result.data() + index, Simd::add(Simd::add(xProducts, yProducts), zProducts));
+  }
+
+  for (; index < size; ++index) {
+    result[index] = firstVectors.getX()[index] * secondVectors.getX()[index]
+                  + firstVectors.getY()[index] * secondVectors.getY()[index]
+                  + firstVectors.getZ()[index] * secondVectors.getZ()[index];
+  }
+}
+
+void computeCrossProducts(const Vec3fArray& firstVectors, const Vec3fArray& secondVectors, Vec3fArray& result) {
+  assert("Error: Both vector arrays must be of the same size to compute cross products." && firstVectors.getSize() == secondVectors.getSize());
+
+  const std::size_t size = firstVectors.getSize();
+  result.resize(size);
+
+  const float* firstX  = firstVectors.getX().data();
+  const float* firstY  = firstVectors.getY().data();
+  const float* firstZ  = firstVectors.getZ().data();
+  const float* secondX = secondVectors.getX().data();
+  const float* secondY = secondVectors.getY().data();
+  const float* secondZ = secondVectors.getZ().data();
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float firstXVals  = Simd::load(firstX + index);
+    const Simd::Float firstYVals  = Simd::load(firstY + index);
+    const Simd::Float firstZVals  = Simd::load(firstZ + index);
+    const Simd::Float secondXVals = Simd::load(secondX + index);
+    const Simd::Float secondYVals = Simd::load(secondY + index);
+    const Simd::Float secondZVals = Simd::load(secondZ + index);
+
+    Simd::store(result.getX().data() + index, Simd::sub(Simd::mul(firstYVals, secondZVals), Simd::mul(firstZVals, secondYVals)));
+    Simd::store(result.getY().data() + index, Simd::sub(Simd::mul(firstZVals, secondXVals), Simd::mul(firstXVals, secondZVals)));
+    Simd::store(result.getZ().data() + index, Simd::sub(Simd::mul(firstXVals, secondYVals), Simd::mul(firstYVals, secondXVals)));
+  }
+
+  for (; index < size; ++index) {
+    const float firstXVal  = firstX[index];
+    const float firstYVal  = firstY[index];
+    const float firstZVal  = firstZ[index];
+    const float secondXVal = secondX[index];
+    const float secondYVal = secondY[index];
+    const float secondZVal = secondZ[index];
+
+    result.getX()[index] = firstYVal * secondZVal - firstZVal * secondYVal;
+    result.getY()[index] = firstZVal * secondXVal - firstXVal * secondZVal;
+    result.getZ()[index] = firstXVal * secondYVal - firstYVal * secondXVal;
+  }
+}
+
+void computeBounds(const Vec3fArray& points, Vec3f& minPoint, Vec3f& maxPoint) {
+  const std::size_t size = points.getSize();
+
+  minPoint = Vec3f(std::numeric_limits<float>::max());
+  maxPoint = Vec3f(std::numeric_limits<float>::lowest());
+
+  const std::array<const float*, 3> components = { points.getX().data(), points.getY().data(), points.getZ().data() };
+
+  // Each component is reduced independently, so that a whole stream is read contiguously at once
+  for (std::size_t compIndex = 0; compIndex < 3; ++compIndex) {
+    const float* values = components[compIndex];
+
+    Simd::Float minVals = Simd::set(minPoint[compIndex]);
+    Simd::Float maxVals = Simd::set(maxPoint[compIndex]);
+
+    std::size_t index = 0;
+
+    for (; index + Simd::Width <= size; index += Simd::Width) {
+      const Simd::Float vals = Simd::load(values + index);
+
+      minVals = Simd::min(minVals, vals);
+      maxVals = Simd::max(maxVals, vals);
+    }
+
+    float minVal = Simd::reduceMin(minVals);
+    float maxVal = Simd::reduceMax(maxVals);
+
+    for (; index < size; ++index) {
+      minVal = std::min(minVal, values[index]);
+      maxVal = std::max(maxVal, values[index]);
+    }
+
+    minPoint[compIndex] = minVal;
+    maxPoint[compIndex] = maxVal;
+  }
+}
+
+} // namespace Batch
+
+} // namespace Raz
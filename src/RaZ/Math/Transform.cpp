@@ -1,20 +1,35 @@
 #include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Raz {
 
+AABB Transform::computeTransformedBox(const AABB& box) const {
+  return box.computeTransformed(getTransformMatrix());
+}
+
+Sphere Transform::computeTransformedSphere(const Sphere& sphere) const {
+  const Vec3f center   = Vec3f(Vec4f(sphere.getCenter(), 1.f) * getTransformMatrix());
+  const float maxScale = std::max({ std::abs(m_scale[0]), std::abs(m_scale[1]), std::abs(m_scale[2]) });
+
+  return Sphere(center, sphere.getRadius() * maxScale);
+}
+
 void Transform::setPosition(const Vec3f& position) {
   m_position = position;
-  m_updated = true;
+  updateMatrices();
 }
 
-void Transform::setRotation(const Mat4f& rotation) {
+void Transform::setRotation(const Quaternionf& rotation) {
   m_rotation = rotation;
-  m_updated = true;
+  updateMatrices();
 }
 
 void Transform::setScale(const Vec3f& scale) {
   m_scale = scale;
-  m_updated = true;
+  updateMatrices();
 }
 
 void Transform::translate(float x, float y, float z) {
@@ -22,23 +37,24 @@ void Transform::translate(float x, float y, float z) {
   m_position[1] += y;
   m_position[2] += z;
 
-  m_updated = true;
+  updateMatrices();
 }
 
 void Transform::rotate(float angle, const Vec3f& axis) {
+  // The new rotation is applied before the current one; normalizing prevents any drift due to accumulated floating-point errors
   const Quaternionf quaternion(angle, axis);
-  m_rotation = quaternion.computeMatrix() * m_rotation;
+  m_rotation = (m_rotation * quaternion).normalize();
 
-  m_updated = true;
+  updateMatrices();
 }
 
 void Transform::rotate(float xAngle, float yAngle, float zAngle) {
   const Quaternionf xQuat(xAngle, Axis::X);
   const Quaternionf yQuat(yAngle, Axis::Y);
   const Quaternionf zQuat(zAngle, Axis::Z);
-  m_rotation = (xQuat.computeMatrix() * yQuat.computeMatrix() * zQuat.computeMatrix()) * m_rotation;
+  m_rotation = (m_rotation * zQuat * yQuat * xQuat).normalize();
 
-  m_updated = true;
+  updateMatrices();
 }
 
 void Transform::scale(float x, float y, float z) {
@@ -46,7 +62,7 @@ void Transform::scale(float x, float y, float z) {
   m_scale[1] *= y;
   m_scale[2] *= z;
 
-  m_updated = true;
+  updateMatrices();
 }
 
 Mat4f Transform::computeTranslationMatrix(bool inverseTranslation) const {
@@ -60,12 +76,36 @@ Mat4f Transform::computeTranslationMatrix(bool inverseTranslation) const {
 }
 
 Mat4f Transform::computeTransformMatrix() const {
-  const Mat4f scale({{ m_scale[0],        0.f,        0.f, 0.f },
-                     {        0.f, m_scale[1],        0.f, 0.f },
-                     {        0.f,        0.f, m_scale[2], 0.f },
-                     {        0.f,        0.f,        0.f, 1.f }});
+  // Directly filling the matrix instead of multiplying the scale, rotation & translation ones: each row of the rotation is scaled, then the translation is set
+  Mat4f transform = m_rotation.computeMatrix();
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    for (std::size_t colIndex = 0; colIndex < 3; ++colIndex)
+      transform[rowIndex * 4 + colIndex] *= m_scale[rowIndex];
+  }
+
+  transform[12] = m_position[0];
+  transform[13] = m_position[1];
+  transform[14] = m_position[2];
+
+  return transform;
+}
+
+void Transform::updateMatrices() {
+  m_updated = true;
+
+  m_transformMatrix = computeTransformMatrix();
+
+  // The upper 3x3 part of the transform matrix is S * R; its inverse transpose is then S^-1 * R, R being orthonormal
+  // This avoids computing a whole matrix inverse: each row of the rotation only has to be divided by the matching scale
+  m_normalMatrix = m_rotation.computeMatrix();
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    const float invScale = 1.f / m_scale[rowIndex];
 
-  return scale * m_rotation * computeTranslationMatrix();
+    for (std::size_t colIndex = 0; colIndex < 3; ++colIndex)
+      m_normalMatrix[rowIndex * 4 + colIndex] *= invScale;
+  }
 }
 
 } // namespace Raz
@@ -0,0 +1,104 @@
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/AabbTreeSystem.hpp"
+#include "RaZ/Render/Camera.hpp"
+
+namespace Raz {
+
+AabbTreeSystem::AabbTreeSystem(float margin) : m_tree(margin) {
+  m_acceptedComponents.setBit(Component::getId<AABB>());
+}
+
+void AabbTreeSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+
+  Proxy proxy {};
+  proxy.index = m_tree.insertProxy(computeWorldBox(*entity, proxy));
+  m_entityProxies.emplace(entity.get(), proxy);
+
+  if (proxy.index >= m_proxyEntities.size())
+    m_proxyEntities.resize(proxy.index + 1);
+
+  m_proxyEntities[proxy.index] = entity.get();
+}
+
+void AabbTreeSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  const auto proxyIter = m_entityProxies.find(entity.get());
+
+  if (proxyIter == m_entityProxies.end())
+    return;
+
+  m_tree.removeProxy(proxyIter->second.index);
+  m_proxyEntities[proxyIter->second.index] = nullptr;
+  m_entityProxies.erase(proxyIter);
+}
+
+void AabbTreeSystem::update(float) {
+  for (const Entity* entity : m_entities) {
+    if (!entity->hasComponent<Transform>())
+      continue;
+
+    Proxy& proxy = m_entityProxies.find(entity)->second;
+    const Mat4f& transform = entity->getComponent<Transform>().getTransformMatrix();
+
+    if (transform.getData() == proxy.transform.getData())
+      continue;
+
+    // The displacement since the last update is given to anticipate the next one
+    const Vec3f displacement({ transform[12] - proxy.transform[12], transform[13] - proxy.transform[13], transform[14] - proxy.transform[14] });
+    m_tree.moveProxy(proxy.index, computeWorldBox(*entity, proxy), displacement);
+  }
+}
+
+void AabbTreeSystem::refreshEntity(const Entity& entity) {
+  const auto proxyIter = m_entityProxies.find(&entity);
+
+  if (proxyIter == m_entityProxies.end())
+    return;
+
+  Proxy& proxy = proxyIter->second;
+  m_tree.moveProxy(proxy.index, computeWorldBox(entity, proxy));
+}
+
+void AabbTreeSystem::queryOverlaps(const AABB& aabb, std::vector<Entity*>& entities) const {
+  std::vector<std::uint32_t> proxyIndices;
+  m_tree.queryOverlaps(aabb, proxyIndices);
+  collectEntities(proxyIndices, entities);
+}
+
+void AabbTreeSystem::queryRay(const Ray& ray, std::vector<Entity*>& entities, float maxDistance) const {
+  std::vector<std::uint32_t> proxyIndices;
+  m_tree.queryRay(ray, proxyIndices, maxDistance);
+  collectEntities(proxyIndices, entities);
+}
+
+void AabbTreeSystem::queryFrustum(const Camera& camera, std::vector<Entity*>& entities) const {
+  std::vector<std::uint32_t> proxyIndices;
+  m_tree.queryFrustum(camera.computeFrustumPlanes(), proxyIndices);
+  collectEntities(proxyIndices, entities);
+}
+
+AABB AabbTreeSystem::computeWorldBox(const Entity& entity, Proxy& proxy) const {
+  const auto& aabb = entity.getComponent<AABB>();
+
+  if (!entity.hasComponent<Transform>())
+    return aabb;
+
+  proxy.transform = entity.getComponent<Transform>().getTransformMatrix();
+  return aabb.computeTransformed(proxy.transform);
+}
+
+void AabbTreeSystem::collectEntities(const std::vector<std::uint32_t>& proxyIndices, std::vector<Entity*>& entities) const {
+  entities.clear();
+  entities.reserve(proxyIndices.size());
+
+  for (const std::uint32_t proxyIndex : proxyIndices) {
+    Entity* entity = m_proxyEntities[proxyIndex];
+
+    if (entity->isEnabled())
+      entities.push_back(entity);
+  }
+}
+
+} // namespace Raz
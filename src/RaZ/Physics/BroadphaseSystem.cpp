@@ -0,0 +1,61 @@
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/BroadphaseSystem.hpp"
+
+namespace Raz {
+
+BroadphaseSystem::BroadphaseSystem() {
+  m_acceptedComponents.setBit(Component::getId<AABB>());
+}
+
+void BroadphaseSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+
+  const std::uint32_t proxyIndex = m_sweepAndPrune.addProxy(computeWorldBox(*entity));
+  m_entityProxies.emplace(entity.get(), proxyIndex);
+
+  if (proxyIndex >= m_proxyEntities.size())
+    m_proxyEntities.resize(proxyIndex + 1);
+
+  m_proxyEntities[proxyIndex] = entity.get();
+}
+
+void BroadphaseSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  const auto proxyIter = m_entityProxies.find(entity.get());
+
+  if (proxyIter == m_entityProxies.end())
+    return;
+
+  m_sweepAndPrune.removeProxy(proxyIter->second);
+  m_proxyEntities[proxyIter->second] = nullptr;
+  m_entityProxies.erase(proxyIter);
+}
+
+void BroadphaseSystem::update(float) {
+  for (Entity* entity : m_entities)
+    m_sweepAndPrune.updateProxy(m_entityProxies.find(entity)->second, computeWorldBox(*entity));
+
+  m_sweepAndPrune.update();
+
+  m_pairs.clear();
+
+  for (const SweepAndPrune::Pair& pair : m_sweepAndPrune.getOverlappingPairs()) {
+    Entity* firstEntity  = m_proxyEntities[pair.first];
+    Entity* secondEntity = m_proxyEntities[pair.second];
+
+    if (firstEntity->isEnabled() && secondEntity->isEnabled())
+      m_pairs.emplace_back(firstEntity, secondEntity);
+  }
+}
+
+AABB BroadphaseSystem::computeWorldBox(const Entity& entity) const {
+  const auto& aabb = entity.getComponent<AABB>();
+
+  if (!entity.hasComponent<Transform>())
+    return aabb;
+
+  return aabb.computeTransformed(entity.getComponent<Transform>().getTransformMatrix());
+}
+
+} // namespace Raz
@@ -0,0 +1,76 @@
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/CharacterController.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+#include <cmath>
+
+namespace Raz {
+
+namespace {
+
+// Displacements shorter than this are considered done, avoiding sweeps that could not move the sphere anyway
+constexpr float MinDisplacementLength = 0.000001f;
+
+} // namespace
+
+void CharacterController::setMaxSlopeAngle(float maxSlopeAngleDegrees) {
+  m_minGroundCosine = std::cos(maxSlopeAngleDegrees * PI<float> / 180.f);
+}
+
+CharacterController::MoveResult CharacterController::move(Transform& transform, const Vec3f& displacement, const TriangleBvh& bvh) const {
+  MoveResult result;
+
+  const Vec3f startPos = transform.getPosition();
+  Vec3f position       = startPos;
+  Vec3f remainingDisp  = displacement;
+
+  Vec3f prevNormal;
+  bool hasPrevNormal = false;
+
+  for (std::size_t slideIndex = 0; slideIndex <= m_maxSlideCount; ++slideIndex) {
+    if (remainingDisp.computeSquaredLength() < MinDisplacementLength * MinDisplacementLength)
+      break;
+
+    TriangleBvh::SweepHit hit;
+
+    if (!bvh.sweep(Sphere(position, m_radius), remainingDisp, hit)) {
+      position += remainingDisp;
+      break;
+    }
+
+    result.hasCollided = true;
+
+    if (hit.normal.dot(m_upDirection) >= m_minGroundCosine)
+      result.isGrounded = true;
+
+    // Moving up to the contact, then away from the surface by the skin width so that the next sweep doesn't start in contact with it
+    position      += remainingDisp * hit.time + hit.normal * m_skinWidth;
+    remainingDisp *= 1.f - hit.time;
+
+    if (slideIndex == m_maxSlideCount)
+      break;
+
+    // Sliding along the surface, by removing the part of the displacement going into it
+    remainingDisp -= hit.normal * remainingDisp.dot(hit.normal);
+
+    // In a crease, sliding along one surface may lead into the previous one: the displacement is then constrained along their intersection
+    if (hasPrevNormal && remainingDisp.dot(prevNormal) < 0.f) {
+      const Vec3f creaseDir = prevNormal.cross(hit.normal);
+      const float sqCreaseLength = creaseDir.computeSquaredLength();
+
+      remainingDisp = (sqCreaseLength > 0.f ? creaseDir * (remainingDisp.dot(creaseDir) / sqCreaseLength) : Vec3f(0.f));
+    }
+
+    prevNormal    = hit.normal;
+    hasPrevNormal = true;
+  }
+
+  transform.setPosition(position);
+  result.displacement = position - startPos;
+
+  return result;
+}
+
+} // namespace Raz
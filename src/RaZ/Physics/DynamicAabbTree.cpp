@@ -0,0 +1,428 @@
+#include "RaZ/Physics/DynamicAabbTree.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace Raz {
+
+namespace {
+
+// Rotations keep the tree balanced enough for its height to remain logarithmic in the number of proxies
+constexpr std::size_t MaxTraversalDepth = 64;
+
+// A fat box extended to anticipate a displacement is shrunk back if it exceeds the tight box by more than this many margins
+constexpr float MaxMarginFactor = 4.f;
+
+// Factor applied to the displacement given when moving a proxy, to anticipate a few of the following moves
+constexpr float DisplacementFactor = 2.f;
+
+inline float computeHalfArea(const Vec3f& minBounds, const Vec3f& maxBounds) {
+  const Vec3f extent = maxBounds - minBounds;
+  return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+}
+
+inline float computeUnionHalfArea(const DynamicAabbTree::Node& firstNode, const DynamicAabbTree::Node& secondNode) {
+  return computeHalfArea(Vec3f({ std::min(firstNode.minBounds[0], secondNode.minBounds[0]),
+                                 std::min(firstNode.minBounds[1], secondNode.minBounds[1]),
+                                 std::min(firstNode.minBounds[2], secondNode.minBounds[2]) }),
+                         Vec3f({ std::max(firstNode.maxBounds[0], secondNode.maxBounds[0]),
+                                 std::max(firstNode.maxBounds[1], secondNode.maxBounds[1]),
+                                 std::max(firstNode.maxBounds[2], secondNode.maxBounds[2]) }));
+}
+
+inline bool contains(const Vec3f& outerMin, const Vec3f& outerMax, const Vec3f& innerMin, const Vec3f& innerMax) {
+  return (outerMin[0] <= innerMin[0] && outerMin[1] <= innerMin[1] && outerMin[2] <= innerMin[2]
+       && outerMax[0] >= innerMax[0] && outerMax[1] >= innerMax[1] && outerMax[2] >= innerMax[2]);
+}
+
+inline bool overlaps(const DynamicAabbTree::Node& node, const Vec3f& minBounds, const Vec3f& maxBounds) {
+  return (node.minBounds[0] <= maxBounds[0] && node.maxBounds[0] >= minBounds[0]
+       && node.minBounds[1] <= maxBounds[1] && node.maxBounds[1] >= minBounds[1]
+       && node.minBounds[2] <= maxBounds[2] && node.maxBounds[2] >= minBounds[2]);
+}
+
+inline bool isHit(const DynamicAabbTree::Node& node, const Vec3f& origin, const Vec3f& invDirection, float maxDistance) {
+  float minDist = 0.f;
+  float maxDist = maxDistance;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    float firstDist  = (node.minBounds[axis] - origin[axis]) * invDirection[axis];
+    float secondDist = (node.maxBounds[axis] - origin[axis]) * invDirection[axis];
+
+    if (firstDist > secondDist)
+      std::swap(firstDist, secondDist);
+
+    // Comparisons are ordered so that NaNs, appearing when the ray lies exactly on a slab's plane, leave the distances untouched
+    minDist = (firstDist > minDist ? firstDist : minDist);
+    maxDist = (secondDist < maxDist ? secondDist : maxDist);
+  }
+
+  return (minDist <= maxDist);
+}
+
+enum class Containment {
+  OUTSIDE,
+  INTERSECTING,
+  INSIDE
+};
+
+inline Containment classify(const DynamicAabbTree::Node& node, const std::array<Plane, 6>& planes) {
+  Containment containment = Containment::INSIDE;
+
+  for (const Plane& plane : planes) {
+    const Vec3f& normal = plane.getNormal();
+
+    // The box's corner the furthest along the plane's normal is checked first: if it is behind the plane, the whole box is
+    const Vec3f furthestCorner({ (normal[0] >= 0.f ? node.maxBounds[0] : node.minBounds[0]),
+                                 (normal[1] >= 0.f ? node.maxBounds[1] : node.minBounds[1]),
+                                 (normal[2] >= 0.f ? node.maxBounds[2] : node.minBounds[2]) });
+
+    if (normal.dot(furthestCorner) < plane.getDistance())
+      return Containment::OUTSIDE;
+
+    const Vec3f closestCorner({ (normal[0] >= 0.f ? node.minBounds[0] : node.maxBounds[0]),
+                                (normal[1] >= 0.f ? node.minBounds[1] : node.maxBounds[1]),
+                                (normal[2] >= 0.f ? node.minBounds[2] : node.maxBounds[2]) });
+
+    if (normal.dot(closestCorner) < plane.getDistance())
+      containment = Containment::INTERSECTING;
+  }
+
+  return containment;
+}
+
+} // namespace
+
+AABB DynamicAabbTree::getFatBox(std::uint32_t proxyIndex) const {
+  assert("Error: Invalid dynamic AABB tree proxy index." && isProxyValid(proxyIndex));
+  return AABB(m_nodes[proxyIndex].maxBounds, m_nodes[proxyIndex].minBounds);
+}
+
+std::uint32_t DynamicAabbTree::insertProxy(const AABB& aabb) {
+  const std::uint32_t proxyIndex = allocateNode();
+
+  Node& leaf     = m_nodes[proxyIndex];
+  leaf.minBounds = aabb.getLeftBottomBackPos() - m_margin;
+  leaf.maxBounds = aabb.getRightTopFrontPos() + m_margin;
+  leaf.height    = 0;
+
+  insertLeaf(proxyIndex);
+  ++m_proxyCount;
+
+  return proxyIndex;
+}
+
+void DynamicAabbTree::removeProxy(std::uint32_t proxyIndex) {
+  assert("Error: Invalid dynamic AABB tree proxy index." && isProxyValid(proxyIndex));
+
+  removeLeaf(proxyIndex);
+  freeNode(proxyIndex);
+  --m_proxyCount;
+}
+
+bool DynamicAabbTree::moveProxy(std::uint32_t proxyIndex, const AABB& aabb, const Vec3f& displacement) {
+  assert("Error: Invalid dynamic AABB tree proxy index." && isProxyValid(proxyIndex));
+
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+  Node& leaf = m_nodes[proxyIndex];
+
+  if (contains(leaf.minBounds, leaf.maxBounds, minPos, maxPos)) {
+    // A fat box much larger than needed, due to a previous displacement, would produce too many false positives & is shrunk back
+    const float maxMargin = m_margin * MaxMarginFactor;
+
+    if (contains(minPos - maxMargin, maxPos + maxMargin, leaf.minBounds, leaf.maxBounds))
+      return false;
+  }
+
+  removeLeaf(proxyIndex);
+
+  leaf.minBounds = minPos - m_margin;
+  leaf.maxBounds = maxPos + m_margin;
+
+  // The fat box is extended in the direction of the movement, so that the next moves remain inside for longer
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float anticipatedMove = displacement[axis] * DisplacementFactor;
+
+    if (anticipatedMove < 0.f)
+      leaf.minBounds[axis] += anticipatedMove;
+    else
+      leaf.maxBounds[axis] += anticipatedMove;
+  }
+
+  insertLeaf(proxyIndex);
+
+  return true;
+}
+
+void DynamicAabbTree::queryOverlaps(const AABB& aabb, std::vector<std::uint32_t>& proxyIndices) const {
+  if (m_rootIndex == NullIndex)
+    return;
+
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = m_rootIndex;
+
+  while (stackSize > 0) {
+    const std::uint32_t nodeIndex = stack[--stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (!overlaps(node, minPos, maxPos))
+      continue;
+
+    if (node.isLeaf()) {
+      proxyIndices.push_back(nodeIndex);
+      continue;
+    }
+
+    stack[stackSize++] = node.leftChildIndex;
+    stack[stackSize++] = node.rightChildIndex;
+  }
+}
+
+void DynamicAabbTree::queryRay(const Ray& ray, std::vector<std::uint32_t>& proxyIndices, float maxDistance) const {
+  if (m_rootIndex == NullIndex)
+    return;
+
+  const Vec3f& origin       = ray.getOrigin();
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = m_rootIndex;
+
+  while (stackSize > 0) {
+    const std::uint32_t nodeIndex = stack[--stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (!isHit(node, origin, invDirection, maxDistance))
+      continue;
+
+    if (node.isLeaf()) {
+      proxyIndices.push_back(nodeIndex);
+      continue;
+    }
+
+    stack[stackSize++] = node.leftChildIndex;
+    stack[stackSize++] = node.rightChildIndex;
+  }
+}
+
+void DynamicAabbTree::queryFrustum(const std::array<Plane, 6>& planes, std::vector<std::uint32_t>& proxyIndices) const {
+  if (m_rootIndex == NullIndex)
+    return;
+
+  // Each node is stacked alongside whether its parent is entirely inside the volume, in which case it needs no further check
+  std::array<std::pair<std::uint32_t, bool>, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = { m_rootIndex, false };
+
+  while (stackSize > 0) {
+    const std::uint32_t nodeIndex = stack[stackSize - 1].first;
+    bool isInside = stack[stackSize - 1].second;
+    --stackSize;
+
+    const Node& node = m_nodes[nodeIndex];
+
+    if (!isInside) {
+      const Containment containment = classify(node, planes);
+
+      if (containment == Containment::OUTSIDE)
+        continue;
+
+      isInside = (containment == Containment::INSIDE);
+    }
+
+    if (node.isLeaf()) {
+      proxyIndices.push_back(nodeIndex);
+      continue;
+    }
+
+    stack[stackSize++] = { node.leftChildIndex, isInside };
+    stack[stackSize++] = { node.rightChildIndex, isInside };
+  }
+}
+
+std::uint32_t DynamicAabbTree::allocateNode() {
+  if (m_freeIndex == NullIndex) {
+    m_nodes.emplace_back();
+    return static_cast<std::uint32_t>(m_nodes.size() - 1);
+  }
+
+  const std::uint32_t nodeIndex = m_freeIndex;
+  m_freeIndex = m_nodes[nodeIndex].parentIndex;
+  m_nodes[nodeIndex] = Node();
+
+  return nodeIndex;
+}
+
+void DynamicAabbTree::freeNode(std::uint32_t nodeIndex) {
+  Node& node       = m_nodes[nodeIndex];
+  node.parentIndex = m_freeIndex;
+  node.height      = -1;
+
+  m_freeIndex = nodeIndex;
+}
+
+void DynamicAabbTree::insertLeaf(std::uint32_t leafIndex) {
+  if (m_rootIndex == NullIndex) {
+    m_rootIndex = leafIndex;
+    m_nodes[leafIndex].parentIndex = NullIndex;
+    return;
+  }
+
+  // Descending towards the sibling which, once merged with the leaf, increases the least the total area of the tree
+  // Going down a child enlarges the current node anyway (the inherited cost), which is added to the cost of stopping at the child
+  // See: Box2D's b2DynamicTree (Erin Catto)
+  std::uint32_t siblingIndex = m_rootIndex;
+
+  while (!m_nodes[siblingIndex].isLeaf()) {
+    const Node& leaf    = m_nodes[leafIndex];
+    const Node& sibling = m_nodes[siblingIndex];
+
+    const float unionArea     = computeUnionHalfArea(sibling, leaf);
+    const float stopCost      = 2.f * unionArea;
+    const float inheritedCost = 2.f * (unionArea - computeHalfArea(sibling.minBounds, sibling.maxBounds));
+
+    const auto computeDescentCost = [this, &leaf, inheritedCost] (std::uint32_t childIndex) {
+      const Node& child = m_nodes[childIndex];
+      const float childUnionArea = computeUnionHalfArea(child, leaf);
+
+      return (child.isLeaf() ? childUnionArea : childUnionArea - computeHalfArea(child.minBounds, child.maxBounds)) + inheritedCost;
+    };
+
+    const float leftCost  = computeDescentCost(sibling.leftChildIndex);
+    const float rightCost = computeDescentCost(sibling.rightChildIndex);
+
+    if (stopCost < leftCost && stopCost < rightCost)
+      break;
+
+    siblingIndex = (leftCost < rightCost ? sibling.leftChildIndex : sibling.rightChildIndex);
+  }
+
+  // A new parent replaces the sibling, which becomes its child alongside the leaf
+  const std::uint32_t oldParentIndex = m_nodes[siblingIndex].parentIndex;
+  const std::uint32_t newParentIndex = allocateNode();
+
+  Node& newParent           = m_nodes[newParentIndex];
+  newParent.parentIndex     = oldParentIndex;
+  newParent.leftChildIndex  = siblingIndex;
+  newParent.rightChildIndex = leafIndex;
+
+  if (oldParentIndex == NullIndex)
+    m_rootIndex = newParentIndex;
+  else
+    replaceChild(oldParentIndex, siblingIndex, newParentIndex);
+
+  m_nodes[siblingIndex].parentIndex = newParentIndex;
+  m_nodes[leafIndex].parentIndex    = newParentIndex;
+
+  updateNode(newParentIndex);
+  refitAncestors(newParentIndex);
+}
+
+void DynamicAabbTree::removeLeaf(std::uint32_t leafIndex) {
+  if (leafIndex == m_rootIndex) {
+    m_rootIndex = NullIndex;
+    return;
+  }
+
+  // The leaf's parent is removed as well, its other child taking its place
+  const std::uint32_t parentIndex      = m_nodes[leafIndex].parentIndex;
+  const std::uint32_t grandParentIndex = m_nodes[parentIndex].parentIndex;
+  const std::uint32_t siblingIndex     = (m_nodes[parentIndex].leftChildIndex == leafIndex ? m_nodes[parentIndex].rightChildIndex
+                                                                                            : m_nodes[parentIndex].leftChildIndex);
+
+  m_nodes[siblingIndex].parentIndex = grandParentIndex;
+  freeNode(parentIndex);
+
+  if (grandParentIndex == NullIndex) {
+    m_rootIndex = siblingIndex;
+    return;
+  }
+
+  replaceChild(grandParentIndex, parentIndex, siblingIndex);
+  refitAncestors(siblingIndex);
+}
+
+void DynamicAabbTree::refitAncestors(std::uint32_t nodeIndex) {
+  std::uint32_t ancestorIndex = m_nodes[nodeIndex].parentIndex;
+
+  while (ancestorIndex != NullIndex) {
+    ancestorIndex = balance(ancestorIndex);
+    updateNode(ancestorIndex);
+    ancestorIndex = m_nodes[ancestorIndex].parentIndex;
+  }
+}
+
+std::uint32_t DynamicAabbTree::balance(std::uint32_t nodeIndex) {
+  Node& node = m_nodes[nodeIndex];
+
+  if (node.isLeaf() || node.height < 2)
+    return nodeIndex;
+
+  const int heightDiff = m_nodes[node.rightChildIndex].height - m_nodes[node.leftChildIndex].height;
+
+  if (heightDiff >= -1 && heightDiff <= 1)
+    return nodeIndex;
+
+  // The highest child is promoted in place of the node, which becomes its child. The promoted one keeps its own highest child,
+  //  the node keeping its other child & taking the lowest one: node(other, promoted(lowest, highest)) => promoted(node(other, lowest), highest)
+  const bool promotesRight          = (heightDiff > 1);
+  const std::uint32_t promotedIndex = (promotesRight ? node.rightChildIndex : node.leftChildIndex);
+  Node& promoted                    = m_nodes[promotedIndex];
+  const bool isLeftHighest          = (m_nodes[promoted.leftChildIndex].height > m_nodes[promoted.rightChildIndex].height);
+  const std::uint32_t highestIndex  = (isLeftHighest ? promoted.leftChildIndex : promoted.rightChildIndex);
+  const std::uint32_t lowestIndex   = (isLeftHighest ? promoted.rightChildIndex : promoted.leftChildIndex);
+
+  promoted.parentIndex = node.parentIndex;
+
+  if (promoted.parentIndex == NullIndex)
+    m_rootIndex = promotedIndex;
+  else
+    replaceChild(promoted.parentIndex, nodeIndex, promotedIndex);
+
+  promoted.leftChildIndex  = nodeIndex;
+  promoted.rightChildIndex = highestIndex;
+  node.parentIndex         = promotedIndex;
+
+  if (promotesRight)
+    node.rightChildIndex = lowestIndex;
+  else
+    node.leftChildIndex = lowestIndex;
+
+  m_nodes[lowestIndex].parentIndex = nodeIndex;
+
+  updateNode(nodeIndex);
+  updateNode(promotedIndex);
+
+  return promotedIndex;
+}
+
+void DynamicAabbTree::replaceChild(std::uint32_t parentIndex, std::uint32_t oldChildIndex, std::uint32_t newChildIndex) {
+  Node& parent = m_nodes[parentIndex];
+
+  if (parent.leftChildIndex == oldChildIndex)
+    parent.leftChildIndex = newChildIndex;
+  else
+    parent.rightChildIndex = newChildIndex;
+}
+
+void DynamicAabbTree::updateNode(std::uint32_t nodeIndex) {
+  Node& node = m_nodes[nodeIndex];
+  const Node& leftChild  = m_nodes[node.leftChildIndex];
+  const Node& rightChild = m_nodes[node.rightChildIndex];
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    node.minBounds[axis] = std::min(leftChild.minBounds[axis], rightChild.minBounds[axis]);
+    node.maxBounds[axis] = std::max(leftChild.maxBounds[axis], rightChild.maxBounds[axis]);
+  }
+
+  node.height = 1 + std::max(leftChild.height, rightChild.height);
+}
+
+} // namespace Raz
@@ -0,0 +1,504 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "RaZ/Physics/Gjk.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+namespace Gjk {
+
+namespace {
+
+constexpr std::size_t MaxGjkIterations = 64;
+constexpr std::size_t MaxEpaIterations = 64;
+
+// Each EPA iteration adds a vertex to the initial tetrahedron; a closed triangle mesh of V vertices has 2V - 4 faces & 3V - 6 edges
+constexpr std::size_t MaxEpaVertices = MaxEpaIterations + 4;
+constexpr std::size_t MaxEpaFaces    = MaxEpaVertices * 2;
+constexpr std::size_t MaxEpaEdges    = MaxEpaVertices * 3;
+
+constexpr float Tolerance = 0.0001f;
+
+/// Point of the Minkowski difference of both shapes, alongside the points of each shape it has been computed from.
+struct SupportPoint {
+  Vec3f point {};
+  Vec3f firstPoint {};
+  Vec3f secondPoint {};
+};
+
+struct Simplex {
+  std::array<SupportPoint, 4> points {};
+  std::size_t pointCount {};
+};
+
+/// Triangle of the EPA polytope, whose vertices are in counter-clockwise order seen from outside.
+struct Face {
+  std::array<std::uint32_t, 3> indices {};
+  Vec3f normal {};
+  /// Distance of the face's plane from the origin.
+  float distance {};
+};
+
+struct Edge {
+  std::uint32_t firstIndex;
+  std::uint32_t secondIndex;
+};
+
+inline SupportPoint computeSupportPoint(const Shape& firstShape, const Shape& secondShape, const Vec3f& direction) {
+  SupportPoint supportPoint;
+  supportPoint.firstPoint  = firstShape.computeSupportPoint(direction);
+  supportPoint.secondPoint = secondShape.computeSupportPoint(-direction);
+  supportPoint.point       = supportPoint.firstPoint - supportPoint.secondPoint;
+
+  return supportPoint;
+}
+
+inline void reduceSimplex(Simplex& simplex, std::size_t firstIndex) {
+  simplex.points[0]  = simplex.points[firstIndex];
+  simplex.pointCount = 1;
+}
+
+inline void reduceSimplex(Simplex& simplex, std::size_t firstIndex, std::size_t secondIndex) {
+  const SupportPoint secondPoint = simplex.points[secondIndex];
+
+  simplex.points[0]  = simplex.points[firstIndex];
+  simplex.points[1]  = secondPoint;
+  simplex.pointCount = 2;
+}
+
+/// Computes the closest point to the origin on a segment, reducing the simplex to the points needed to express it.
+Vec3f solveSegment(Simplex& simplex) {
+  const Vec3f& firstPos  = simplex.points[0].point;
+  const Vec3f& secondPos = simplex.points[1].point;
+
+  const Vec3f segment       = secondPos - firstPos;
+  const float projDist      = -firstPos.dot(segment);
+  const float sqSegmentDist = segment.computeSquaredLength();
+
+  if (projDist <= 0.f) {
+    reduceSimplex(simplex, 0);
+    return simplex.points[0].point;
+  }
+
+  if (projDist >= sqSegmentDist) {
+    reduceSimplex(simplex, 1);
+    return simplex.points[0].point;
+  }
+
+  return firstPos + segment * (projDist / sqSegmentDist);
+}
+
+/// Computes the closest point to the origin on a triangle, reducing the simplex to the points needed to express it.
+/// This follows the same Voronoi regions search as Triangle::computeProjection(), with the origin as the projected point.
+Vec3f solveTriangle(Simplex& simplex) {
+  const Vec3f& firstPos  = simplex.points[0].point;
+  const Vec3f& secondPos = simplex.points[1].point;
+  const Vec3f& thirdPos  = simplex.points[2].point;
+
+  const Vec3f firstEdge  = secondPos - firstPos;
+  const Vec3f secondEdge = thirdPos - firstPos;
+
+  const float firstDot1 = -firstEdge.dot(firstPos);
+  const float firstDot2 = -secondEdge.dot(firstPos);
+
+  if (firstDot1 <= 0.f && firstDot2 <= 0.f) {
+    reduceSimplex(simplex, 0);
+    return simplex.points[0].point;
+  }
+
+  const float secondDot1 = -firstEdge.dot(secondPos);
+  const float secondDot2 = -secondEdge.dot(secondPos);
+
+  if (secondDot1 >= 0.f && secondDot2 <= secondDot1) {
+    reduceSimplex(simplex, 1);
+    return simplex.points[0].point;
+  }
+
+  const float thirdArea = firstDot1 * secondDot2 - secondDot1 * firstDot2;
+
+  if (thirdArea <= 0.f && firstDot1 >= 0.f && secondDot1 <= 0.f) {
+    const Vec3f closestPoint = firstPos + firstEdge * (firstDot1 / (firstDot1 - secondDot1));
+    reduceSimplex(simplex, 0, 1);
+    return closestPoint;
+  }
+
+  const float thirdDot1 = -firstEdge.dot(thirdPos);
+  const float thirdDot2 = -secondEdge.dot(thirdPos);
+
+  if (thirdDot2 >= 0.f && thirdDot1 <= thirdDot2) {
+    reduceSimplex(simplex, 2);
+    return simplex.points[0].point;
+  }
+
+  const float secondArea = thirdDot1 * firstDot2 - firstDot1 * thirdDot2;
+
+  if (secondArea <= 0.f && firstDot2 >= 0.f && thirdDot2 <= 0.f) {
+    const Vec3f closestPoint = firstPos + secondEdge * (firstDot2 / (firstDot2 - thirdDot2));
+    reduceSimplex(simplex, 0, 2);
+    return closestPoint;
+  }
+
+  const float firstArea = secondDot1 * thirdDot2 - thirdDot1 * secondDot2;
+
+  if (firstArea <= 0.f && (secondDot2 - secondDot1) >= 0.f && (thirdDot1 - thirdDot2) >= 0.f) {
+    const float edgeRatio    = (secondDot2 - secondDot1) / ((secondDot2 - secondDot1) + (thirdDot1 - thirdDot2));
+    const Vec3f closestPoint = secondPos + (thirdPos - secondPos) * edgeRatio;
+    reduceSimplex(simplex, 1, 2);
+    return closestPoint;
+  }
+
+  const float areaSum = firstArea + secondArea + thirdArea;
+
+  // A degenerate triangle, whose points are aligned, has no face: the closest point is on its first edge
+  if (areaSum <= 0.f) {
+    simplex.pointCount = 2;
+    return solveSegment(simplex);
+  }
+
+  const float invArea = 1.f / areaSum;
+  return firstPos + firstEdge * (secondArea * invArea) + secondEdge * (thirdArea * invArea);
+}
+
+/// Computes the closest point to the origin on a tetrahedron, reducing the simplex to the points needed to express it.
+/// \return True if the origin is inside the tetrahedron, false otherwise.
+bool solveTetrahedron(Simplex& simplex, Vec3f& closestPoint) {
+  // Each face, followed by the vertex opposite to it
+  constexpr std::array<std::array<std::size_t, 4>, 4> faces = {{ {{ 0, 1, 2, 3 }}, {{ 0, 2, 3, 1 }}, {{ 0, 3, 1, 2 }}, {{ 1, 3, 2, 0 }} }};
+
+  bool isOutside = false;
+  float closestSqDist = std::numeric_limits<float>::max();
+  Simplex closestSimplex;
+
+  for (const std::array<std::size_t, 4>& face : faces) {
+    const Vec3f& firstPos = simplex.points[face[0]].point;
+    const Vec3f normal    = (simplex.points[face[1]].point - firstPos).cross(simplex.points[face[2]].point - firstPos);
+
+    const float originSide   = -normal.dot(firstPos);
+    const float oppositeSide = normal.dot(simplex.points[face[3]].point - firstPos);
+
+    // The origin is inside the tetrahedron only if it is on the same side of all faces as their opposite vertex
+    // A flat tetrahedron having no inside, all of its faces are checked
+    if (originSide * oppositeSide > 0.f)
+      continue;
+
+    isOutside = true;
+
+    Simplex faceSimplex;
+    faceSimplex.points     = {{ simplex.points[face[0]], simplex.points[face[1]], simplex.points[face[2]] }};
+    faceSimplex.pointCount = 3;
+
+    const Vec3f faceClosestPoint = solveTriangle(faceSimplex);
+    const float faceSqDist       = faceClosestPoint.computeSquaredLength();
+
+    if (faceSqDist < closestSqDist) {
+      closestSqDist  = faceSqDist;
+      closestSimplex = faceSimplex;
+      closestPoint   = faceClosestPoint;
+    }
+  }
+
+  if (!isOutside)
+    return true;
+
+  simplex = closestSimplex;
+  return false;
+}
+
+/// Runs the GJK algorithm, iteratively building a simplex of the Minkowski difference getting closer to the origin.
+/// \return True if the simplex has reached the origin, meaning that the shapes intersect each other, false otherwise.
+bool runGjk(const Shape& firstShape, const Shape& secondShape, Simplex& simplex) {
+  simplex.points[0]  = computeSupportPoint(firstShape, secondShape, Axis::X);
+  simplex.pointCount = 1;
+
+  Vec3f closestPoint = simplex.points[0].point;
+
+  for (std::size_t iterIndex = 0; iterIndex < MaxGjkIterations; ++iterIndex) {
+    const float sqDist = closestPoint.computeSquaredLength();
+
+    // The origin lies on the simplex: the shapes are at least touching each other
+    if (sqDist <= Tolerance * Tolerance)
+      return true;
+
+    const SupportPoint supportPoint = computeSupportPoint(firstShape, secondShape, -closestPoint);
+    const float supportDist = supportPoint.point.dot(closestPoint);
+
+    // The difference doesn't reach the origin in the direction of the latter: the shapes are separated
+    if (supportDist > Tolerance * std::sqrt(sqDist))
+      return false;
+
+    // The support point gets no closer to the origin than the simplex already is: the closest distance has been found
+    if (sqDist - supportDist <= Tolerance * sqDist)
+      return false;
+
+    simplex.points[simplex.pointCount++] = supportPoint;
+
+    switch (simplex.pointCount) {
+      case 2:
+        closestPoint = solveSegment(simplex);
+        break;
+
+      case 3:
+        closestPoint = solveTriangle(simplex);
+        break;
+
+      case 4:
+      default:
+        if (solveTetrahedron(simplex, closestPoint))
+          return true;
+        break;
+    }
+  }
+
+  return false;
+}
+
+/// Adds points to a simplex containing the origin until it becomes a tetrahedron, as needed by EPA.
+/// \param flatNormal Normal of the Minkowski difference, set if it is flat.
+/// \return True if a tetrahedron has been made, false if the Minkowski difference is flat.
+bool completeSimplex(const Shape& firstShape, const Shape& secondShape, Simplex& simplex, Vec3f& flatNormal) {
+  if (simplex.pointCount == 1) {
+    for (const Vec3f& direction : { Axis::X, -Axis::X, Axis::Y, -Axis::Y, Axis::Z, -Axis::Z }) {
+      const SupportPoint supportPoint = computeSupportPoint(firstShape, secondShape, direction);
+
+      if ((supportPoint.point - simplex.points[0].point).computeSquaredLength() > Tolerance * Tolerance) {
+        simplex.points[simplex.pointCount++] = supportPoint;
+        break;
+      }
+    }
+
+    if (simplex.pointCount == 1) {
+      flatNormal = Axis::Y;
+      return false;
+    }
+  }
+
+  if (simplex.pointCount == 2) {
+    const Vec3f lineDir = (simplex.points[1].point - simplex.points[0].point).normalize();
+
+    // Searching in directions orthogonal to the line, computed from the axis the least aligned with it
+    const Vec3f& axis = (std::abs(lineDir[0]) < 0.5f ? Axis::X : (std::abs(lineDir[1]) < 0.5f ? Axis::Y : Axis::Z));
+    const Vec3f firstDir  = lineDir.cross(axis).normalize();
+    const Vec3f secondDir = lineDir.cross(firstDir);
+
+    for (const Vec3f& direction : { firstDir, -firstDir, secondDir, -secondDir }) {
+      const SupportPoint supportPoint = computeSupportPoint(firstShape, secondShape, direction);
+
+      if ((supportPoint.point - simplex.points[0].point).cross(lineDir).computeSquaredLength() > Tolerance * Tolerance) {
+        simplex.points[simplex.pointCount++] = supportPoint;
+        break;
+      }
+    }
+
+    if (simplex.pointCount == 2) {
+      flatNormal = firstDir;
+      return false;
+    }
+  }
+
+  if (simplex.pointCount == 3) {
+    const Vec3f& firstPos = simplex.points[0].point;
+    const Vec3f normal    = (simplex.points[1].point - firstPos).cross(simplex.points[2].point - firstPos).normalize();
+
+    for (const Vec3f& direction : { normal, -normal }) {
+      const SupportPoint supportPoint = computeSupportPoint(firstShape, secondShape, direction);
+
+      if (std::abs(normal.dot(supportPoint.point - firstPos)) > Tolerance) {
+        simplex.points[simplex.pointCount++] = supportPoint;
+        break;
+      }
+    }
+
+    if (simplex.pointCount == 3) {
+      flatNormal = normal;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Face makeFace(const std::array<SupportPoint, MaxEpaVertices>& vertices,
+              std::uint32_t firstIndex, std::uint32_t secondIndex, std::uint32_t thirdIndex) {
+  Face face;
+  face.indices = {{ firstIndex, secondIndex, thirdIndex }};
+
+  const Vec3f& firstPos = vertices[firstIndex].point;
+  const Vec3f normal    = (vertices[secondIndex].point - firstPos).cross(vertices[thirdIndex].point - firstPos);
+  const float normalLength = normal.computeLength();
+
+  // A degenerate face has no normal; it is never picked as the closest one
+  if (normalLength <= 0.f) {
+    face.distance = std::numeric_limits<float>::max();
+    return face;
+  }
+
+  face.normal   = normal / normalLength;
+  face.distance = face.normal.dot(firstPos);
+
+  return face;
+}
+
+template <std::size_t N>
+std::size_t findClosestFace(const std::array<Face, N>& faces, std::size_t faceCount) {
+  std::size_t closestIndex = 0;
+
+  for (std::size_t faceIndex = 1; faceIndex < faceCount; ++faceIndex) {
+    if (faces[faceIndex].distance < faces[closestIndex].distance)
+      closestIndex = faceIndex;
+  }
+
+  return closestIndex;
+}
+
+/// Runs the EPA algorithm, expanding the tetrahedron given by GJK towards the surface of the Minkowski difference.
+/// The face of the difference the closest to the origin gives the contact normal & depth.
+void runEpa(const Shape& firstShape, const Shape& secondShape, const Simplex& simplex, Contact& contact) {
+  std::array<SupportPoint, MaxEpaVertices> vertices;
+  std::size_t vertexCount = 4;
+
+  for (std::size_t pointIndex = 0; pointIndex < 4; ++pointIndex)
+    vertices[pointIndex] = simplex.points[pointIndex];
+
+  std::array<Face, MaxEpaFaces> faces;
+  std::size_t faceCount = 0;
+
+  // The tetrahedron's faces are oriented away from its center
+  const Vec3f center = (vertices[0].point + vertices[1].point + vertices[2].point + vertices[3].point) / 4.f;
+  constexpr std::array<std::array<std::uint32_t, 3>, 4> tetraFaces = {{ {{ 0, 1, 2 }}, {{ 0, 3, 1 }}, {{ 0, 2, 3 }}, {{ 1, 3, 2 }} }};
+
+  for (const std::array<std::uint32_t, 3>& tetraFace : tetraFaces) {
+    Face face = makeFace(vertices, tetraFace[0], tetraFace[1], tetraFace[2]);
+
+    if (face.normal.dot(vertices[tetraFace[0]].point - center) < 0.f)
+      face = makeFace(vertices, tetraFace[0], tetraFace[2], tetraFace[1]);
+
+    faces[faceCount++] = face;
+  }
+
+  std::array<Edge, MaxEpaEdges> horizon;
+
+  for (std::size_t iterIndex = 0; iterIndex < MaxEpaIterations; ++iterIndex) {
+    const Face& closestFace = faces[findClosestFace(faces, faceCount)];
+    const SupportPoint supportPoint = computeSupportPoint(firstShape, secondShape, closestFace.normal);
+
+    // The difference doesn't extend further than the closest face: its surface has been reached
+    if (supportPoint.point.dot(closestFace.normal) - closestFace.distance <= Tolerance || vertexCount == MaxEpaVertices)
+      break;
+
+    const auto newIndex = static_cast<std::uint32_t>(vertexCount);
+    vertices[vertexCount++] = supportPoint;
+
+    // Removing all faces visible from the new point, keeping the edges bounding the hole they leave
+    std::size_t edgeCount = 0;
+
+    for (std::size_t faceIndex = 0; faceIndex < faceCount;) {
+      const Face& face = faces[faceIndex];
+
+      if (face.normal.dot(supportPoint.point - vertices[face.indices[0]].point) <= 0.f) {
+        ++faceIndex;
+        continue;
+      }
+
+      for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+        const Edge edge { face.indices[edgeIndex], face.indices[(edgeIndex + 1) % 3] };
+        bool isShared = false;
+
+        // An edge shared by two removed faces has been found in the opposite direction, & is not on the hole's boundary
+        for (std::size_t horizonIndex = 0; horizonIndex < edgeCount; ++horizonIndex) {
+          if (horizon[horizonIndex].firstIndex == edge.secondIndex && horizon[horizonIndex].secondIndex == edge.firstIndex) {
+            horizon[horizonIndex] = horizon[--edgeCount];
+            isShared = true;
+            break;
+          }
+        }
+
+        if (!isShared) {
+          assert("Error: Too many edges on the EPA horizon." && edgeCount < MaxEpaEdges);
+          horizon[edgeCount++] = edge;
+        }
+      }
+
+      faces[faceIndex] = faces[--faceCount];
+    }
+
+    // Filling the hole with faces linking its boundary to the new point, keeping their counter-clockwise order
+    for (std::size_t edgeIndex = 0; edgeIndex < edgeCount; ++edgeIndex) {
+      assert("Error: Too many faces in the EPA polytope." && faceCount < MaxEpaFaces);
+      faces[faceCount++] = makeFace(vertices, horizon[edgeIndex].firstIndex, horizon[edgeIndex].secondIndex, newIndex);
+    }
+  }
+
+  const Face& closestFace = faces[findClosestFace(faces, faceCount)];
+
+  contact.normal = closestFace.normal;
+  contact.depth  = std::max(closestFace.distance, 0.f);
+
+  // The contact points are found from the barycentric coordinates of the origin's projection onto the closest face
+  const SupportPoint& firstVertex  = vertices[closestFace.indices[0]];
+  const SupportPoint& secondVertex = vertices[closestFace.indices[1]];
+  const SupportPoint& thirdVertex  = vertices[closestFace.indices[2]];
+
+  const Vec3f firstEdge  = secondVertex.point - firstVertex.point;
+  const Vec3f secondEdge = thirdVertex.point - firstVertex.point;
+  const Vec3f projDir    = closestFace.normal * closestFace.distance - firstVertex.point;
+
+  const float firstDot      = firstEdge.dot(firstEdge);
+  const float crossDot      = firstEdge.dot(secondEdge);
+  const float secondDot     = secondEdge.dot(secondEdge);
+  const float firstProjDot  = projDir.dot(firstEdge);
+  const float secondProjDot = projDir.dot(secondEdge);
+  const float denominator   = firstDot * secondDot - crossDot * crossDot;
+
+  float secondCoeff = 1.f / 3.f;
+  float thirdCoeff  = 1.f / 3.f;
+
+  if (denominator > 0.f) {
+    secondCoeff = (secondDot * firstProjDot - crossDot * secondProjDot) / denominator;
+    thirdCoeff  = (firstDot * secondProjDot - crossDot * firstProjDot) / denominator;
+  }
+
+  const float firstCoeff = 1.f - secondCoeff - thirdCoeff;
+
+  contact.firstPoint  = firstVertex.firstPoint * firstCoeff + secondVertex.firstPoint * secondCoeff + thirdVertex.firstPoint * thirdCoeff;
+  contact.secondPoint = firstVertex.secondPoint * firstCoeff + secondVertex.secondPoint * secondCoeff + thirdVertex.secondPoint * thirdCoeff;
+}
+
+} // namespace
+
+bool intersects(const Shape& firstShape, const Shape& secondShape) {
+  Simplex simplex;
+  return runGjk(firstShape, secondShape, simplex);
+}
+
+bool computeContact(const Shape& firstShape, const Shape& secondShape, Contact& contact) {
+  Simplex simplex;
+
+  if (!runGjk(firstShape, secondShape, simplex))
+    return false;
+
+  Vec3f flatNormal;
+
+  if (completeSimplex(firstShape, secondShape, simplex, flatNormal)) {
+    runEpa(firstShape, secondShape, simplex, contact);
+    return true;
+  }
+
+  // The Minkowski difference being flat, the shapes can't penetrate each other; they only touch, in the flat's normal direction
+  const Vec3f centersDir = secondShape.computeCentroid() - firstShape.computeCentroid();
+
+  contact.normal      = (flatNormal.dot(centersDir) < 0.f ? -flatNormal : flatNormal);
+  contact.depth       = 0.f;
+  contact.firstPoint  = simplex.points[0].firstPoint;
+  contact.secondPoint = simplex.points[0].secondPoint;
+
+  return true;
+}
+
+} // namespace Gjk
+
+} // namespace Raz
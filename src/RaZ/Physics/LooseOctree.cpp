@@ -0,0 +1,312 @@
+#include "RaZ/Physics/LooseOctree.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::uint64_t RootKey = 1;
+constexpr std::uint32_t RootIndex = 0;
+
+// Each traversed level stacks at most 8 children, one of which is immediately popped
+constexpr std::size_t MaxStackSize = 7 * LooseOctree::MaxDepth + 8;
+
+inline float computeSquaredDistance(const Vec3f& point, const Vec3f& minBounds, const Vec3f& maxBounds) {
+  float sqDistance = 0.f;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float distance = std::max(minBounds[axis] - point[axis], 0.f) + std::max(point[axis] - maxBounds[axis], 0.f);
+    sqDistance += distance * distance;
+  }
+
+  return sqDistance;
+}
+
+inline bool overlaps(const Vec3f& minBounds1, const Vec3f& maxBounds1, const Vec3f& minBounds2, const Vec3f& maxBounds2) {
+  return (minBounds1[0] <= maxBounds2[0] && maxBounds1[0] >= minBounds2[0]
+       && minBounds1[1] <= maxBounds2[1] && maxBounds1[1] >= minBounds2[1]
+       && minBounds1[2] <= maxBounds2[2] && maxBounds1[2] >= minBounds2[2]);
+}
+
+} // namespace
+
+LooseOctree::LooseOctree(const Vec3f& center, float halfSize, std::size_t maxDepth) : m_maxDepth{ maxDepth } {
+  if (maxDepth > MaxDepth)
+    throw std::runtime_error("Error: A loose octree's depth cannot be greater than " + std::to_string(MaxDepth) + '.');
+
+  Node root;
+  root.center   = center;
+  root.halfSize = halfSize;
+  root.key      = RootKey;
+
+  m_nodes.push_back(root);
+  m_nodeIndices.emplace(RootKey, RootIndex);
+}
+
+std::uint32_t LooseOctree::addObject(const AABB& aabb) {
+  std::uint32_t objectIndex {};
+
+  if (m_freeObjectIndex != NullIndex) {
+    objectIndex       = m_freeObjectIndex;
+    m_freeObjectIndex = m_objects[objectIndex].nextIndex;
+  } else {
+    objectIndex = static_cast<std::uint32_t>(m_objects.size());
+    m_objects.emplace_back();
+  }
+
+  Object& object   = m_objects[objectIndex];
+  object.minBounds = aabb.getLeftBottomBackPos();
+  object.maxBounds = aabb.getRightTopFrontPos();
+
+  linkObject(objectIndex, findOrCreateNode(computeNodeKey(object.minBounds, object.maxBounds)));
+  ++m_objectCount;
+
+  return objectIndex;
+}
+
+void LooseOctree::removeObject(std::uint32_t objectIndex) {
+  assert("Error: Invalid loose octree object index." && isObjectValid(objectIndex));
+
+  unlinkObject(objectIndex);
+
+  Object& object    = m_objects[objectIndex];
+  object.nodeIndex  = NullIndex;
+  object.nextIndex  = m_freeObjectIndex;
+  m_freeObjectIndex = objectIndex;
+
+  --m_objectCount;
+}
+
+bool LooseOctree::moveObject(std::uint32_t objectIndex, const AABB& aabb) {
+  assert("Error: Invalid loose octree object index." && isObjectValid(objectIndex));
+
+  Object& object   = m_objects[objectIndex];
+  object.minBounds = aabb.getLeftBottomBackPos();
+  object.maxBounds = aabb.getRightTopFrontPos();
+
+  const std::uint64_t nodeKey = computeNodeKey(object.minBounds, object.maxBounds);
+
+  if (m_nodes[object.nodeIndex].key == nodeKey)
+    return false;
+
+  // The object must be unlinked first: the nodes it leaves empty are removed, which may include the new node or one of its ancestors
+  unlinkObject(objectIndex);
+  linkObject(objectIndex, findOrCreateNode(nodeKey));
+
+  return true;
+}
+
+void LooseOctree::queryRadius(const Vec3f& center, float radius, std::vector<std::uint32_t>& objectIndices) const {
+  const float sqRadius = radius * radius;
+
+  query([&center, sqRadius] (const Node& node) {
+    const float looseHalfSize = node.halfSize * 2.f;
+    return (computeSquaredDistance(center, node.center - looseHalfSize, node.center + looseHalfSize) <= sqRadius);
+  }, [&center, sqRadius] (const Object& object) {
+    return (computeSquaredDistance(center, object.minBounds, object.maxBounds) <= sqRadius);
+  }, objectIndices);
+}
+
+void LooseOctree::queryBox(const AABB& aabb, std::vector<std::uint32_t>& objectIndices) const {
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  query([&minPos, &maxPos] (const Node& node) {
+    const float looseHalfSize = node.halfSize * 2.f;
+    return overlaps(node.center - looseHalfSize, node.center + looseHalfSize, minPos, maxPos);
+  }, [&minPos, &maxPos] (const Object& object) {
+    return overlaps(object.minBounds, object.maxBounds, minPos, maxPos);
+  }, objectIndices);
+}
+
+void LooseOctree::queryRadius(const std::vector<Vec3f>& centers, float radius,
+                              std::vector<std::uint32_t>& objectIndices, std::vector<std::size_t>& queryOffsets) const {
+  objectIndices.clear();
+  queryOffsets.clear();
+  queryOffsets.reserve(centers.size() + 1);
+
+  for (const Vec3f& center : centers) {
+    queryOffsets.push_back(objectIndices.size());
+    queryRadius(center, radius, objectIndices);
+  }
+
+  queryOffsets.push_back(objectIndices.size());
+}
+
+void LooseOctree::queryBox(const std::vector<AABB>& aabbs, std::vector<std::uint32_t>& objectIndices, std::vector<std::size_t>& queryOffsets) const {
+  objectIndices.clear();
+  queryOffsets.clear();
+  queryOffsets.reserve(aabbs.size() + 1);
+
+  for (const AABB& aabb : aabbs) {
+    queryOffsets.push_back(objectIndices.size());
+    queryBox(aabb, objectIndices);
+  }
+
+  queryOffsets.push_back(objectIndices.size());
+}
+
+std::uint64_t LooseOctree::computeNodeKey(const Vec3f& minBounds, const Vec3f& maxBounds) const {
+  const Node& root = m_nodes[RootIndex];
+
+  const Vec3f center = (minBounds + maxBounds) * 0.5f;
+  const Vec3f rootMin = root.center - root.halfSize;
+  const float rootSize = root.halfSize * 2.f;
+
+  // Objects whose center is out of the root cell can't be guaranteed to fit in any loose bounds, & are kept in the root
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    if (!(center[axis] >= rootMin[axis] && center[axis] <= rootMin[axis] + rootSize))
+      return RootKey;
+  }
+
+  const Vec3f halfExtents = (maxBounds - minBounds) * 0.5f;
+  const float maxHalfExtent = std::max(halfExtents[0], std::max(halfExtents[1], halfExtents[2]));
+
+  // An object with its center in a cell is contained by the cell's loose bounds as long as it isn't larger than the cell
+  std::size_t depth = 0;
+  float cellHalfSize = root.halfSize;
+
+  while (depth < m_maxDepth && cellHalfSize * 0.5f >= maxHalfExtent) {
+    cellHalfSize *= 0.5f;
+    ++depth;
+  }
+
+  const std::uint32_t maxCellIndex = (1u << depth) - 1;
+  std::array<std::uint32_t, 3> cellIndices {};
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float cellIndex = (center[axis] - rootMin[axis]) / (cellHalfSize * 2.f);
+    cellIndices[axis] = std::min(static_cast<std::uint32_t>(cellIndex), maxCellIndex);
+  }
+
+  // The key starts with a 1 bit, followed by the octant (x, y & z bits) of each level from the root down to the node's
+  std::uint64_t key = RootKey;
+
+  for (std::size_t level = depth; level > 0; --level) {
+    const std::size_t bitIndex = level - 1;
+
+    key = (key << 3u) | ((cellIndices[0] >> bitIndex) & 1u)
+                      | (((cellIndices[1] >> bitIndex) & 1u) << 1u)
+                      | (((cellIndices[2] >> bitIndex) & 1u) << 2u);
+  }
+
+  return key;
+}
+
+std::uint32_t LooseOctree::findOrCreateNode(std::uint64_t key) {
+  const auto nodeIter = m_nodeIndices.find(key);
+
+  if (nodeIter != m_nodeIndices.end())
+    return nodeIter->second;
+
+  // The node doesn't exist yet; its parent, found or created likewise, gives its position
+  const std::uint32_t parentIndex = findOrCreateNode(key >> 3u);
+  std::uint32_t nodeIndex {};
+
+  if (m_freeNodeIndex != NullIndex) {
+    nodeIndex       = m_freeNodeIndex;
+    m_freeNodeIndex = m_nodes[nodeIndex].parentIndex;
+    m_nodes[nodeIndex] = Node();
+  } else {
+    nodeIndex = static_cast<std::uint32_t>(m_nodes.size());
+    m_nodes.emplace_back();
+  }
+
+  Node& parent = m_nodes[parentIndex];
+  Node& node   = m_nodes[nodeIndex];
+
+  const auto octant       = static_cast<std::size_t>(key & 7u);
+  const float quarterSize   = parent.halfSize * 0.5f;
+
+  node.center      = parent.center + Vec3f({ (octant & 1u ? quarterSize : -quarterSize),
+                                             (octant & 2u ? quarterSize : -quarterSize),
+                                             (octant & 4u ? quarterSize : -quarterSize) });
+  node.halfSize    = quarterSize;
+  node.key         = key;
+  node.parentIndex = parentIndex;
+
+  parent.childIndices[octant] = nodeIndex;
+  ++parent.childCount;
+
+  m_nodeIndices.emplace(key, nodeIndex);
+
+  return nodeIndex;
+}
+
+void LooseOctree::linkObject(std::uint32_t objectIndex, std::uint32_t nodeIndex) {
+  Node& node     = m_nodes[nodeIndex];
+  Object& object = m_objects[objectIndex];
+
+  object.nodeIndex = nodeIndex;
+  object.prevIndex = NullIndex;
+  object.nextIndex = node.firstObjectIndex;
+
+  if (node.firstObjectIndex != NullIndex)
+    m_objects[node.firstObjectIndex].prevIndex = objectIndex;
+
+  node.firstObjectIndex = objectIndex;
+  ++node.objectCount;
+}
+
+void LooseOctree::unlinkObject(std::uint32_t objectIndex) {
+  const Object& object = m_objects[objectIndex];
+  std::uint32_t nodeIndex = object.nodeIndex;
+
+  if (object.prevIndex != NullIndex)
+    m_objects[object.prevIndex].nextIndex = object.nextIndex;
+  else
+    m_nodes[nodeIndex].firstObjectIndex = object.nextIndex;
+
+  if (object.nextIndex != NullIndex)
+    m_objects[object.nextIndex].prevIndex = object.prevIndex;
+
+  --m_nodes[nodeIndex].objectCount;
+
+  // Empty leaves are removed, which may leave their parent empty as well; the root always remains
+  while (nodeIndex != RootIndex && m_nodes[nodeIndex].objectCount == 0 && m_nodes[nodeIndex].childCount == 0) {
+    Node& node = m_nodes[nodeIndex];
+    Node& parent = m_nodes[node.parentIndex];
+
+    parent.childIndices[node.key & 7u] = NullIndex;
+    --parent.childCount;
+
+    m_nodeIndices.erase(node.key);
+
+    const std::uint32_t parentIndex = node.parentIndex;
+    node.parentIndex = m_freeNodeIndex;
+    m_freeNodeIndex  = nodeIndex;
+
+    nodeIndex = parentIndex;
+  }
+}
+
+template <typename NodeTestT, typename ObjectTestT>
+void LooseOctree::query(const NodeTestT& testNode, const ObjectTestT& testObject, std::vector<std::uint32_t>& objectIndices) const {
+  // The root is always traversed, as it may hold objects out of its bounds
+  std::array<std::uint32_t, MaxStackSize> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = RootIndex;
+
+  while (stackSize > 0) {
+    const Node& node = m_nodes[stack[--stackSize]];
+
+    for (std::uint32_t objectIndex = node.firstObjectIndex; objectIndex != NullIndex; objectIndex = m_objects[objectIndex].nextIndex) {
+      if (testObject(m_objects[objectIndex]))
+        objectIndices.push_back(objectIndex);
+    }
+
+    if (node.childCount == 0)
+      continue;
+
+    for (const std::uint32_t childIndex : node.childIndices) {
+      if (childIndex != NullIndex && testNode(m_nodes[childIndex]))
+        stack[stackSize++] = childIndex;
+    }
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,94 @@
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/OctreeSystem.hpp"
+
+namespace Raz {
+
+OctreeSystem::OctreeSystem(const Vec3f& center, float halfSize, std::size_t maxDepth) : m_octree(center, halfSize, maxDepth) {
+  m_acceptedComponents.setBit(Component::getId<AABB>());
+}
+
+void OctreeSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+
+  Object object {};
+  object.index = m_octree.addObject(computeWorldBox(*entity, object));
+  m_entityObjects.emplace(entity.get(), object);
+
+  if (object.index >= m_objectEntities.size())
+    m_objectEntities.resize(object.index + 1);
+
+  m_objectEntities[object.index] = entity.get();
+}
+
+void OctreeSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  const auto objectIter = m_entityObjects.find(entity.get());
+
+  if (objectIter == m_entityObjects.end())
+    return;
+
+  m_octree.removeObject(objectIter->second.index);
+  m_objectEntities[objectIter->second.index] = nullptr;
+  m_entityObjects.erase(objectIter);
+}
+
+void OctreeSystem::update(float) {
+  for (const Entity* entity : m_entities) {
+    if (!entity->hasComponent<Transform>())
+      continue;
+
+    Object& object = m_entityObjects.find(entity)->second;
+
+    if (entity->getComponent<Transform>().getTransformMatrix().getData() == object.transform.getData())
+      continue;
+
+    m_octree.moveObject(object.index, computeWorldBox(*entity, object));
+  }
+}
+
+void OctreeSystem::refreshEntity(const Entity& entity) {
+  const auto objectIter = m_entityObjects.find(&entity);
+
+  if (objectIter == m_entityObjects.end())
+    return;
+
+  Object& object = objectIter->second;
+  m_octree.moveObject(object.index, computeWorldBox(entity, object));
+}
+
+void OctreeSystem::queryRadius(const Vec3f& center, float radius, std::vector<Entity*>& entities) const {
+  std::vector<std::uint32_t> objectIndices;
+  m_octree.queryRadius(center, radius, objectIndices);
+  collectEntities(objectIndices, entities);
+}
+
+void OctreeSystem::queryBox(const AABB& aabb, std::vector<Entity*>& entities) const {
+  std::vector<std::uint32_t> objectIndices;
+  m_octree.queryBox(aabb, objectIndices);
+  collectEntities(objectIndices, entities);
+}
+
+AABB OctreeSystem::computeWorldBox(const Entity& entity, Object& object) const {
+  const auto& aabb = entity.getComponent<AABB>();
+
+  if (!entity.hasComponent<Transform>())
+    return aabb;
+
+  object.transform = entity.getComponent<Transform>().getTransformMatrix();
+  return aabb.computeTransformed(object.transform);
+}
+
+void OctreeSystem::collectEntities(const std::vector<std::uint32_t>& objectIndices, std::vector<Entity*>& entities) const {
+  entities.clear();
+  entities.reserve(objectIndices.size());
+
+  for (const std::uint32_t objectIndex : objectIndices) {
+    Entity* entity = m_objectEntities[objectIndex];
+
+    if (entity->isEnabled())
+      entities.push_back(entity);
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,1105 @@
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Raz {
+
+namespace {
+
+// Distance under which separated shapes already generate contacts, keeping resting contacts alive & anticipating impacts
+constexpr float ContactMargin = 0.02f;
+// Penetration left uncorrected, avoiding jitter on resting contacts
+constexpr float PenetrationSlop = 0.005f;
+// Fraction of the remaining penetration corrected at each step
+constexpr float BaumgarteFactor = 0.2f;
+// Approaching speed under which contacts don't bounce, preventing resting bodies from vibrating
+constexpr float RestitutionThreshold = 1.f;
+// Distance under which a new contact point is considered to be the same as one of the previous step, & inherits its impulses
+constexpr float WarmStartDistance = 0.05f;
+// Separation advantage an edge-edge axis must have over the face ones to be selected, faces giving more stable contacts
+constexpr float EdgeAxisTolerance = 0.005f;
+constexpr float SleepLinearSpeed  = 0.05f;
+constexpr float SleepAngularSpeed = 0.05f;
+// Duration during which all bodies of an island must have stayed under the sleep speeds for it to fall asleep
+constexpr float TimeToSleep = 0.5f;
+
+struct Box {
+  Vec3f center;
+  const std::array<Vec3f, 3>& axes;
+  const Vec3f& halfExtents;
+};
+
+/// Contact points between two shapes, with a normal going from the first shape to the second.
+struct ContactSet {
+  void add(const Vec3f& position, float depth) {
+    positions[count] = position;
+    depths[count]    = depth;
+    ++count;
+  }
+
+  Vec3f normal {};
+  std::size_t count = 0;
+  std::array<Vec3f, 8> positions {};
+  std::array<float, 8> depths {};
+};
+
+template <typename T>
+void removeElement(std::vector<T>& vec, std::size_t index) {
+  vec[index] = std::move(vec.back());
+  vec.pop_back();
+}
+
+Mat3f computeWorldInverseInertia(const std::array<Vec3f, 3>& axes, const Vec3f& localInvInertia) {
+  // R * I^-1 * R^T, the rotation's columns being the body's axes in world coordinates
+  Mat3f invInertia;
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    for (std::size_t colIndex = 0; colIndex < 3; ++colIndex) {
+      float value = 0.f;
+
+      for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex)
+        value += axes[axisIndex][rowIndex] * axes[axisIndex][colIndex] * localInvInertia[axisIndex];
+
+      invInertia[rowIndex * 3 + colIndex] = value;
+    }
+  }
+
+  return invInertia;
+}
+
+float projectBox(const Box& box, const Vec3f& axis) {
+  return box.halfExtents[0] * std::abs(box.axes[0].dot(axis))
+       + box.halfExtents[1] * std::abs(box.axes[1].dot(axis))
+       + box.halfExtents[2] * std::abs(box.axes[2].dot(axis));
+}
+
+/// Keeps at most 4 contacts out of a set, covering the largest area: the deepest one, the furthest from it, & the two spanning the largest triangles on each side.
+void reduceContacts(ContactSet& contacts) {
+  if (contacts.count <= 4)
+    return;
+
+  std::array<std::size_t, 4> keptIndices {};
+  keptIndices[0] = static_cast<std::size_t>(std::max_element(contacts.depths.cbegin(), contacts.depths.cbegin() + contacts.count) - contacts.depths.cbegin());
+
+  const Vec3f& firstPos = contacts.positions[keptIndices[0]];
+  float maxSqDist = -1.f;
+
+  for (std::size_t contactIndex = 0; contactIndex < contacts.count; ++contactIndex) {
+    const float sqDist = (contacts.positions[contactIndex] - firstPos).computeSquaredLength();
+
+    if (sqDist > maxSqDist) {
+      maxSqDist      = sqDist;
+      keptIndices[1] = contactIndex;
+    }
+  }
+
+  const Vec3f firstEdge = contacts.positions[keptIndices[1]] - firstPos;
+  float minArea = std::numeric_limits<float>::max();
+  float maxArea = std::numeric_limits<float>::lowest();
+
+  for (std::size_t contactIndex = 0; contactIndex < contacts.count; ++contactIndex) {
+    const float area = firstEdge.cross(contacts.positions[contactIndex] - firstPos).dot(contacts.normal);
+
+    if (area > maxArea) {
+      maxArea        = area;
+      keptIndices[2] = contactIndex;
+    }
+
+    if (area < minArea) {
+      minArea        = area;
+      keptIndices[3] = contactIndex;
+    }
+  }
+
+  ContactSet reducedContacts;
+  reducedContacts.normal = contacts.normal;
+
+  for (std::size_t keptIndex = 0; keptIndex < keptIndices.size(); ++keptIndex) {
+    // If all contacts are aligned, the same one may be selected several times
+    if (std::find(keptIndices.cbegin(), keptIndices.cbegin() + keptIndex, keptIndices[keptIndex]) == keptIndices.cbegin() + keptIndex)
+      reducedContacts.add(contacts.positions[keptIndices[keptIndex]], contacts.depths[keptIndices[keptIndex]]);
+  }
+
+  contacts = reducedContacts;
+}
+
+void collideSpheres(const Vec3f& firstCenter, float firstRadius, const Vec3f& secondCenter, float secondRadius, ContactSet& contacts) {
+  const Vec3f centersDiff = secondCenter - firstCenter;
+  const float sqDist      = centersDiff.computeSquaredLength();
+  const float radiusSum   = firstRadius + secondRadius;
+
+  if (sqDist > (radiusSum + ContactMargin) * (radiusSum + ContactMargin))
+    return;
+
+  const float dist = std::sqrt(sqDist);
+  const float depth = radiusSum - dist;
+
+  // Concentric spheres are pushed apart along an arbitrary direction
+  contacts.normal = (dist > std::numeric_limits<float>::epsilon() ? centersDiff / dist : Axis::Y);
+  contacts.add(firstCenter + contacts.normal * (firstRadius - depth * 0.5f), depth);
+}
+
+void collideSphereBox(const Vec3f& center, float radius, const Box& box, ContactSet& contacts) {
+  const Vec3f relCenter = center - box.center;
+  Vec3f localCenter;
+  Vec3f localClosest;
+  bool isInside = true;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    localCenter[axisIndex]  = relCenter.dot(box.axes[axisIndex]);
+    localClosest[axisIndex] = std::max(-box.halfExtents[axisIndex], std::min(localCenter[axisIndex], box.halfExtents[axisIndex]));
+    isInside &= (localClosest[axisIndex] == localCenter[axisIndex]);
+  }
+
+  if (isInside) {
+    // The sphere's center is inside the box: it is pushed out through the closest face
+    std::size_t faceAxis = 0;
+    float faceDist       = std::numeric_limits<float>::max();
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      const float dist = box.halfExtents[axisIndex] - std::abs(localCenter[axisIndex]);
+
+      if (dist < faceDist) {
+        faceDist = dist;
+        faceAxis = axisIndex;
+      }
+    }
+
+    const Vec3f faceNormal = box.axes[faceAxis] * (localCenter[faceAxis] >= 0.f ? 1.f : -1.f);
+
+    contacts.normal = -faceNormal;
+    contacts.add(center + faceNormal * ((faceDist - radius) * 0.5f), radius + faceDist);
+    return;
+  }
+
+  const Vec3f closestPoint = box.center + box.axes[0] * localClosest[0] + box.axes[1] * localClosest[1] + box.axes[2] * localClosest[2];
+  const Vec3f closestDiff  = closestPoint - center;
+  const float sqDist       = closestDiff.computeSquaredLength();
+
+  if (sqDist > (radius + ContactMargin) * (radius + ContactMargin))
+    return;
+
+  const float dist = std::sqrt(sqDist);
+
+  contacts.normal = closestDiff / dist;
+  contacts.add((center + contacts.normal * radius + closestPoint) * 0.5f, radius - dist);
+}
+
+void collideSpherePlane(const Vec3f& center, float radius, const Vec3f& planeNormal, float planeDistance, ContactSet& contacts) {
+  const float dist = planeNormal.dot(center) - planeDistance;
+
+  if (dist - radius > ContactMargin)
+    return;
+
+  contacts.normal = -planeNormal;
+  contacts.add(center - planeNormal * ((radius + dist) * 0.5f), radius - dist);
+}
+
+void collideBoxPlane(const Box& box, const Vec3f& planeNormal, float planeDistance, ContactSet& contacts) {
+  contacts.normal = -planeNormal;
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    Vec3f corner = box.center;
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex)
+      corner += box.axes[axisIndex] * (box.halfExtents[axisIndex] * ((cornerIndex >> axisIndex) & 1u ? 1.f : -1.f));
+
+    const float dist = planeNormal.dot(corner) - planeDistance;
+
+    if (dist <= ContactMargin)
+      contacts.add(corner - planeNormal * (dist * 0.5f), -dist);
+  }
+
+  reduceContacts(contacts);
+}
+
+/// Clips a convex polygon, keeping its part behind a plane.
+std::size_t clipPolygon(const std::array<Vec3f, 8>& polygon, std::size_t pointCount,
+                        const Vec3f& planeNormal, float planeDistance, std::array<Vec3f, 8>& clippedPolygon) {
+  std::size_t clippedCount = 0;
+
+  for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+    const Vec3f& point     = polygon[pointIndex];
+    const Vec3f& nextPoint = polygon[(pointIndex + 1) % pointCount];
+    const float dist       = planeNormal.dot(point) - planeDistance;
+    const float nextDist   = planeNormal.dot(nextPoint) - planeDistance;
+
+    if (dist <= 0.f)
+      clippedPolygon[clippedCount++] = point;
+
+    if ((dist <= 0.f) != (nextDist <= 0.f))
+      clippedPolygon[clippedCount++] = point + (nextPoint - point) * (dist / (dist - nextDist));
+  }
+
+  return clippedCount;
+}
+
+/// Computes the contacts of an incident box's face against a reference box's face, clipping the former by the latter's sides.
+void computeFaceContacts(const Box& refBox, const Box& incBox, std::size_t refAxis, bool isFlipped, ContactSet& contacts) {
+  const Vec3f refNormal = refBox.axes[refAxis] * ((incBox.center - refBox.center).dot(refBox.axes[refAxis]) >= 0.f ? 1.f : -1.f);
+
+  // The incident face is the one whose normal is the most opposed to the reference one
+  std::size_t incAxis = 0;
+  float maxAbsDot     = -1.f;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const float absDot = std::abs(incBox.axes[axisIndex].dot(refNormal));
+
+    if (absDot > maxAbsDot) {
+      maxAbsDot = absDot;
+      incAxis   = axisIndex;
+    }
+  }
+
+  const Vec3f incNormal     = incBox.axes[incAxis] * (incBox.axes[incAxis].dot(refNormal) > 0.f ? -1.f : 1.f);
+  const Vec3f incFaceCenter = incBox.center + incNormal * incBox.halfExtents[incAxis];
+  const Vec3f incFirstEdge  = incBox.axes[(incAxis + 1) % 3] * incBox.halfExtents[(incAxis + 1) % 3];
+  const Vec3f incSecondEdge = incBox.axes[(incAxis + 2) % 3] * incBox.halfExtents[(incAxis + 2) % 3];
+
+  std::array<Vec3f, 8> polygon {};
+  polygon[0] = incFaceCenter + incFirstEdge + incSecondEdge;
+  polygon[1] = incFaceCenter - incFirstEdge + incSecondEdge;
+  polygon[2] = incFaceCenter - incFirstEdge - incSecondEdge;
+  polygon[3] = incFaceCenter + incFirstEdge - incSecondEdge;
+  std::size_t pointCount = 4;
+
+  std::array<Vec3f, 8> clippedPolygon {};
+
+  for (std::size_t sideIndex = 0; sideIndex < 4 && pointCount > 0; ++sideIndex) {
+    const std::size_t sideAxis = (refAxis + 1 + sideIndex / 2) % 3;
+    const Vec3f sideNormal     = refBox.axes[sideAxis] * (sideIndex % 2 == 0 ? 1.f : -1.f);
+
+    pointCount = clipPolygon(polygon, pointCount, sideNormal, sideNormal.dot(refBox.center) + refBox.halfExtents[sideAxis], clippedPolygon);
+    std::swap(polygon, clippedPolygon);
+  }
+
+  const float refFaceDistance = refNormal.dot(refBox.center) + refBox.halfExtents[refAxis];
+  contacts.normal = (isFlipped ? -refNormal : refNormal);
+
+  for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+    const float dist = refNormal.dot(polygon[pointIndex]) - refFaceDistance;
+
+    if (dist <= ContactMargin)
+      contacts.add(polygon[pointIndex] - refNormal * (dist * 0.5f), -dist);
+  }
+
+  reduceContacts(contacts);
+}
+
+/// Computes the single contact between the closest edges of two boxes.
+void computeEdgeContact(const Box& firstBox, const Box& secondBox, std::size_t firstAxis, std::size_t secondAxis,
+                        const Vec3f& normal, float separation, ContactSet& contacts) {
+  // Each edge is the one of its box furthest along the normal, towards the other box
+  Vec3f firstEdgeCenter  = firstBox.center;
+  Vec3f secondEdgeCenter = secondBox.center;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    if (axisIndex != firstAxis)
+      firstEdgeCenter += firstBox.axes[axisIndex] * (firstBox.halfExtents[axisIndex] * (firstBox.axes[axisIndex].dot(normal) > 0.f ? 1.f : -1.f));
+
+    if (axisIndex != secondAxis)
+      secondEdgeCenter += secondBox.axes[axisIndex] * (secondBox.halfExtents[axisIndex] * (secondBox.axes[axisIndex].dot(normal) > 0.f ? -1.f : 1.f));
+  }
+
+  // Closest points between both edges
+  const Vec3f& firstDir      = firstBox.axes[firstAxis];
+  const Vec3f& secondDir     = secondBox.axes[secondAxis];
+  const float firstHalfLength  = firstBox.halfExtents[firstAxis];
+  const float secondHalfLength = secondBox.halfExtents[secondAxis];
+
+  const Vec3f centersDiff = firstEdgeCenter - secondEdgeCenter;
+  const float dirsDot     = firstDir.dot(secondDir);
+  const float firstDot    = firstDir.dot(centersDiff);
+  const float secondDot   = secondDir.dot(centersDiff);
+  const float denom       = 1.f - dirsDot * dirsDot;
+
+  float firstParam = (denom > std::numeric_limits<float>::epsilon() ? (dirsDot * secondDot - firstDot) / denom : 0.f);
+  firstParam = std::max(-firstHalfLength, std::min(firstParam, firstHalfLength));
+
+  float secondParam = std::max(-secondHalfLength, std::min(dirsDot * firstParam + secondDot, secondHalfLength));
+  firstParam = std::max(-firstHalfLength, std::min(dirsDot * secondParam - firstDot, firstHalfLength));
+
+  contacts.normal = normal;
+  contacts.add((firstEdgeCenter + firstDir * firstParam + secondEdgeCenter + secondDir * secondParam) * 0.5f, -separation);
+}
+
+/// Finds the axis of least penetration between two boxes with the separating axis theorem, then computes their contacts along it.
+void collideBoxes(const Box& firstBox, const Box& secondBox, ContactSet& contacts) {
+  const Vec3f centersDiff = secondBox.center - firstBox.center;
+
+  float firstFaceSep = std::numeric_limits<float>::lowest();
+  std::size_t firstFaceAxis = 0;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const Vec3f& axis = firstBox.axes[axisIndex];
+    const float separation = std::abs(centersDiff.dot(axis)) - firstBox.halfExtents[axisIndex] - projectBox(secondBox, axis);
+
+    if (separation > ContactMargin)
+      return;
+
+    if (separation > firstFaceSep) {
+      firstFaceSep  = separation;
+      firstFaceAxis = axisIndex;
+    }
+  }
+
+  float secondFaceSep = std::numeric_limits<float>::lowest();
+  std::size_t secondFaceAxis = 0;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const Vec3f& axis = secondBox.axes[axisIndex];
+    const float separation = std::abs(centersDiff.dot(axis)) - projectBox(firstBox, axis) - secondBox.halfExtents[axisIndex];
+
+    if (separation > ContactMargin)
+      return;
+
+    if (separation > secondFaceSep) {
+      secondFaceSep  = separation;
+      secondFaceAxis = axisIndex;
+    }
+  }
+
+  float edgeSep = std::numeric_limits<float>::lowest();
+  std::size_t firstEdgeAxis  = 0;
+  std::size_t secondEdgeAxis = 0;
+  Vec3f edgeNormal;
+
+  for (std::size_t firstIndex = 0; firstIndex < 3; ++firstIndex) {
+    for (std::size_t secondIndex = 0; secondIndex < 3; ++secondIndex) {
+      Vec3f axis = firstBox.axes[firstIndex].cross(secondBox.axes[secondIndex]);
+      const float axisLength = axis.computeLength();
+
+      // Parallel edges give no new axis, the face ones already covering it
+      if (axisLength < 0.0001f)
+        continue;
+
+      axis /= axisLength;
+
+      const float centersDist = centersDiff.dot(axis);
+      const float separation  = std::abs(centersDist) - projectBox(firstBox, axis) - projectBox(secondBox, axis);
+
+      if (separation > ContactMargin)
+        return;
+
+      if (separation > edgeSep) {
+        edgeSep        = separation;
+        firstEdgeAxis  = firstIndex;
+        secondEdgeAxis = secondIndex;
+        edgeNormal     = (centersDist >= 0.f ? axis : -axis);
+      }
+    }
+  }
+
+  const float faceSep = std::max(firstFaceSep, secondFaceSep);
+
+  if (edgeSep > faceSep + EdgeAxisTolerance)
+    computeEdgeContact(firstBox, secondBox, firstEdgeAxis, secondEdgeAxis, edgeNormal, edgeSep, contacts);
+  else if (secondFaceSep > firstFaceSep + EdgeAxisTolerance)
+    computeFaceContacts(secondBox, firstBox, secondFaceAxis, true, contacts);
+  else
+    computeFaceContacts(firstBox, secondBox, firstFaceAxis, false, contacts);
+}
+
+/// Computes two directions orthogonal to each other & to the given normal.
+void computeTangents(const Vec3f& normal, std::array<Vec3f, 2>& tangents) {
+  tangents[0] = normal.cross(std::abs(normal[0]) < 0.57735f ? Axis::X : Axis::Y).normalize();
+  tangents[1] = normal.cross(tangents[0]);
+}
+
+} // namespace
+
+PhysicsSystem::PhysicsSystem() {
+  m_acceptedComponents.setBit(Component::getId<Collider>());
+  m_acceptedComponents.setBit(Component::getId<RigidBody>());
+}
+
+void PhysicsSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+
+  const auto bodyIndex = static_cast<std::uint32_t>(m_bodyEntities.size());
+  m_entityBodies.emplace(entity.get(), bodyIndex);
+
+  // The body's actual state & box are read from its components at the next update
+  const std::uint32_t proxyIndex = m_sweepAndPrune.addProxy(AABB(Vec3f(0.f), Vec3f(0.f)));
+
+  if (proxyIndex >= m_proxyBodies.size())
+    m_proxyBodies.resize(proxyIndex + 1);
+
+  m_proxyBodies[proxyIndex] = bodyIndex;
+
+  m_bodyEntities.push_back(entity.get());
+  m_proxies.push_back(proxyIndex);
+  m_states.push_back(BodyState::DISABLED);
+  m_positions.emplace_back(0.f);
+  m_orientations.push_back(Quaternionf::identity());
+  m_centerOffsets.emplace_back(0.f);
+  m_linearVelocities.emplace_back(0.f);
+  m_angularVelocities.emplace_back(0.f);
+  m_inverseMasses.push_back(0.f);
+  m_localInverseInertias.emplace_back(0.f);
+  m_worldInverseInertias.emplace_back();
+  m_restitutions.push_back(0.f);
+  m_frictions.push_back(0.f);
+  m_linearDampings.push_back(0.f);
+  m_angularDampings.push_back(0.f);
+  m_sleepTimes.push_back(0.f);
+  m_colliders.emplace_back();
+}
+
+void PhysicsSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  const auto bodyIter = m_entityBodies.find(entity.get());
+
+  if (bodyIter == m_entityBodies.end())
+    return;
+
+  const std::uint32_t bodyIndex = bodyIter->second;
+  m_entityBodies.erase(bodyIter);
+  m_sweepAndPrune.removeProxy(m_proxies[bodyIndex]);
+
+  // The last body takes the removed one's place
+  removeElement(m_bodyEntities, bodyIndex);
+  removeElement(m_proxies, bodyIndex);
+  removeElement(m_states, bodyIndex);
+  removeElement(m_positions, bodyIndex);
+  removeElement(m_orientations, bodyIndex);
+  removeElement(m_centerOffsets, bodyIndex);
+  removeElement(m_linearVelocities, bodyIndex);
+  removeElement(m_angularVelocities, bodyIndex);
+  removeElement(m_inverseMasses, bodyIndex);
+  removeElement(m_localInverseInertias, bodyIndex);
+  removeElement(m_worldInverseInertias, bodyIndex);
+  removeElement(m_restitutions, bodyIndex);
+  removeElement(m_frictions, bodyIndex);
+  removeElement(m_linearDampings, bodyIndex);
+  removeElement(m_angularDampings, bodyIndex);
+  removeElement(m_sleepTimes, bodyIndex);
+  removeElement(m_colliders, bodyIndex);
+
+  if (bodyIndex < m_bodyEntities.size()) {
+    m_entityBodies[m_bodyEntities[bodyIndex]] = bodyIndex;
+    m_proxyBodies[m_proxies[bodyIndex]]       = bodyIndex;
+  }
+}
+
+void PhysicsSystem::update(float deltaTime) {
+  m_remainingTime += deltaTime;
+
+  if (m_remainingTime < m_timeStep)
+    return;
+
+  readComponents();
+
+  std::size_t stepCount = 0;
+
+  while (m_remainingTime >= m_timeStep && stepCount < m_maxStepCount) {
+    step(m_timeStep);
+    m_remainingTime -= m_timeStep;
+    ++stepCount;
+  }
+
+  // Whole steps that could not be executed are dropped
+  m_remainingTime = std::fmod(m_remainingTime, m_timeStep);
+
+  writeComponents();
+}
+
+void PhysicsSystem::readComponents() {
+  Threading::parallelize(0, m_bodyEntities.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    const Transform defaultTransform;
+
+    for (std::size_t bodyIndex = beginIndex; bodyIndex < endIndex; ++bodyIndex) {
+      const Entity& entity    = *m_bodyEntities[bodyIndex];
+      WorldCollider& collider = m_colliders[bodyIndex];
+      collider.isEnabled      = (entity.isEnabled() && entity.hasComponent<Collider>());
+
+      if (!entity.isEnabled()) {
+        m_states[bodyIndex] = BodyState::DISABLED;
+        continue;
+      }
+
+      const Transform& transform = (entity.hasComponent<Transform>() ? entity.getComponent<Transform>() : defaultTransform);
+      const Vec3f& scale         = transform.getScale();
+
+      // Inertia of a unit mass, around the body's local axes
+      Vec3f unitInertia(0.4f);
+      Vec3f localCenter(0.f);
+
+      if (collider.isEnabled) {
+        const auto& colliderComp = entity.getComponent<Collider>();
+        collider.type = colliderComp.getType();
+
+        switch (collider.type) {
+          case ColliderType::SPHERE:
+          {
+            const auto& sphere = colliderComp.getShape<Sphere>();
+            const float maxScale = std::max(std::abs(scale[0]), std::max(std::abs(scale[1]), std::abs(scale[2])));
+
+            localCenter     = sphere.getCenter();
+            collider.scalar = sphere.getRadius() * maxScale;
+            unitInertia     = Vec3f(0.4f * collider.scalar * collider.scalar);
+            break;
+          }
+
+          case ColliderType::BOX:
+          {
+            const auto& box = colliderComp.getShape<AABB>();
+            const Vec3f halfExtents = box.computeHalfExtents() * scale;
+
+            localCenter          = box.computeCentroid();
+            collider.halfExtents = Vec3f({ std::abs(halfExtents[0]), std::abs(halfExtents[1]), std::abs(halfExtents[2]) });
+
+            const Vec3f sqHalfExtents = collider.halfExtents * collider.halfExtents;
+            unitInertia = Vec3f({ sqHalfExtents[1] + sqHalfExtents[2], sqHalfExtents[0] + sqHalfExtents[2], sqHalfExtents[0] + sqHalfExtents[1] }) / 3.f;
+            break;
+          }
+
+          case ColliderType::PLANE:
+          {
+            // Planes being static, they are directly expressed in world coordinates
+            const auto& plane = colliderComp.getShape<Plane>();
+            const Vec3f worldPoint = transform.getPosition() + transform.getRotation() * (plane.getNormal() * plane.getDistance() * scale);
+
+            collider.vector = (transform.getRotation() * plane.getNormal()).normalize();
+            collider.scalar = collider.vector.dot(worldPoint);
+            break;
+          }
+        }
+      }
+
+      m_centerOffsets[bodyIndex] = localCenter * scale;
+      m_positions[bodyIndex]     = transform.getPosition() + transform.getRotation() * m_centerOffsets[bodyIndex];
+      m_orientations[bodyIndex]  = transform.getRotation();
+
+      const RigidBody* rigidBody = (entity.hasComponent<RigidBody>() ? &entity.getComponent<RigidBody>() : nullptr);
+      m_restitutions[bodyIndex]  = (rigidBody ? rigidBody->getRestitution() : 0.f);
+      m_frictions[bodyIndex]     = (rigidBody ? rigidBody->getFriction() : 0.5f);
+
+      if (rigidBody == nullptr || rigidBody->isStatic() || (collider.isEnabled && collider.type == ColliderType::PLANE)) {
+        m_states[bodyIndex]               = BodyState::STATIC;
+        m_inverseMasses[bodyIndex]        = 0.f;
+        m_localInverseInertias[bodyIndex] = Vec3f(0.f);
+        m_worldInverseInertias[bodyIndex] = Mat3f();
+        m_linearVelocities[bodyIndex]     = Vec3f(0.f);
+        m_angularVelocities[bodyIndex]    = Vec3f(0.f);
+        continue;
+      }
+
+      const BodyState state = (rigidBody->isSleeping() ? BodyState::SLEEPING : BodyState::AWAKE);
+
+      // A body woken up from the outside must not fall back asleep right away
+      if (state != m_states[bodyIndex])
+        m_sleepTimes[bodyIndex] = 0.f;
+
+      m_states[bodyIndex]            = state;
+      m_inverseMasses[bodyIndex]     = 1.f / rigidBody->getMass();
+      m_linearDampings[bodyIndex]    = rigidBody->getLinearDamping();
+      m_angularDampings[bodyIndex]   = rigidBody->getAngularDamping();
+      m_linearVelocities[bodyIndex]  = rigidBody->getLinearVelocity();
+      m_angularVelocities[bodyIndex] = rigidBody->getAngularVelocity();
+
+      for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+        const float inertia = rigidBody->getMass() * unitInertia[axisIndex];
+        m_localInverseInertias[bodyIndex][axisIndex] = (inertia > 0.f ? 1.f / inertia : 0.f);
+      }
+    }
+  });
+}
+
+void PhysicsSystem::writeComponents() {
+  Threading::parallelize(0, m_bodyEntities.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t bodyIndex = beginIndex; bodyIndex < endIndex; ++bodyIndex) {
+      const BodyState state = m_states[bodyIndex];
+
+      if (state != BodyState::AWAKE && state != BodyState::SLEEPING)
+        continue;
+
+      Entity& entity = *m_bodyEntities[bodyIndex];
+      auto& rigidBody = entity.getComponent<RigidBody>();
+
+      // Bodies which were already sleeping haven't moved
+      if (state == BodyState::SLEEPING && rigidBody.m_isSleeping)
+        continue;
+
+      if (entity.hasComponent<Transform>()) {
+        auto& transform = entity.getComponent<Transform>();
+        transform.setPosition(m_positions[bodyIndex] - m_orientations[bodyIndex] * m_centerOffsets[bodyIndex]);
+        transform.setRotation(m_orientations[bodyIndex]);
+      }
+
+      rigidBody.m_linearVelocity  = m_linearVelocities[bodyIndex];
+      rigidBody.m_angularVelocity = m_angularVelocities[bodyIndex];
+      rigidBody.m_isSleeping      = (state == BodyState::SLEEPING);
+    }
+  });
+}
+
+void PhysicsSystem::step(float timeStep) {
+  computeWorldColliders();
+  findContacts();
+  buildIslands();
+
+  // Islands are independent from each other & can be solved concurrently; their sizes being very uneven, each thread fetches the next available one
+  Threading::parallelizeDynamic(m_islandCount, [this, timeStep] (std::size_t orderIndex, std::size_t) {
+    solveIsland(m_islandOrder[orderIndex], timeStep);
+  });
+}
+
+void PhysicsSystem::computeWorldColliders() {
+  Threading::parallelize(0, m_bodyEntities.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t bodyIndex = beginIndex; bodyIndex < endIndex; ++bodyIndex) {
+      if (m_states[bodyIndex] == BodyState::DISABLED || m_states[bodyIndex] == BodyState::STATIC)
+        continue;
+
+      WorldCollider& collider = m_colliders[bodyIndex];
+      const Quaternionf& orientation = m_orientations[bodyIndex];
+
+      collider.vector = m_positions[bodyIndex];
+      collider.axes   = { orientation * Axis::X, orientation * Axis::Y, orientation * Axis::Z };
+
+      m_worldInverseInertias[bodyIndex] = computeWorldInverseInertia(collider.axes, m_localInverseInertias[bodyIndex]);
+    }
+  });
+
+  // Static bodies may have been moved from the outside, & must be updated too
+  for (std::size_t bodyIndex = 0; bodyIndex < m_bodyEntities.size(); ++bodyIndex) {
+    if (m_states[bodyIndex] == BodyState::STATIC) {
+      WorldCollider& collider = m_colliders[bodyIndex];
+
+      if (collider.type != ColliderType::PLANE) {
+        const Quaternionf& orientation = m_orientations[bodyIndex];
+        collider.vector = m_positions[bodyIndex];
+        collider.axes   = { orientation * Axis::X, orientation * Axis::Y, orientation * Axis::Z };
+      }
+    }
+
+    const WorldCollider& collider = m_colliders[bodyIndex];
+    Vec3f halfExtents(0.f);
+
+    if (collider.isEnabled) {
+      switch (collider.type) {
+        case ColliderType::SPHERE:
+          halfExtents = Vec3f(collider.scalar);
+          break;
+
+        case ColliderType::BOX:
+          for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+            halfExtents[axisIndex] = std::abs(collider.axes[0][axisIndex]) * collider.halfExtents[0]
+                                   + std::abs(collider.axes[1][axisIndex]) * collider.halfExtents[1]
+                                   + std::abs(collider.axes[2][axisIndex]) * collider.halfExtents[2];
+          }
+          break;
+
+        case ColliderType::PLANE:
+          // Planes are infinite, & overlap all other boxes
+          m_sweepAndPrune.updateProxy(m_proxies[bodyIndex], AABB(Vec3f(std::numeric_limits<float>::max()), Vec3f(std::numeric_limits<float>::lowest())));
+          continue;
+      }
+    }
+
+    halfExtents += ContactMargin;
+    m_sweepAndPrune.updateProxy(m_proxies[bodyIndex], AABB(m_positions[bodyIndex] + halfExtents, m_positions[bodyIndex] - halfExtents));
+  }
+
+  m_sweepAndPrune.update();
+}
+
+void PhysicsSystem::findContacts() {
+  // The last step's contacts are kept to warm start the new ones, their keys being sorted to be found quickly
+  std::swap(m_manifolds, m_prevManifolds);
+  m_manifolds.clear();
+
+  m_prevManifoldKeys.resize(m_prevManifolds.size());
+
+  for (std::uint32_t manifoldIndex = 0; manifoldIndex < m_prevManifolds.size(); ++manifoldIndex)
+    m_prevManifoldKeys[manifoldIndex] = std::make_pair(m_prevManifolds[manifoldIndex].key, manifoldIndex);
+
+  std::sort(m_prevManifoldKeys.begin(), m_prevManifoldKeys.end());
+  m_candidatePairs.clear();
+  m_sleepingPairs.clear();
+
+  for (const SweepAndPrune::Pair& pair : m_sweepAndPrune.getOverlappingPairs()) {
+    std::uint32_t firstBody  = m_proxyBodies[pair.first];
+    std::uint32_t secondBody = m_proxyBodies[pair.second];
+
+    if (!m_colliders[firstBody].isEnabled || !m_colliders[secondBody].isEnabled)
+      continue;
+
+    const BodyState firstState  = m_states[firstBody];
+    const BodyState secondState = m_states[secondBody];
+
+    if (firstState == BodyState::DISABLED || secondState == BodyState::DISABLED)
+      continue;
+
+    // The narrowphase expects the colliders to be ordered by type
+    if (m_colliders[firstBody].type > m_colliders[secondBody].type)
+      std::swap(firstBody, secondBody);
+
+    if (firstState == BodyState::AWAKE || secondState == BodyState::AWAKE)
+      m_candidatePairs.emplace_back(firstBody, secondBody);
+    else if (firstState == BodyState::SLEEPING || secondState == BodyState::SLEEPING)
+      m_sleepingPairs.emplace_back(firstBody, secondBody);
+  }
+
+  std::size_t firstNewManifold = 0;
+
+  while (true) {
+    // The contacts of all candidate pairs are computed in parallel, & the pairs which don't actually touch are removed afterwards
+    m_manifolds.resize(firstNewManifold + m_candidatePairs.size());
+
+    Threading::parallelize(0, m_candidatePairs.size(), [this, firstNewManifold] (std::size_t beginIndex, std::size_t endIndex) {
+      for (std::size_t pairIndex = beginIndex; pairIndex < endIndex; ++pairIndex)
+        computeManifold(m_candidatePairs[pairIndex].first, m_candidatePairs[pairIndex].second, m_manifolds[firstNewManifold + pairIndex]);
+    });
+
+    m_manifolds.erase(std::remove_if(m_manifolds.begin() + static_cast<std::ptrdiff_t>(firstNewManifold), m_manifolds.end(), [] (const ContactManifold& manifold) {
+      return (manifold.pointCount == 0);
+    }), m_manifolds.end());
+
+    // Sleeping bodies touched by awake ones are woken up; their own contacts with other sleeping or static bodies must then be computed as well
+    bool hasWokenUp = false;
+
+    for (std::size_t manifoldIndex = firstNewManifold; manifoldIndex < m_manifolds.size(); ++manifoldIndex) {
+      for (const std::uint32_t bodyIndex : { m_manifolds[manifoldIndex].firstBody, m_manifolds[manifoldIndex].secondBody }) {
+        if (m_states[bodyIndex] == BodyState::SLEEPING) {
+          m_states[bodyIndex]     = BodyState::AWAKE;
+          m_sleepTimes[bodyIndex] = 0.f;
+          hasWokenUp = true;
+        }
+      }
+    }
+
+    if (!hasWokenUp)
+      break;
+
+    firstNewManifold = m_manifolds.size();
+    m_candidatePairs.clear();
+
+    const auto awakePairIter = std::partition(m_sleepingPairs.begin(), m_sleepingPairs.end(), [this] (const std::pair<std::uint32_t, std::uint32_t>& pair) {
+      return (m_states[pair.first] != BodyState::AWAKE && m_states[pair.second] != BodyState::AWAKE);
+    });
+
+    m_candidatePairs.assign(awakePairIter, m_sleepingPairs.end());
+    m_sleepingPairs.erase(awakePairIter, m_sleepingPairs.end());
+  }
+}
+
+void PhysicsSystem::computeManifold(std::uint32_t firstBody, std::uint32_t secondBody, ContactManifold& manifold) const {
+  const WorldCollider& firstCollider  = m_colliders[firstBody];
+  const WorldCollider& secondCollider = m_colliders[secondBody];
+
+  ContactSet contacts;
+
+  switch (firstCollider.type) {
+    case ColliderType::SPHERE:
+      switch (secondCollider.type) {
+        case ColliderType::SPHERE:
+          collideSpheres(firstCollider.vector, firstCollider.scalar, secondCollider.vector, secondCollider.scalar, contacts);
+          break;
+
+        case ColliderType::BOX:
+          collideSphereBox(firstCollider.vector, firstCollider.scalar, Box{ secondCollider.vector, secondCollider.axes, secondCollider.halfExtents }, contacts);
+          break;
+
+        case ColliderType::PLANE:
+          collideSpherePlane(firstCollider.vector, firstCollider.scalar, secondCollider.vector, secondCollider.scalar, contacts);
+          break;
+      }
+      break;
+
+    case ColliderType::BOX:
+    {
+      const Box firstBox{ firstCollider.vector, firstCollider.axes, firstCollider.halfExtents };
+
+      if (secondCollider.type == ColliderType::BOX)
+        collideBoxes(firstBox, Box{ secondCollider.vector, secondCollider.axes, secondCollider.halfExtents }, contacts);
+      else
+        collideBoxPlane(firstBox, secondCollider.vector, secondCollider.scalar, contacts);
+
+      break;
+    }
+
+    case ColliderType::PLANE:
+      // Planes are always static, & never collide with each other
+      break;
+  }
+
+  const std::uint64_t firstId  = m_bodyEntities[firstBody]->getId();
+  const std::uint64_t secondId = m_bodyEntities[secondBody]->getId();
+  assert("Error: Entity IDs must fit on 32 bits to identify contact manifolds."
+      && firstId <= std::numeric_limits<std::uint32_t>::max() && secondId <= std::numeric_limits<std::uint32_t>::max());
+
+  manifold.key         = (firstId << 32u) | secondId;
+  manifold.firstBody   = firstBody;
+  manifold.secondBody  = secondBody;
+  manifold.normal      = contacts.normal;
+  manifold.friction    = std::sqrt(m_frictions[firstBody] * m_frictions[secondBody]);
+  manifold.restitution = std::max(m_restitutions[firstBody], m_restitutions[secondBody]);
+  manifold.pointCount  = static_cast<std::uint32_t>(contacts.count);
+
+  if (contacts.count == 0)
+    return;
+
+  computeTangents(manifold.normal, manifold.tangents);
+
+  const auto prevKeyIter = std::lower_bound(m_prevManifoldKeys.cbegin(), m_prevManifoldKeys.cend(), std::make_pair(manifold.key, 0u));
+  const ContactManifold* prevManifold = (prevKeyIter != m_prevManifoldKeys.cend() && prevKeyIter->first == manifold.key
+                                      ? &m_prevManifolds[prevKeyIter->second] : nullptr);
+  const bool canWarmStart = (prevManifold != nullptr && prevManifold->normal.dot(manifold.normal) > 0.95f);
+
+  for (std::size_t pointIndex = 0; pointIndex < contacts.count; ++pointIndex) {
+    ContactPoint& point = manifold.points[pointIndex];
+    point = ContactPoint();
+    point.position = contacts.positions[pointIndex];
+    point.depth    = contacts.depths[pointIndex];
+
+    if (!canWarmStart)
+      continue;
+
+    // The point inherits the impulses of the closest previous one, if near enough
+    float minSqDist = WarmStartDistance * WarmStartDistance;
+
+    for (std::size_t prevPointIndex = 0; prevPointIndex < prevManifold->pointCount; ++prevPointIndex) {
+      const ContactPoint& prevPoint = prevManifold->points[prevPointIndex];
+      const float sqDist = (prevPoint.position - point.position).computeSquaredLength();
+
+      if (sqDist < minSqDist) {
+        minSqDist             = sqDist;
+        point.normalImpulse   = prevPoint.normalImpulse;
+        point.tangentImpulses = prevPoint.tangentImpulses;
+      }
+    }
+  }
+}
+
+void PhysicsSystem::buildIslands() {
+  const std::size_t bodyCount = m_bodyEntities.size();
+
+  // Awake bodies touching each other are merged with a union-find; static bodies don't connect islands, not being moved by the solver
+  std::vector<std::uint32_t> parents(bodyCount);
+  std::iota(parents.begin(), parents.end(), 0u);
+
+  const auto findRoot = [&parents] (std::uint32_t bodyIndex) {
+    while (parents[bodyIndex] != bodyIndex) {
+      parents[bodyIndex] = parents[parents[bodyIndex]];
+      bodyIndex = parents[bodyIndex];
+    }
+
+    return bodyIndex;
+  };
+
+  for (const ContactManifold& manifold : m_manifolds) {
+    if (m_states[manifold.firstBody] == BodyState::AWAKE && m_states[manifold.secondBody] == BodyState::AWAKE)
+      parents[findRoot(manifold.firstBody)] = findRoot(manifold.secondBody);
+  }
+
+  constexpr std::uint32_t InvalidIsland = std::numeric_limits<std::uint32_t>::max();
+  std::vector<std::uint32_t> bodyIslands(bodyCount, InvalidIsland);
+  m_islandCount = 0;
+
+  for (std::uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    if (m_states[bodyIndex] != BodyState::AWAKE)
+      continue;
+
+    const std::uint32_t rootIndex = findRoot(bodyIndex);
+
+    if (bodyIslands[rootIndex] == InvalidIsland)
+      bodyIslands[rootIndex] = static_cast<std::uint32_t>(m_islandCount++);
+
+    bodyIslands[bodyIndex] = bodyIslands[rootIndex];
+  }
+
+  // The bodies & contacts are grouped by island with a counting sort
+  m_islandBodyOffsets.assign(m_islandCount + 1, 0);
+  m_islandManifoldOffsets.assign(m_islandCount + 1, 0);
+
+  const auto getManifoldIsland = [this, &bodyIslands] (const ContactManifold& manifold) {
+    return bodyIslands[(m_states[manifold.firstBody] == BodyState::AWAKE ? manifold.firstBody : manifold.secondBody)];
+  };
+
+  for (std::uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    if (bodyIslands[bodyIndex] != InvalidIsland)
+      ++m_islandBodyOffsets[bodyIslands[bodyIndex] + 1];
+  }
+
+  for (const ContactManifold& manifold : m_manifolds)
+    ++m_islandManifoldOffsets[getManifoldIsland(manifold) + 1];
+
+  std::partial_sum(m_islandBodyOffsets.begin(), m_islandBodyOffsets.end(), m_islandBodyOffsets.begin());
+  std::partial_sum(m_islandManifoldOffsets.begin(), m_islandManifoldOffsets.end(), m_islandManifoldOffsets.begin());
+
+  m_islandBodies.resize(m_islandBodyOffsets.back());
+  m_islandManifolds.resize(m_islandManifoldOffsets.back());
+
+  std::vector<std::uint32_t> islandFillCounts(m_islandCount, 0);
+
+  for (std::uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const std::uint32_t islandIndex = bodyIslands[bodyIndex];
+
+    if (islandIndex != InvalidIsland)
+      m_islandBodies[m_islandBodyOffsets[islandIndex] + islandFillCounts[islandIndex]++] = bodyIndex;
+  }
+
+  std::fill(islandFillCounts.begin(), islandFillCounts.end(), 0);
+
+  for (std::uint32_t manifoldIndex = 0; manifoldIndex < m_manifolds.size(); ++manifoldIndex) {
+    const std::uint32_t islandIndex = getManifoldIsland(m_manifolds[manifoldIndex]);
+    m_islandManifolds[m_islandManifoldOffsets[islandIndex] + islandFillCounts[islandIndex]++] = manifoldIndex;
+  }
+
+  // The largest islands are solved first, so that the threads don't end up waiting for one of them at the end
+  m_islandOrder.resize(m_islandCount);
+  std::iota(m_islandOrder.begin(), m_islandOrder.end(), 0u);
+  std::sort(m_islandOrder.begin(), m_islandOrder.end(), [this] (std::uint32_t islandIndex1, std::uint32_t islandIndex2) {
+    return (m_islandManifoldOffsets[islandIndex1 + 1] - m_islandManifoldOffsets[islandIndex1]
+          > m_islandManifoldOffsets[islandIndex2 + 1] - m_islandManifoldOffsets[islandIndex2]);
+  });
+}
+
+void PhysicsSystem::solveIsland(std::size_t islandIndex, float timeStep) {
+  const std::uint32_t* bodiesBegin = m_islandBodies.data() + m_islandBodyOffsets[islandIndex];
+  const std::uint32_t* bodiesEnd   = m_islandBodies.data() + m_islandBodyOffsets[islandIndex + 1];
+  const std::uint32_t* manifoldsBegin = m_islandManifolds.data() + m_islandManifoldOffsets[islandIndex];
+  const std::uint32_t* manifoldsEnd   = m_islandManifolds.data() + m_islandManifoldOffsets[islandIndex + 1];
+
+  const float invTimeStep = 1.f / timeStep;
+
+  for (const std::uint32_t* bodyIter = bodiesBegin; bodyIter != bodiesEnd; ++bodyIter) {
+    m_linearVelocities[*bodyIter]  += m_gravity * timeStep;
+    m_linearVelocities[*bodyIter]  /= 1.f + timeStep * m_linearDampings[*bodyIter];
+    m_angularVelocities[*bodyIter] /= 1.f + timeStep * m_angularDampings[*bodyIter];
+  }
+
+  // Static bodies, shared between islands, have a null inverse mass & are never written to
+  const auto applyImpulse = [this] (const ContactManifold& manifold, const ContactPoint& point, std::size_t dirIndex, const Vec3f& direction, float impulse) {
+    if (m_inverseMasses[manifold.firstBody] > 0.f) {
+      m_linearVelocities[manifold.firstBody]  -= direction * (impulse * m_inverseMasses[manifold.firstBody]);
+      m_angularVelocities[manifold.firstBody] -= point.firstAngularDeltas[dirIndex] * impulse;
+    }
+
+    if (m_inverseMasses[manifold.secondBody] > 0.f) {
+      m_linearVelocities[manifold.secondBody]  += direction * (impulse * m_inverseMasses[manifold.secondBody]);
+      m_angularVelocities[manifold.secondBody] += point.secondAngularDeltas[dirIndex] * impulse;
+    }
+  };
+
+  const auto computeRelativeVelocity = [this] (const ContactManifold& manifold, const ContactPoint& point) {
+    return m_linearVelocities[manifold.secondBody] + m_angularVelocities[manifold.secondBody].cross(point.secondArm)
+         - m_linearVelocities[manifold.firstBody] - m_angularVelocities[manifold.firstBody].cross(point.firstArm);
+  };
+
+  // Preparing the contacts & warm starting them
+  for (const std::uint32_t* manifoldIter = manifoldsBegin; manifoldIter != manifoldsEnd; ++manifoldIter) {
+    ContactManifold& manifold = m_manifolds[*manifoldIter];
+    const std::array<Vec3f, 3> directions = { manifold.normal, manifold.tangents[0], manifold.tangents[1] };
+
+    for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+      ContactPoint& point = manifold.points[pointIndex];
+      point.firstArm  = point.position - m_positions[manifold.firstBody];
+      point.secondArm = point.position - m_positions[manifold.secondBody];
+
+      for (std::size_t dirIndex = 0; dirIndex < 3; ++dirIndex) {
+        const Vec3f firstArmCross  = point.firstArm.cross(directions[dirIndex]);
+        const Vec3f secondArmCross = point.secondArm.cross(directions[dirIndex]);
+
+        point.firstAngularDeltas[dirIndex]  = m_worldInverseInertias[manifold.firstBody] * firstArmCross;
+        point.secondAngularDeltas[dirIndex] = m_worldInverseInertias[manifold.secondBody] * secondArmCross;
+
+        const float invEffectiveMass = m_inverseMasses[manifold.firstBody] + m_inverseMasses[manifold.secondBody]
+                                     + firstArmCross.dot(point.firstAngularDeltas[dirIndex])
+                                     + secondArmCross.dot(point.secondAngularDeltas[dirIndex]);
+        point.effectiveMasses[dirIndex] = (invEffectiveMass > 0.f ? 1.f / invEffectiveMass : 0.f);
+      }
+
+      // Separated points let the bodies approach until they touch; penetrating ones are pushed apart progressively
+      if (point.depth < 0.f)
+        point.velocityBias = point.depth * invTimeStep;
+      else
+        point.velocityBias = BaumgarteFactor * invTimeStep * std::max(point.depth - PenetrationSlop, 0.f);
+
+      const float normalVelocity = computeRelativeVelocity(manifold, point).dot(manifold.normal);
+
+      if (point.depth >= 0.f && normalVelocity < -RestitutionThreshold)
+        point.velocityBias = std::max(point.velocityBias, -manifold.restitution * normalVelocity);
+
+      applyImpulse(manifold, point, 0, manifold.normal, point.normalImpulse);
+      applyImpulse(manifold, point, 1, manifold.tangents[0], point.tangentImpulses[0]);
+      applyImpulse(manifold, point, 2, manifold.tangents[1], point.tangentImpulses[1]);
+    }
+  }
+
+  for (std::size_t iterIndex = 0; iterIndex < m_velocityIterationCount; ++iterIndex) {
+    for (const std::uint32_t* manifoldIter = manifoldsBegin; manifoldIter != manifoldsEnd; ++manifoldIter) {
+      ContactManifold& manifold = m_manifolds[*manifoldIter];
+
+      for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+        ContactPoint& point = manifold.points[pointIndex];
+        const float maxFriction = manifold.friction * point.normalImpulse;
+
+        for (std::size_t tangentIndex = 0; tangentIndex < 2; ++tangentIndex) {
+          const Vec3f& tangent = manifold.tangents[tangentIndex];
+          const float impulse  = -point.effectiveMasses[tangentIndex + 1] * computeRelativeVelocity(manifold, point).dot(tangent);
+          const float prevImpulse = point.tangentImpulses[tangentIndex];
+
+          point.tangentImpulses[tangentIndex] = std::max(-maxFriction, std::min(prevImpulse + impulse, maxFriction));
+          applyImpulse(manifold, point, tangentIndex + 1, tangent, point.tangentImpulses[tangentIndex] - prevImpulse);
+        }
+
+        const float normalVelocity = computeRelativeVelocity(manifold, point).dot(manifold.normal);
+        const float impulse        = -point.effectiveMasses[0] * (normalVelocity - point.velocityBias);
+        const float prevImpulse    = point.normalImpulse;
+
+        // The accumulated impulse can only push the bodies apart
+        point.normalImpulse = std::max(prevImpulse + impulse, 0.f);
+        applyImpulse(manifold, point, 0, manifold.normal, point.normalImpulse - prevImpulse);
+      }
+    }
+  }
+
+  float minSleepTime = std::numeric_limits<float>::max();
+
+  for (const std::uint32_t* bodyIter = bodiesBegin; bodyIter != bodiesEnd; ++bodyIter) {
+    const std::uint32_t bodyIndex = *bodyIter;
+    const Vec3f& linearVelocity   = m_linearVelocities[bodyIndex];
+    const Vec3f& angularVelocity  = m_angularVelocities[bodyIndex];
+
+    m_positions[bodyIndex] += linearVelocity * timeStep;
+
+    // Integrating the orientation: dq/dt = 1/2 * w * q
+    const Quaternionf& orientation = m_orientations[bodyIndex];
+    const Vec3f halfRotation = angularVelocity * (timeStep * 0.5f);
+    const Quaternionf spin   = Quaternionf::fromComponents(0.f, halfRotation[0], halfRotation[1], halfRotation[2]) * orientation;
+    m_orientations[bodyIndex] = Quaternionf::fromComponents(orientation.getReal() + spin.getReal(),
+                                                            orientation.getComplexes()[0] + spin.getComplexes()[0],
+                                                            orientation.getComplexes()[1] + spin.getComplexes()[1],
+                                                            orientation.getComplexes()[2] + spin.getComplexes()[2]).normalize();
+
+    if (linearVelocity.computeSquaredLength() > SleepLinearSpeed * SleepLinearSpeed
+     || angularVelocity.computeSquaredLength() > SleepAngularSpeed * SleepAngularSpeed)
+      m_sleepTimes[bodyIndex] = 0.f;
+    else
+      m_sleepTimes[bodyIndex] += timeStep;
+
+    minSleepTime = std::min(minSleepTime, m_sleepTimes[bodyIndex]);
+  }
+
+  // An island falls asleep as a whole, its bodies supporting each other
+  if (minSleepTime < TimeToSleep)
+    return;
+
+  for (const std::uint32_t* bodyIter = bodiesBegin; bodyIter != bodiesEnd; ++bodyIter) {
+    m_states[*bodyIter]            = BodyState::SLEEPING;
+    m_linearVelocities[*bodyIter]  = Vec3f(0.f);
+    m_angularVelocities[*bodyIter] = Vec3f(0.f);
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,146 @@
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RaycastSystem.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Mesh.hpp"
+
+namespace Raz {
+
+RaycastSystem::RaycastSystem() {
+  m_acceptedComponents.setBit(Component::getId<Mesh>());
+}
+
+void RaycastSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+  m_instancesOutdated = true;
+}
+
+void RaycastSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  // The entity may be destroyed & another one created at the same address; its hierarchies must not be kept
+  m_meshBvhs.erase(entity.get());
+  m_instancesOutdated = true;
+}
+
+void RaycastSystem::refresh() {
+  // Entities can be enabled, disabled or given a transform at any time; if the ones to be instanced differ, everything is rebuilt
+  std::vector<Entity*> instancedEntities;
+  instancedEntities.reserve(m_entities.size());
+
+  for (Entity* entity : m_entities) {
+    if (entity->isEnabled() && entity->hasComponent<Transform>())
+      instancedEntities.emplace_back(entity);
+  }
+
+  if (m_instancesOutdated || instancedEntities != m_instancedEntities) {
+    m_instancedEntities = std::move(instancedEntities);
+    rebuildInstances();
+    return;
+  }
+
+  // An entity's Mesh component may also have been replaced, in which case its hierarchies are rebuilt
+  for (const Entity* entity : m_instancedEntities) {
+    if (m_meshBvhs.find(entity)->second.mesh != &entity->getComponent<Mesh>()) {
+      rebuildInstances();
+      return;
+    }
+  }
+
+  // Otherwise, only the top-level hierarchy is rebuilt, & only if an entity has moved
+  bool hasMoved = false;
+
+  for (std::size_t instanceIndex = 0; instanceIndex < m_instanceInfos.size(); ++instanceIndex) {
+    const Mat4f& transformMat = m_instanceInfos[instanceIndex].entity->getComponent<Transform>().getTransformMatrix();
+
+    if (transformMat.getData() != m_instanceBvh.getInstances()[instanceIndex].transform.getData()) {
+      m_instanceBvh.setInstanceTransform(instanceIndex, transformMat);
+      hasMoved = true;
+    }
+  }
+
+  if (hasMoved)
+    m_instanceBvh.build();
+}
+
+void RaycastSystem::refreshMesh(const Entity& entity) {
+  const auto bvhsIter = m_meshBvhs.find(&entity);
+
+  if (bvhsIter == m_meshBvhs.end())
+    return;
+
+  const Mesh& mesh = entity.getComponent<Mesh>();
+  bvhsIter->second.mesh = &mesh;
+
+  std::vector<TriangleBvh>& submeshBvhs = bvhsIter->second.submeshBvhs;
+  submeshBvhs.resize(mesh.getSubmeshes().size());
+
+  for (std::size_t submeshIndex = 0; submeshIndex < submeshBvhs.size(); ++submeshIndex) {
+    const Submesh& submesh = *mesh.getSubmeshes()[submeshIndex];
+    submeshBvhs[submeshIndex].build(submesh.getVertices(), submesh.getIndices());
+  }
+
+  // The hierarchies may have been reallocated & their bounds have changed; the instances must be recreated right away
+  rebuildInstances();
+}
+
+bool RaycastSystem::raycast(const Ray& ray, RaycastHit& hit, float maxDistance) const {
+  std::size_t instanceIndex {};
+
+  if (!m_instanceBvh.intersect(ray, hit, instanceIndex, maxDistance))
+    return false;
+
+  hit.entity       = m_instanceInfos[instanceIndex].entity;
+  hit.submeshIndex = m_instanceInfos[instanceIndex].submeshIndex;
+
+  return true;
+}
+
+bool RaycastSystem::pick(const Camera& camera, const Vec2f& screenPos, const Vec2f& screenSize, RaycastHit& hit) const {
+  // The screen's vertical axis goes downwards, while the normalized device coordinates' one goes upwards
+  const Vec2f ndcPos({ 2.f * screenPos[0] / screenSize[0] - 1.f, 1.f - 2.f * screenPos[1] / screenSize[1] });
+  return raycast(camera.computeRay(ndcPos), hit);
+}
+
+void RaycastSystem::rebuildInstances() {
+  // Keeping only the hierarchies of the entities still instanced, building those of the new ones & of the ones whose mesh has been replaced
+  std::unordered_map<const Entity*, MeshBvhs> usedBvhs;
+
+  for (const Entity* entity : m_instancedEntities) {
+    const Mesh& mesh = entity->getComponent<Mesh>();
+    const auto bvhsIter = m_meshBvhs.find(entity);
+
+    if (bvhsIter != m_meshBvhs.end() && bvhsIter->second.mesh == &mesh) {
+      usedBvhs.emplace(entity, std::move(bvhsIter->second));
+      continue;
+    }
+
+    MeshBvhs meshBvhs;
+    meshBvhs.mesh = &mesh;
+    meshBvhs.submeshBvhs.reserve(mesh.getSubmeshes().size());
+
+    for (const SubmeshPtr& submesh : mesh.getSubmeshes())
+      meshBvhs.submeshBvhs.emplace_back(static_cast<const Submesh&>(*submesh));
+
+    usedBvhs.emplace(entity, std::move(meshBvhs));
+  }
+
+  m_meshBvhs = std::move(usedBvhs);
+
+  m_instanceBvh.clear();
+  m_instanceInfos.clear();
+
+  for (Entity* entity : m_instancedEntities) {
+    const std::vector<TriangleBvh>& submeshBvhs = m_meshBvhs.find(entity)->second.submeshBvhs;
+    const Mat4f& transformMat = entity->getComponent<Transform>().getTransformMatrix();
+
+    for (std::size_t submeshIndex = 0; submeshIndex < submeshBvhs.size(); ++submeshIndex) {
+      m_instanceBvh.addInstance(submeshBvhs[submeshIndex], transformMat);
+      m_instanceInfos.push_back({ entity, submeshIndex });
+    }
+  }
+
+  m_instanceBvh.build();
+  m_instancesOutdated = false;
+}
+
+} // namespace Raz
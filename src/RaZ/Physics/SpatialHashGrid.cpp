@@ -0,0 +1,234 @@
+#include "RaZ/Physics/SpatialHashGrid.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Raz {
+
+namespace {
+
+// Number of buckets whose offsets are computed by a single task during the prefix sum
+constexpr std::size_t BucketChunkSize = 16384;
+// Minimum number of buckets, avoiding pointless collisions between the cells of small sets of points
+constexpr std::size_t MinBucketCount = 64;
+// Maximum number of cells covered by a query on each axis: 3, plus 1 from the rounding of the query's box
+constexpr std::size_t MaxQueryCellsPerAxis = 4;
+
+std::size_t computeNextPowerOfTwo(std::size_t value) {
+  std::size_t powerOfTwo = 1;
+
+  while (powerOfTwo < value)
+    powerOfTwo <<= 1u;
+
+  return powerOfTwo;
+}
+
+std::array<int, 3> computeCell(const Vec3f& position, float invCellSize) {
+  return {{ static_cast<int>(std::floor(position[0] * invCellSize)),
+            static_cast<int>(std::floor(position[1] * invCellSize)),
+            static_cast<int>(std::floor(position[2] * invCellSize)) }};
+}
+
+std::uint32_t hashCell(int x, int y, int z, std::uint32_t bucketMask) {
+  // Large primes from Teschner et al., "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+  return ((static_cast<std::uint32_t>(x) * 73856093u) ^ (static_cast<std::uint32_t>(y) * 19349663u) ^ (static_cast<std::uint32_t>(z) * 83492791u))
+       & bucketMask;
+}
+
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize, std::size_t bucketCount) : m_fixedBucketCount{ bucketCount } {
+  setCellSize(cellSize);
+}
+
+void SpatialHashGrid::setCellSize(float cellSize) {
+  assert("Error: The spatial hash grid's cell size must be strictly positive." && cellSize > 0.f);
+
+  m_cellSize    = cellSize;
+  m_invCellSize = 1.f / cellSize;
+}
+
+void SpatialHashGrid::rebuild(const std::vector<float>& xPositions, const std::vector<float>& yPositions, const std::vector<float>& zPositions) {
+  assert("Error: The spatial hash grid's position lists must have the same size."
+      && xPositions.size() == yPositions.size() && xPositions.size() == zPositions.size());
+
+  rebuild(xPositions.size(), [&xPositions, &yPositions, &zPositions] (std::size_t pointIndex) {
+    return Vec3f({ xPositions[pointIndex], yPositions[pointIndex], zPositions[pointIndex] });
+  });
+}
+
+void SpatialHashGrid::rebuild(const std::vector<Vec3f>& positions) {
+  rebuild(positions.size(), [&positions] (std::size_t pointIndex) { return positions[pointIndex]; });
+}
+
+void SpatialHashGrid::queryRadius(const Vec3f& center, float radius, std::vector<std::uint32_t>& pointIndices) const {
+  forEachPointAround(center, radius, [&pointIndices] (std::uint32_t pointIndex) { pointIndices.push_back(pointIndex); });
+}
+
+void SpatialHashGrid::queryRadius(const std::vector<Vec3f>& centers, float radius,
+                                  std::vector<std::uint32_t>& pointIndices, std::vector<std::size_t>& queryOffsets) const {
+  // The results are first counted to know where each query must write its own, then written in parallel
+  queryOffsets.assign(centers.size() + 1, 0);
+
+  Threading::parallelize(0, centers.size(), [this, &centers, radius, &queryOffsets] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t queryIndex = beginIndex; queryIndex < endIndex; ++queryIndex) {
+      std::size_t resultCount = 0;
+      forEachPointAround(centers[queryIndex], radius, [&resultCount] (std::uint32_t) { ++resultCount; });
+      queryOffsets[queryIndex + 1] = resultCount;
+    }
+  });
+
+  std::partial_sum(queryOffsets.begin(), queryOffsets.end(), queryOffsets.begin());
+
+  pointIndices.clear();
+  pointIndices.resize(queryOffsets.back());
+
+  Threading::parallelize(0, centers.size(), [this, &centers, radius, &pointIndices, &queryOffsets] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t queryIndex = beginIndex; queryIndex < endIndex; ++queryIndex) {
+      std::size_t resultIndex = queryOffsets[queryIndex];
+      forEachPointAround(centers[queryIndex], radius, [&pointIndices, &resultIndex] (std::uint32_t pointIndex) { pointIndices[resultIndex++] = pointIndex; });
+    }
+  });
+}
+
+std::uint32_t SpatialHashGrid::computeBucket(const Vec3f& position) const {
+  const std::array<int, 3> cell = computeCell(position, m_invCellSize);
+  return hashCell(cell[0], cell[1], cell[2], m_bucketMask);
+}
+
+template <typename PositionGetterT>
+void SpatialHashGrid::rebuild(std::size_t pointCount, const PositionGetterT& getPosition) {
+  assert("Error: A spatial hash grid can't hold more than 2^32 points." && pointCount <= std::numeric_limits<std::uint32_t>::max());
+
+  const std::size_t bucketCount = computeNextPowerOfTwo(std::max(m_fixedBucketCount != 0 ? m_fixedBucketCount : pointCount, MinBucketCount));
+  m_bucketMask = static_cast<std::uint32_t>(bucketCount - 1);
+
+  if (bucketCount > m_bucketCounterCapacity) {
+    m_bucketCounters        = std::make_unique<std::atomic<std::uint32_t>[]>(bucketCount);
+    m_bucketCounterCapacity = bucketCount;
+  }
+
+  m_pointBuckets.resize(pointCount);
+  m_bucketOffsets.resize(bucketCount + 1);
+  m_sortedIndices.resize(pointCount);
+  m_sortedXPositions.resize(pointCount);
+  m_sortedYPositions.resize(pointCount);
+  m_sortedZPositions.resize(pointCount);
+
+  std::atomic<std::uint32_t>* bucketCounters = m_bucketCounters.get();
+
+  Threading::parallelize(0, bucketCount, [bucketCounters] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t bucketIndex = beginIndex; bucketIndex < endIndex; ++bucketIndex)
+      bucketCounters[bucketIndex].store(0, std::memory_order_relaxed);
+  });
+
+  // First pass: counting the points in each bucket
+  Threading::parallelize(0, pointCount, [this, &getPosition, bucketCounters] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t pointIndex = beginIndex; pointIndex < endIndex; ++pointIndex) {
+      const std::uint32_t bucketIndex = computeBucket(getPosition(pointIndex));
+      m_pointBuckets[pointIndex] = bucketIndex;
+      bucketCounters[bucketIndex].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  // Computing each bucket's offset with a prefix sum: each chunk of buckets is summed, then offset by the sum of all previous chunks
+  const std::size_t chunkCount = (bucketCount + BucketChunkSize - 1) / BucketChunkSize;
+  std::vector<std::uint32_t> chunkOffsets(chunkCount + 1, 0);
+
+  Threading::parallelize(0, chunkCount, [bucketCounters, bucketCount, &chunkOffsets] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t chunkIndex = beginIndex; chunkIndex < endIndex; ++chunkIndex) {
+      const std::size_t chunkEnd = std::min((chunkIndex + 1) * BucketChunkSize, bucketCount);
+      std::uint32_t pointSum = 0;
+
+      for (std::size_t bucketIndex = chunkIndex * BucketChunkSize; bucketIndex < chunkEnd; ++bucketIndex)
+        pointSum += bucketCounters[bucketIndex].load(std::memory_order_relaxed);
+
+      chunkOffsets[chunkIndex + 1] = pointSum;
+    }
+  });
+
+  std::partial_sum(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+
+  Threading::parallelize(0, chunkCount, [this, bucketCounters, bucketCount, &chunkOffsets] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t chunkIndex = beginIndex; chunkIndex < endIndex; ++chunkIndex) {
+      const std::size_t chunkEnd = std::min((chunkIndex + 1) * BucketChunkSize, bucketCount);
+      std::uint32_t bucketOffset = chunkOffsets[chunkIndex];
+
+      for (std::size_t bucketIndex = chunkIndex * BucketChunkSize; bucketIndex < chunkEnd; ++bucketIndex) {
+        const std::uint32_t bucketPointCount = bucketCounters[bucketIndex].load(std::memory_order_relaxed);
+
+        // The counter now becomes the bucket's insertion cursor
+        m_bucketOffsets[bucketIndex] = bucketOffset;
+        bucketCounters[bucketIndex].store(bucketOffset, std::memory_order_relaxed);
+        bucketOffset += bucketPointCount;
+      }
+    }
+  });
+
+  m_bucketOffsets[bucketCount] = static_cast<std::uint32_t>(pointCount);
+
+  // Second pass: placing each point in its bucket's range
+  Threading::parallelize(0, pointCount, [this, &getPosition, bucketCounters] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t pointIndex = beginIndex; pointIndex < endIndex; ++pointIndex) {
+      const std::uint32_t sortedIndex = bucketCounters[m_pointBuckets[pointIndex]].fetch_add(1, std::memory_order_relaxed);
+      const Vec3f position = getPosition(pointIndex);
+
+      m_sortedIndices[sortedIndex]    = static_cast<std::uint32_t>(pointIndex);
+      m_sortedXPositions[sortedIndex] = position[0];
+      m_sortedYPositions[sortedIndex] = position[1];
+      m_sortedZPositions[sortedIndex] = position[2];
+    }
+  });
+}
+
+template <typename ActionT>
+void SpatialHashGrid::forEachPointAround(const Vec3f& center, float radius, const ActionT& action) const {
+  assert("Error: The spatial hash grid's query radius must not exceed its cell size." && radius <= m_cellSize);
+
+  if (m_sortedIndices.empty())
+    return;
+
+  // The radius not exceeding the cell size, the query's box overlaps at most 3 cells on each axis. Its corners being rounded separately
+  //   though, one more cell may be covered, & points in it can be within the radius once their distance is rounded as well
+  const std::array<int, 3> minCell = computeCell(center - radius, m_invCellSize);
+  std::array<int, 3> maxCell = computeCell(center + radius, m_invCellSize);
+
+  for (std::size_t axis = 0; axis < 3; ++axis)
+    maxCell[axis] = std::min(maxCell[axis], minCell[axis] + static_cast<int>(MaxQueryCellsPerAxis) - 1);
+
+  const float sqRadius = radius * radius;
+
+  // Several of the cells may be hashed into the same bucket, which must then be scanned only once
+  std::array<std::uint32_t, MaxQueryCellsPerAxis * MaxQueryCellsPerAxis * MaxQueryCellsPerAxis> scannedBuckets {};
+  std::size_t scannedBucketCount = 0;
+
+  for (int z = minCell[2]; z <= maxCell[2]; ++z) {
+    for (int y = minCell[1]; y <= maxCell[1]; ++y) {
+      for (int x = minCell[0]; x <= maxCell[0]; ++x) {
+        const std::uint32_t bucketIndex = hashCell(x, y, z, m_bucketMask);
+
+        if (std::find(scannedBuckets.cbegin(), scannedBuckets.cbegin() + scannedBucketCount, bucketIndex) != scannedBuckets.cbegin() + scannedBucketCount)
+          continue;
+
+        scannedBuckets[scannedBucketCount++] = bucketIndex;
+
+        // Buckets may also hold points of other cells, which are discarded by the distance test
+        for (std::uint32_t sortedIndex = m_bucketOffsets[bucketIndex]; sortedIndex < m_bucketOffsets[bucketIndex + 1]; ++sortedIndex) {
+          const float xDiff = m_sortedXPositions[sortedIndex] - center[0];
+          const float yDiff = m_sortedYPositions[sortedIndex] - center[1];
+          const float zDiff = m_sortedZPositions[sortedIndex] - center[2];
+
+          if (xDiff * xDiff + yDiff * yDiff + zDiff * zDiff <= sqRadius)
+            action(m_sortedIndices[sortedIndex]);
+        }
+      }
+    }
+  }
+}
+
+} // namespace Raz
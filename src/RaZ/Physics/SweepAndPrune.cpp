@@ -0,0 +1,172 @@
+#include "RaZ/Physics/SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Raz {
+
+namespace {
+
+// Factor by which the boxes' spread along another axis must exceed the one along the current sweep axis to switch to it. Switching requiring
+//  a full sort, this avoids alternating between axes along which the boxes are similarly spread
+constexpr float SweepAxisSwitchRatio = 1.5f;
+
+} // namespace
+
+std::uint32_t SweepAndPrune::addProxy(const AABB& aabb) {
+  std::uint32_t proxyIndex {};
+
+  if (!m_freeProxies.empty()) {
+    proxyIndex = m_freeProxies.back();
+    m_freeProxies.pop_back();
+    m_validProxies[proxyIndex] = true;
+  } else {
+    proxyIndex = static_cast<std::uint32_t>(m_validProxies.size());
+    m_validProxies.push_back(true);
+    m_endpointIndices.emplace_back();
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      m_minBounds[axis].emplace_back();
+      m_maxBounds[axis].emplace_back();
+    }
+  }
+
+  updateProxy(proxyIndex, aabb);
+
+  // The new proxy is appended at the end, & will be moved to its place by the next sort
+  m_endpointIndices[proxyIndex] = static_cast<std::uint32_t>(m_endpoints.size());
+  m_endpoints.push_back({ m_minBounds[m_sweepAxis][proxyIndex], proxyIndex });
+
+  ++m_proxyCount;
+  ++m_displacedEndpointCount;
+
+  return proxyIndex;
+}
+
+void SweepAndPrune::updateProxy(std::uint32_t proxyIndex, const AABB& aabb) {
+  assert("Error: Invalid sweep & prune proxy index." && isProxyValid(proxyIndex));
+
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    m_minBounds[axis][proxyIndex] = minPos[axis];
+    m_maxBounds[axis][proxyIndex] = maxPos[axis];
+  }
+}
+
+void SweepAndPrune::removeProxy(std::uint32_t proxyIndex) {
+  assert("Error: Invalid sweep & prune proxy index." && isProxyValid(proxyIndex));
+
+  m_validProxies[proxyIndex] = false;
+  m_freeProxies.push_back(proxyIndex);
+  --m_proxyCount;
+
+  // The last endpoint takes the place of the removed one, & will be moved back to its place by the next sort
+  const std::uint32_t endpointIndex = m_endpointIndices[proxyIndex];
+
+  if (endpointIndex + 1 != m_endpoints.size()) {
+    m_endpoints[endpointIndex] = m_endpoints.back();
+    m_endpointIndices[m_endpoints[endpointIndex].proxyIndex] = endpointIndex;
+    ++m_displacedEndpointCount;
+  }
+
+  m_endpoints.pop_back();
+}
+
+void SweepAndPrune::update() {
+  const std::size_t sweepAxis = selectSweepAxis();
+
+  if (sweepAxis != m_sweepAxis) {
+    m_sweepAxis = sweepAxis;
+    m_displacedEndpointCount = m_endpoints.size(); // The current order is meaningless on another axis
+  }
+
+  sortEndpoints();
+
+  m_pairs.clear();
+
+  const std::size_t firstAxis  = (m_sweepAxis + 1) % 3;
+  const std::size_t secondAxis = (m_sweepAxis + 2) % 3;
+
+  const std::vector<float>& sweepMaxBounds = m_maxBounds[m_sweepAxis];
+
+  // Boxes are sorted by their lower bound: each one can only overlap with the following ones starting before its upper bound
+  for (std::size_t endpointIndex = 0; endpointIndex < m_endpoints.size(); ++endpointIndex) {
+    const std::uint32_t proxyIndex = m_endpoints[endpointIndex].proxyIndex;
+    const float maxBound = sweepMaxBounds[proxyIndex];
+
+    for (std::size_t otherIndex = endpointIndex + 1; otherIndex < m_endpoints.size() && m_endpoints[otherIndex].value <= maxBound; ++otherIndex) {
+      const std::uint32_t otherProxyIndex = m_endpoints[otherIndex].proxyIndex;
+
+      if (m_minBounds[firstAxis][proxyIndex] > m_maxBounds[firstAxis][otherProxyIndex]
+       || m_minBounds[firstAxis][otherProxyIndex] > m_maxBounds[firstAxis][proxyIndex]
+       || m_minBounds[secondAxis][proxyIndex] > m_maxBounds[secondAxis][otherProxyIndex]
+       || m_minBounds[secondAxis][otherProxyIndex] > m_maxBounds[secondAxis][proxyIndex])
+        continue;
+
+      m_pairs.emplace_back(std::min(proxyIndex, otherProxyIndex), std::max(proxyIndex, otherProxyIndex));
+    }
+  }
+}
+
+void SweepAndPrune::sortEndpoints() {
+  const std::vector<float>& minBounds = m_minBounds[m_sweepAxis];
+
+  for (Endpoint& endpoint : m_endpoints)
+    endpoint.value = minBounds[endpoint.proxyIndex];
+
+  const auto compareEndpoints = [] (const Endpoint& endpoint1, const Endpoint& endpoint2) { return (endpoint1.value < endpoint2.value); };
+
+  // An insertion sort is only efficient if the order is nearly preserved; if many boxes have just been added or moved, a full sort is made
+  if (m_displacedEndpointCount > m_endpoints.size() / 8) {
+    std::sort(m_endpoints.begin(), m_endpoints.end(), compareEndpoints);
+  } else {
+    for (std::size_t endpointIndex = 1; endpointIndex < m_endpoints.size(); ++endpointIndex) {
+      const Endpoint endpoint = m_endpoints[endpointIndex];
+      std::size_t insertIndex = endpointIndex;
+
+      while (insertIndex > 0 && compareEndpoints(endpoint, m_endpoints[insertIndex - 1])) {
+        m_endpoints[insertIndex] = m_endpoints[insertIndex - 1];
+        --insertIndex;
+      }
+
+      m_endpoints[insertIndex] = endpoint;
+    }
+  }
+
+  m_displacedEndpointCount = 0;
+
+  for (std::size_t endpointIndex = 0; endpointIndex < m_endpoints.size(); ++endpointIndex)
+    m_endpointIndices[m_endpoints[endpointIndex].proxyIndex] = static_cast<std::uint32_t>(endpointIndex);
+}
+
+std::size_t SweepAndPrune::selectSweepAxis() const {
+  if (m_proxyCount == 0)
+    return m_sweepAxis;
+
+  // The boxes are swept along the axis on which their centers have the highest variance, where the fewest of them overlap
+  std::array<float, 3> variances {};
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const std::vector<float>& minBounds = m_minBounds[axis];
+    const std::vector<float>& maxBounds = m_maxBounds[axis];
+
+    float centerSum   = 0.f;
+    float sqCenterSum = 0.f;
+
+    for (const Endpoint& endpoint : m_endpoints) {
+      const float center = (minBounds[endpoint.proxyIndex] + maxBounds[endpoint.proxyIndex]) * 0.5f;
+      centerSum   += center;
+      sqCenterSum += center * center;
+    }
+
+    const auto proxyCount = static_cast<float>(m_proxyCount);
+    variances[axis] = sqCenterSum / proxyCount - (centerSum / proxyCount) * (centerSum / proxyCount);
+  }
+
+  const auto bestAxis = static_cast<std::size_t>(std::max_element(variances.cbegin(), variances.cend()) - variances.cbegin());
+  return (variances[bestAxis] > variances[m_sweepAxis] * SweepAxisSwitchRatio ? bestAxis : m_sweepAxis);
+}
+
+} // namespace Raz
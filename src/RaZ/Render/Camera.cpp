@@ -58,4 +58,44 @@ const Mat4f& Camera::computeInverseProjectionMatrix() {
   return m_invProjMat;
 }
 
+Ray Camera::computeRay(const Vec2f& ndcPos) const {
+  // Unprojecting the points at both ends of the depth range, which lie respectively on the near & far planes
+  const Mat4f invViewProjMat = m_invProjMat * m_invViewMat;
+
+  const Vec4f nearPoint = Vec4f({ ndcPos[0], ndcPos[1], 0.f, 1.f }) * invViewProjMat;
+  const Vec4f farPoint  = Vec4f({ ndcPos[0], ndcPos[1], 1.f, 1.f }) * invViewProjMat;
+
+  const Vec3f nearPos = Vec3f(nearPoint) / nearPoint[3];
+  const Vec3f farPos  = Vec3f(farPoint) / farPoint[3];
+
+  return Ray(nearPos, (farPos - nearPos).normalize());
+}
+
+std::array<Plane, 6> Camera::computeFrustumPlanes() const {
+  // Points are transformed into clip space as row vectors: each clip coordinate is the dot product with a column of the matrix
+  // A point is visible if -w <= x <= w, -w <= y <= w & 0 <= z <= w; each of these inequalities defines a plane
+  // See: Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix (Gribb & Hartmann)
+  const Mat4f viewProjMat = m_viewMat * m_projMat;
+
+  const auto getColumn = [&viewProjMat] (std::size_t colIndex) {
+    return Vec4f({ viewProjMat[colIndex], viewProjMat[4 + colIndex], viewProjMat[8 + colIndex], viewProjMat[12 + colIndex] });
+  };
+
+  const Vec4f xColumn = getColumn(0);
+  const Vec4f yColumn = getColumn(1);
+  const Vec4f zColumn = getColumn(2);
+  const Vec4f wColumn = getColumn(3);
+
+  const auto createPlane = [] (const Vec4f& coefficients) {
+    const Vec3f normal(coefficients);
+    const float invLength = 1.f / normal.computeLength();
+
+    return Plane(-coefficients[3] * invLength, normal * invLength);
+  };
+
+  return {{ createPlane(wColumn + xColumn), createPlane(wColumn - xColumn),
+            createPlane(wColumn + yColumn), createPlane(wColumn - yColumn),
+            createPlane(zColumn), createPlane(wColumn - zColumn) }};
+}
+
 } // namespace Raz
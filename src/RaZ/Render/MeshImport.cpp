@@ -32,6 +32,9 @@ void Mesh::import(const std::string& filePath) {
   } else {
     throw std::runtime_error("Error: Couldn't open the file '" + filePath + "'");
   }
+
+  computeBounds();
+  computeConvexHulls();
 }
 
 void Mesh::save(const std::string& filePath) const {
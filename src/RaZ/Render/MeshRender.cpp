@@ -1,4 +1,7 @@
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
 
 namespace Raz {
 
@@ -20,6 +23,51 @@ std::size_t Mesh::recoverTriangleCount() const {
   return indexCount / 3;
 }
 
+AABB Mesh::computeBoundingBox() const {
+  if (m_submeshes.empty())
+    return AABB(Vec3f(0.f), Vec3f(0.f));
+
+  Vec3f minPos = m_submeshes.front()->getBoundingBox().getLeftBottomBackPos();
+  Vec3f maxPos = m_submeshes.front()->getBoundingBox().getRightTopFrontPos();
+
+  for (std::size_t submeshIndex = 1; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    const AABB& submeshBox = m_submeshes[submeshIndex]->getBoundingBox();
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minPos[axis] = std::min(minPos[axis], submeshBox.getLeftBottomBackPos()[axis]);
+      maxPos[axis] = std::max(maxPos[axis], submeshBox.getRightTopFrontPos()[axis]);
+    }
+  }
+
+  return AABB(maxPos, minPos);
+}
+
+Sphere Mesh::computeBoundingSphere() const {
+  const Vec3f center = computeBoundingBox().computeCentroid();
+  float radius       = 0.f;
+
+  for (const SubmeshPtr& submesh : m_submeshes) {
+    const Sphere& submeshSphere = submesh->getBoundingSphere();
+    radius = std::max(radius, (submeshSphere.getCenter() - center).computeLength() + submeshSphere.getRadius());
+  }
+
+  return Sphere(center, radius);
+}
+
+void Mesh::computeBounds() const {
+  Threading::parallelize(0, m_submeshes.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t submeshIndex = beginIndex; submeshIndex < endIndex; ++submeshIndex)
+      m_submeshes[submeshIndex]->computeBounds();
+  });
+}
+
+void Mesh::computeConvexHulls(std::size_t maxVertexCount, float tolerance) const {
+  Threading::parallelize(0, m_submeshes.size(), [this, maxVertexCount, tolerance] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t submeshIndex = beginIndex; submeshIndex < endIndex; ++submeshIndex)
+      m_submeshes[submeshIndex]->computeConvexHull(maxVertexCount, tolerance);
+  });
+}
+
 void Mesh::drawUnitQuad() {
   static const MeshPtr quadMesh = Mesh::create(Quad(Vec3f({ -1.f,  1.f, 0.f }),
                                                     Vec3f({  1.f,  1.f, 0.f }),
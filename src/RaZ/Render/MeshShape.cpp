@@ -40,6 +40,7 @@ Mesh::Mesh(const Triangle& triangle) : Mesh() {
   indices[1] = 0;
   indices[2] = 2;
 
+  computeBounds();
   load();
 }
 
@@ -91,6 +92,7 @@ Mesh::Mesh(const Quad& quad) : Mesh() {
   indices[4] = 2;
   indices[5] = 3;
 
+  computeBounds();
   load();
 }
 
@@ -215,6 +217,7 @@ Mesh::Mesh(const AABB& box) : Mesh() {
   indices[34] = 6;
   indices[35] = 2;
 
+  computeBounds();
   load();
 }
 
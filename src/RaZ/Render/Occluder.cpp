@@ -0,0 +1,41 @@
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Occluder.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+Occluder::Occluder(const AABB& box) {
+  const Vec3f& minPos = box.getLeftBottomBackPos();
+  const Vec3f& maxPos = box.getRightTopFrontPos();
+
+  m_positions.reserve(8);
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    m_positions.emplace_back(Vec3f({ (cornerIndex & 1u ? maxPos[0] : minPos[0]),
+                                     (cornerIndex & 2u ? maxPos[1] : minPos[1]),
+                                     (cornerIndex & 4u ? maxPos[2] : minPos[2]) }));
+  }
+
+  // Two triangles per face; the rasterizer handles both windings, so their orientation is irrelevant
+  m_indices = { 0, 2, 3, 0, 3, 1,   // Back   (-Z)
+                4, 5, 7, 4, 7, 6,   // Front  (+Z)
+                0, 4, 6, 0, 6, 2,   // Left   (-X)
+                1, 3, 7, 1, 7, 5,   // Right  (+X)
+                0, 1, 5, 0, 5, 4,   // Bottom (-Y)
+                2, 6, 7, 2, 7, 3 }; // Top    (+Y)
+}
+
+Occluder::Occluder(const Mesh& mesh) {
+  for (const SubmeshPtr& submeshPtr : mesh.getSubmeshes()) {
+    const Submesh& submesh = *submeshPtr; // Accessed as const, so that its cached bounds are kept
+    const auto firstIndex  = static_cast<unsigned int>(m_positions.size());
+
+    for (const Vertex& vertex : submesh.getVertices())
+      m_positions.emplace_back(vertex.position);
+
+    for (unsigned int index : submesh.getIndices())
+      m_indices.emplace_back(firstIndex + index);
+  }
+}
+
+} // namespace Raz
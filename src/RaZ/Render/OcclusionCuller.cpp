@@ -0,0 +1,310 @@
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Render/Occluder.hpp"
+#include "RaZ/Render/OcclusionCuller.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Raz {
+
+static_assert(OcclusionCuller::TileWidth % Simd::Width == 0, "Error: The tile width must be a multiple of the SIMD width.");
+
+namespace {
+
+Vec2f computeScreenPosition(const Vec4f& clipPos, float width, float height) {
+  const float invW = 1.f / clipPos[3];
+
+  // The vertical axis is flipped so that rows go from the top of the screen to the bottom
+  return Vec2f({ (clipPos[0] * invW * 0.5f + 0.5f) * width, (0.5f - clipPos[1] * invW * 0.5f) * height });
+}
+
+} // namespace
+
+void OcclusionCuller::resize(unsigned int width, unsigned int height) {
+  m_tileCountX = std::max((width + TileWidth - 1) / TileWidth, 1u);
+  m_tileCountY = std::max((height + TileHeight - 1) / TileHeight, 1u);
+
+  m_levels.clear();
+  m_levels.push_back(DepthLevel{ m_tileCountX * TileWidth, m_tileCountY * TileHeight, {} });
+
+  // Each level halves the previous one's size, rounded up, down to a single texel
+  while (m_levels.back().width > 1 || m_levels.back().height > 1) {
+    const DepthLevel& prevLevel = m_levels.back();
+    m_levels.push_back(DepthLevel{ (prevLevel.width + 1) / 2, (prevLevel.height + 1) / 2, {} });
+  }
+
+  for (DepthLevel& level : m_levels)
+    level.depths.resize(level.width * level.height);
+
+  m_tileTriangles.resize(m_tileCountX * m_tileCountY);
+
+  clear();
+}
+
+void OcclusionCuller::clear() {
+  for (DepthLevel& level : m_levels)
+    std::fill(level.depths.begin(), level.depths.end(), 1.f);
+
+  m_triangles.clear();
+
+  for (std::vector<std::uint32_t>& tileTriangles : m_tileTriangles)
+    tileTriangles.clear();
+}
+
+void OcclusionCuller::addOccluder(const std::vector<Vec3f>& positions, const std::vector<unsigned int>& indices, const Mat4f& modelViewProjMat) {
+  const auto width  = static_cast<float>(getWidth());
+  const auto height = static_cast<float>(getHeight());
+
+  m_clipPositions.resize(positions.size());
+
+  for (std::size_t posIndex = 0; posIndex < positions.size(); ++posIndex)
+    m_clipPositions[posIndex] = Vec4f(positions[posIndex], 1.f) * modelViewProjMat;
+
+  for (std::size_t triIndex = 0; triIndex + 2 < indices.size(); triIndex += 3) {
+    const Vec4f& firstClipPos  = m_clipPositions[indices[triIndex]];
+    const Vec4f& secondClipPos = m_clipPositions[indices[triIndex + 1]];
+    const Vec4f& thirdClipPos  = m_clipPositions[indices[triIndex + 2]];
+
+    // A vertex with a negative depth is in front of the near plane or behind the camera; clipping the triangle is not worth it for an occluder
+    if (firstClipPos[2] < 0.f || secondClipPos[2] < 0.f || thirdClipPos[2] < 0.f)
+      continue;
+
+    const Vec2f firstPos = computeScreenPosition(firstClipPos, width, height);
+    Vec2f secondPos      = computeScreenPosition(secondClipPos, width, height);
+    Vec2f thirdPos       = computeScreenPosition(thirdClipPos, width, height);
+
+    const float firstDepth = firstClipPos[2] / firstClipPos[3];
+    float secondDepth      = secondClipPos[2] / secondClipPos[3];
+    float thirdDepth       = thirdClipPos[2] / thirdClipPos[3];
+
+    float area = (secondPos[0] - firstPos[0]) * (thirdPos[1] - firstPos[1]) - (secondPos[1] - firstPos[1]) * (thirdPos[0] - firstPos[0]);
+
+    if (std::abs(area) <= std::numeric_limits<float>::epsilon())
+      continue;
+
+    // Both windings are accepted, the vertices being reordered so that the edge functions are positive inside the triangle
+    if (area < 0.f) {
+      std::swap(secondPos, thirdPos);
+      std::swap(secondDepth, thirdDepth);
+      area = -area;
+    }
+
+    const float minX = std::min({ firstPos[0], secondPos[0], thirdPos[0] });
+    const float minY = std::min({ firstPos[1], secondPos[1], thirdPos[1] });
+    const float maxX = std::max({ firstPos[0], secondPos[0], thirdPos[0] });
+    const float maxY = std::max({ firstPos[1], secondPos[1], thirdPos[1] });
+
+    if (maxX < 0.f || maxY < 0.f || minX >= width || minY >= height)
+      continue;
+
+    ScreenTriangle triangle;
+    triangle.minX = std::max(static_cast<int>(minX), 0);
+    triangle.minY = std::max(static_cast<int>(minY), 0);
+    triangle.maxX = std::min(static_cast<int>(maxX), static_cast<int>(width) - 1);
+    triangle.maxY = std::min(static_cast<int>(maxY), static_cast<int>(height) - 1);
+
+    // The edge function of the edge going from A to B, evaluated at P, is (Bx - Ax) * (Py - Ay) - (By - Ay) * (Px - Ax)
+    const std::array<const Vec2f*, 3> triPositions = { &firstPos, &secondPos, &thirdPos };
+
+    for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      const Vec2f& edgeBegin = *triPositions[edgeIndex];
+      const Vec2f& edgeEnd   = *triPositions[(edgeIndex + 1) % 3];
+
+      const float edgeX = edgeEnd[0] - edgeBegin[0];
+      const float edgeY = edgeEnd[1] - edgeBegin[1];
+
+      triangle.edgeStepsX[edgeIndex]  = -edgeY;
+      triangle.edgeStepsY[edgeIndex]  = edgeX;
+      triangle.edgeOffsets[edgeIndex] = edgeY * edgeBegin[0] - edgeX * edgeBegin[1];
+    }
+
+    // The depth in normalized device coordinates is linear in screen space; it is the sum of the vertices' depths weighted by the barycentric
+    //  coordinates, each being the edge function of the opposite edge divided by the triangle's area
+    const float invArea = 1.f / area;
+    const std::array<float, 3> weightedDepths = { thirdDepth * invArea, firstDepth * invArea, secondDepth * invArea };
+
+    for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      triangle.depthStepX  += weightedDepths[edgeIndex] * triangle.edgeStepsX[edgeIndex];
+      triangle.depthStepY  += weightedDepths[edgeIndex] * triangle.edgeStepsY[edgeIndex];
+      triangle.depthOffset += weightedDepths[edgeIndex] * triangle.edgeOffsets[edgeIndex];
+    }
+
+    const auto newTriIndex = static_cast<std::uint32_t>(m_triangles.size());
+    m_triangles.push_back(triangle);
+
+    for (int tileY = triangle.minY / static_cast<int>(TileHeight); tileY <= triangle.maxY / static_cast<int>(TileHeight); ++tileY) {
+      for (int tileX = triangle.minX / static_cast<int>(TileWidth); tileX <= triangle.maxX / static_cast<int>(TileWidth); ++tileX)
+        m_tileTriangles[static_cast<std::size_t>(tileY) * m_tileCountX + static_cast<std::size_t>(tileX)].push_back(newTriIndex);
+    }
+  }
+}
+
+void OcclusionCuller::addOccluder(const Occluder& occluder, const Mat4f& modelViewProjMat) {
+  addOccluder(occluder.getPositions(), occluder.getIndices(), modelViewProjMat);
+}
+
+void OcclusionCuller::rasterize() {
+  // Tiles cover distinct parts of the depth buffer, & can thus be rasterized without any synchronization
+  Threading::parallelize(0, m_tileTriangles.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t tileIndex = beginIndex; tileIndex < endIndex; ++tileIndex)
+      rasterizeTile(tileIndex);
+  });
+
+  buildPyramid();
+}
+
+bool OcclusionCuller::isOccluded(const AABB& box, const Mat4f& viewProjMat) const {
+  const DepthLevel& depthBuffer = m_levels.front();
+
+  const auto width  = static_cast<float>(depthBuffer.width);
+  const auto height = static_cast<float>(depthBuffer.height);
+
+  const Vec3f& minPos = box.getLeftBottomBackPos();
+  const Vec3f& maxPos = box.getRightTopFrontPos();
+
+  float minX = std::numeric_limits<float>::max();
+  float minY = std::numeric_limits<float>::max();
+  float maxX = std::numeric_limits<float>::lowest();
+  float maxY = std::numeric_limits<float>::lowest();
+  float minDepth = std::numeric_limits<float>::max();
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    const Vec3f corner({ (cornerIndex & 1u ? maxPos[0] : minPos[0]),
+                         (cornerIndex & 2u ? maxPos[1] : minPos[1]),
+                         (cornerIndex & 4u ? maxPos[2] : minPos[2]) });
+    const Vec4f clipPos = Vec4f(corner, 1.f) * viewProjMat;
+
+    if (clipPos[2] < 0.f)
+      return false;
+
+    const Vec2f screenPos = computeScreenPosition(clipPos, width, height);
+
+    minX = std::min(minX, screenPos[0]);
+    minY = std::min(minY, screenPos[1]);
+    maxX = std::max(maxX, screenPos[0]);
+    maxY = std::max(maxY, screenPos[1]);
+    minDepth = std::min(minDepth, clipPos[2] / clipPos[3]);
+  }
+
+  // Boxes outside of the screen are left to frustum culling
+  if (maxX < 0.f || maxY < 0.f || minX >= width || minY >= height)
+    return false;
+
+  const auto firstX = static_cast<unsigned int>(std::max(minX, 0.f));
+  const auto firstY = static_cast<unsigned int>(std::max(minY, 0.f));
+  const auto lastX  = std::min(static_cast<unsigned int>(maxX), depthBuffer.width - 1);
+  const auto lastY  = std::min(static_cast<unsigned int>(maxY), depthBuffer.height - 1);
+
+  // The level is chosen so that the bounds cover at most 3x3 texels; a texel at a given level covers 2^level pixels on each side
+  const unsigned int extent = std::max(lastX - firstX, lastY - firstY);
+  std::size_t levelIndex    = 0;
+
+  while ((extent >> levelIndex) > 1 && levelIndex + 1 < m_levels.size())
+    ++levelIndex;
+
+  const DepthLevel& level = m_levels[levelIndex];
+  float maxDepth = 0.f;
+
+  for (unsigned int texelY = (firstY >> levelIndex); texelY <= (lastY >> levelIndex); ++texelY) {
+    for (unsigned int texelX = (firstX >> levelIndex); texelX <= (lastX >> levelIndex); ++texelX)
+      maxDepth = std::max(maxDepth, level.depths[texelY * level.width + texelX]);
+  }
+
+  return (minDepth > maxDepth);
+}
+
+void OcclusionCuller::rasterizeTile(std::size_t tileIndex) {
+  const std::vector<std::uint32_t>& tileTriangles = m_tileTriangles[tileIndex];
+
+  if (tileTriangles.empty())
+    return;
+
+  DepthLevel& depthBuffer = m_levels.front();
+
+  const auto tileMinX = static_cast<int>((tileIndex % m_tileCountX) * TileWidth);
+  const auto tileMinY = static_cast<int>((tileIndex / m_tileCountX) * TileHeight);
+  const int tileMaxX  = tileMinX + static_cast<int>(TileWidth) - 1;
+  const int tileMaxY  = tileMinY + static_cast<int>(TileHeight) - 1;
+
+  // Offsets of each lane's pixel center from the first one processed at once
+  std::array<float, Simd::Width> laneOffsets {};
+
+  for (std::size_t laneIndex = 0; laneIndex < Simd::Width; ++laneIndex)
+    laneOffsets[laneIndex] = static_cast<float>(laneIndex) + 0.5f;
+
+  const Simd::Float laneCenters = Simd::load(laneOffsets.data());
+  const Simd::Float zero        = Simd::set(0.f);
+
+  for (std::uint32_t triIndex : tileTriangles) {
+    const ScreenTriangle& triangle = m_triangles[triIndex];
+
+    // Pixels are processed in groups aligned on the SIMD width; as the tile width is a multiple of it, a group never spans over two tiles
+    const int firstX = std::max(triangle.minX, tileMinX) / static_cast<int>(Simd::Width) * static_cast<int>(Simd::Width);
+    const int lastX  = std::min(triangle.maxX, tileMaxX);
+    const int firstY = std::max(triangle.minY, tileMinY);
+    const int lastY  = std::min(triangle.maxY, tileMaxY);
+
+    const Simd::Float firstStepsX  = Simd::set(triangle.edgeStepsX[0]);
+    const Simd::Float secondStepsX = Simd::set(triangle.edgeStepsX[1]);
+    const Simd::Float thirdStepsX  = Simd::set(triangle.edgeStepsX[2]);
+    const Simd::Float depthStepsX  = Simd::set(triangle.depthStepX);
+
+    for (int y = firstY; y <= lastY; ++y) {
+      const float centerY = static_cast<float>(y) + 0.5f;
+
+      const Simd::Float firstRowEdge  = Simd::set(triangle.edgeStepsY[0] * centerY + triangle.edgeOffsets[0]);
+      const Simd::Float secondRowEdge = Simd::set(triangle.edgeStepsY[1] * centerY + triangle.edgeOffsets[1]);
+      const Simd::Float thirdRowEdge  = Simd::set(triangle.edgeStepsY[2] * centerY + triangle.edgeOffsets[2]);
+      const Simd::Float rowDepth      = Simd::set(triangle.depthStepY * centerY + triangle.depthOffset);
+
+      float* rowDepths = depthBuffer.depths.data() + static_cast<std::size_t>(y) * depthBuffer.width;
+
+      for (int x = firstX; x <= lastX; x += static_cast<int>(Simd::Width)) {
+        const Simd::Float centersX = Simd::add(Simd::set(static_cast<float>(x)), laneCenters);
+
+        const Simd::Float firstEdge  = Simd::add(Simd::mul(firstStepsX, centersX), firstRowEdge);
+        const Simd::Float secondEdge = Simd::add(Simd::mul(secondStepsX, centersX), secondRowEdge);
+        const Simd::Float thirdEdge  = Simd::add(Simd::mul(thirdStepsX, centersX), thirdRowEdge);
+
+        const Simd::Float insideMask = Simd::andMasks(Simd::andMasks(Simd::lessOrEqual(zero, firstEdge), Simd::lessOrEqual(zero, secondEdge)),
+                                                      Simd::lessOrEqual(zero, thirdEdge));
+
+        if (Simd::getMaskBits(insideMask) == 0)
+          continue;
+
+        const Simd::Float depths     = Simd::add(Simd::mul(depthStepsX, centersX), rowDepth);
+        const Simd::Float prevDepths = Simd::load(rowDepths + x);
+
+        Simd::store(rowDepths + x, Simd::select(insideMask, Simd::min(prevDepths, depths), prevDepths));
+      }
+    }
+  }
+}
+
+void OcclusionCuller::buildPyramid() {
+  for (std::size_t levelIndex = 1; levelIndex < m_levels.size(); ++levelIndex) {
+    const DepthLevel& prevLevel = m_levels[levelIndex - 1];
+    DepthLevel& level           = m_levels[levelIndex];
+
+    for (unsigned int y = 0; y < level.height; ++y) {
+      // Odd sizes make the last texels cover a single one of the previous level on their side
+      const unsigned int firstPrevY = y * 2;
+      const unsigned int lastPrevY  = std::min(firstPrevY + 1, prevLevel.height - 1);
+
+      for (unsigned int x = 0; x < level.width; ++x) {
+        const unsigned int firstPrevX = x * 2;
+        const unsigned int lastPrevX  = std::min(firstPrevX + 1, prevLevel.width - 1);
+
+        level.depths[y * level.width + x] = std::max({ prevLevel.depths[firstPrevY * prevLevel.width + firstPrevX],
+                                                       prevLevel.depths[firstPrevY * prevLevel.width + lastPrevX],
+                                                       prevLevel.depths[lastPrevY * prevLevel.width + firstPrevX],
+                                                       prevLevel.depths[lastPrevY * prevLevel.width + lastPrevX] });
+      }
+    }
+  }
+}
+
+} // namespace Raz
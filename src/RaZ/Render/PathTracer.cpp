@@ -0,0 +1,490 @@
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/PathTracer.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Raz {
+
+namespace {
+
+constexpr float RayOffset    = 0.0001f;
+/// Roughness under which the GGX distribution becomes too sharp to be sampled reliably with single precision.
+constexpr float MinRoughness = 0.03f;
+/// Number of bounces after which paths may be randomly terminated, their contribution being compensated for those surviving.
+constexpr unsigned int RouletteBounceCount = 3;
+
+/// Hashes an integer; see: Hash Functions for GPU Rendering (Jarzynski & Olano).
+constexpr std::uint32_t hashPcg(std::uint32_t value) {
+  const std::uint32_t state = value * 747796405u + 2891336453u;
+  const std::uint32_t word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+  return (word >> 22u) ^ word;
+}
+
+/// Xorshift generator of uniform floats in [0, 1), seeded per sample so that the drawn values never depend on the thread computing them.
+class RandomGenerator {
+public:
+  explicit RandomGenerator(std::uint32_t seed) : m_state{ (seed == 0 ? 1u : seed) } {}
+
+  float generate() {
+    m_state ^= m_state << 13u;
+    m_state ^= m_state >> 17u;
+    m_state ^= m_state << 5u;
+    return static_cast<float>(m_state >> 8u) * (1.f / 16777216.f);
+  }
+
+private:
+  std::uint32_t m_state {};
+};
+
+/// Computes two directions forming an orthonormal basis with the given normal; see: Building an Orthonormal Basis, Revisited (Duff et al.).
+void computeBasis(const Vec3f& normal, Vec3f& tangent, Vec3f& bitangent) {
+  const float sign   = std::copysign(1.f, normal[2]);
+  const float factor = -1.f / (sign + normal[2]);
+  const float cross  = normal[0] * normal[1] * factor;
+
+  tangent   = Vec3f({ 1.f + sign * normal[0] * normal[0] * factor, sign * cross, -sign * normal[0] });
+  bitangent = Vec3f({ cross, sign + normal[1] * normal[1] * factor, -normal[1] });
+}
+
+Vec3f toWorld(const Vec3f& localDir, const Vec3f& normal) {
+  Vec3f tangent;
+  Vec3f bitangent;
+  computeBasis(normal, tangent, bitangent);
+
+  return tangent * localDir[0] + bitangent * localDir[1] + normal * localDir[2];
+}
+
+/// Surface properties at a hit point, as needed by the BRDF.
+struct ShadingPoint {
+  Vec3f albedo {};
+  Vec3f baseReflectivity {};
+  float metallic {};
+  float roughness {};
+  /// Squared roughness, defining the GGX distribution.
+  float alpha {};
+};
+
+ShadingPoint computeShadingPoint(const PathTracer::Surface& surface) {
+  ShadingPoint point;
+  point.albedo           = surface.baseColor;
+  point.metallic         = std::min(std::max(surface.metallicFactor, 0.f), 1.f);
+  point.baseReflectivity = Vec3f(0.04f) * (1.f - point.metallic) + point.albedo * point.metallic;
+  point.roughness        = std::min(std::max(surface.roughnessFactor, MinRoughness), 1.f);
+  point.alpha            = point.roughness * point.roughness;
+  return point;
+}
+
+float computeNormalDistrib(float halfVecAngle, float alpha) {
+  const float sqrAlpha = alpha * alpha;
+  const float divider  = halfVecAngle * halfVecAngle * (sqrAlpha - 1.f) + 1.f;
+  return sqrAlpha / std::max(PI<float> * divider * divider, 0.001f);
+}
+
+float computeGeomSchlickGGX(float angle, float roughness) {
+  const float incrRough = roughness + 1.f;
+  const float factor    = (incrRough * incrRough) / 8.f;
+  return angle / (angle * (1.f - factor) + factor);
+}
+
+/// Evaluates the Cook-Torrance BRDF exactly as the rasterizer's shader does.
+/// \param point Surface properties.
+/// \param viewAngle Cosine of the angle between the normal & the view direction.
+/// \param lightAngle Cosine of the angle between the normal & the light direction.
+/// \param halfVecAngle Cosine of the angle between the normal & the half vector.
+/// \param viewHalfAngle Cosine of the angle between the view direction & the half vector.
+/// \return BRDF value, to be multiplied by the incoming radiance & the light angle.
+Vec3f evaluateBrdf(const ShadingPoint& point, float viewAngle, float lightAngle, float halfVecAngle, float viewHalfAngle) {
+  const float normalDistrib = computeNormalDistrib(halfVecAngle, point.alpha);
+  const float geometry      = computeGeomSchlickGGX(viewAngle, point.roughness) * computeGeomSchlickGGX(lightAngle, point.roughness);
+  const Vec3f fresnel       = point.baseReflectivity + (Vec3f(1.f) - point.baseReflectivity) * std::pow(1.f - viewHalfAngle, 5.f);
+
+  const Vec3f specular = fresnel * (normalDistrib * geometry / std::max(4.f * viewAngle * lightAngle, 0.001f));
+  const Vec3f diffuse  = (Vec3f(1.f) - fresnel) * (1.f - point.metallic);
+
+  return diffuse * point.albedo / PI<float> + specular;
+}
+
+/// Probability of sampling the specular lobe rather than the diffuse one; metals, having no diffuse part, favor the former.
+float computeSpecularProbability(const ShadingPoint& point) {
+  return 0.5f + 0.5f * point.metallic;
+}
+
+/// Computes the density with which a light direction is drawn, combining both lobes.
+float computeSamplingPdf(const ShadingPoint& point, float lightAngle, float halfVecAngle, float viewHalfAngle) {
+  const float specularProbability = computeSpecularProbability(point);
+  const float specularPdf         = computeNormalDistrib(halfVecAngle, point.alpha) * halfVecAngle / (4.f * std::max(viewHalfAngle, 0.0001f));
+  const float diffusePdf          = lightAngle / PI<float>;
+  return specularProbability * specularPdf + (1.f - specularProbability) * diffusePdf;
+}
+
+/// Draws a light direction, either from the GGX distribution of half vectors or from a cosine-weighted hemisphere.
+Vec3f sampleDirection(const ShadingPoint& point, const Vec3f& normal, const Vec3f& viewDir, RandomGenerator& randGenerator) {
+  const float lobeChoice = randGenerator.generate();
+  const float firstRand  = randGenerator.generate();
+  const float azimuth    = 2.f * PI<float> * randGenerator.generate();
+
+  if (lobeChoice < computeSpecularProbability(point)) {
+    const float sqrAlpha = point.alpha * point.alpha;
+    const float cosTheta = std::sqrt((1.f - firstRand) / (1.f + (sqrAlpha - 1.f) * firstRand));
+    const float sinTheta = std::sqrt(std::max(1.f - cosTheta * cosTheta, 0.f));
+
+    const Vec3f halfVec = toWorld(Vec3f({ sinTheta * std::cos(azimuth), sinTheta * std::sin(azimuth), cosTheta }), normal);
+    return halfVec * (2.f * viewDir.dot(halfVec)) - viewDir;
+  }
+
+  const float sinTheta = std::sqrt(firstRand);
+  return toWorld(Vec3f({ sinTheta * std::cos(azimuth), sinTheta * std::sin(azimuth), std::sqrt(1.f - firstRand) }), normal);
+}
+
+} // namespace
+
+PathTracer::PathTracer(unsigned int width, unsigned int height)
+  : m_width{ width }, m_height{ height }, m_accumulatedRadiance(static_cast<std::size_t>(width) * height, Vec3f(0.f)) {}
+
+void PathTracer::setCamera(const Camera& camera) {
+  m_camera = std::make_unique<Camera>(camera);
+  resetAccumulation();
+}
+
+void PathTracer::setCamera(const Camera& camera, const Transform& cameraTransform) {
+  setCamera(camera);
+
+  m_camera->computeViewMatrix(cameraTransform.computeTranslationMatrix(true), cameraTransform.getRotation().inverse().computeMatrix());
+  m_camera->computeInverseViewMatrix();
+}
+
+std::size_t PathTracer::addGeometry(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  Geometry geometry;
+  geometry.vertices = vertices;
+  geometry.indices  = indices;
+
+  m_geometries.emplace_back(std::move(geometry));
+  return m_geometries.size() - 1;
+}
+
+void PathTracer::addInstance(std::size_t geometryIndex, const Mat4f& transform, const Surface& surface) {
+  if (geometryIndex >= m_geometries.size())
+    throw std::invalid_argument("Error: Invalid geometry index given to the path tracer");
+
+  Instance instance;
+  instance.geometryIndex = geometryIndex;
+  instance.transform     = transform;
+  instance.normalMatrix  = transform.inverse().transpose();
+  instance.surface       = surface;
+
+  m_instances.emplace_back(std::move(instance));
+
+  m_sceneOutdated = true;
+  resetAccumulation();
+}
+
+void PathTracer::addMesh(const Mesh& mesh, const Mat4f& transform) {
+  for (const SubmeshPtr& submeshPtr : mesh.getSubmeshes()) {
+    const Submesh& submesh = *submeshPtr; // Accessed as const, so that its cached bounds are kept
+    auto geometryIter = m_submeshGeometries.find(&submesh);
+
+    if (geometryIter == m_submeshGeometries.end())
+      geometryIter = m_submeshGeometries.emplace(&submesh, addGeometry(submesh.getVertices(), submesh.getIndices())).first;
+
+    const std::size_t materialIndex = submesh.getMaterialIndex();
+    const Surface surface = (materialIndex < mesh.getMaterials().size() ? recoverSurface(*mesh.getMaterials()[materialIndex]) : Surface());
+
+    addInstance(geometryIter->second, transform, surface);
+  }
+}
+
+void PathTracer::addLight(const Light& light, const Vec3f& position) {
+  LightSource lightSource;
+  lightSource.isDirectional = (light.getType() == LightType::DIRECTIONAL);
+  lightSource.position      = position;
+  lightSource.direction     = (lightSource.isDirectional ? light.getDirection().normalize() : Vec3f(0.f));
+  lightSource.radiance      = light.getColor() * light.getEnergy();
+
+  m_lights.emplace_back(lightSource);
+  resetAccumulation();
+}
+
+void PathTracer::loadWorld(const World& world) {
+  clearScene();
+
+  bool hasCamera = false;
+
+  for (const EntityPtr& entity : world.getEntities()) {
+    if (!entity->isEnabled() || !entity->hasComponent<Transform>())
+      continue;
+
+    const auto& transform = entity->getComponent<Transform>();
+
+    if (entity->hasComponent<Mesh>())
+      addMesh(entity->getComponent<Mesh>(), transform.getTransformMatrix());
+
+    if (entity->hasComponent<Light>())
+      addLight(entity->getComponent<Light>(), transform.getPosition());
+
+    if (!hasCamera && entity->hasComponent<Camera>()) {
+      setCamera(entity->getComponent<Camera>(), transform);
+      hasCamera = true;
+    }
+  }
+}
+
+void PathTracer::clearScene() {
+  m_geometries.clear();
+  m_instances.clear();
+  m_lights.clear();
+  m_submeshGeometries.clear();
+  m_instanceBvh.clear();
+
+  m_sceneOutdated = true;
+  resetAccumulation();
+}
+
+void PathTracer::resetAccumulation() {
+  std::fill(m_accumulatedRadiance.begin(), m_accumulatedRadiance.end(), Vec3f(0.f));
+  m_sampleCount = 0;
+}
+
+void PathTracer::render(unsigned int sampleCount) {
+  if (m_camera == nullptr)
+    throw std::runtime_error("Error: The path tracer needs a camera to render the scene");
+
+  if (sampleCount == 0)
+    return;
+
+  if (m_sceneOutdated)
+    prepareScene();
+
+  const std::size_t tileCountX = (m_width + TileSize - 1) / TileSize;
+  const std::size_t tileCountY = (m_height + TileSize - 1) / TileSize;
+  const std::size_t tileCount  = tileCountX * tileCountY;
+
+  // Tiles take very different times to render depending on what they see; each thread thus fetches the next available one
+  //  as soon as it is done, instead of being assigned a fixed range of them
+  Threading::parallelizeDynamic(tileCount, [this, sampleCount] (std::size_t tileIndex, std::size_t) {
+    renderTile(tileIndex, sampleCount);
+  }, m_threadCount);
+
+  m_sampleCount += sampleCount;
+}
+
+Vec3f PathTracer::getPixelRadiance(unsigned int x, unsigned int y) const {
+  assert("Error: The pixel's coordinates must be within the path tracer's image." && x < m_width && y < m_height);
+
+  if (m_sampleCount == 0)
+    return Vec3f(0.f);
+
+  return m_accumulatedRadiance[static_cast<std::size_t>(y) * m_width + x] / static_cast<float>(m_sampleCount);
+}
+
+Image PathTracer::computeImage(bool toneMapped) const {
+  Image image(m_width, m_height, ImageColorspace::RGB, (toneMapped ? ImageDataType::BYTE : ImageDataType::FLOAT));
+
+  const float invSampleCount = (m_sampleCount == 0 ? 0.f : 1.f / static_cast<float>(m_sampleCount));
+
+  for (std::size_t pixelIndex = 0; pixelIndex < m_accumulatedRadiance.size(); ++pixelIndex) {
+    const Vec3f radiance = m_accumulatedRadiance[pixelIndex] * invSampleCount;
+
+    for (std::size_t channelIndex = 0; channelIndex < 3; ++channelIndex) {
+      if (!toneMapped) {
+        static_cast<float*>(image.getDataPtr())[pixelIndex * 3 + channelIndex] = radiance[channelIndex];
+        continue;
+      }
+
+      // Mapping the radiance as the rasterizer does: Reinhard tone mapping, then gamma correction
+      const float color = std::pow(radiance[channelIndex] / (radiance[channelIndex] + 1.f), 1.f / 2.2f);
+      static_cast<uint8_t*>(image.getDataPtr())[pixelIndex * 3 + channelIndex] = static_cast<uint8_t>(std::lround(color * 255.f));
+    }
+  }
+
+  return image;
+}
+
+void PathTracer::saveImage(const std::string& filePath) const {
+  // Rows being stored from the bottom, they must be reversed to be written from the top
+  computeImage().save(filePath, true);
+}
+
+PathTracer::Surface PathTracer::recoverSurface(const Material& material) {
+  Surface surface;
+
+  if (material.getType() == MaterialType::COOK_TORRANCE) {
+    const auto& cookTorranceMat = static_cast<const MaterialCookTorrance&>(material);
+
+    surface.baseColor       = cookTorranceMat.getBaseColor();
+    surface.metallicFactor  = cookTorranceMat.getMetallicFactor();
+    surface.roughnessFactor = cookTorranceMat.getRoughnessFactor();
+  } else {
+    const auto& standardMat = static_cast<const MaterialStandard&>(material);
+
+    surface.baseColor = standardMat.getDiffuse();
+    surface.emission  = standardMat.getEmissive();
+  }
+
+  return surface;
+}
+
+void PathTracer::prepareScene() {
+  // Geometries are only built once, the top-level hierarchy being rebuilt over all instances
+  Threading::parallelize(0, m_geometries.size(), [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t geometryIndex = beginIndex; geometryIndex < endIndex; ++geometryIndex) {
+      Geometry& geometry = m_geometries[geometryIndex];
+
+      if (geometry.bvh.isEmpty() && !geometry.indices.empty())
+        geometry.bvh.build(geometry.vertices, geometry.indices);
+    }
+  });
+
+  m_instanceBvh.clear();
+
+  for (const Instance& instance : m_instances)
+    m_instanceBvh.addInstance(m_geometries[instance.geometryIndex].bvh, instance.transform);
+
+  m_instanceBvh.build();
+  m_sceneOutdated = false;
+}
+
+Vec3f PathTracer::traceRay(const Ray& ray, std::uint32_t seed) const {
+  RandomGenerator randGenerator(seed);
+
+  Vec3f radiance(0.f);
+  Vec3f throughput(1.f);
+  Ray currentRay = ray;
+
+  for (unsigned int bounceIndex = 0; ; ++bounceIndex) {
+    RayHit hit;
+    std::size_t instanceIndex {};
+
+    if (!m_instanceBvh.intersect(currentRay, hit, instanceIndex)) {
+      radiance += throughput * m_backgroundColor;
+      break;
+    }
+
+    const Instance& instance = m_instances[instanceIndex];
+    const Geometry& geometry = m_geometries[instance.geometryIndex];
+    const Vec3f viewDir      = -currentRay.getDirection();
+
+    // Surfaces are two-sided: the geometric normal is made to face the ray, the interpolated one being flipped to match it
+    const Vec3f geomNormal = (hit.normal.dot(viewDir) < 0.f ? -hit.normal : hit.normal);
+
+    const std::size_t firstIndex = hit.triangleIndex * 3;
+    const float firstWeight      = 1.f - hit.barycentricCoords[0] - hit.barycentricCoords[1];
+    const Vec3f localNormal      = geometry.vertices[geometry.indices[firstIndex]].normal * firstWeight
+                                 + geometry.vertices[geometry.indices[firstIndex + 1]].normal * hit.barycentricCoords[0]
+                                 + geometry.vertices[geometry.indices[firstIndex + 2]].normal * hit.barycentricCoords[1];
+
+    Vec3f normal = geomNormal;
+
+    if (localNormal.computeSquaredLength() > 0.f) {
+      normal = Vec3f(Vec4f(localNormal, 0.f) * instance.normalMatrix).normalize();
+
+      if (normal.dot(geomNormal) < 0.f)
+        normal = -normal;
+    }
+
+    radiance += throughput * instance.surface.emission;
+
+    const ShadingPoint point = computeShadingPoint(instance.surface);
+    const float viewAngle    = std::max(normal.dot(viewDir), 0.f);
+    const Vec3f origin       = hit.position + geomNormal * RayOffset;
+
+    // Sampling all lights directly; being punctual, they could never be hit otherwise
+    for (const LightSource& light : m_lights) {
+      Vec3f lightDir      = -light.direction;
+      Vec3f lightRadiance = light.radiance;
+      float lightDistance = std::numeric_limits<float>::max();
+
+      if (!light.isDirectional) {
+        lightDir = light.position - hit.position;
+
+        const float sqrDistance = lightDir.computeSquaredLength();
+        lightDistance  = std::sqrt(sqrDistance);
+        lightDir      /= lightDistance;
+        lightRadiance /= sqrDistance;
+      }
+
+      const float lightAngle = normal.dot(lightDir);
+
+      if (lightAngle <= 0.f || geomNormal.dot(lightDir) <= 0.f)
+        continue;
+
+      if (m_instanceBvh.intersects(Ray(origin, lightDir), lightDistance - RayOffset))
+        continue;
+
+      const Vec3f halfVec = (viewDir + lightDir).normalize();
+      const Vec3f brdf    = evaluateBrdf(point, viewAngle, lightAngle, std::max(normal.dot(halfVec), 0.f), std::max(viewDir.dot(halfVec), 0.f));
+      radiance += throughput * brdf * lightRadiance * lightAngle;
+    }
+
+    if (bounceIndex >= m_maxBounceCount)
+      break;
+
+    const Vec3f nextDir    = sampleDirection(point, normal, viewDir, randGenerator);
+    const float lightAngle = normal.dot(nextDir);
+
+    if (lightAngle <= 0.f || geomNormal.dot(nextDir) <= 0.f)
+      break;
+
+    const Vec3f halfVec       = (viewDir + nextDir).normalize();
+    const float halfVecAngle  = std::max(normal.dot(halfVec), 0.f);
+    const float viewHalfAngle = std::max(viewDir.dot(halfVec), 0.f);
+    const float pdf           = computeSamplingPdf(point, lightAngle, halfVecAngle, viewHalfAngle);
+
+    if (pdf <= 0.f)
+      break;
+
+    throughput *= evaluateBrdf(point, viewAngle, lightAngle, halfVecAngle, viewHalfAngle) * (lightAngle / pdf);
+
+    if (bounceIndex >= RouletteBounceCount) {
+      const float survivalProbability = std::min(std::max(std::max(throughput[0], throughput[1]), throughput[2]), 0.95f);
+
+      if (randGenerator.generate() >= survivalProbability)
+        break;
+
+      throughput /= survivalProbability;
+    }
+
+    currentRay = Ray(origin, nextDir);
+  }
+
+  return radiance;
+}
+
+void PathTracer::renderTile(std::size_t tileIndex, unsigned int sampleCount) {
+  const std::size_t tileCountX = (m_width + TileSize - 1) / TileSize;
+  const unsigned int beginX    = static_cast<unsigned int>(tileIndex % tileCountX) * TileSize;
+  const unsigned int beginY    = static_cast<unsigned int>(tileIndex / tileCountX) * TileSize;
+  const unsigned int endX      = std::min(beginX + TileSize, m_width);
+  const unsigned int endY      = std::min(beginY + TileSize, m_height);
+
+  const float invWidth  = 1.f / static_cast<float>(m_width);
+  const float invHeight = 1.f / static_cast<float>(m_height);
+
+  for (unsigned int y = beginY; y < endY; ++y) {
+    for (unsigned int x = beginX; x < endX; ++x) {
+      const std::size_t pixelIndex = static_cast<std::size_t>(y) * m_width + x;
+
+      for (unsigned int sampleIndex = m_sampleCount; sampleIndex < m_sampleCount + sampleCount; ++sampleIndex) {
+        const std::uint32_t seed = hashPcg(static_cast<std::uint32_t>(pixelIndex) ^ hashPcg(sampleIndex));
+        RandomGenerator randGenerator(seed);
+
+        // Jittering the position within the pixel to antialias the image as samples accumulate
+        const Vec2f ndcPos({ 2.f * (static_cast<float>(x) + randGenerator.generate()) * invWidth - 1.f,
+                             2.f * (static_cast<float>(y) + randGenerator.generate()) * invHeight - 1.f });
+
+        m_accumulatedRadiance[pixelIndex] += traceRay(m_camera->computeRay(ndcPos), hashPcg(seed));
+      }
+    }
+  }
+}
+
+} // namespace Raz
@@ -2,7 +2,9 @@
 #include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/Light.hpp"
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Occluder.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
@@ -13,6 +15,7 @@ RenderSystem::RenderSystem(unsigned int windowWidth, unsigned int windowHeight,
 
   m_acceptedComponents.setBit(Component::getId<Mesh>());
   m_acceptedComponents.setBit(Component::getId<Light>());
+  m_acceptedComponents.setBit(Component::getId<Occluder>());
 }
 
 void RenderSystem::linkEntity(const EntityPtr& entity) {
@@ -35,7 +38,7 @@ void RenderSystem::update(float deltaTime) {
 
   if (camTransform.hasUpdated()) {
     const Mat4f& viewMat = camera.computeViewMatrix(camTransform.computeTranslationMatrix(true),
-                                                    camTransform.getRotation().inverse());
+                                                    camTransform.getRotation().inverse().computeMatrix());
     camera.computeInverseViewMatrix();
     viewProjMat = viewMat * camera.getProjectionMatrix();
 
@@ -46,15 +49,30 @@ void RenderSystem::update(float deltaTime) {
     viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
   }
 
+  if (m_isOcclusionCullingEnabled)
+    rasterizeOccluders(viewProjMat);
+
   for (auto& entity : m_entities) {
     if (entity->isEnabled()) {
       if (entity->hasComponent<Mesh>() && entity->hasComponent<Transform>()) {
-        const Mat4f modelMat = entity->getComponent<Transform>().computeTransformMatrix();
+        // Matrices are cached by the transform, & only recomputed if the entity has been moved since the last frame
+        const auto& transform = entity->getComponent<Transform>();
+        const Mat4f& modelMat = transform.getTransformMatrix();
+        const auto& mesh      = entity->getComponent<Mesh>();
+
+        if (m_isOcclusionCullingEnabled) {
+          // An entity's own box, if any, is preferred over its mesh's one, which always contains all of its vertices
+          const AABB worldBox = transform.computeTransformedBox(entity->hasComponent<AABB>() ? entity->getComponent<AABB>() : mesh.computeBoundingBox());
+
+          if (m_occlusionCuller.isOccluded(worldBox, viewProjMat))
+            continue;
+        }
 
         m_program.sendUniform("uniModelMatrix", modelMat);
+        m_program.sendUniform("uniNormalMatrix", transform.getNormalMatrix());
         m_program.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
 
-        entity->getComponent<Mesh>().draw(m_program);
+        mesh.draw(m_program);
       }
     }
   }
@@ -123,6 +141,19 @@ void RenderSystem::updateLights() const {
   m_program.sendUniform("uniLightCount", lightCount);
 }
 
+void RenderSystem::rasterizeOccluders(const Mat4f& viewProjMat) {
+  m_occlusionCuller.clear();
+
+  for (const auto& entity : m_entities) {
+    if (entity->isEnabled() && entity->hasComponent<Occluder>() && entity->hasComponent<Transform>()) {
+      const Mat4f& modelMat = entity->getComponent<Transform>().getTransformMatrix();
+      m_occlusionCuller.addOccluder(entity->getComponent<Occluder>(), modelMat * viewProjMat);
+    }
+  }
+
+  m_occlusionCuller.rasterize();
+}
+
 void RenderSystem::updateShaders() const {
   m_program.updateShaders();
   sendCameraMatrices();
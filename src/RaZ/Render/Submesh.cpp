@@ -1,7 +1,70 @@
 #include "RaZ/Render/Submesh.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Raz {
 
+const AABB& Submesh::getBoundingBox() const {
+  computeBounds();
+  return m_boundingBox;
+}
+
+const Sphere& Submesh::getBoundingSphere() const {
+  computeBounds();
+  return m_boundingSphere;
+}
+
+const ConvexHull& Submesh::getConvexHull() const {
+  if (m_convexHullOutdated)
+    computeConvexHull(m_convexHullMaxVertexCount, m_convexHullTolerance);
+
+  return m_convexHull;
+}
+
+void Submesh::computeBounds() const {
+  if (!m_boundsOutdated)
+    return;
+
+  const std::vector<Vertex>& vertices = getVertices();
+
+  if (vertices.empty()) {
+    m_boundingBox    = AABB(Vec3f(0.f), Vec3f(0.f));
+    m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
+    m_boundsOutdated = false;
+    return;
+  }
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (const Vertex& vertex : vertices) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minPos[axis] = std::min(minPos[axis], vertex.position[axis]);
+      maxPos[axis] = std::max(maxPos[axis], vertex.position[axis]);
+    }
+  }
+
+  // Centering the sphere on the box gives a tighter radius than half its diagonal, at the cost of a second pass over the vertices
+  const Vec3f center = (minPos + maxPos) * 0.5f;
+  float maxSqDist    = 0.f;
+
+  for (const Vertex& vertex : vertices)
+    maxSqDist = std::max(maxSqDist, (vertex.position - center).computeSquaredLength());
+
+  m_boundingBox    = AABB(maxPos, minPos);
+  m_boundingSphere = Sphere(center, std::sqrt(maxSqDist));
+  m_boundsOutdated = false;
+}
+
+void Submesh::computeConvexHull(std::size_t maxVertexCount, float tolerance) const {
+  m_convexHull.compute(getVertices(), maxVertexCount, tolerance);
+  m_convexHullMaxVertexCount = maxVertexCount;
+  m_convexHullTolerance      = tolerance;
+  m_convexHullOutdated       = false;
+}
+
 void Submesh::load() const {
   m_vao.bind();
 
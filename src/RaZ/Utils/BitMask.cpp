@@ -0,0 +1,44 @@
+#include "RaZ/Utils/BitMask.hpp"
+
+namespace Raz {
+
+void BitMask::reset(std::size_t bitCount) {
+  m_bitCount = bitCount;
+  m_words.assign((bitCount + WordBitCount - 1) / WordBitCount, 0);
+}
+
+void BitMask::setBit(std::size_t index, bool value) {
+  const std::uint64_t bit = std::uint64_t(1) << (index % WordBitCount);
+  std::uint64_t& word     = m_words[index / WordBitCount];
+
+  word = (value ? (word | bit) : (word & ~bit));
+}
+
+std::size_t BitMask::getEnabledBitCount() const {
+  std::size_t count = 0;
+
+  for (std::uint64_t word : m_words) {
+    // Clearing the lowest enabled bit until none is left
+    for (; word != 0; word &= word - 1)
+      ++count;
+  }
+
+  return count;
+}
+
+void BitMask::getEnabledIndices(std::vector<std::uint32_t>& indices) const {
+  indices.clear();
+
+  for (std::size_t wordIndex = 0; wordIndex < m_words.size(); ++wordIndex) {
+    for (std::uint64_t word = m_words[wordIndex]; word != 0; word &= word - 1) {
+      std::uint32_t bitIndex = 0;
+
+      while (((word >> bitIndex) & 1u) == 0)
+        ++bitIndex;
+
+      indices.push_back(static_cast<std::uint32_t>(wordIndex * WordBitCount) + bitIndex);
+    }
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,709 @@
+#include "RaZ/Physics/Gjk.hpp"
+#include "RaZ/Utils/ConvexHull.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+/// Computes the distance under which points are considered to be on a plane, relative to their extent to remain meaningful at any scale.
+template <typename T>
+T computeEpsilon(const std::vector<Vec3<T>>& points) {
+  Vec3<T> maxAbsCoords(0);
+
+  for (const Vec3<T>& point : points) {
+    for (std::size_t axis = 0; axis < 3; ++axis)
+      maxAbsCoords[axis] = std::max(maxAbsCoords[axis], std::abs(point[axis]));
+  }
+
+  return 3 * std::numeric_limits<T>::epsilon() * (maxAbsCoords[0] + maxAbsCoords[1] + maxAbsCoords[2]);
+}
+
+Vec3d toDouble(const Vec3f& vec) {
+  return Vec3d({ static_cast<double>(vec[0]), static_cast<double>(vec[1]), static_cast<double>(vec[2]) });
+}
+
+// Vector::dot() accumulates in a float & lengths are floats; these keep the double precision the hull's computations rely on
+
+double computeDot(const Vec3d& firstVec, const Vec3d& secondVec) {
+  return firstVec[0] * secondVec[0] + firstVec[1] * secondVec[1] + firstVec[2] * secondVec[2];
+}
+
+double computeLength(const Vec3d& vec) {
+  return std::sqrt(computeDot(vec, vec));
+}
+
+/// Normalizes a vector, which is returned unchanged if null.
+Vec3d computeNormalized(const Vec3d& vec) {
+  const double length = computeLength(vec);
+
+  if (length <= 0.0)
+    return vec;
+
+  return Vec3d({ vec[0] / length, vec[1] / length, vec[2] / length });
+}
+
+/// Incremental construction of a convex hull with the Quickhull algorithm.
+/// Each face keeps the points which are outside of the hull & above it; the furthest of all these points is repeatedly added to the hull,
+///  replacing all the faces it can see by new ones joining it to the horizon, which is the loop of edges bounding the visible faces.
+/// Computations are made in double precision: faces being never merged, nearly coplanar ones would otherwise create noticeable concavities.
+class QuickhullBuilder {
+public:
+  QuickhullBuilder(const std::vector<Vec3f>& points, float tolerance);
+
+  const std::vector<std::uint32_t>& getSimplex() const { return m_simplex; }
+  Vec3f getSimplexNormal() const { return Vec3f({ static_cast<float>(m_simplexNormal[0]), static_cast<float>(m_simplexNormal[1]), static_cast<float>(m_simplexNormal[2]) }); }
+
+  /// Finds 4 points forming a tetrahedron as large as possible, to start the hull from.
+  /// \return True if such a tetrahedron exists, false if the points are flat (only the first 3 simplex points being found), linear or all equal.
+  bool buildInitialHull();
+  /// Adds the furthest points outside of the hull until either none remains or the hull has reached the vertex limit.
+  /// \param maxVertexCount Maximum number of vertices of the hull; 0 if unlimited.
+  void expand(std::size_t maxVertexCount);
+  /// Recovers the hull's faces, the vertices being those of the input points which are actually used.
+  /// \param vertices Hull's vertices.
+  /// \param indices Indices of each face's vertices.
+  void extract(std::vector<Vec3f>& vertices, std::vector<unsigned int>& indices) const;
+
+private:
+  struct Face {
+    std::array<std::uint32_t, 3> vertices {};
+    /// Faces sharing each edge, the one of index i going from the vertex i to the next one.
+    std::array<std::uint32_t, 3> neighbors {};
+    Vec3d normal {};
+    double distance {};
+    std::vector<std::uint32_t> outsidePoints {};
+    std::uint32_t furthestPoint = InvalidIndex;
+    double furthestDistance {};
+    bool isVisible = false;
+  };
+
+  struct HorizonStep {
+    std::uint32_t face {};
+    /// Edge the face has been entered by, which is the first to be visited.
+    std::uint32_t entryEdge {};
+    std::uint32_t visitedEdgeCount {};
+  };
+
+  struct HorizonEdge {
+    std::uint32_t firstVertex {};
+    std::uint32_t secondVertex {};
+    /// Face beyond the horizon sharing the edge, which is not visible from the added point.
+    std::uint32_t neighbor {};
+  };
+
+  double computeDistance(const Face& face, const Vec3d& point) const { return computeDot(face.normal, point) - face.distance; }
+  std::uint32_t addFace(std::uint32_t firstVertex, std::uint32_t secondVertex, std::uint32_t thirdVertex);
+  std::uint32_t findEdge(const Face& face, std::uint32_t firstVertex, std::uint32_t secondVertex) const;
+  /// Assigns a point to the face it is the furthest above among the given ones, if above any of them by more than the tolerance.
+  /// \return True if the point has been assigned to a face, false otherwise.
+  bool assignPoint(std::uint32_t pointIndex, std::uint32_t firstFace, std::uint32_t faceCount);
+  void computeHorizon(std::uint32_t eyePoint, std::uint32_t firstFace);
+  void addPoint(std::uint32_t faceIndex);
+
+  const std::vector<Vec3f>& m_inputPoints;
+  std::vector<Vec3d> m_points {};
+  double m_epsilon {};
+  double m_tolerance {};
+
+  std::vector<std::uint32_t> m_simplex {};
+  Vec3d m_simplexNormal {};
+
+  std::vector<Face> m_faces {};
+  /// Faces having outside points, sorted by their furthest one's distance. Faces replaced since their insertion are simply skipped.
+  std::priority_queue<std::pair<double, std::uint32_t>> m_pendingFaces {};
+  std::vector<std::uint32_t> m_visibleFaces {};
+  std::vector<HorizonEdge> m_horizon {};
+  std::vector<HorizonStep> m_horizonStack {};
+};
+
+QuickhullBuilder::QuickhullBuilder(const std::vector<Vec3f>& points, float tolerance) : m_inputPoints{ points } {
+  m_points.reserve(points.size());
+
+  for (const Vec3f& point : points)
+    m_points.emplace_back(toDouble(point));
+
+  m_epsilon   = computeEpsilon(m_points);
+  m_tolerance = std::max(static_cast<double>(tolerance), m_epsilon);
+}
+
+bool QuickhullBuilder::buildInitialHull() {
+  // The two furthest extreme points along any axis form the first edge
+  std::array<std::uint32_t, 3> minIndices {};
+  std::array<std::uint32_t, 3> maxIndices {};
+
+  for (std::uint32_t pointIndex = 1; pointIndex < m_points.size(); ++pointIndex) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if (m_points[pointIndex][axis] < m_points[minIndices[axis]][axis])
+        minIndices[axis] = pointIndex;
+
+      if (m_points[pointIndex][axis] > m_points[maxIndices[axis]][axis])
+        maxIndices[axis] = pointIndex;
+    }
+  }
+
+  std::size_t bestAxis = 0;
+
+  for (std::size_t axis = 1; axis < 3; ++axis) {
+    if (m_points[maxIndices[axis]][axis] - m_points[minIndices[axis]][axis] > m_points[maxIndices[bestAxis]][bestAxis] - m_points[minIndices[bestAxis]][bestAxis])
+      bestAxis = axis;
+  }
+
+  const std::uint32_t firstIndex  = minIndices[bestAxis];
+  const std::uint32_t secondIndex = maxIndices[bestAxis];
+  m_simplex = { firstIndex };
+
+  const Vec3d& firstPoint = m_points[firstIndex];
+  const Vec3d edgeDir     = m_points[secondIndex] - firstPoint;
+  const double edgeLength = computeLength(edgeDir);
+
+  if (edgeLength <= m_epsilon)
+    return false;
+
+  m_simplex.push_back(secondIndex);
+
+  // The third point is the furthest from the edge
+  std::uint32_t thirdIndex = InvalidIndex;
+  double maxEdgeDist       = 0.0;
+
+  for (std::uint32_t pointIndex = 0; pointIndex < m_points.size(); ++pointIndex) {
+    const double edgeDist = computeLength(edgeDir.cross(m_points[pointIndex] - firstPoint)) / edgeLength;
+
+    if (edgeDist > maxEdgeDist) {
+      maxEdgeDist = edgeDist;
+      thirdIndex  = pointIndex;
+    }
+  }
+
+  if (maxEdgeDist <= m_epsilon)
+    return false;
+
+  m_simplex.push_back(thirdIndex);
+  m_simplexNormal = computeNormalized(edgeDir.cross(m_points[thirdIndex] - firstPoint));
+
+  // The fourth point is the furthest from the plane of the three others
+  std::uint32_t fourthIndex = InvalidIndex;
+  double maxPlaneDist      = 0.0;
+
+  for (std::uint32_t pointIndex = 0; pointIndex < m_points.size(); ++pointIndex) {
+    const double planeDist = std::abs(computeDot(m_simplexNormal, m_points[pointIndex] - firstPoint));
+
+    if (planeDist > maxPlaneDist) {
+      maxPlaneDist = planeDist;
+      fourthIndex  = pointIndex;
+    }
+  }
+
+  if (maxPlaneDist <= m_epsilon)
+    return false;
+
+  m_simplex.push_back(fourthIndex);
+
+  // The base's normal must point away from the fourth point
+  std::array<std::uint32_t, 3> base = { firstIndex, secondIndex, thirdIndex };
+
+  if (computeDot(m_simplexNormal, m_points[fourthIndex] - firstPoint) > 0.0)
+    std::swap(base[1], base[2]);
+
+  addFace(base[0], base[1], base[2]);
+  addFace(base[1], base[0], fourthIndex);
+  addFace(base[2], base[1], fourthIndex);
+  addFace(base[0], base[2], fourthIndex);
+
+  for (Face& face : m_faces) {
+    for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      const std::uint32_t edgeBegin = face.vertices[edgeIndex];
+      const std::uint32_t edgeEnd   = face.vertices[(edgeIndex + 1) % 3];
+
+      for (std::uint32_t neighborIndex = 0; neighborIndex < m_faces.size(); ++neighborIndex) {
+        if (findEdge(m_faces[neighborIndex], edgeEnd, edgeBegin) != InvalidIndex) {
+          face.neighbors[edgeIndex] = neighborIndex;
+          break;
+        }
+      }
+    }
+  }
+
+  for (std::uint32_t pointIndex = 0; pointIndex < m_points.size(); ++pointIndex) {
+    if (std::find(m_simplex.cbegin(), m_simplex.cend(), pointIndex) == m_simplex.cend())
+      assignPoint(pointIndex, 0, 4);
+  }
+
+  for (std::uint32_t faceIndex = 0; faceIndex < 4; ++faceIndex) {
+    if (m_faces[faceIndex].furthestPoint != InvalidIndex)
+      m_pendingFaces.emplace(m_faces[faceIndex].furthestDistance, faceIndex);
+  }
+
+  return true;
+}
+
+void QuickhullBuilder::expand(std::size_t maxVertexCount) {
+  std::size_t vertexCount = 4;
+
+  while (!m_pendingFaces.empty() && (maxVertexCount == 0 || vertexCount < maxVertexCount)) {
+    const std::uint32_t faceIndex = m_pendingFaces.top().second;
+    m_pendingFaces.pop();
+
+    // A face which has been replaced has given its points to the new ones
+    if (m_faces[faceIndex].isVisible)
+      continue;
+
+    addPoint(faceIndex);
+    ++vertexCount;
+  }
+}
+
+void QuickhullBuilder::extract(std::vector<Vec3f>& vertices, std::vector<unsigned int>& indices) const {
+  vertices.clear();
+  indices.clear();
+
+  std::vector<std::uint32_t> vertexIndices(m_points.size(), InvalidIndex);
+
+  for (const Face& face : m_faces) {
+    if (face.isVisible)
+      continue;
+
+    for (std::uint32_t pointIndex : face.vertices) {
+      if (vertexIndices[pointIndex] == InvalidIndex) {
+        vertexIndices[pointIndex] = static_cast<std::uint32_t>(vertices.size());
+        vertices.emplace_back(m_inputPoints[pointIndex]);
+      }
+
+      indices.emplace_back(vertexIndices[pointIndex]);
+    }
+  }
+}
+
+std::uint32_t QuickhullBuilder::addFace(std::uint32_t firstVertex, std::uint32_t secondVertex, std::uint32_t thirdVertex) {
+  Face face;
+  face.vertices = { firstVertex, secondVertex, thirdVertex };
+
+  const Vec3d& firstPos = m_points[firstVertex];
+  const Vec3d normal    = (m_points[secondVertex] - firstPos).cross(m_points[thirdVertex] - firstPos);
+
+  // A degenerate face keeps a null normal, no point ever being considered above it
+  if (computeDot(normal, normal) > 0.0) {
+    face.normal   = computeNormalized(normal);
+    face.distance = computeDot(face.normal, firstPos);
+  }
+
+  m_faces.emplace_back(std::move(face));
+  return static_cast<std::uint32_t>(m_faces.size() - 1);
+}
+
+std::uint32_t QuickhullBuilder::findEdge(const Face& face, std::uint32_t firstVertex, std::uint32_t secondVertex) const {
+  for (std::uint32_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+    if (face.vertices[edgeIndex] == firstVertex && face.vertices[(edgeIndex + 1) % 3] == secondVertex)
+      return edgeIndex;
+  }
+
+  return InvalidIndex;
+}
+
+bool QuickhullBuilder::assignPoint(std::uint32_t pointIndex, std::uint32_t firstFace, std::uint32_t faceCount) {
+  const Vec3d& point = m_points[pointIndex];
+
+  std::uint32_t bestFace = InvalidIndex;
+  double maxDistance     = m_tolerance;
+
+  for (std::uint32_t faceIndex = firstFace; faceIndex < firstFace + faceCount; ++faceIndex) {
+    const double distance = computeDistance(m_faces[faceIndex], point);
+
+    if (distance > maxDistance) {
+      maxDistance = distance;
+      bestFace    = faceIndex;
+    }
+  }
+
+  if (bestFace == InvalidIndex)
+    return false;
+
+  Face& face = m_faces[bestFace];
+  face.outsidePoints.emplace_back(pointIndex);
+
+  if (face.furthestPoint == InvalidIndex || maxDistance > face.furthestDistance) {
+    face.furthestPoint    = pointIndex;
+    face.furthestDistance = maxDistance;
+  }
+
+  return true;
+}
+
+void QuickhullBuilder::computeHorizon(std::uint32_t eyePoint, std::uint32_t firstFace) {
+  m_visibleFaces.clear();
+  m_horizon.clear();
+  m_horizonStack.clear();
+
+  // Depth-first traversal of the visible faces, each crossing its edges in order starting from the one it has been entered by,
+  //  so that the horizon edges are found consecutively around the loop
+  m_faces[firstFace].isVisible = true;
+  m_visibleFaces.push_back(firstFace);
+  m_horizonStack.push_back(HorizonStep{ firstFace, 0, 0 });
+
+  while (!m_horizonStack.empty()) {
+    HorizonStep& step = m_horizonStack.back();
+
+    if (step.visitedEdgeCount == 3) {
+      m_horizonStack.pop_back();
+      continue;
+    }
+
+    const Face& face                  = m_faces[step.face];
+    const std::uint32_t edgeIndex     = (step.entryEdge + step.visitedEdgeCount) % 3;
+    const std::uint32_t edgeBegin     = face.vertices[edgeIndex];
+    const std::uint32_t edgeEnd       = face.vertices[(edgeIndex + 1) % 3];
+    const std::uint32_t neighborIndex = face.neighbors[edgeIndex];
+    Face& neighbor                    = m_faces[neighborIndex];
+
+    ++step.visitedEdgeCount;
+
+    if (neighbor.isVisible)
+      continue;
+
+    if (computeDistance(neighbor, m_points[eyePoint]) > m_epsilon) {
+      neighbor.isVisible = true;
+      m_visibleFaces.push_back(neighborIndex);
+      m_horizonStack.push_back(HorizonStep{ neighborIndex, findEdge(neighbor, edgeEnd, edgeBegin), 0 });
+    } else {
+      m_horizon.push_back(HorizonEdge{ edgeBegin, edgeEnd, neighborIndex });
+    }
+  }
+}
+
+void QuickhullBuilder::addPoint(std::uint32_t faceIndex) {
+  const std::uint32_t eyePoint = m_faces[faceIndex].furthestPoint;
+  computeHorizon(eyePoint, faceIndex);
+
+  // Each horizon edge is joined to the new point, the new faces being linked to the faces beyond the horizon & to each other
+  const auto firstNewFace = static_cast<std::uint32_t>(m_faces.size());
+  const auto horizonSize  = static_cast<std::uint32_t>(m_horizon.size());
+
+  for (std::uint32_t edgeIndex = 0; edgeIndex < horizonSize; ++edgeIndex) {
+    const HorizonEdge& edge = m_horizon[edgeIndex];
+    assert("Error: The convex hull's horizon must be a closed loop." && edge.secondVertex == m_horizon[(edgeIndex + 1) % horizonSize].firstVertex);
+
+    const std::uint32_t newFaceIndex = addFace(edge.firstVertex, edge.secondVertex, eyePoint);
+
+    Face& newFace = m_faces[newFaceIndex];
+    newFace.neighbors = { edge.neighbor, firstNewFace + (edgeIndex + 1) % horizonSize, firstNewFace + (edgeIndex + horizonSize - 1) % horizonSize };
+
+    Face& neighbor = m_faces[edge.neighbor];
+    neighbor.neighbors[findEdge(neighbor, edge.secondVertex, edge.firstVertex)] = newFaceIndex;
+  }
+
+  // Points which were outside of the replaced faces are, if not inside the hull, outside of the new ones. Due to the tolerance on the faces'
+  //  visibility, they may however only be outside of a face beyond the horizon, which the added point was almost in the plane of
+  for (std::uint32_t visibleFaceIndex : m_visibleFaces) {
+    std::vector<std::uint32_t> outsidePoints = std::move(m_faces[visibleFaceIndex].outsidePoints);
+
+    for (std::uint32_t pointIndex : outsidePoints) {
+      if (pointIndex == eyePoint || assignPoint(pointIndex, firstNewFace, horizonSize))
+        continue;
+
+      for (const HorizonEdge& edge : m_horizon) {
+        if (assignPoint(pointIndex, edge.neighbor, 1)) {
+          m_pendingFaces.emplace(m_faces[edge.neighbor].furthestDistance, edge.neighbor);
+          break;
+        }
+      }
+    }
+  }
+
+  for (std::uint32_t newFaceIndex = firstNewFace; newFaceIndex < firstNewFace + horizonSize; ++newFaceIndex) {
+    if (m_faces[newFaceIndex].furthestPoint != InvalidIndex)
+      m_pendingFaces.emplace(m_faces[newFaceIndex].furthestDistance, newFaceIndex);
+  }
+}
+
+} // namespace
+
+void ConvexHull::compute(const std::vector<Vec3f>& points, std::size_t maxVertexCount, float tolerance) {
+  m_vertices.clear();
+  m_indices.clear();
+  m_isFlat = false;
+
+  if (points.empty()) {
+    computeFacePlanes();
+    return;
+  }
+
+  QuickhullBuilder builder(points, tolerance);
+
+  if (builder.buildInitialHull()) {
+    builder.expand(maxVertexCount == 0 ? 0 : std::max(maxVertexCount, static_cast<std::size_t>(4)));
+    builder.extract(m_vertices, m_indices);
+  } else if (builder.getSimplex().size() == 3) {
+    computeFlat(points, builder.getSimplexNormal());
+  } else {
+    for (std::uint32_t pointIndex : builder.getSimplex())
+      m_vertices.emplace_back(points[pointIndex]);
+  }
+
+  computeFacePlanes();
+}
+
+void ConvexHull::compute(const std::vector<Vertex>& vertices, std::size_t maxVertexCount, float tolerance) {
+  std::vector<Vec3f> points;
+  points.reserve(vertices.size());
+
+  for (const Vertex& vertex : vertices)
+    points.emplace_back(vertex.position);
+
+  compute(points, maxVertexCount, tolerance);
+}
+
+bool ConvexHull::contains(const Vec3f& point) const {
+  if (m_vertices.empty())
+    return false;
+
+  if (m_isFlat || m_facePlanes.empty())
+    return ((computeProjection(point) - point).computeSquaredLength() <= m_epsilon * m_epsilon);
+
+  return std::all_of(m_facePlanes.cbegin(), m_facePlanes.cend(), [this, &point] (const Plane& plane) {
+    return (plane.getNormal().dot(point) - plane.getDistance() <= m_epsilon);
+  });
+}
+
+bool ConvexHull::intersects(const Line& line) const {
+  return Gjk::intersects(*this, line);
+}
+
+bool ConvexHull::intersects(const Plane& plane) const {
+  if (m_vertices.empty())
+    return false;
+
+  const Vec3f& normal = plane.getNormal();
+
+  const float frontDist = normal.dot(computeSupportPoint(normal)) - plane.getDistance();
+  const float backDist  = normal.dot(computeSupportPoint(-normal)) - plane.getDistance();
+
+  return (backDist <= 0.f && frontDist >= 0.f);
+}
+
+bool ConvexHull::intersects(const Sphere& sphere) const {
+  return Gjk::intersects(*this, sphere);
+}
+
+bool ConvexHull::intersects(const Triangle& triangle) const {
+  return Gjk::intersects(*this, triangle);
+}
+
+bool ConvexHull::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
+}
+
+bool ConvexHull::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
+}
+
+bool ConvexHull::intersects(const ConvexHull& hull) const {
+  return Gjk::intersects(*this, hull);
+}
+
+Vec3f ConvexHull::computeProjection(const Vec3f& point) const {
+  if (m_vertices.empty())
+    return point;
+
+  if (m_vertices.size() == 1)
+    return m_vertices.front();
+
+  if (m_indices.empty())
+    return Line(m_vertices[0], m_vertices[1]).computeProjection(point);
+
+  if (!m_isFlat && contains(point))
+    return point;
+
+  Vec3f closestPoint  = m_vertices.front();
+  float minSqDistance = std::numeric_limits<float>::max();
+
+  for (std::size_t index = 0; index + 2 < m_indices.size(); index += 3) {
+    const Vec3f projPoint  = Triangle(m_vertices[m_indices[index]], m_vertices[m_indices[index + 1]], m_vertices[m_indices[index + 2]]).computeProjection(point);
+    const float sqDistance = (projPoint - point).computeSquaredLength();
+
+    if (sqDistance < minSqDistance) {
+      minSqDistance = sqDistance;
+      closestPoint  = projPoint;
+    }
+  }
+
+  return closestPoint;
+}
+
+Vec3f ConvexHull::computeSupportPoint(const Vec3f& direction) const {
+  if (m_vertices.empty())
+    return Vec3f(0.f);
+
+  const Vec3f* supportPoint = &m_vertices.front();
+  float maxDot = direction.dot(*supportPoint);
+
+  for (std::size_t vertIndex = 1; vertIndex < m_vertices.size(); ++vertIndex) {
+    const float dot = direction.dot(m_vertices[vertIndex]);
+
+    if (dot > maxDot) {
+      maxDot       = dot;
+      supportPoint = &m_vertices[vertIndex];
+    }
+  }
+
+  return *supportPoint;
+}
+
+Vec3f ConvexHull::computeCentroid() const {
+  if (m_vertices.empty())
+    return Vec3f(0.f);
+
+  Vec3f vertexAverage(0.f);
+
+  for (const Vec3f& vertex : m_vertices)
+    vertexAverage += vertex;
+
+  vertexAverage /= static_cast<float>(m_vertices.size());
+
+  if (m_indices.empty())
+    return vertexAverage;
+
+  // The hull is split into tetrahedra joining each face to a point inside it (or triangles for a flat hull), whose centroids are
+  //  averaged weighted by their volume (or area)
+  Vec3f weightedCentroids(0.f);
+  float totalWeight = 0.f;
+
+  for (std::size_t index = 0; index + 2 < m_indices.size(); index += 3) {
+    const Vec3f& firstPos  = m_vertices[m_indices[index]];
+    const Vec3f& secondPos = m_vertices[m_indices[index + 1]];
+    const Vec3f& thirdPos  = m_vertices[m_indices[index + 2]];
+
+    if (m_isFlat) {
+      const float area = (secondPos - firstPos).cross(thirdPos - firstPos).computeLength();
+      weightedCentroids += (firstPos + secondPos + thirdPos) * (area / 3.f);
+      totalWeight += area;
+    } else {
+      const float volume = (firstPos - vertexAverage).dot((secondPos - vertexAverage).cross(thirdPos - vertexAverage));
+      weightedCentroids += (firstPos + secondPos + thirdPos + vertexAverage) * (volume / 4.f);
+      totalWeight += volume;
+    }
+  }
+
+  return (totalWeight > 0.f ? weightedCentroids / totalWeight : vertexAverage);
+}
+
+AABB ConvexHull::computeBoundingBox() const {
+  if (m_vertices.empty())
+    return AABB(Vec3f(0.f), Vec3f(0.f));
+
+  Vec3f minPos = m_vertices.front();
+  Vec3f maxPos = m_vertices.front();
+
+  for (const Vec3f& vertex : m_vertices) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minPos[axis] = std::min(minPos[axis], vertex[axis]);
+      maxPos[axis] = std::max(maxPos[axis], vertex[axis]);
+    }
+  }
+
+  return AABB(maxPos, minPos);
+}
+
+ConvexHull ConvexHull::computeTransformed(const Mat4f& transform) const {
+  ConvexHull transformedHull = *this;
+
+  for (Vec3f& vertex : transformedHull.m_vertices)
+    vertex = Vec3f(Vec4f(vertex, 1.f) * transform);
+
+  transformedHull.computeFacePlanes();
+  return transformedHull;
+}
+
+void ConvexHull::computeFlat(const std::vector<Vec3f>& points, const Vec3f& normal) {
+  m_isFlat = true;
+
+  // The points are projected onto two axes orthogonal to the normal, on which a 2D hull is computed with Andrew's monotone chain algorithm
+  const Vec3f refAxis    = (std::abs(normal[0]) < 0.9f ? Axis::X : Axis::Y);
+  const Vec3f firstAxis  = normal.cross(refAxis).normalize();
+  const Vec3f secondAxis = normal.cross(firstAxis);
+
+  std::vector<std::pair<Vec2f, std::uint32_t>> projPoints;
+  projPoints.reserve(points.size());
+
+  for (std::uint32_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+    projPoints.emplace_back(Vec2f({ firstAxis.dot(points[pointIndex]), secondAxis.dot(points[pointIndex]) }), pointIndex);
+
+  std::sort(projPoints.begin(), projPoints.end(), [] (const auto& firstPoint, const auto& secondPoint) {
+    return (firstPoint.first[0] < secondPoint.first[0] || (firstPoint.first[0] == secondPoint.first[0] && firstPoint.first[1] < secondPoint.first[1]));
+  });
+
+  const auto computeTurn = [] (const Vec2f& origin, const Vec2f& firstPoint, const Vec2f& secondPoint) {
+    return (firstPoint[0] - origin[0]) * (secondPoint[1] - origin[1]) - (firstPoint[1] - origin[1]) * (secondPoint[0] - origin[0]);
+  };
+
+  // The lower chain is built from left to right, then the upper one from right to left; only strict left turns are kept
+  std::vector<std::pair<Vec2f, std::uint32_t>> chain;
+  chain.reserve(projPoints.size() * 2);
+
+  for (std::size_t pass = 0; pass < 2; ++pass) {
+    const std::size_t chainStart = chain.size();
+
+    for (std::size_t pointIndex = 0; pointIndex < projPoints.size(); ++pointIndex) {
+      const auto& projPoint = projPoints[pass == 0 ? pointIndex : projPoints.size() - 1 - pointIndex];
+
+      while (chain.size() >= chainStart + 2 && computeTurn(chain[chain.size() - 2].first, chain.back().first, projPoint.first) <= 0.f)
+        chain.pop_back();
+
+      chain.push_back(projPoint);
+    }
+
+    // The last point of each chain is the first of the other
+    chain.pop_back();
+  }
+
+  for (const auto& chainPoint : chain)
+    m_vertices.emplace_back(points[chainPoint.second]);
+
+  for (unsigned int vertIndex = 1; vertIndex + 1 < m_vertices.size(); ++vertIndex)
+    m_indices.insert(m_indices.end(), { 0, vertIndex, vertIndex + 1 });
+}
+
+void ConvexHull::computeFacePlanes() {
+  m_facePlanes.clear();
+  m_epsilon = computeEpsilon(m_vertices);
+
+  if (m_indices.empty())
+    return;
+
+  Vec3f vertexAverage(0.f);
+
+  for (const Vec3f& vertex : m_vertices)
+    vertexAverage += vertex;
+
+  vertexAverage /= static_cast<float>(m_vertices.size());
+
+  m_facePlanes.reserve(m_indices.size() / 3);
+
+  for (std::size_t index = 0; index + 2 < m_indices.size(); index += 3) {
+    // Normals are computed in double precision, those of thin faces being otherwise too imprecise for their planes to be used far from them
+    const Vec3d firstPos = toDouble(m_vertices[m_indices[index]]);
+    const Vec3d firstEdge  = toDouble(m_vertices[m_indices[index + 1]]) - firstPos;
+    const Vec3d secondEdge = toDouble(m_vertices[m_indices[index + 2]]) - firstPos;
+    Vec3d normal = computeNormalized(firstEdge.cross(secondEdge));
+
+    // A transformation mirroring the hull reverses its faces' winding; they are flipped back so that their normals point outwards
+    if (!m_isFlat && computeDot(normal, toDouble(vertexAverage) - firstPos) > 0.0) {
+      std::swap(m_indices[index + 1], m_indices[index + 2]);
+      normal = -normal;
+    }
+
+    m_facePlanes.emplace_back(static_cast<float>(computeDot(normal, firstPos)),
+                              Vec3f({ static_cast<float>(normal[0]), static_cast<float>(normal[1]), static_cast<float>(normal[2]) }));
+  }
+}
+
+} // namespace Raz
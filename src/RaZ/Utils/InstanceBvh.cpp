@@ -0,0 +1,254 @@
+#include "RaZ/Utils/InstanceBvh.hpp"
+#include "RaZ/Utils/BvhUtils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::uint32_t MaxLeafInstances  = 2;
+constexpr std::size_t MaxTraversalDepth = 64;
+
+/// Brings a ray into an instance's local space. The direction is not normalized, so that hit distances remain the world ones.
+inline Ray computeLocalRay(const Ray& ray, const InstanceBvh::Instance& instance) {
+  return Ray(BvhUtils::transformPoint(ray.getOrigin(), instance.invTransform),
+             BvhUtils::transformDirection(ray.getDirection(), instance.invTransform));
+}
+
+} // namespace
+
+std::size_t InstanceBvh::addInstance(const TriangleBvh& bvh, const Mat4f& transform) {
+  Instance instance;
+  instance.bvh = &bvh;
+
+  m_instances.emplace_back(instance);
+  setInstanceTransform(m_instances.size() - 1, transform);
+
+  return m_instances.size() - 1;
+}
+
+void InstanceBvh::setInstanceTransform(std::size_t instanceIndex, const Mat4f& transform) {
+  assert("Error: Instance index is out of bounds." && instanceIndex < m_instances.size());
+
+  Instance& instance = m_instances[instanceIndex];
+  instance.transform    = transform;
+  instance.invTransform = transform.inverse();
+
+  if (instance.bvh->isEmpty())
+    return;
+
+  // Transforming the local box into a world one, with Arvo's method: each matrix element extends the box on the column's axis
+  const TriangleBvh::Node& localRoot = instance.bvh->getNodes().front();
+
+  for (std::size_t column = 0; column < 3; ++column) {
+    float minBound = transform[12 + column];
+    float maxBound = minBound;
+
+    for (std::size_t row = 0; row < 3; ++row) {
+      const float firstVal  = transform[row * 4 + column] * localRoot.minBounds[row];
+      const float secondVal = transform[row * 4 + column] * localRoot.maxBounds[row];
+
+      minBound += std::min(firstVal, secondVal);
+      maxBound += std::max(firstVal, secondVal);
+    }
+
+    instance.minBounds[column] = minBound;
+    instance.maxBounds[column] = maxBound;
+  }
+}
+
+void InstanceBvh::clear() {
+  m_instances.clear();
+  m_instanceIndices.clear();
+  m_nodes.clear();
+}
+
+void InstanceBvh::build() {
+  m_instanceIndices.clear();
+  m_nodes.clear();
+
+  // Instances without any triangle can never be hit, & are thus left out
+  for (std::size_t instanceIndex = 0; instanceIndex < m_instances.size(); ++instanceIndex) {
+    if (!m_instances[instanceIndex].bvh->isEmpty())
+      m_instanceIndices.emplace_back(static_cast<std::uint32_t>(instanceIndex));
+  }
+
+  if (m_instanceIndices.empty())
+    return;
+
+  m_nodes.reserve(m_instanceIndices.size() * 2);
+  buildNode(0, static_cast<std::uint32_t>(m_instanceIndices.size()));
+}
+
+bool InstanceBvh::intersects(const Ray& ray, float maxDistance) const {
+  if (m_nodes.empty())
+    return false;
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const std::uint32_t nodeIndex = stack[--stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (BvhUtils::computeEntryDistance(node, ray.getOrigin(), ray.getInverseDirection(), maxDistance) == std::numeric_limits<float>::max())
+      continue;
+
+    if (node.isLeaf()) {
+      for (std::uint32_t refIndex = node.offset; refIndex < node.offset + node.instanceCount; ++refIndex) {
+        const Instance& instance = m_instances[m_instanceIndices[refIndex]];
+
+        if (instance.bvh->intersects(computeLocalRay(ray, instance), maxDistance))
+          return true;
+      }
+
+      continue;
+    }
+
+    stack[stackSize++] = node.offset;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+
+  return false;
+}
+
+bool InstanceBvh::intersect(const Ray& ray, RayHit& hit, std::size_t& instanceIndex, float maxDistance) const {
+  if (m_nodes.empty())
+    return false;
+
+  float closestDistance = maxDistance;
+  std::size_t closestInstanceIndex = m_instances.size();
+  RayHit closestHit;
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::array<float, MaxTraversalDepth> stackDistances {};
+  std::size_t stackSize = 0;
+
+  const float rootDistance = BvhUtils::computeEntryDistance(m_nodes.front(), ray.getOrigin(), ray.getInverseDirection(), closestDistance);
+
+  if (rootDistance == std::numeric_limits<float>::max())
+    return false;
+
+  stack[0]          = 0;
+  stackDistances[0] = rootDistance;
+  ++stackSize;
+
+  while (stackSize > 0) {
+    --stackSize;
+
+    if (stackDistances[stackSize] >= closestDistance)
+      continue;
+
+    const std::uint32_t nodeIndex = stack[stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (std::uint32_t refIndex = node.offset; refIndex < node.offset + node.instanceCount; ++refIndex) {
+        const std::uint32_t instIndex = m_instanceIndices[refIndex];
+
+        // The local hit distance being the world one, the closest distance can directly be given to the instance's hierarchy
+        if (m_instances[instIndex].bvh->intersect(computeLocalRay(ray, m_instances[instIndex]), closestHit, closestDistance)) {
+          closestDistance      = closestHit.distance;
+          closestInstanceIndex = instIndex;
+        }
+      }
+
+      continue;
+    }
+
+    std::uint32_t nearIndex = nodeIndex + 1;
+    std::uint32_t farIndex  = node.offset;
+    float nearDistance = BvhUtils::computeEntryDistance(m_nodes[nearIndex], ray.getOrigin(), ray.getInverseDirection(), closestDistance);
+    float farDistance  = BvhUtils::computeEntryDistance(m_nodes[farIndex], ray.getOrigin(), ray.getInverseDirection(), closestDistance);
+
+    if (farDistance < nearDistance) {
+      std::swap(nearIndex, farIndex);
+      std::swap(nearDistance, farDistance);
+    }
+
+    if (farDistance != std::numeric_limits<float>::max()) {
+      stack[stackSize]          = farIndex;
+      stackDistances[stackSize] = farDistance;
+      ++stackSize;
+    }
+
+    if (nearDistance != std::numeric_limits<float>::max()) {
+      stack[stackSize]          = nearIndex;
+      stackDistances[stackSize] = nearDistance;
+      ++stackSize;
+    }
+  }
+
+  if (closestInstanceIndex == m_instances.size())
+    return false;
+
+  // Normals are transformed by the inverse transpose matrix; multiplying on the left by the inverse is equivalent
+  const Mat4f& invTransform = m_instances[closestInstanceIndex].invTransform;
+  const Vec3f& localNormal  = closestHit.normal;
+  const Vec3f worldNormal({ invTransform[0] * localNormal[0] + invTransform[1] * localNormal[1] + invTransform[2] * localNormal[2],
+                            invTransform[4] * localNormal[0] + invTransform[5] * localNormal[1] + invTransform[6] * localNormal[2],
+                            invTransform[8] * localNormal[0] + invTransform[9] * localNormal[1] + invTransform[10] * localNormal[2] });
+
+  hit          = closestHit;
+  hit.position = ray.getOrigin() + ray.getDirection() * closestDistance;
+  hit.normal   = worldNormal.normalize();
+
+  instanceIndex = closestInstanceIndex;
+
+  return true;
+}
+
+std::uint32_t InstanceBvh::buildNode(std::uint32_t beginIndex, std::uint32_t endIndex) {
+  const auto nodeIndex = static_cast<std::uint32_t>(m_nodes.size());
+  m_nodes.emplace_back();
+
+  Vec3f minBounds(std::numeric_limits<float>::max());
+  Vec3f maxBounds(std::numeric_limits<float>::lowest());
+  Vec3f minCentroid(std::numeric_limits<float>::max());
+  Vec3f maxCentroid(std::numeric_limits<float>::lowest());
+
+  for (std::uint32_t refIndex = beginIndex; refIndex < endIndex; ++refIndex) {
+    const Instance& instance = m_instances[m_instanceIndices[refIndex]];
+    const Vec3f centroid     = (instance.minBounds + instance.maxBounds) * 0.5f;
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minBounds[axis]   = std::min(minBounds[axis], instance.minBounds[axis]);
+      maxBounds[axis]   = std::max(maxBounds[axis], instance.maxBounds[axis]);
+      minCentroid[axis] = std::min(minCentroid[axis], centroid[axis]);
+      maxCentroid[axis] = std::max(maxCentroid[axis], centroid[axis]);
+    }
+  }
+
+  m_nodes[nodeIndex].minBounds = minBounds;
+  m_nodes[nodeIndex].maxBounds = maxBounds;
+
+  if (endIndex - beginIndex <= MaxLeafInstances) {
+    m_nodes[nodeIndex].offset        = beginIndex;
+    m_nodes[nodeIndex].instanceCount = endIndex - beginIndex;
+    return nodeIndex;
+  }
+
+  // Instances being few compared to triangles, a median split along the axis on which they are the most spread is good enough
+  const Vec3f centroidExtent = maxCentroid - minCentroid;
+  std::size_t axis = (centroidExtent[0] > centroidExtent[1] ? 0 : 1);
+  axis = (centroidExtent[2] > centroidExtent[axis] ? 2 : axis);
+
+  const std::uint32_t middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+  std::nth_element(m_instanceIndices.begin() + beginIndex, m_instanceIndices.begin() + middleIndex, m_instanceIndices.begin() + endIndex,
+                   [this, axis] (std::uint32_t firstIndex, std::uint32_t secondIndex) {
+    const Instance& firstInstance  = m_instances[firstIndex];
+    const Instance& secondInstance = m_instances[secondIndex];
+    return (firstInstance.minBounds[axis] + firstInstance.maxBounds[axis] < secondInstance.minBounds[axis] + secondInstance.maxBounds[axis]);
+  });
+
+  buildNode(beginIndex, middleIndex);
+  m_nodes[nodeIndex].offset = buildNode(middleIndex, endIndex);
+
+  return nodeIndex;
+}
+
+} // namespace Raz
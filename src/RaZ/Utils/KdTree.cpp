@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <array>
+
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Render/Submesh.hpp"
+#include "RaZ/Utils/KdTree.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t MaxLeafPoints     = 16;
+constexpr std::size_t MinParallelPoints = 16384;
+
+// Points being split in halves, the depth can't exceed 32 with 32-bit indices; each level stacks at most one more node
+constexpr std::size_t MaxTraversalDepth = 64;
+
+struct BuildPoint {
+  Vec3f position {};
+  std::uint32_t index {};
+};
+
+/// Computes the range of points of a node, from its index among those of its level.
+inline void computeNodeRange(std::size_t level, std::size_t levelIndex, std::size_t& beginIndex, std::size_t& endIndex) {
+  for (std::size_t bitIndex = level; bitIndex > 0; --bitIndex) {
+    const std::size_t middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+
+    if ((levelIndex >> (bitIndex - 1)) & 1u)
+      beginIndex = middleIndex;
+    else
+      endIndex = middleIndex;
+  }
+}
+
+inline bool compareNeighbors(const KdTree::Neighbor& neighbor1, const KdTree::Neighbor& neighbor2) {
+  return (neighbor1.sqDistance < neighbor2.sqDistance);
+}
+
+} // namespace
+
+KdTree::KdTree(const Submesh& submesh) : KdTree(submesh.getVertices()) {}
+
+void KdTree::build(const std::vector<Vec3f>& points) {
+  build(points.size(), [&points] (std::size_t pointIndex) -> const Vec3f& { return points[pointIndex]; });
+}
+
+void KdTree::build(const std::vector<Vertex>& vertices) {
+  build(vertices.size(), [&vertices] (std::size_t vertIndex) -> const Vec3f& { return vertices[vertIndex].position; });
+}
+
+bool KdTree::findNearest(const Vec3f& position, Neighbor& neighbor, float maxDistance) const {
+  float maxSqDistance = maxDistance * maxDistance;
+  bool hasFound = false;
+
+  traverse(position, maxSqDistance, [this, &position, &neighbor, &maxSqDistance, &hasFound] (std::size_t beginIndex, std::size_t pointCount) {
+    std::array<float, MaxLeafPoints + Simd::Width> sqDistances {};
+    computeSquaredDistances(position, beginIndex, pointCount, sqDistances.data());
+
+    for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+      if (sqDistances[pointIndex] > maxSqDistance)
+        continue;
+
+      maxSqDistance       = sqDistances[pointIndex];
+      neighbor.index      = m_indices[beginIndex + pointIndex];
+      neighbor.sqDistance = maxSqDistance;
+      hasFound            = true;
+    }
+  });
+
+  return hasFound;
+}
+
+void KdTree::findNearest(const Vec3f& position, std::size_t count, std::vector<Neighbor>& neighbors, float maxDistance) const {
+  neighbors.clear();
+
+  if (count == 0)
+    return;
+
+  neighbors.reserve(count);
+
+  // The neighbors are kept in a max-heap, the furthest one being replaced as soon as a closer point is found
+  const float maxSqDistance = maxDistance * maxDistance;
+  float worstSqDistance     = maxSqDistance;
+
+  traverse(position, worstSqDistance, [&] (std::size_t beginIndex, std::size_t pointCount) {
+    std::array<float, MaxLeafPoints + Simd::Width> sqDistances {};
+    computeSquaredDistances(position, beginIndex, pointCount, sqDistances.data());
+
+    for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+      const float sqDistance = sqDistances[pointIndex];
+
+      if (sqDistance > worstSqDistance)
+        continue;
+
+      if (neighbors.size() == count) {
+        std::pop_heap(neighbors.begin(), neighbors.end(), compareNeighbors);
+        neighbors.pop_back();
+      }
+
+      neighbors.push_back({ m_indices[beginIndex + pointIndex], sqDistance });
+      std::push_heap(neighbors.begin(), neighbors.end(), compareNeighbors);
+
+      if (neighbors.size() == count)
+        worstSqDistance = neighbors.front().sqDistance;
+    }
+  });
+
+  std::sort_heap(neighbors.begin(), neighbors.end(), compareNeighbors);
+}
+
+void KdTree::findInRadius(const Vec3f& position, float radius, std::vector<Neighbor>& neighbors) const {
+  neighbors.clear();
+
+  const float sqRadius = radius * radius;
+
+  traverse(position, sqRadius, [this, &position, &neighbors, sqRadius] (std::size_t beginIndex, std::size_t pointCount) {
+    std::array<float, MaxLeafPoints + Simd::Width> sqDistances {};
+    computeSquaredDistances(position, beginIndex, pointCount, sqDistances.data());
+
+    for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+      if (sqDistances[pointIndex] <= sqRadius)
+        neighbors.push_back({ m_indices[beginIndex + pointIndex], sqDistances[pointIndex] });
+    }
+  });
+}
+
+template <typename PositionGetterT>
+void KdTree::build(std::size_t pointCount, const PositionGetterT& getPosition) {
+  m_nodes.clear();
+  m_depth = 0;
+  m_xPositions.clear();
+  m_yPositions.clear();
+  m_zPositions.clear();
+  m_indices.clear();
+
+  if (pointCount == 0)
+    return;
+
+  std::vector<BuildPoint> points(pointCount);
+
+  for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+    points[pointIndex] = { getPosition(pointIndex), static_cast<std::uint32_t>(pointIndex) };
+
+  // The points are halved on each level until the biggest leaves hold few enough of them
+  while (((pointCount - 1) >> m_depth) + 1 > MaxLeafPoints)
+    ++m_depth;
+
+  m_nodes.resize((std::size_t(1) << m_depth) - 1);
+
+  for (std::size_t level = 0; level < m_depth; ++level) {
+    const std::size_t firstNodeIndex = (std::size_t(1) << level) - 1;
+
+    // The nodes of a same level hold distinct ranges of points, & can thus be built independently
+    const auto buildNodes = [this, &points, level, firstNodeIndex] (std::size_t beginIndex, std::size_t endIndex) {
+      for (std::size_t levelIndex = beginIndex; levelIndex < endIndex; ++levelIndex) {
+        std::size_t firstPointIndex = 0;
+        std::size_t lastPointIndex  = points.size();
+        computeNodeRange(level, levelIndex, firstPointIndex, lastPointIndex);
+
+        Vec3f minBounds(std::numeric_limits<float>::max());
+        Vec3f maxBounds(std::numeric_limits<float>::lowest());
+
+        for (std::size_t pointIndex = firstPointIndex; pointIndex < lastPointIndex; ++pointIndex) {
+          for (std::size_t axis = 0; axis < 3; ++axis) {
+            minBounds[axis] = std::min(minBounds[axis], points[pointIndex].position[axis]);
+            maxBounds[axis] = std::max(maxBounds[axis], points[pointIndex].position[axis]);
+          }
+        }
+
+        const Vec3f extent = maxBounds - minBounds;
+        const std::size_t splitAxis = (extent[0] > extent[1] ? (extent[0] > extent[2] ? 0 : 2) : (extent[1] > extent[2] ? 1 : 2));
+
+        const auto middleIter = points.begin() + static_cast<std::ptrdiff_t>(firstPointIndex + (lastPointIndex - firstPointIndex) / 2);
+        std::nth_element(points.begin() + static_cast<std::ptrdiff_t>(firstPointIndex), middleIter,
+                         points.begin() + static_cast<std::ptrdiff_t>(lastPointIndex), [splitAxis] (const BuildPoint& point1, const BuildPoint& point2) {
+          return (point1.position[splitAxis] < point2.position[splitAxis]);
+        });
+
+        Node& node      = m_nodes[firstNodeIndex + levelIndex];
+        node.splitValue = middleIter->position[splitAxis];
+        node.splitAxis  = static_cast<std::uint32_t>(splitAxis);
+      }
+    };
+
+    const std::size_t levelNodeCount = std::size_t(1) << level;
+
+    if (levelNodeCount > 1 && pointCount >= MinParallelPoints)
+      Threading::parallelize(0, levelNodeCount, buildNodes);
+    else
+      buildNodes(0, levelNodeCount);
+  }
+
+  // The coordinates are padded so that the last leaf can be read a whole SIMD register at a time
+  m_xPositions.resize(pointCount + Simd::Width);
+  m_yPositions.resize(pointCount + Simd::Width);
+  m_zPositions.resize(pointCount + Simd::Width);
+  m_indices.resize(pointCount);
+
+  for (std::size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex) {
+    m_xPositions[pointIndex] = points[pointIndex].position[0];
+    m_yPositions[pointIndex] = points[pointIndex].position[1];
+    m_zPositions[pointIndex] = points[pointIndex].position[2];
+    m_indices[pointIndex]    = points[pointIndex].index;
+  }
+}
+
+template <typename LeafFuncT>
+void KdTree::traverse(const Vec3f& position, const float& maxSqDistance, const LeafFuncT& processLeaf) const {
+  if (m_indices.empty())
+    return;
+
+  // Each node is stacked with a lower bound of its points' squared distance, to be skipped if closer points have been found in the meantime
+  struct StackEntry {
+    std::uint32_t nodeIndex;
+    std::uint32_t beginIndex;
+    std::uint32_t endIndex;
+    float sqDistance;
+  };
+
+  std::array<StackEntry, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = { 0, 0, static_cast<std::uint32_t>(m_indices.size()), 0.f };
+
+  while (stackSize > 0) {
+    const StackEntry entry = stack[--stackSize];
+
+    if (entry.sqDistance > maxSqDistance)
+      continue;
+
+    // All leaves are on the last level, after every inner node
+    if (entry.nodeIndex >= m_nodes.size()) {
+      processLeaf(entry.beginIndex, entry.endIndex - entry.beginIndex);
+      continue;
+    }
+
+    const Node& node = m_nodes[entry.nodeIndex];
+    const std::uint32_t middleIndex = entry.beginIndex + (entry.endIndex - entry.beginIndex) / 2;
+    const float planeDist = position[node.splitAxis] - node.splitValue;
+
+    const StackEntry leftEntry  = { entry.nodeIndex * 2 + 1, entry.beginIndex, middleIndex, entry.sqDistance };
+    const StackEntry rightEntry = { entry.nodeIndex * 2 + 2, middleIndex, entry.endIndex, entry.sqDistance };
+
+    // The child on the other side of the splitting plane is stacked first, to be processed after the closest one
+    StackEntry farEntry = (planeDist < 0.f ? rightEntry : leftEntry);
+    farEntry.sqDistance = std::max(entry.sqDistance, planeDist * planeDist);
+
+    stack[stackSize++] = farEntry;
+    stack[stackSize++] = (planeDist < 0.f ? leftEntry : rightEntry);
+  }
+}
+
+void KdTree::computeSquaredDistances(const Vec3f& position, std::size_t beginIndex, std::size_t pointCount, float* sqDistances) const {
+  const Simd::Float xPos = Simd::set(position[0]);
+  const Simd::Float yPos = Simd::set(position[1]);
+  const Simd::Float zPos = Simd::set(position[2]);
+
+  for (std::size_t pointIndex = 0; pointIndex < pointCount; pointIndex += Simd::Width) {
+    const Simd::Float xDiff = Simd::sub(Simd::load(m_xPositions.data() + beginIndex + pointIndex), xPos);
+    const Simd::Float yDiff = Simd::sub(Simd::load(m_yPositions.data() + beginIndex + pointIndex), yPos);
+    const Simd::Float zDiff = Simd::sub(Simd::load(m_zPositions.data() + beginIndex + pointIndex), zPos);
+
+    const Simd::Float sqDists = Simd::add(Simd::add(Simd::mul(xDiff, xDiff), Simd::mul(yDiff, yDiff)), Simd::mul(zDiff, zDiff));
+    Simd::store(sqDistances + pointIndex, sqDists);
+  }
+}
+
+} // namespace Raz
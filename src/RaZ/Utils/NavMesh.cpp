@@ -0,0 +1,1565 @@
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/NavMesh.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Raz {
+
+namespace {
+
+// Flag of the regions of the spans lying in a tile's border, which overlaps the neighboring tiles & only gives context to the tile's own spans
+constexpr std::uint32_t BorderRegion = 0x80000000;
+// Region of a sweep connected to several regions of the previous row
+constexpr std::uint32_t MultipleRegions = 0xFFFFFFFF;
+constexpr std::uint32_t NoConnection = 0xFFFFFFFF;
+constexpr std::size_t NoSlot = std::numeric_limits<std::size_t>::max();
+// Clearance of the topmost spans, which have nothing above them
+constexpr int MaxClearance = 0xFFFF;
+// Voxels added to a tile's border beyond the agents' radius, so that the area eroded near its sides matches the neighboring tiles' one
+constexpr int ExtraBorderSize = 3;
+// Maximum number of vertices of a triangle clipped by the sides of a voxel column
+constexpr std::size_t MaxClippedVertexCount = 12;
+// Safety bound on the number of steps taken to trace a region's outline
+constexpr std::size_t MaxContourIterations = 40000;
+// Maximum height difference, in voxels, between two outline vertices at the same horizontal position for them to be merged
+constexpr int MaxVertexMergeHeight = 2;
+
+// Offsets towards the neighboring column in each direction: -X, +Z, +X & -Z
+constexpr std::array<int, 4> DirectionOffsetsX = {{ -1, 0, 1, 0 }};
+constexpr std::array<int, 4> DirectionOffsetsZ = {{ 0, 1, 0, -1 }};
+
+using ClippedPolygon = std::array<Vec3f, MaxClippedVertexCount>;
+using GridVertex     = std::array<int, 3>;
+
+/// Generation parameters converted into voxels, along with the placement of the tile being built.
+struct TileConfig {
+  float cellSize {};
+  float cellHeight {};
+  float walkableSlopeCos {};
+  int walkableHeight {};
+  int walkableClimb {};
+  int walkableRadius {};
+  /// Number of voxels around the tile, rasterized only to give context to the tile's own voxels.
+  int borderSize {};
+  /// Number of voxel columns along each side of the tile, border included.
+  int gridSize {};
+  /// Maximum squared distance, in voxels, between the simplified outlines & the traced ones.
+  float sqMaxEdgeError {};
+  std::size_t minRegionCellCount {};
+  /// Lowest corner of the tile's grid, border included.
+  Vec3f minBounds {};
+};
+
+/// Solid interval of a voxel column, occupied by geometry.
+struct SolidSpan {
+  int minHeight {};
+  int maxHeight {};
+  bool isWalkable {};
+};
+
+/// Solid interval produced by the rasterization of a triangle, before being merged with the others of the same column.
+struct RasterSpan {
+  std::uint32_t columnIndex {};
+  SolidSpan span {};
+};
+
+/// Open space above a walkable solid span, on which agents can stand.
+struct CompactSpan {
+  int height {};
+  int clearance {};
+  /// Index of the span of each neighboring column which can be reached from this one, if any.
+  std::array<std::uint32_t, 4> neighbors {};
+};
+
+/// Open spans of a tile's grid, each column's ones being contiguous & sorted from bottom to top.
+struct CompactHeightfield {
+  int gridSize {};
+  /// Index of each column's first span, followed by the span count.
+  std::vector<std::uint32_t> columnOffsets {};
+  std::vector<CompactSpan> spans {};
+  std::vector<std::uint8_t> walkables {};
+  std::vector<std::uint32_t> regions {};
+};
+
+struct ContourVertex {
+  int x {};
+  int y {};
+  int z {};
+  /// Region on the other side of the outline's edge; 0 if there is none.
+  std::uint32_t neighborRegion {};
+};
+
+/// Polygon being built from a region's triangles, referencing the tile's grid vertices.
+struct BuildPolygon {
+  std::array<std::uint32_t, NavMesh::MaxPolygonVertexCount> vertexIndices {};
+  std::size_t vertexCount {};
+};
+
+TileConfig computeTileConfig(const NavMeshSettings& settings) {
+  assert("Error: The navigation mesh's voxel sizes must be strictly positive." && settings.cellSize > 0.f && settings.cellHeight > 0.f);
+  assert("Error: The navigation mesh's tiles must hold at least one voxel." && settings.tileCellCount > 0);
+
+  TileConfig config;
+  config.cellSize           = settings.cellSize;
+  config.cellHeight         = settings.cellHeight;
+  config.walkableSlopeCos   = std::cos(settings.agentMaxSlope * PI<float> / 180.f);
+  config.walkableHeight     = static_cast<int>(std::ceil(settings.agentHeight / settings.cellHeight));
+  config.walkableClimb      = static_cast<int>(std::floor(settings.agentMaxClimb / settings.cellHeight));
+  config.walkableRadius     = static_cast<int>(std::ceil(settings.agentRadius / settings.cellSize));
+  config.borderSize         = config.walkableRadius + ExtraBorderSize;
+  config.gridSize           = static_cast<int>(settings.tileCellCount) + config.borderSize * 2;
+  config.sqMaxEdgeError     = (settings.maxEdgeError * settings.maxEdgeError) / (settings.cellSize * settings.cellSize);
+  config.minRegionCellCount = settings.minRegionCellCount;
+
+  return config;
+}
+
+/// Splits a convex polygon in two along an axis-aligned plane, as done by Recast.
+/// \param polygon Polygon to be split.
+/// \param vertexCount Number of vertices of the polygon.
+/// \param axis Axis orthogonal to the plane: 0 for X, 2 for Z.
+/// \param planePos Position of the plane along the axis.
+/// \param belowPolygon Part of the polygon below the plane.
+/// \param belowCount Number of vertices of the part below the plane.
+/// \param abovePolygon Part of the polygon above the plane.
+/// \param aboveCount Number of vertices of the part above the plane.
+void splitPolygon(const ClippedPolygon& polygon, std::size_t vertexCount, std::size_t axis, float planePos,
+                  ClippedPolygon& belowPolygon, std::size_t& belowCount, ClippedPolygon& abovePolygon, std::size_t& aboveCount) {
+  std::array<float, MaxClippedVertexCount> distances {};
+
+  for (std::size_t i = 0; i < vertexCount; ++i)
+    distances[i] = planePos - polygon[i][axis];
+
+  belowCount = 0;
+  aboveCount = 0;
+
+  for (std::size_t i = 0, prevIndex = vertexCount - 1; i < vertexCount; prevIndex = i, ++i) {
+    const bool isPrevBelow = (distances[prevIndex] >= 0.f);
+    const bool isBelow     = (distances[i] >= 0.f);
+
+    if (isPrevBelow != isBelow) {
+      const float ratio = distances[prevIndex] / (distances[prevIndex] - distances[i]);
+      const Vec3f intersection = polygon[prevIndex] + (polygon[i] - polygon[prevIndex]) * ratio;
+
+      belowPolygon[belowCount++] = intersection;
+      abovePolygon[aboveCount++] = intersection;
+
+      // A vertex lying on the plane is the intersection itself, & must not be added again
+      if (distances[i] > 0.f)
+        belowPolygon[belowCount++] = polygon[i];
+      else if (distances[i] < 0.f)
+        abovePolygon[aboveCount++] = polygon[i];
+
+      continue;
+    }
+
+    if (isBelow) {
+      belowPolygon[belowCount++] = polygon[i];
+
+      if (distances[i] != 0.f)
+        continue;
+    }
+
+    abovePolygon[aboveCount++] = polygon[i];
+  }
+}
+
+/// Rasterizes a triangle into the solid spans of the columns it overlaps.
+void rasterizeTriangle(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos, const TileConfig& config, std::vector<RasterSpan>& rasterSpans) {
+  const float gridExtent = config.cellSize * static_cast<float>(config.gridSize);
+  const Vec3f triangleMin({ std::min({ firstPos[0], secondPos[0], thirdPos[0] }),
+                           std::min({ firstPos[1], secondPos[1], thirdPos[1] }),
+                           std::min({ firstPos[2], secondPos[2], thirdPos[2] }) });
+  const Vec3f triangleMax({ std::max({ firstPos[0], secondPos[0], thirdPos[0] }),
+                           std::max({ firstPos[1], secondPos[1], thirdPos[1] }),
+                           std::max({ firstPos[2], secondPos[2], thirdPos[2] }) });
+
+  if (triangleMax[0] < config.minBounds[0] || triangleMin[0] > config.minBounds[0] + gridExtent
+   || triangleMax[2] < config.minBounds[2] || triangleMin[2] > config.minBounds[2] + gridExtent)
+    return;
+
+  // A triangle is walkable if it faces upwards & its slope is low enough
+  const Vec3f normal = (secondPos - firstPos).cross(thirdPos - firstPos);
+  const float normalLength = normal.computeLength();
+  const bool isWalkable = (normalLength > 0.f && normal[1] >= config.walkableSlopeCos * normalLength);
+
+  const float invCellSize   = 1.f / config.cellSize;
+  const float invCellHeight = 1.f / config.cellHeight;
+  const int lastIndex = config.gridSize - 1;
+
+  const int firstRow = std::max(static_cast<int>(std::floor((triangleMin[2] - config.minBounds[2]) * invCellSize)), -1);
+  const int lastRow  = std::min(static_cast<int>(std::floor((triangleMax[2] - config.minBounds[2]) * invCellSize)), lastIndex);
+
+  ClippedPolygon remainingPolygon {{ firstPos, secondPos, thirdPos }};
+  std::size_t remainingCount = 3;
+  ClippedPolygon rowPolygon {};
+  ClippedPolygon cellPolygon {};
+  ClippedPolygon nextPolygon {};
+  std::size_t rowCount {};
+  std::size_t cellCount {};
+  std::size_t nextCount {};
+
+  // The triangle is cut row by row along Z, then each row column by column along X
+  for (int z = firstRow; z <= lastRow; ++z) {
+    splitPolygon(remainingPolygon, remainingCount, 2, config.minBounds[2] + static_cast<float>(z + 1) * config.cellSize,
+                 rowPolygon, rowCount, nextPolygon, nextCount);
+    std::swap(remainingPolygon, nextPolygon);
+    remainingCount = nextCount;
+
+    if (rowCount < 3 || z < 0)
+      continue;
+
+    float rowMinX = rowPolygon[0][0];
+    float rowMaxX = rowPolygon[0][0];
+
+    for (std::size_t i = 1; i < rowCount; ++i) {
+      rowMinX = std::min(rowMinX, rowPolygon[i][0]);
+      rowMaxX = std::max(rowMaxX, rowPolygon[i][0]);
+    }
+
+    const int firstColumn = std::min(std::max(static_cast<int>(std::floor((rowMinX - config.minBounds[0]) * invCellSize)), -1), lastIndex);
+    const int lastColumn  = std::min(std::max(static_cast<int>(std::floor((rowMaxX - config.minBounds[0]) * invCellSize)), 0), lastIndex);
+
+    for (int x = firstColumn; x <= lastColumn; ++x) {
+      splitPolygon(rowPolygon, rowCount, 0, config.minBounds[0] + static_cast<float>(x + 1) * config.cellSize,
+                   cellPolygon, cellCount, nextPolygon, nextCount);
+      std::swap(rowPolygon, nextPolygon);
+      rowCount = nextCount;
+
+      if (cellCount < 3 || x < 0)
+        continue;
+
+      float cellMinY = cellPolygon[0][1];
+      float cellMaxY = cellPolygon[0][1];
+
+      for (std::size_t i = 1; i < cellCount; ++i) {
+        cellMinY = std::min(cellMinY, cellPolygon[i][1]);
+        cellMaxY = std::max(cellMaxY, cellPolygon[i][1]);
+      }
+
+      const int minHeight = static_cast<int>(std::floor((cellMinY - config.minBounds[1]) * invCellHeight));
+      const int maxHeight = std::max(static_cast<int>(std::ceil((cellMaxY - config.minBounds[1]) * invCellHeight)), minHeight + 1);
+
+      rasterSpans.push_back(RasterSpan{ static_cast<std::uint32_t>(z * config.gridSize + x), SolidSpan{ minHeight, maxHeight, isWalkable } });
+    }
+  }
+}
+
+/// Merges the rasterized spans into solid columns, then finds the open spans above them on which agents can stand.
+CompactHeightfield buildCompactHeightfield(std::vector<RasterSpan>& rasterSpans, const TileConfig& config) {
+  const auto columnCount = static_cast<std::size_t>(config.gridSize * config.gridSize);
+
+  std::sort(rasterSpans.begin(), rasterSpans.end(), [] (const RasterSpan& span1, const RasterSpan& span2) {
+    return (span1.columnIndex < span2.columnIndex || (span1.columnIndex == span2.columnIndex && span1.span.minHeight < span2.span.minHeight));
+  });
+
+  std::vector<std::uint32_t> solidOffsets(columnCount + 1);
+  std::vector<SolidSpan> solidSpans;
+  solidSpans.reserve(rasterSpans.size());
+
+  std::size_t rasterIndex = 0;
+
+  for (std::size_t columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+    solidOffsets[columnIndex] = static_cast<std::uint32_t>(solidSpans.size());
+
+    for (; rasterIndex < rasterSpans.size() && rasterSpans[rasterIndex].columnIndex == columnIndex; ++rasterIndex) {
+      const SolidSpan& span = rasterSpans[rasterIndex].span;
+
+      if (solidSpans.size() == solidOffsets[columnIndex] || span.minHeight > solidSpans.back().maxHeight) {
+        solidSpans.push_back(span);
+        continue;
+      }
+
+      // Overlapping spans are merged; the top one decides whether the result is walkable, unless both tops are close enough to step between them
+      SolidSpan& mergedSpan = solidSpans.back();
+
+      if (std::abs(span.maxHeight - mergedSpan.maxHeight) <= config.walkableClimb)
+        mergedSpan.isWalkable = (mergedSpan.isWalkable || span.isWalkable);
+      else if (span.maxHeight > mergedSpan.maxHeight)
+        mergedSpan.isWalkable = span.isWalkable;
+
+      mergedSpan.maxHeight = std::max(mergedSpan.maxHeight, span.maxHeight);
+    }
+  }
+
+  solidOffsets[columnCount] = static_cast<std::uint32_t>(solidSpans.size());
+
+  CompactHeightfield heightfield;
+  heightfield.gridSize = config.gridSize;
+  heightfield.columnOffsets.resize(columnCount + 1);
+  heightfield.spans.reserve(solidSpans.size());
+
+  for (std::size_t columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+    heightfield.columnOffsets[columnIndex] = static_cast<std::uint32_t>(heightfield.spans.size());
+
+    bool wasPrevWalkable = false;
+    int prevMaxHeight    = 0;
+
+    for (std::uint32_t spanIndex = solidOffsets[columnIndex]; spanIndex < solidOffsets[columnIndex + 1]; ++spanIndex) {
+      SolidSpan& span = solidSpans[spanIndex];
+      const bool wasWalkable = span.isWalkable;
+
+      // Low obstacles standing on a walkable span, such as curbs or steps, can be walked on
+      if (!span.isWalkable && wasPrevWalkable && span.maxHeight - prevMaxHeight <= config.walkableClimb)
+        span.isWalkable = true;
+
+      wasPrevWalkable = wasWalkable;
+      prevMaxHeight   = span.maxHeight;
+
+      const int ceiling   = (spanIndex + 1 < solidOffsets[columnIndex + 1] ? solidSpans[spanIndex + 1].minHeight : span.maxHeight + MaxClearance);
+      const int clearance = std::min(ceiling - span.maxHeight, MaxClearance);
+
+      if (!span.isWalkable || clearance < config.walkableHeight)
+        continue;
+
+      CompactSpan compactSpan;
+      compactSpan.height    = span.maxHeight;
+      compactSpan.clearance = clearance;
+      compactSpan.neighbors.fill(NoConnection);
+      heightfield.spans.push_back(compactSpan);
+    }
+  }
+
+  heightfield.columnOffsets[columnCount] = static_cast<std::uint32_t>(heightfield.spans.size());
+
+  // Agents can move between neighboring spans if the step is low enough & the space between both is high enough
+  for (int z = 0; z < config.gridSize; ++z) {
+    for (int x = 0; x < config.gridSize; ++x) {
+      const auto columnIndex = static_cast<std::size_t>(z * config.gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        CompactSpan& span = heightfield.spans[spanIndex];
+
+        for (std::size_t direction = 0; direction < 4; ++direction) {
+          const int neighborX = x + DirectionOffsetsX[direction];
+          const int neighborZ = z + DirectionOffsetsZ[direction];
+
+          if (neighborX < 0 || neighborZ < 0 || neighborX >= config.gridSize || neighborZ >= config.gridSize)
+            continue;
+
+          const auto neighborColumn = static_cast<std::size_t>(neighborZ * config.gridSize + neighborX);
+
+          for (std::uint32_t neighborIndex = heightfield.columnOffsets[neighborColumn];
+               neighborIndex < heightfield.columnOffsets[neighborColumn + 1]; ++neighborIndex) {
+            const CompactSpan& neighborSpan = heightfield.spans[neighborIndex];
+            const int bottom = std::max(span.height, neighborSpan.height);
+            const int top    = std::min(span.height + span.clearance, neighborSpan.height + neighborSpan.clearance);
+
+            if (top - bottom >= config.walkableHeight && std::abs(neighborSpan.height - span.height) <= config.walkableClimb) {
+              span.neighbors[direction] = neighborIndex;
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  heightfield.walkables.assign(heightfield.spans.size(), 1);
+  heightfield.regions.assign(heightfield.spans.size(), 0);
+
+  return heightfield;
+}
+
+/// Shrinks the walkable area by the agents' radius, computing each span's distance to the area's boundary with a chamfer distance transform.
+void erodeWalkableArea(CompactHeightfield& heightfield, int radius) {
+  const int gridSize = heightfield.gridSize;
+  std::vector<CompactSpan>& spans = heightfield.spans;
+  std::vector<std::uint8_t> distances(spans.size(), 0xFF);
+
+  // Spans missing a neighbor lie on the boundary
+  for (std::size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex) {
+    if (std::find(spans[spanIndex].neighbors.cbegin(), spans[spanIndex].neighbors.cend(), NoConnection) != spans[spanIndex].neighbors.cend())
+      distances[spanIndex] = 0;
+  }
+
+  const auto propagateDistance = [&spans, &distances] (std::uint32_t spanIndex, std::size_t direction, std::size_t diagonalDirection) {
+    const std::uint32_t neighborIndex = spans[spanIndex].neighbors[direction];
+
+    if (neighborIndex == NoConnection)
+      return;
+
+    // Straight steps cost 2 & diagonal ones 3, approximating a Euclidean distance
+    distances[spanIndex] = static_cast<std::uint8_t>(std::min<int>(distances[spanIndex], distances[neighborIndex] + 2));
+
+    const std::uint32_t diagonalIndex = spans[neighborIndex].neighbors[diagonalDirection];
+
+    if (diagonalIndex != NoConnection)
+      distances[spanIndex] = static_cast<std::uint8_t>(std::min<int>(distances[spanIndex], distances[diagonalIndex] + 3));
+  };
+
+  // The distances are propagated forward from the -X & -Z neighbors, then backward from the +X & +Z ones
+  for (int z = 0; z < gridSize; ++z) {
+    for (int x = 0; x < gridSize; ++x) {
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        propagateDistance(spanIndex, 0, 3);
+        propagateDistance(spanIndex, 3, 2);
+      }
+    }
+  }
+
+  for (int z = gridSize - 1; z >= 0; --z) {
+    for (int x = gridSize - 1; x >= 0; --x) {
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        propagateDistance(spanIndex, 2, 1);
+        propagateDistance(spanIndex, 1, 0);
+      }
+    }
+  }
+
+  const int minDistance = radius * 2;
+
+  for (std::size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex) {
+    if (distances[spanIndex] < minDistance)
+      heightfield.walkables[spanIndex] = 0;
+  }
+
+  // Connections towards eroded spans are removed, so that they are seen as walls by the following steps
+  for (CompactSpan& span : spans) {
+    for (std::uint32_t& neighborIndex : span.neighbors) {
+      if (neighborIndex != NoConnection && heightfield.walkables[neighborIndex] == 0)
+        neighborIndex = NoConnection;
+    }
+  }
+}
+
+/// Partitions the walkable area into monotone regions, which have no holes & can thus be outlined by a single contour, then removes the small ones.
+void buildRegions(CompactHeightfield& heightfield, const TileConfig& config) {
+  const int gridSize   = heightfield.gridSize;
+  const int borderSize = config.borderSize;
+  const std::vector<CompactSpan>& spans = heightfield.spans;
+  std::vector<std::uint32_t>& regions   = heightfield.regions;
+
+  const auto isRegularRegion = [] (std::uint32_t region) { return (region != 0 && (region & BorderRegion) == 0); };
+
+  // Each side of the border is a distinct region, so that the outline of a region covering the whole tile changes neighbor at its corners
+  for (int z = 0; z < gridSize; ++z) {
+    for (int x = 0; x < gridSize; ++x) {
+      std::uint32_t borderRegion = BorderRegion;
+
+      if (x < borderSize)
+        borderRegion |= 1;
+      else if (x >= gridSize - borderSize)
+        borderRegion |= 2;
+      else if (z < borderSize)
+        borderRegion |= 3;
+      else if (z >= gridSize - borderSize)
+        borderRegion |= 4;
+      else
+        continue;
+
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        if (heightfield.walkables[spanIndex] != 0)
+          regions[spanIndex] = borderRegion;
+      }
+    }
+  }
+
+  // Each row is swept along X, consecutive connected spans forming a sweep. A sweep continues the region of the previous row's spans it touches
+  //   if it is the only one of this row to touch it, & touches no other region; a new region is created otherwise
+  struct Sweep {
+    std::uint32_t prevRegion {};
+    std::uint32_t prevSpanCount {};
+    std::uint32_t region {};
+  };
+
+  std::vector<Sweep> sweeps;
+  std::vector<std::uint32_t> prevRegionSpanCounts;
+  std::uint32_t regionCount = 1;
+
+  for (int z = borderSize; z < gridSize - borderSize; ++z) {
+    sweeps.assign(1, Sweep());
+    prevRegionSpanCounts.assign(regionCount, 0);
+
+    // While sweeping the row, its spans hold the index of their sweep instead of a region
+    for (int x = borderSize; x < gridSize - borderSize; ++x) {
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        if (heightfield.walkables[spanIndex] == 0)
+          continue;
+
+        const std::uint32_t leftIndex = spans[spanIndex].neighbors[0];
+        std::uint32_t sweepIndex = (leftIndex != NoConnection && isRegularRegion(regions[leftIndex]) ? regions[leftIndex] : 0);
+
+        if (sweepIndex == 0) {
+          sweepIndex = static_cast<std::uint32_t>(sweeps.size());
+          sweeps.emplace_back();
+        }
+
+        const std::uint32_t prevRowIndex = spans[spanIndex].neighbors[3];
+
+        if (prevRowIndex != NoConnection && isRegularRegion(regions[prevRowIndex])) {
+          const std::uint32_t prevRegion = regions[prevRowIndex];
+          Sweep& sweep = sweeps[sweepIndex];
+
+          if (sweep.prevRegion == 0 || sweep.prevRegion == prevRegion) {
+            sweep.prevRegion = prevRegion;
+            ++sweep.prevSpanCount;
+            ++prevRegionSpanCounts[prevRegion];
+          } else {
+            sweep.prevRegion = MultipleRegions;
+          }
+        }
+
+        regions[spanIndex] = sweepIndex;
+      }
+    }
+
+    for (std::size_t sweepIndex = 1; sweepIndex < sweeps.size(); ++sweepIndex) {
+      Sweep& sweep = sweeps[sweepIndex];
+
+      if (sweep.prevRegion != 0 && sweep.prevRegion != MultipleRegions && prevRegionSpanCounts[sweep.prevRegion] == sweep.prevSpanCount)
+        sweep.region = sweep.prevRegion;
+      else
+        sweep.region = regionCount++;
+    }
+
+    for (int x = borderSize; x < gridSize - borderSize; ++x) {
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        if (isRegularRegion(regions[spanIndex]))
+          regions[spanIndex] = sweeps[regions[spanIndex]].region;
+      }
+    }
+  }
+
+  // Connected regions are grouped; the groups too small to be relevant are removed, unless they touch the border & may continue in another tile
+  std::vector<std::uint32_t> groups(regionCount);
+  std::iota(groups.begin(), groups.end(), 0);
+
+  const auto findGroup = [&groups] (std::uint32_t region) {
+    while (groups[region] != region) {
+      groups[region] = groups[groups[region]];
+      region = groups[region];
+    }
+
+    return region;
+  };
+
+  std::vector<std::size_t> regionSpanCounts(regionCount, 0);
+  std::vector<std::uint8_t> bordersTile(regionCount, 0);
+
+  for (std::size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex) {
+    const std::uint32_t region = regions[spanIndex];
+
+    if (!isRegularRegion(region))
+      continue;
+
+    ++regionSpanCounts[region];
+
+    for (const std::uint32_t neighborIndex : spans[spanIndex].neighbors) {
+      if (neighborIndex == NoConnection)
+        continue;
+
+      const std::uint32_t neighborRegion = regions[neighborIndex];
+
+      if ((neighborRegion & BorderRegion) != 0)
+        bordersTile[region] = 1;
+      else if (neighborRegion != 0 && neighborRegion != region)
+        groups[findGroup(neighborRegion)] = findGroup(region);
+    }
+  }
+
+  std::vector<std::size_t> groupSpanCounts(regionCount, 0);
+  std::vector<std::uint8_t> groupBordersTile(regionCount, 0);
+
+  for (std::uint32_t region = 1; region < regionCount; ++region) {
+    const std::uint32_t group = findGroup(region);
+    groupSpanCounts[group] += regionSpanCounts[region];
+    groupBordersTile[group] |= bordersTile[region];
+  }
+
+  for (std::uint32_t& region : regions) {
+    if (!isRegularRegion(region))
+      continue;
+
+    const std::uint32_t group = findGroup(region);
+
+    if (groupSpanCounts[group] < config.minRegionCellCount && groupBordersTile[group] == 0)
+      region = 0;
+  }
+}
+
+/// Computes the height of an outline's vertex, at a span's corner: the highest of the spans sharing this corner, so that it lies above all of them.
+/// \param direction Direction of the edge ending at the corner; the corner is between this direction & the next one.
+int computeCornerHeight(const CompactHeightfield& heightfield, std::uint32_t spanIndex, std::size_t direction) {
+  const CompactSpan& span = heightfield.spans[spanIndex];
+  const std::size_t nextDirection = (direction + 1) % 4;
+  int height = span.height;
+
+  if (span.neighbors[direction] != NoConnection) {
+    const CompactSpan& neighborSpan = heightfield.spans[span.neighbors[direction]];
+    height = std::max(height, neighborSpan.height);
+
+    if (neighborSpan.neighbors[nextDirection] != NoConnection)
+      height = std::max(height, heightfield.spans[neighborSpan.neighbors[nextDirection]].height);
+  }
+
+  if (span.neighbors[nextDirection] != NoConnection) {
+    const CompactSpan& neighborSpan = heightfield.spans[span.neighbors[nextDirection]];
+    height = std::max(height, neighborSpan.height);
+
+    if (neighborSpan.neighbors[direction] != NoConnection)
+      height = std::max(height, heightfield.spans[neighborSpan.neighbors[direction]].height);
+  }
+
+  return height;
+}
+
+/// Traces a region's outline, following the edges separating its spans from the others.
+/// \param edgeFlags Directions in which each span borders another region; the edges traced are removed.
+/// \param vertices Outline's vertices; each one holds the region beyond the edge ending at it.
+void traceContour(const CompactHeightfield& heightfield, int x, int z, std::uint32_t spanIndex,
+                  std::vector<std::uint8_t>& edgeFlags, std::vector<ContourVertex>& vertices) {
+  std::size_t direction = 0;
+
+  while ((edgeFlags[spanIndex] & (1u << direction)) == 0)
+    ++direction;
+
+  const std::uint32_t startIndex     = spanIndex;
+  const std::size_t startDirection = direction;
+
+  for (std::size_t iteration = 0; iteration < MaxContourIterations; ++iteration) {
+    const CompactSpan& span = heightfield.spans[spanIndex];
+
+    if (edgeFlags[spanIndex] & (1u << direction)) {
+      // The edge borders another region: the corner ending it is added, & the outline turns to follow the span's next side
+      ContourVertex vertex;
+      vertex.x = x + (direction == 1 || direction == 2 ? 1 : 0);
+      vertex.y = computeCornerHeight(heightfield, spanIndex, direction);
+      vertex.z = z + (direction == 0 || direction == 1 ? 1 : 0);
+
+      if (span.neighbors[direction] != NoConnection)
+        vertex.neighborRegion = heightfield.regions[span.neighbors[direction]];
+
+      vertices.push_back(vertex);
+
+      edgeFlags[spanIndex] &= static_cast<std::uint8_t>(~(1u << direction));
+      direction = (direction + 1) % 4;
+    } else {
+      // The neighbor belongs to the same region: the outline goes on from it
+      spanIndex = span.neighbors[direction];
+      x += DirectionOffsetsX[direction];
+      z += DirectionOffsetsZ[direction];
+      direction = (direction + 3) % 4;
+    }
+
+    if (spanIndex == startIndex && direction == startDirection)
+      break;
+  }
+}
+
+float computeSquaredSegmentDistance(const ContourVertex& point, const ContourVertex& segmentStart, const ContourVertex& segmentEnd) {
+  const auto segmentX = static_cast<float>(segmentEnd.x - segmentStart.x);
+  const auto segmentZ = static_cast<float>(segmentEnd.z - segmentStart.z);
+  const auto pointX   = static_cast<float>(point.x - segmentStart.x);
+  const auto pointZ   = static_cast<float>(point.z - segmentStart.z);
+  const float sqLength = segmentX * segmentX + segmentZ * segmentZ;
+
+  float ratio = (sqLength > 0.f ? (pointX * segmentX + pointZ * segmentZ) / sqLength : 0.f);
+  ratio = std::min(std::max(ratio, 0.f), 1.f);
+
+  const float diffX = pointX - segmentX * ratio;
+  const float diffZ = pointZ - segmentZ * ratio;
+
+  return diffX * diffX + diffZ * diffZ;
+}
+
+/// Simplifies a traced outline, keeping the vertices where the neighboring region changes & approximating walls within the maximum error.
+/// \return Simplified outline's vertices; each one holds the region beyond the edge starting from it.
+std::vector<ContourVertex> simplifyContour(const std::vector<ContourVertex>& rawVertices, float sqMaxError) {
+  const std::size_t rawCount = rawVertices.size();
+  std::vector<std::size_t> keptIndices;
+
+  for (std::size_t i = 0; i < rawCount; ++i) {
+    if (rawVertices[i].neighborRegion != rawVertices[(i + 1) % rawCount].neighborRegion)
+      keptIndices.push_back(i);
+  }
+
+  // An outline surrounded only by walls is seeded with its lower left & upper right vertices
+  if (keptIndices.empty()) {
+    std::size_t lowerIndex = 0;
+    std::size_t upperIndex = 0;
+
+    for (std::size_t i = 1; i < rawCount; ++i) {
+      const ContourVertex& vertex = rawVertices[i];
+
+      if (vertex.x < rawVertices[lowerIndex].x || (vertex.x == rawVertices[lowerIndex].x && vertex.z < rawVertices[lowerIndex].z))
+        lowerIndex = i;
+
+      if (vertex.x > rawVertices[upperIndex].x || (vertex.x == rawVertices[upperIndex].x && vertex.z > rawVertices[upperIndex].z))
+        upperIndex = i;
+    }
+
+    keptIndices.push_back(std::min(lowerIndex, upperIndex));
+
+    if (upperIndex != lowerIndex)
+      keptIndices.push_back(std::max(lowerIndex, upperIndex));
+  }
+
+  // Walls are refined by adding their farthest vertex from the simplified edge until all of them are close enough
+  for (std::size_t i = 0; i < keptIndices.size();) {
+    const std::size_t firstIndex = keptIndices[i];
+    const std::size_t lastIndex  = keptIndices[(i + 1) % keptIndices.size()];
+
+    float maxSqDist = 0.f;
+    std::size_t farthestIndex = rawCount;
+
+    if (rawVertices[(firstIndex + 1) % rawCount].neighborRegion == 0) {
+      for (std::size_t rawIndex = (firstIndex + 1) % rawCount; rawIndex != lastIndex; rawIndex = (rawIndex + 1) % rawCount) {
+        const float sqDist = computeSquaredSegmentDistance(rawVertices[rawIndex], rawVertices[firstIndex], rawVertices[lastIndex]);
+
+        if (sqDist > maxSqDist) {
+          maxSqDist     = sqDist;
+          farthestIndex = rawIndex;
+        }
+      }
+    }
+
+    if (farthestIndex != rawCount && maxSqDist > sqMaxError)
+      keptIndices.insert(keptIndices.begin() + static_cast<std::ptrdiff_t>(i + 1), farthestIndex);
+    else
+      ++i;
+  }
+
+  std::vector<ContourVertex> vertices;
+  vertices.reserve(keptIndices.size());
+
+  for (const std::size_t rawIndex : keptIndices) {
+    ContourVertex vertex = rawVertices[rawIndex];
+    vertex.neighborRegion = rawVertices[(rawIndex + 1) % rawCount].neighborRegion;
+    vertices.push_back(vertex);
+  }
+
+  // Vertices at the same horizontal position would produce degenerate edges
+  for (std::size_t i = 0; i < vertices.size() && vertices.size() > 1;) {
+    const std::size_t nextIndex = (i + 1) % vertices.size();
+
+    if (vertices[i].x != vertices[nextIndex].x || vertices[i].z != vertices[nextIndex].z) {
+      ++i;
+      continue;
+    }
+
+    vertices[i].neighborRegion = vertices[nextIndex].neighborRegion;
+    vertices.erase(vertices.begin() + static_cast<std::ptrdiff_t>(nextIndex));
+  }
+
+  return vertices;
+}
+
+/// Computes twice the signed area of a triangle projected on the horizontal plane, positive if it is counter-clockwise when seen from above.
+std::int64_t computeArea(const GridVertex& firstVertex, const GridVertex& secondVertex, const GridVertex& thirdVertex) {
+  return static_cast<std::int64_t>(secondVertex[2] - firstVertex[2]) * (thirdVertex[0] - firstVertex[0])
+       - static_cast<std::int64_t>(secondVertex[0] - firstVertex[0]) * (thirdVertex[2] - firstVertex[2]);
+}
+
+bool isInTriangle(const GridVertex& point, const GridVertex& firstVertex, const GridVertex& secondVertex, const GridVertex& thirdVertex) {
+  return (computeArea(firstVertex, secondVertex, point) >= 0 && computeArea(secondVertex, thirdVertex, point) >= 0
+       && computeArea(thirdVertex, firstVertex, point) >= 0);
+}
+
+/// Triangulates a polygon by ear clipping, cutting at each step the ear with the shortest diagonal to avoid slivers.
+/// \param polygon Indices of the polygon's vertices, in counter-clockwise order when seen from above.
+/// \param triangles Triangles, appended to the given list.
+void triangulate(std::vector<std::uint32_t> polygon, const std::vector<GridVertex>& vertices, std::vector<BuildPolygon>& triangles) {
+  const auto isSamePosition = [] (const GridVertex& firstVertex, const GridVertex& secondVertex) {
+    return (firstVertex[0] == secondVertex[0] && firstVertex[2] == secondVertex[2]);
+  };
+
+  while (polygon.size() > 3) {
+    const std::size_t vertexCount = polygon.size();
+    std::size_t earIndex  = vertexCount;
+    std::size_t flatIndex = vertexCount;
+    std::int64_t minSqDiagonal = std::numeric_limits<std::int64_t>::max();
+
+    for (std::size_t i = 0; i < vertexCount; ++i) {
+      const GridVertex& prevVertex = vertices[polygon[(i + vertexCount - 1) % vertexCount]];
+      const GridVertex& vertex     = vertices[polygon[i]];
+      const GridVertex& nextVertex = vertices[polygon[(i + 1) % vertexCount]];
+      const std::int64_t area = computeArea(prevVertex, vertex, nextVertex);
+
+      if (area == 0 && flatIndex == vertexCount)
+        flatIndex = i;
+
+      if (area <= 0)
+        continue;
+
+      const auto diagonalX = static_cast<std::int64_t>(nextVertex[0] - prevVertex[0]);
+      const auto diagonalZ = static_cast<std::int64_t>(nextVertex[2] - prevVertex[2]);
+      const std::int64_t sqDiagonal = diagonalX * diagonalX + diagonalZ * diagonalZ;
+
+      if (sqDiagonal >= minSqDiagonal)
+        continue;
+
+      // A convex vertex is an ear if no other vertex lies in the triangle it forms with its neighbors
+      bool isEar = true;
+
+      for (const std::uint32_t otherIndex : polygon) {
+        const GridVertex& otherVertex = vertices[otherIndex];
+
+        if (isSamePosition(otherVertex, prevVertex) || isSamePosition(otherVertex, vertex) || isSamePosition(otherVertex, nextVertex))
+          continue;
+
+        if (isInTriangle(otherVertex, prevVertex, vertex, nextVertex)) {
+          isEar = false;
+          break;
+        }
+      }
+
+      if (isEar) {
+        earIndex      = i;
+        minSqDiagonal = sqDiagonal;
+      }
+    }
+
+    // Without any ear, the outline is degenerate; collinear vertices are then dropped, & the rest discarded if there are none
+    if (earIndex == vertexCount) {
+      if (flatIndex == vertexCount)
+        return;
+
+      polygon.erase(polygon.begin() + static_cast<std::ptrdiff_t>(flatIndex));
+      continue;
+    }
+
+    BuildPolygon triangle;
+    triangle.vertexIndices[0] = polygon[(earIndex + vertexCount - 1) % vertexCount];
+    triangle.vertexIndices[1] = polygon[earIndex];
+    triangle.vertexIndices[2] = polygon[(earIndex + 1) % vertexCount];
+    triangle.vertexCount      = 3;
+    triangles.push_back(triangle);
+
+    polygon.erase(polygon.begin() + static_cast<std::ptrdiff_t>(earIndex));
+  }
+
+  if (polygon.size() == 3 && computeArea(vertices[polygon[0]], vertices[polygon[1]], vertices[polygon[2]]) > 0) {
+    BuildPolygon triangle;
+    std::copy(polygon.cbegin(), polygon.cend(), triangle.vertexIndices.begin());
+    triangle.vertexCount = 3;
+    triangles.push_back(triangle);
+  }
+}
+
+/// Checks if two polygons can be merged into a convex one, sharing an edge & not exceeding the maximum vertex count.
+/// \param firstEdge Index of the shared edge in the first polygon.
+/// \param secondEdge Index of the shared edge in the second polygon.
+/// \return Squared length of the shared edge, or -1 if the polygons can't be merged.
+std::int64_t computeMergeValue(const BuildPolygon& firstPolygon, const BuildPolygon& secondPolygon, const std::vector<GridVertex>& vertices,
+                               std::size_t& firstEdge, std::size_t& secondEdge) {
+  const std::size_t firstCount  = firstPolygon.vertexCount;
+  const std::size_t secondCount = secondPolygon.vertexCount;
+
+  if (firstCount + secondCount - 2 > NavMesh::MaxPolygonVertexCount)
+    return -1;
+
+  firstEdge  = firstCount;
+  secondEdge = secondCount;
+
+  for (std::size_t i = 0; i < firstCount && firstEdge == firstCount; ++i) {
+    const std::uint32_t edgeStart = firstPolygon.vertexIndices[i];
+    const std::uint32_t edgeEnd   = firstPolygon.vertexIndices[(i + 1) % firstCount];
+
+    for (std::size_t j = 0; j < secondCount; ++j) {
+      if (secondPolygon.vertexIndices[j] == edgeEnd && secondPolygon.vertexIndices[(j + 1) % secondCount] == edgeStart) {
+        firstEdge  = i;
+        secondEdge = j;
+        break;
+      }
+    }
+  }
+
+  if (firstEdge == firstCount)
+    return -1;
+
+  // Both corners at the ends of the shared edge must remain strictly convex
+  const GridVertex& firstCornerPrev = vertices[firstPolygon.vertexIndices[(firstEdge + firstCount - 1) % firstCount]];
+  const GridVertex& firstCorner     = vertices[firstPolygon.vertexIndices[firstEdge]];
+  const GridVertex& firstCornerNext = vertices[secondPolygon.vertexIndices[(secondEdge + 2) % secondCount]];
+
+  if (computeArea(firstCornerPrev, firstCorner, firstCornerNext) <= 0)
+    return -1;
+
+  const GridVertex& secondCornerPrev = vertices[secondPolygon.vertexIndices[(secondEdge + secondCount - 1) % secondCount]];
+  const GridVertex& secondCorner     = vertices[secondPolygon.vertexIndices[secondEdge]];
+  const GridVertex& secondCornerNext = vertices[firstPolygon.vertexIndices[(firstEdge + 2) % firstCount]];
+
+  if (computeArea(secondCornerPrev, secondCorner, secondCornerNext) <= 0)
+    return -1;
+
+  const GridVertex& edgeStart = vertices[firstPolygon.vertexIndices[firstEdge]];
+  const GridVertex& edgeEnd   = vertices[firstPolygon.vertexIndices[(firstEdge + 1) % firstCount]];
+  const auto edgeX = static_cast<std::int64_t>(edgeEnd[0] - edgeStart[0]);
+  const auto edgeZ = static_cast<std::int64_t>(edgeEnd[2] - edgeStart[2]);
+
+  return edgeX * edgeX + edgeZ * edgeZ;
+}
+
+/// Merges triangles into convex polygons, greedily joining at each step the pair sharing the longest edge.
+void mergePolygons(std::vector<BuildPolygon>& polygons, const std::vector<GridVertex>& vertices) {
+  while (polygons.size() > 1) {
+    std::int64_t bestValue = 0;
+    std::size_t bestFirst  = 0;
+    std::size_t bestSecond = 0;
+    std::size_t bestFirstEdge  = 0;
+    std::size_t bestSecondEdge = 0;
+
+    for (std::size_t i = 0; i + 1 < polygons.size(); ++i) {
+      for (std::size_t j = i + 1; j < polygons.size(); ++j) {
+        std::size_t firstEdge {};
+        std::size_t secondEdge {};
+        const std::int64_t value = computeMergeValue(polygons[i], polygons[j], vertices, firstEdge, secondEdge);
+
+        if (value > bestValue) {
+          bestValue      = value;
+          bestFirst      = i;
+          bestSecond     = j;
+          bestFirstEdge  = firstEdge;
+          bestSecondEdge = secondEdge;
+        }
+      }
+    }
+
+    if (bestValue <= 0)
+      return;
+
+    const BuildPolygon& firstPolygon  = polygons[bestFirst];
+    const BuildPolygon& secondPolygon = polygons[bestSecond];
+    BuildPolygon mergedPolygon;
+
+    // The first polygon's vertices are taken from the end of the shared edge, followed by the second's, skipping the shared vertices
+    for (std::size_t i = 0; i + 1 < firstPolygon.vertexCount; ++i)
+      mergedPolygon.vertexIndices[mergedPolygon.vertexCount++] = firstPolygon.vertexIndices[(bestFirstEdge + 1 + i) % firstPolygon.vertexCount];
+
+    for (std::size_t i = 0; i + 1 < secondPolygon.vertexCount; ++i)
+      mergedPolygon.vertexIndices[mergedPolygon.vertexCount++] = secondPolygon.vertexIndices[(bestSecondEdge + 1 + i) % secondPolygon.vertexCount];
+
+    polygons[bestFirst] = mergedPolygon;
+    polygons.erase(polygons.begin() + static_cast<std::ptrdiff_t>(bestSecond));
+  }
+}
+
+/// Builds a tile's convex polygons from its regions' outlines, & connects them to each other.
+NavMesh::Tile buildPolygons(const std::vector<std::vector<ContourVertex>>& contours, const TileConfig& config) {
+  // Vertices shared by several outlines are merged, being found through a grid of their horizontal positions
+  const auto vertexGridSize = static_cast<std::size_t>(config.gridSize + 1);
+  std::vector<std::uint32_t> vertexGridHeads(vertexGridSize * vertexGridSize, NoConnection);
+  std::vector<std::uint32_t> nextGridVertices;
+  std::vector<GridVertex> gridVertices;
+
+  const auto addVertex = [&] (const ContourVertex& vertex) {
+    std::uint32_t& head = vertexGridHeads[static_cast<std::size_t>(vertex.z) * vertexGridSize + static_cast<std::size_t>(vertex.x)];
+
+    for (std::uint32_t vertexIndex = head; vertexIndex != NoConnection; vertexIndex = nextGridVertices[vertexIndex]) {
+      if (std::abs(gridVertices[vertexIndex][1] - vertex.y) <= MaxVertexMergeHeight)
+        return vertexIndex;
+    }
+
+    const auto vertexIndex = static_cast<std::uint32_t>(gridVertices.size());
+    gridVertices.push_back(GridVertex{{ vertex.x, vertex.y, vertex.z }});
+    nextGridVertices.push_back(head);
+    head = vertexIndex;
+
+    return vertexIndex;
+  };
+
+  std::vector<BuildPolygon> tilePolygons;
+  std::vector<BuildPolygon> regionPolygons;
+  std::vector<std::uint32_t> outline;
+
+  for (const std::vector<ContourVertex>& contour : contours) {
+    outline.clear();
+
+    for (const ContourVertex& vertex : contour) {
+      const std::uint32_t vertexIndex = addVertex(vertex);
+
+      if (outline.empty() || outline.back() != vertexIndex)
+        outline.push_back(vertexIndex);
+    }
+
+    while (outline.size() > 1 && outline.front() == outline.back())
+      outline.pop_back();
+
+    if (outline.size() < 3)
+      continue;
+
+    std::int64_t area = 0;
+
+    for (std::size_t i = 1; i + 1 < outline.size(); ++i)
+      area += computeArea(gridVertices[outline[0]], gridVertices[outline[i]], gridVertices[outline[i + 1]]);
+
+    if (area == 0)
+      continue;
+
+    if (area < 0)
+      std::reverse(outline.begin(), outline.end());
+
+    regionPolygons.clear();
+    triangulate(outline, gridVertices, regionPolygons);
+    mergePolygons(regionPolygons, gridVertices);
+
+    tilePolygons.insert(tilePolygons.end(), regionPolygons.cbegin(), regionPolygons.cend());
+  }
+
+  NavMesh::Tile tile;
+  tile.vertices.reserve(gridVertices.size());
+
+  for (const GridVertex& vertex : gridVertices) {
+    tile.vertices.push_back(config.minBounds + Vec3f({ static_cast<float>(vertex[0]) * config.cellSize,
+                                                       static_cast<float>(vertex[1]) * config.cellHeight,
+                                                       static_cast<float>(vertex[2]) * config.cellSize }));
+  }
+
+  tile.polygons.resize(tilePolygons.size());
+
+  // Polygons sharing an edge are found by sorting all edges by their vertices
+  struct PolygonEdge {
+    std::uint32_t firstVertex {};
+    std::uint32_t secondVertex {};
+    std::uint32_t polygonIndex {};
+    std::uint32_t edgeIndex {};
+  };
+
+  std::vector<PolygonEdge> edges;
+
+  for (std::size_t polygonIndex = 0; polygonIndex < tilePolygons.size(); ++polygonIndex) {
+    const BuildPolygon& buildPolygon = tilePolygons[polygonIndex];
+    NavMesh::Polygon& polygon = tile.polygons[polygonIndex];
+
+    polygon.vertexCount = static_cast<std::uint32_t>(buildPolygon.vertexCount);
+    polygon.vertexIndices = buildPolygon.vertexIndices;
+    polygon.neighbors.fill(NavMesh::NoNeighbor);
+
+    for (std::size_t edgeIndex = 0; edgeIndex < buildPolygon.vertexCount; ++edgeIndex) {
+      const std::uint32_t edgeStart = buildPolygon.vertexIndices[edgeIndex];
+      const std::uint32_t edgeEnd   = buildPolygon.vertexIndices[(edgeIndex + 1) % buildPolygon.vertexCount];
+
+      edges.push_back(PolygonEdge{ std::min(edgeStart, edgeEnd), std::max(edgeStart, edgeEnd),
+                                   static_cast<std::uint32_t>(polygonIndex), static_cast<std::uint32_t>(edgeIndex) });
+    }
+  }
+
+  std::sort(edges.begin(), edges.end(), [] (const PolygonEdge& edge1, const PolygonEdge& edge2) {
+    return (edge1.firstVertex < edge2.firstVertex || (edge1.firstVertex == edge2.firstVertex && edge1.secondVertex < edge2.secondVertex));
+  });
+
+  for (std::size_t i = 0; i + 1 < edges.size(); ++i) {
+    const PolygonEdge& edge     = edges[i];
+    const PolygonEdge& nextEdge = edges[i + 1];
+
+    if (edge.firstVertex != nextEdge.firstVertex || edge.secondVertex != nextEdge.secondVertex)
+      continue;
+
+    tile.polygons[edge.polygonIndex].neighbors[edge.edgeIndex]         = nextEdge.polygonIndex;
+    tile.polygons[nextEdge.polygonIndex].neighbors[nextEdge.edgeIndex] = edge.polygonIndex;
+    ++i;
+  }
+
+  // Edges lying on the tile's sides may be connected to the neighboring tiles' polygons
+  const int minBorder = config.borderSize;
+  const int maxBorder = config.gridSize - config.borderSize;
+
+  for (NavMesh::Polygon& polygon : tile.polygons) {
+    for (std::size_t edgeIndex = 0; edgeIndex < polygon.vertexCount; ++edgeIndex) {
+      if (polygon.neighbors[edgeIndex] != NavMesh::NoNeighbor)
+        continue;
+
+      const GridVertex& edgeStart = gridVertices[polygon.vertexIndices[edgeIndex]];
+      const GridVertex& edgeEnd   = gridVertices[polygon.vertexIndices[(edgeIndex + 1) % polygon.vertexCount]];
+
+      if (edgeStart[0] == minBorder && edgeEnd[0] == minBorder)
+        polygon.neighbors[edgeIndex] = NavMesh::ExternalEdge | 0;
+      else if (edgeStart[2] == maxBorder && edgeEnd[2] == maxBorder)
+        polygon.neighbors[edgeIndex] = NavMesh::ExternalEdge | 1;
+      else if (edgeStart[0] == maxBorder && edgeEnd[0] == maxBorder)
+        polygon.neighbors[edgeIndex] = NavMesh::ExternalEdge | 2;
+      else if (edgeStart[2] == minBorder && edgeEnd[2] == minBorder)
+        polygon.neighbors[edgeIndex] = NavMesh::ExternalEdge | 3;
+    }
+  }
+
+  return tile;
+}
+
+NavMesh::Tile buildTile(std::vector<RasterSpan>& rasterSpans, const TileConfig& config) {
+  CompactHeightfield heightfield = buildCompactHeightfield(rasterSpans, config);
+  erodeWalkableArea(heightfield, config.walkableRadius);
+  buildRegions(heightfield, config);
+
+  // Each span's sides bordering another region, or no walkable area at all, are flagged to be traced
+  const int gridSize = heightfield.gridSize;
+  std::vector<std::uint8_t> edgeFlags(heightfield.spans.size(), 0);
+
+  for (std::size_t spanIndex = 0; spanIndex < heightfield.spans.size(); ++spanIndex) {
+    const std::uint32_t region = heightfield.regions[spanIndex];
+
+    if (region == 0 || (region & BorderRegion) != 0)
+      continue;
+
+    for (std::size_t direction = 0; direction < 4; ++direction) {
+      const std::uint32_t neighborIndex = heightfield.spans[spanIndex].neighbors[direction];
+
+      if (neighborIndex == NoConnection || heightfield.regions[neighborIndex] != region)
+        edgeFlags[spanIndex] |= static_cast<std::uint8_t>(1u << direction);
+    }
+  }
+
+  std::vector<std::vector<ContourVertex>> contours;
+  std::vector<ContourVertex> rawVertices;
+
+  for (int z = 0; z < gridSize; ++z) {
+    for (int x = 0; x < gridSize; ++x) {
+      const auto columnIndex = static_cast<std::size_t>(z * gridSize + x);
+
+      for (std::uint32_t spanIndex = heightfield.columnOffsets[columnIndex]; spanIndex < heightfield.columnOffsets[columnIndex + 1]; ++spanIndex) {
+        // Spans surrounded by their own region, or already traced, have no edge left
+        if (edgeFlags[spanIndex] == 0)
+          continue;
+
+        rawVertices.clear();
+        traceContour(heightfield, x, z, spanIndex, edgeFlags, rawVertices);
+
+        std::vector<ContourVertex> vertices = simplifyContour(rawVertices, config.sqMaxEdgeError);
+
+        if (vertices.size() >= 3)
+          contours.push_back(std::move(vertices));
+      }
+    }
+  }
+
+  return buildPolygons(contours, config);
+}
+
+/// Gathers the triangles of all the submeshes of a mesh.
+void gatherTriangles(const Mesh& mesh, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+  for (const SubmeshPtr& submeshPtr : mesh.getSubmeshes()) {
+    const Submesh& submesh = *submeshPtr; // Accessed as const, so that its cached bounds are kept
+    const auto indexOffset = static_cast<unsigned int>(vertices.size());
+    const std::vector<unsigned int>& submeshIndices = submesh.getIndices();
+
+    vertices.insert(vertices.end(), submesh.getVertices().cbegin(), submesh.getVertices().cend());
+
+    // Any incomplete triangle is skipped, as it would otherwise shift all the following ones
+    for (std::size_t i = 0; i + 2 < submeshIndices.size(); i += 3) {
+      indices.push_back(submeshIndices[i] + indexOffset);
+      indices.push_back(submeshIndices[i + 1] + indexOffset);
+      indices.push_back(submeshIndices[i + 2] + indexOffset);
+    }
+  }
+}
+
+/// Computes the point of a segment at a given coordinate along an axis.
+Vec3f interpolateAlong(const Vec3f& segmentStart, const Vec3f& segmentEnd, std::size_t axis, float coordinate) {
+  const float ratio = (coordinate - segmentStart[axis]) / (segmentEnd[axis] - segmentStart[axis]);
+  return segmentStart + (segmentEnd - segmentStart) * ratio;
+}
+
+} // namespace
+
+void NavMesh::build(const Mesh& mesh, const NavMeshSettings& settings) {
+  std::vector<Vertex> vertices;
+  std::vector<unsigned int> indices;
+  gatherTriangles(mesh, vertices, indices);
+
+  build(vertices, indices, settings);
+}
+
+void NavMesh::build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const NavMeshSettings& settings) {
+  m_settings = settings;
+  m_tiles.clear();
+  m_tileCountX = 0;
+  m_tileCountZ = 0;
+
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount == 0) {
+    linkTiles({});
+    return;
+  }
+
+  Vec3f minBounds = vertices[indices.front()].position;
+  Vec3f maxBounds = minBounds;
+
+  for (std::size_t i = 0; i < triangleCount * 3; ++i) {
+    const Vec3f& position = vertices[indices[i]].position;
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minBounds[axis] = std::min(minBounds[axis], position[axis]);
+      maxBounds[axis] = std::max(maxBounds[axis], position[axis]);
+    }
+  }
+
+  const float tileSize = m_settings.cellSize * static_cast<float>(m_settings.tileCellCount);
+
+  m_minBounds  = minBounds;
+  m_tileCountX = std::max(static_cast<std::size_t>(std::ceil((maxBounds[0] - minBounds[0]) / tileSize)), static_cast<std::size_t>(1));
+  m_tileCountZ = std::max(static_cast<std::size_t>(std::ceil((maxBounds[2] - minBounds[2]) / tileSize)), static_cast<std::size_t>(1));
+  m_tiles.resize(m_tileCountX * m_tileCountZ);
+
+  std::vector<std::size_t> tileIndices(m_tiles.size());
+  std::iota(tileIndices.begin(), tileIndices.end(), 0);
+
+  buildTiles(vertices, indices, tileIndices);
+  linkTiles(tileIndices);
+}
+
+std::size_t NavMesh::rebuild(const Mesh& mesh, const AABB& area) {
+  std::vector<Vertex> vertices;
+  std::vector<unsigned int> indices;
+  gatherTriangles(mesh, vertices, indices);
+
+  return rebuild(vertices, indices, area);
+}
+
+std::size_t NavMesh::rebuild(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const AABB& area) {
+  if (m_tiles.empty())
+    return 0;
+
+  // A tile is affected if the area overlaps it or its border, which is rasterized with it
+  const TileConfig config = computeTileConfig(m_settings);
+  const float tileSize    = m_settings.cellSize * static_cast<float>(m_settings.tileCellCount);
+  const float borderSize  = m_settings.cellSize * static_cast<float>(config.borderSize);
+
+  const Vec3f& areaMin = area.getLeftBottomBackPos();
+  const Vec3f& areaMax = area.getRightTopFrontPos();
+
+  const int firstTileX = static_cast<int>(std::floor((areaMin[0] - borderSize - m_minBounds[0]) / tileSize));
+  const int lastTileX  = static_cast<int>(std::floor((areaMax[0] + borderSize - m_minBounds[0]) / tileSize));
+  const int firstTileZ = static_cast<int>(std::floor((areaMin[2] - borderSize - m_minBounds[2]) / tileSize));
+  const int lastTileZ  = static_cast<int>(std::floor((areaMax[2] + borderSize - m_minBounds[2]) / tileSize));
+
+  std::vector<std::size_t> tileIndices;
+
+  for (int tileZ = std::max(firstTileZ, 0); tileZ <= std::min(lastTileZ, static_cast<int>(m_tileCountZ) - 1); ++tileZ) {
+    for (int tileX = std::max(firstTileX, 0); tileX <= std::min(lastTileX, static_cast<int>(m_tileCountX) - 1); ++tileX)
+      tileIndices.push_back(static_cast<std::size_t>(tileZ) * m_tileCountX + static_cast<std::size_t>(tileX));
+  }
+
+  if (tileIndices.empty())
+    return 0;
+
+  buildTiles(vertices, indices, tileIndices);
+  linkTiles(tileIndices);
+
+  return tileIndices.size();
+}
+
+std::vector<Vec3f> NavMesh::computePolygonVertices(std::size_t polygonIndex) const {
+  assert("Error: The polygon index is out of the navigation mesh's bounds." && polygonIndex < getPolygonCount());
+
+  const auto tileIter = std::upper_bound(m_tilePolygonOffsets.cbegin(), m_tilePolygonOffsets.cend(), polygonIndex) - 1;
+  const Tile& tile = m_tiles[static_cast<std::size_t>(tileIter - m_tilePolygonOffsets.cbegin())];
+  const Polygon& polygon = tile.polygons[polygonIndex - *tileIter];
+
+  std::vector<Vec3f> vertices;
+  vertices.reserve(polygon.vertexCount);
+
+  for (std::size_t i = 0; i < polygon.vertexCount; ++i)
+    vertices.push_back(tile.vertices[polygon.vertexIndices[i]]);
+
+  return vertices;
+}
+
+void NavMesh::buildTiles(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<std::size_t>& tileIndices) {
+  const TileConfig baseConfig = computeTileConfig(m_settings);
+  const float tileSize   = m_settings.cellSize * static_cast<float>(m_settings.tileCellCount);
+  const float borderSize = m_settings.cellSize * static_cast<float>(baseConfig.borderSize);
+  const std::size_t triangleCount = indices.size() / 3;
+
+  std::vector<std::size_t> tileSlots(m_tiles.size(), NoSlot);
+
+  for (std::size_t slotIndex = 0; slotIndex < tileIndices.size(); ++slotIndex)
+    tileSlots[tileIndices[slotIndex]] = slotIndex;
+
+  // Triangles are binned into the tiles to be built whose bounds, border included, they overlap; they are counted first, then stored
+  std::vector<std::size_t> triangleOffsets(tileIndices.size() + 1, 0);
+
+  const auto forEachTriangleTile = [&] (std::size_t triangleIndex, const auto& action) {
+    const Vec3f& firstPos  = vertices[indices[triangleIndex * 3]].position;
+    const Vec3f& secondPos = vertices[indices[triangleIndex * 3 + 1]].position;
+    const Vec3f& thirdPos  = vertices[indices[triangleIndex * 3 + 2]].position;
+
+    const float minX = std::min({ firstPos[0], secondPos[0], thirdPos[0] }) - borderSize - m_minBounds[0];
+    const float maxX = std::max({ firstPos[0], secondPos[0], thirdPos[0] }) + borderSize - m_minBounds[0];
+    const float minZ = std::min({ firstPos[2], secondPos[2], thirdPos[2] }) - borderSize - m_minBounds[2];
+    const float maxZ = std::max({ firstPos[2], secondPos[2], thirdPos[2] }) + borderSize - m_minBounds[2];
+
+    const int firstTileX = std::max(static_cast<int>(std::floor(minX / tileSize)), 0);
+    const int lastTileX  = std::min(static_cast<int>(std::floor(maxX / tileSize)), static_cast<int>(m_tileCountX) - 1);
+    const int firstTileZ = std::max(static_cast<int>(std::floor(minZ / tileSize)), 0);
+    const int lastTileZ  = std::min(static_cast<int>(std::floor(maxZ / tileSize)), static_cast<int>(m_tileCountZ) - 1);
+
+    for (int tileZ = firstTileZ; tileZ <= lastTileZ; ++tileZ) {
+      for (int tileX = firstTileX; tileX <= lastTileX; ++tileX) {
+        const std::size_t slotIndex = tileSlots[static_cast<std::size_t>(tileZ) * m_tileCountX + static_cast<std::size_t>(tileX)];
+
+        if (slotIndex != NoSlot)
+          action(slotIndex);
+      }
+    }
+  };
+
+  for (std::size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+    forEachTriangleTile(triangleIndex, [&triangleOffsets] (std::size_t slotIndex) { ++triangleOffsets[slotIndex + 1]; });
+
+  std::partial_sum(triangleOffsets.begin(), triangleOffsets.end(), triangleOffsets.begin());
+
+  std::vector<std::uint32_t> tileTriangles(triangleOffsets[tileIndices.size()]);
+
+  std::vector<std::size_t> slotCursors(triangleOffsets.cbegin(), triangleOffsets.cend() - 1);
+
+  for (std::size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+    forEachTriangleTile(triangleIndex, [&tileTriangles, &slotCursors, triangleIndex] (std::size_t slotIndex) {
+      tileTriangles[slotCursors[slotIndex]++] = static_cast<std::uint32_t>(triangleIndex);
+    });
+  }
+
+  // The cost of a tile varies a lot with its geometry; each thread thus fetches the next tile to be built
+  const unsigned int threadCount = Threading::getSystemThreadCount();
+
+  // Each thread reuses its own spans from a tile to the next
+  std::vector<std::vector<RasterSpan>> threadRasterSpans(threadCount);
+
+  Threading::parallelizeDynamic(tileIndices.size(), [&] (std::size_t slotIndex, std::size_t threadIndex) {
+    const std::size_t tileIndex = tileIndices[slotIndex];
+    const auto tileX = static_cast<int>(tileIndex % m_tileCountX);
+    const auto tileZ = static_cast<int>(tileIndex / m_tileCountX);
+    const int tileCellCount = static_cast<int>(m_settings.tileCellCount);
+
+    TileConfig config = baseConfig;
+    config.minBounds  = m_minBounds + Vec3f({ static_cast<float>(tileX * tileCellCount - config.borderSize) * config.cellSize,
+                                              0.f,
+                                              static_cast<float>(tileZ * tileCellCount - config.borderSize) * config.cellSize });
+
+    std::vector<RasterSpan>& rasterSpans = threadRasterSpans[threadIndex];
+    rasterSpans.clear();
+
+    for (std::size_t i = triangleOffsets[slotIndex]; i < triangleOffsets[slotIndex + 1]; ++i) {
+      const std::size_t triangleIndex = tileTriangles[i];
+      rasterizeTriangle(vertices[indices[triangleIndex * 3]].position,
+                        vertices[indices[triangleIndex * 3 + 1]].position,
+                        vertices[indices[triangleIndex * 3 + 2]].position,
+                        config, rasterSpans);
+    }
+
+    m_tiles[tileIndex] = buildTile(rasterSpans, config);
+  }, threadCount);
+}
+
+void NavMesh::linkTiles(const std::vector<std::size_t>& rebuiltTileIndices) {
+  // The links of the rebuilt tiles' direct neighbors may lead into the rebuilt tiles; these are relinked as well
+  std::vector<std::uint8_t> rebuiltTiles(m_tiles.size(), 0);
+  std::vector<std::uint8_t> relinkedTiles(m_tiles.size(), 0);
+
+  for (const std::size_t tileIndex : rebuiltTileIndices) {
+    rebuiltTiles[tileIndex]  = 1;
+    relinkedTiles[tileIndex] = 1;
+
+    for (std::size_t side = 0; side < 4; ++side) {
+      const int neighborTileX = static_cast<int>(tileIndex % m_tileCountX) + DirectionOffsetsX[side];
+      const int neighborTileZ = static_cast<int>(tileIndex / m_tileCountX) + DirectionOffsetsZ[side];
+
+      if (neighborTileX < 0 || neighborTileZ < 0 || neighborTileX >= static_cast<int>(m_tileCountX) || neighborTileZ >= static_cast<int>(m_tileCountZ))
+        continue;
+
+      relinkedTiles[static_cast<std::size_t>(neighborTileZ) * m_tileCountX + static_cast<std::size_t>(neighborTileX)] = 1;
+    }
+  }
+
+  // The other tiles' polygons & links are kept, only being moved as the rebuilt tiles' polygon counts may have changed
+  const std::vector<std::uint32_t> prevPolygonOffsets = std::move(m_tilePolygonOffsets);
+  const std::vector<Vec3f> prevPolygonCenters         = std::move(m_polygonCenters);
+  const std::vector<Vec3f> prevPolygonMinBounds       = std::move(m_polygonMinBounds);
+  const std::vector<Vec3f> prevPolygonMaxBounds       = std::move(m_polygonMaxBounds);
+  const std::vector<std::uint32_t> prevLinkOffsets    = std::move(m_linkOffsets);
+  const std::vector<Link> prevLinks                   = std::move(m_links);
+
+  m_tilePolygonOffsets.assign(m_tiles.size() + 1, 0);
+
+  for (std::size_t tileIndex = 0; tileIndex < m_tiles.size(); ++tileIndex)
+    m_tilePolygonOffsets[tileIndex + 1] = m_tilePolygonOffsets[tileIndex] + static_cast<std::uint32_t>(m_tiles[tileIndex].polygons.size());
+
+  const std::size_t polygonCount = m_tilePolygonOffsets.back();
+
+  m_polygonCenters.resize(polygonCount);
+  m_polygonMinBounds.resize(polygonCount);
+  m_polygonMaxBounds.resize(polygonCount);
+
+  Threading::parallelize(0, m_tiles.size(), [&] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t tileIndex = beginIndex; tileIndex < endIndex; ++tileIndex) {
+      const Tile& tile = m_tiles[tileIndex];
+
+      if (rebuiltTiles[tileIndex] == 0) {
+        const std::size_t prevOffset = prevPolygonOffsets[tileIndex];
+        const std::size_t offset     = m_tilePolygonOffsets[tileIndex];
+
+        std::copy_n(prevPolygonCenters.cbegin() + prevOffset, tile.polygons.size(), m_polygonCenters.begin() + offset);
+        std::copy_n(prevPolygonMinBounds.cbegin() + prevOffset, tile.polygons.size(), m_polygonMinBounds.begin() + offset);
+        std::copy_n(prevPolygonMaxBounds.cbegin() + prevOffset, tile.polygons.size(), m_polygonMaxBounds.begin() + offset);
+        continue;
+      }
+
+      for (std::size_t polygonIndex = 0; polygonIndex < tile.polygons.size(); ++polygonIndex) {
+        const Polygon& polygon = tile.polygons[polygonIndex];
+        const std::size_t globalIndex = m_tilePolygonOffsets[tileIndex] + polygonIndex;
+
+        Vec3f center;
+        Vec3f minBounds = tile.vertices[polygon.vertexIndices[0]];
+        Vec3f maxBounds = minBounds;
+
+        for (std::size_t i = 0; i < polygon.vertexCount; ++i) {
+          const Vec3f& vertex = tile.vertices[polygon.vertexIndices[i]];
+          center += vertex;
+
+          for (std::size_t axis = 0; axis < 3; ++axis) {
+            minBounds[axis] = std::min(minBounds[axis], vertex[axis]);
+            maxBounds[axis] = std::max(maxBounds[axis], vertex[axis]);
+          }
+        }
+
+        m_polygonCenters[globalIndex]   = center / static_cast<float>(polygon.vertexCount);
+        m_polygonMinBounds[globalIndex] = minBounds;
+        m_polygonMaxBounds[globalIndex] = maxBounds;
+      }
+    }
+  });
+
+  // The links are counted to know where each polygon's ones must be written, then written in parallel
+  m_linkOffsets.assign(polygonCount + 1, 0);
+
+  Threading::parallelize(0, m_tiles.size(), [&] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t tileIndex = beginIndex; tileIndex < endIndex; ++tileIndex) {
+      for (std::size_t polygonIndex = 0; polygonIndex < m_tiles[tileIndex].polygons.size(); ++polygonIndex) {
+        std::uint32_t linkCount = 0;
+
+        if (relinkedTiles[tileIndex] != 0) {
+          forEachLink(tileIndex, polygonIndex, [&linkCount] (const Link&) { ++linkCount; });
+        } else {
+          const std::size_t prevIndex = prevPolygonOffsets[tileIndex] + polygonIndex;
+          linkCount = prevLinkOffsets[prevIndex + 1] - prevLinkOffsets[prevIndex];
+        }
+
+        m_linkOffsets[m_tilePolygonOffsets[tileIndex] + polygonIndex + 1] = linkCount;
+      }
+    }
+  });
+
+  std::partial_sum(m_linkOffsets.begin(), m_linkOffsets.end(), m_linkOffsets.begin());
+
+  m_links.resize(m_linkOffsets.back());
+
+  Threading::parallelize(0, m_tiles.size(), [&] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t tileIndex = beginIndex; tileIndex < endIndex; ++tileIndex) {
+      for (std::size_t polygonIndex = 0; polygonIndex < m_tiles[tileIndex].polygons.size(); ++polygonIndex) {
+        std::uint32_t linkIndex = m_linkOffsets[m_tilePolygonOffsets[tileIndex] + polygonIndex];
+
+        if (relinkedTiles[tileIndex] != 0) {
+          forEachLink(tileIndex, polygonIndex, [this, &linkIndex] (const Link& link) { m_links[linkIndex++] = link; });
+          continue;
+        }
+
+        // A kept link leads to a polygon of a tile which has not been rebuilt either, whose index only has to be shifted
+        const std::size_t prevIndex = prevPolygonOffsets[tileIndex] + polygonIndex;
+
+        for (std::uint32_t prevLinkIndex = prevLinkOffsets[prevIndex]; prevLinkIndex < prevLinkOffsets[prevIndex + 1]; ++prevLinkIndex) {
+          Link link = prevLinks[prevLinkIndex];
+
+          const auto targetTileIter = std::upper_bound(prevPolygonOffsets.cbegin(), prevPolygonOffsets.cend(), link.polygonIndex) - 1;
+          const auto targetTileIndex = static_cast<std::size_t>(targetTileIter - prevPolygonOffsets.cbegin());
+          link.polygonIndex = link.polygonIndex - *targetTileIter + m_tilePolygonOffsets[targetTileIndex];
+
+          m_links[linkIndex++] = link;
+        }
+      }
+    }
+  });
+}
+
+template <typename LinkFunc>
+void NavMesh::forEachLink(std::size_t tileIndex, std::size_t polygonIndex, LinkFunc&& linkFunc) const {
+  const Tile& tile = m_tiles[tileIndex];
+  const Polygon& polygon = tile.polygons[polygonIndex];
+  const Vec3f& center = m_polygonCenters[m_tilePolygonOffsets[tileIndex] + polygonIndex];
+
+  // The portal's ends are ordered as seen from the polygon's center
+  const auto makeLink = [&center] (std::uint32_t neighborIndex, const Vec3f& firstPos, const Vec3f& secondPos) {
+    const float area = (firstPos[2] - center[2]) * (secondPos[0] - center[0]) - (firstPos[0] - center[0]) * (secondPos[2] - center[2]);
+    return (area > 0.f ? Link{ neighborIndex, firstPos, secondPos } : Link{ neighborIndex, secondPos, firstPos });
+  };
+
+  for (std::size_t edgeIndex = 0; edgeIndex < polygon.vertexCount; ++edgeIndex) {
+    const std::uint32_t neighbor = polygon.neighbors[edgeIndex];
+
+    if (neighbor == NoNeighbor)
+      continue;
+
+    const Vec3f& edgeStart = tile.vertices[polygon.vertexIndices[edgeIndex]];
+    const Vec3f& edgeEnd   = tile.vertices[polygon.vertexIndices[(edgeIndex + 1) % polygon.vertexCount]];
+
+    if ((neighbor & ExternalEdge) == 0) {
+      linkFunc(makeLink(m_tilePolygonOffsets[tileIndex] + neighbor, edgeStart, edgeEnd));
+      continue;
+    }
+
+    // An edge on the tile's side is connected to the polygons of the neighboring tile whose edges on the opposite side overlap it
+    const std::size_t side = neighbor & 3u;
+    const int neighborTileX = static_cast<int>(tileIndex % m_tileCountX) + DirectionOffsetsX[side];
+    const int neighborTileZ = static_cast<int>(tileIndex / m_tileCountX) + DirectionOffsetsZ[side];
+
+    if (neighborTileX < 0 || neighborTileZ < 0 || neighborTileX >= static_cast<int>(m_tileCountX) || neighborTileZ >= static_cast<int>(m_tileCountZ))
+      continue;
+
+    const std::size_t neighborTileIndex = static_cast<std::size_t>(neighborTileZ) * m_tileCountX + static_cast<std::size_t>(neighborTileX);
+    const Tile& neighborTile = m_tiles[neighborTileIndex];
+    const std::uint32_t oppositeEdge = ExternalEdge | static_cast<std::uint32_t>((side + 2) % 4);
+
+    // Sides along X lie on a constant X & span Z, & conversely
+    const std::size_t tangentAxis = (side % 2 == 0 ? 2 : 0);
+    const float edgeMin = std::min(edgeStart[tangentAxis], edgeEnd[tangentAxis]);
+    const float edgeMax = std::max(edgeStart[tangentAxis], edgeEnd[tangentAxis]);
+    const float minOverlap = m_settings.cellSize * 0.5f;
+
+    for (std::size_t neighborIndex = 0; neighborIndex < neighborTile.polygons.size(); ++neighborIndex) {
+      const Polygon& neighborPolygon = neighborTile.polygons[neighborIndex];
+
+      for (std::size_t neighborEdgeIndex = 0; neighborEdgeIndex < neighborPolygon.vertexCount; ++neighborEdgeIndex) {
+        if (neighborPolygon.neighbors[neighborEdgeIndex] != oppositeEdge)
+          continue;
+
+        const Vec3f& neighborStart = neighborTile.vertices[neighborPolygon.vertexIndices[neighborEdgeIndex]];
+        const Vec3f& neighborEnd   = neighborTile.vertices[neighborPolygon.vertexIndices[(neighborEdgeIndex + 1) % neighborPolygon.vertexCount]];
+
+        const float overlapMin = std::max(edgeMin, std::min(neighborStart[tangentAxis], neighborEnd[tangentAxis]));
+        const float overlapMax = std::min(edgeMax, std::max(neighborStart[tangentAxis], neighborEnd[tangentAxis]));
+
+        if (overlapMax - overlapMin < minOverlap)
+          continue;
+
+        const Vec3f portalStart = interpolateAlong(edgeStart, edgeEnd, tangentAxis, overlapMin);
+        const Vec3f portalEnd   = interpolateAlong(edgeStart, edgeEnd, tangentAxis, overlapMax);
+
+        // Edges at the same horizontal position may belong to different floors
+        if (std::abs(interpolateAlong(neighborStart, neighborEnd, tangentAxis, overlapMin)[1] - portalStart[1]) > m_settings.agentMaxClimb
+         || std::abs(interpolateAlong(neighborStart, neighborEnd, tangentAxis, overlapMax)[1] - portalEnd[1]) > m_settings.agentMaxClimb)
+          continue;
+
+        linkFunc(makeLink(m_tilePolygonOffsets[neighborTileIndex] + static_cast<std::uint32_t>(neighborIndex), portalStart, portalEnd));
+      }
+    }
+  }
+}
+
+} // namespace Raz
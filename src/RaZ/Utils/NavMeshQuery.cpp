@@ -0,0 +1,340 @@
+#include "RaZ/Utils/NavMesh.hpp"
+#include "RaZ/Utils/NavMeshQuery.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+/// Computes twice the signed area of a triangle projected on the horizontal plane, positive if it is counter-clockwise when seen from above.
+float computeArea(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos) {
+  return (secondPos[2] - firstPos[2]) * (thirdPos[0] - firstPos[0]) - (secondPos[0] - firstPos[0]) * (thirdPos[2] - firstPos[2]);
+}
+
+/// Straightens a path through a sequence of portals with the "simple stupid funnel algorithm" by Mikko Mononen.
+/// \param portals Left & right ends of the portals, the first & last ones being the path's start & end.
+/// \param path Corners of the path, from start to end.
+void pullString(const std::vector<std::pair<Vec3f, Vec3f>>& portals, std::vector<Vec3f>& path) {
+  Vec3f apexPos  = portals.front().first;
+  Vec3f leftPos  = apexPos;
+  Vec3f rightPos = apexPos;
+  std::size_t apexIndex  = 0;
+  std::size_t leftIndex  = 0;
+  std::size_t rightIndex = 0;
+
+  path.push_back(apexPos);
+
+  const auto restartFrom = [&] (const Vec3f& cornerPos, std::size_t cornerIndex) {
+    apexPos   = cornerPos;
+    apexIndex = cornerIndex;
+
+    if (!(path.back() == apexPos))
+      path.push_back(apexPos);
+
+    leftPos    = apexPos;
+    rightPos   = apexPos;
+    leftIndex  = apexIndex;
+    rightIndex = apexIndex;
+  };
+
+  for (std::size_t portalIndex = 1; portalIndex < portals.size(); ++portalIndex) {
+    const Vec3f& portalLeft  = portals[portalIndex].first;
+    const Vec3f& portalRight = portals[portalIndex].second;
+
+    // The funnel's right side is tightened, unless it then crosses the left one: the left end becomes a corner, from which the funnel restarts
+    if (computeArea(apexPos, rightPos, portalRight) <= 0.f) {
+      if (apexPos == rightPos || computeArea(apexPos, leftPos, portalRight) > 0.f) {
+        rightPos   = portalRight;
+        rightIndex = portalIndex;
+      } else {
+        restartFrom(leftPos, leftIndex);
+        portalIndex = apexIndex;
+        continue;
+      }
+    }
+
+    // Likewise for the left side
+    if (computeArea(apexPos, leftPos, portalLeft) >= 0.f) {
+      if (apexPos == leftPos || computeArea(apexPos, rightPos, portalLeft) < 0.f) {
+        leftPos   = portalLeft;
+        leftIndex = portalIndex;
+      } else {
+        restartFrom(rightPos, rightIndex);
+        portalIndex = apexIndex;
+        continue;
+      }
+    }
+  }
+
+  if (!(path.back() == portals.back().first))
+    path.push_back(portals.back().first);
+}
+
+} // namespace
+
+std::size_t NavMeshQuery::findClosestPolygon(const Vec3f& position, Vec3f& closestPos) const {
+  const NavMesh& navMesh = *m_navMesh;
+  const std::size_t polygonCount = navMesh.getPolygonCount();
+
+  if (navMesh.m_tiles.empty())
+    return polygonCount;
+
+  const float tileSize = navMesh.m_settings.cellSize * static_cast<float>(navMesh.m_settings.tileCellCount);
+  const int maxTileX   = static_cast<int>(navMesh.m_tileCountX) - 1;
+  const int maxTileZ   = static_cast<int>(navMesh.m_tileCountZ) - 1;
+  const int tileX      = std::min(std::max(static_cast<int>(std::floor((position[0] - navMesh.m_minBounds[0]) / tileSize)), 0), maxTileX);
+  const int tileZ      = std::min(std::max(static_cast<int>(std::floor((position[2] - navMesh.m_minBounds[2]) / tileSize)), 0), maxTileZ);
+
+  std::size_t closestPolygon = polygonCount;
+  float minSqDist = std::numeric_limits<float>::max();
+
+  for (int neighborZ = std::max(tileZ - 1, 0); neighborZ <= std::min(tileZ + 1, maxTileZ); ++neighborZ) {
+    for (int neighborX = std::max(tileX - 1, 0); neighborX <= std::min(tileX + 1, maxTileX); ++neighborX) {
+      const std::size_t tileIndex = static_cast<std::size_t>(neighborZ) * navMesh.m_tileCountX + static_cast<std::size_t>(neighborX);
+      const NavMesh::Tile& tile = navMesh.m_tiles[tileIndex];
+
+      for (std::size_t polygonIndex = 0; polygonIndex < tile.polygons.size(); ++polygonIndex) {
+        const std::size_t globalIndex = navMesh.m_tilePolygonOffsets[tileIndex] + polygonIndex;
+
+        // Polygons whose bounding box is farther than the closest point found so far are skipped
+        float boxSqDist = 0.f;
+
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+          const float dist = std::max({ navMesh.m_polygonMinBounds[globalIndex][axis] - position[axis],
+                                        position[axis] - navMesh.m_polygonMaxBounds[globalIndex][axis],
+                                        0.f });
+          boxSqDist += dist * dist;
+        }
+
+        if (boxSqDist >= minSqDist)
+          continue;
+
+        const NavMesh::Polygon& polygon = tile.polygons[polygonIndex];
+        const Vec3f& firstPos = tile.vertices[polygon.vertexIndices[0]];
+
+        for (std::size_t i = 1; i + 1 < polygon.vertexCount; ++i) {
+          const Vec3f projectedPos = Triangle(firstPos, tile.vertices[polygon.vertexIndices[i]], tile.vertices[polygon.vertexIndices[i + 1]]).computeProjection(position);
+          const float sqDist = (projectedPos - position).computeSquaredLength();
+
+          if (sqDist < minSqDist) {
+            minSqDist      = sqDist;
+            closestPolygon = globalIndex;
+            closestPos     = projectedPos;
+          }
+        }
+      }
+    }
+  }
+
+  return closestPolygon;
+}
+
+bool NavMeshQuery::findPolygonPath(std::size_t startPolygon, const Vec3f& startPos, std::size_t endPolygon, const Vec3f& endPos,
+                                   std::vector<std::size_t>& polygonPath) {
+  assert("Error: The polygon indices are out of the navigation mesh's bounds."
+      && startPolygon < m_navMesh->getPolygonCount() && endPolygon < m_navMesh->getPolygonCount());
+
+  polygonPath.clear();
+
+  if (!searchLinks(static_cast<std::uint32_t>(startPolygon), startPos, static_cast<std::uint32_t>(endPolygon), endPos))
+    return false;
+
+  polygonPath.reserve(m_pathLinks.size() + 1);
+  polygonPath.push_back(startPolygon);
+
+  for (const std::uint32_t linkIndex : m_pathLinks)
+    polygonPath.push_back(m_navMesh->m_links[linkIndex].polygonIndex);
+
+  return true;
+}
+
+bool NavMeshQuery::findPath(const Vec3f& startPos, const Vec3f& endPos, std::vector<Vec3f>& path) {
+  path.clear();
+
+  Vec3f closestStartPos;
+  Vec3f closestEndPos;
+  const std::size_t startPolygon = findClosestPolygon(startPos, closestStartPos);
+  const std::size_t endPolygon   = findClosestPolygon(endPos, closestEndPos);
+  const std::size_t polygonCount = m_navMesh->getPolygonCount();
+
+  if (startPolygon == polygonCount || endPolygon == polygonCount)
+    return false;
+
+  if (!searchLinks(static_cast<std::uint32_t>(startPolygon), closestStartPos, static_cast<std::uint32_t>(endPolygon), closestEndPos))
+    return false;
+
+  m_portals.clear();
+  m_portals.emplace_back(closestStartPos, closestStartPos);
+
+  for (const std::uint32_t linkIndex : m_pathLinks)
+    m_portals.emplace_back(m_navMesh->m_links[linkIndex].leftPos, m_navMesh->m_links[linkIndex].rightPos);
+
+  m_portals.emplace_back(closestEndPos, closestEndPos);
+
+  pullString(m_portals, path);
+
+  return true;
+}
+
+bool NavMeshQuery::searchLinks(std::uint32_t startPolygon, const Vec3f& startPos, std::uint32_t endPolygon, const Vec3f& endPos) {
+  m_pathLinks.clear();
+
+  if (startPolygon == endPolygon)
+    return true;
+
+  const NavMesh& navMesh = *m_navMesh;
+
+  // The navigation mesh may have been rebuilt since the last search
+  if (m_nodes.size() != navMesh.getPolygonCount()) {
+    m_nodes.assign(navMesh.getPolygonCount(), Node());
+    m_searchIndex = 0;
+  }
+
+  // Nodes are not reset between searches, but tagged with the index of the search reaching them; they must be reset when the index wraps around
+  if (++m_searchIndex == 0) {
+    for (Node& node : m_nodes)
+      node.searchIndex = 0;
+
+    m_searchIndex = 1;
+  }
+
+  m_openHeap.clear();
+
+  Node& startNode = m_nodes[startPolygon];
+  startNode.position      = startPos;
+  startNode.cost          = 0.f;
+  startNode.totalCost     = (endPos - startPos).computeLength();
+  startNode.parentPolygon = startPolygon;
+  startNode.searchIndex   = m_searchIndex;
+  pushOpenNode(startPolygon);
+
+  while (!m_openHeap.empty()) {
+    const std::uint32_t polygonIndex = popOpenNode();
+
+    if (polygonIndex == endPolygon) {
+      for (std::uint32_t pathPolygon = endPolygon; pathPolygon != startPolygon; pathPolygon = m_nodes[pathPolygon].parentPolygon)
+        m_pathLinks.push_back(m_nodes[pathPolygon].parentLink);
+
+      std::reverse(m_pathLinks.begin(), m_pathLinks.end());
+      return true;
+    }
+
+    const Vec3f nodePos  = m_nodes[polygonIndex].position;
+    const float nodeCost  = m_nodes[polygonIndex].cost;
+
+    for (std::uint32_t linkIndex = navMesh.m_linkOffsets[polygonIndex]; linkIndex < navMesh.m_linkOffsets[polygonIndex + 1]; ++linkIndex) {
+      const NavMesh::Link& link = navMesh.m_links[linkIndex];
+      const Vec3f neighborPos = (link.leftPos + link.rightPos) * 0.5f;
+
+      float cost      = nodeCost + (neighborPos - nodePos).computeLength();
+      float heuristic = (endPos - neighborPos).computeLength();
+
+      // The end polygon's cost includes the remaining distance to the end itself, which is exact
+      if (link.polygonIndex == endPolygon) {
+        cost      += heuristic;
+        heuristic  = 0.f;
+      }
+
+      Node& neighborNode = m_nodes[link.polygonIndex];
+      const bool isVisited = (neighborNode.searchIndex == m_searchIndex);
+
+      // Nodes are compared by their cost only: as their position depends on the portal they are entered through, comparing their total costs
+      //   could make a node the parent of its own ancestor
+      if (isVisited && cost >= neighborNode.cost)
+        continue;
+
+      neighborNode.position      = neighborPos;
+      neighborNode.cost          = cost;
+      neighborNode.totalCost     = cost + heuristic;
+      neighborNode.parentPolygon = polygonIndex;
+      neighborNode.parentLink    = linkIndex;
+      neighborNode.searchIndex   = m_searchIndex;
+
+      if (isVisited && neighborNode.isOpen)
+        moveUpOpenNode(neighborNode.heapIndex);
+      else
+        pushOpenNode(link.polygonIndex);
+    }
+  }
+
+  return false;
+}
+
+void NavMeshQuery::pushOpenNode(std::uint32_t polygonIndex) {
+  Node& node = m_nodes[polygonIndex];
+  node.isOpen    = true;
+  node.heapIndex = static_cast<std::uint32_t>(m_openHeap.size());
+
+  m_openHeap.push_back(polygonIndex);
+  moveUpOpenNode(node.heapIndex);
+}
+
+std::uint32_t NavMeshQuery::popOpenNode() {
+  const std::uint32_t polygonIndex = m_openHeap.front();
+  m_nodes[polygonIndex].isOpen = false;
+
+  m_openHeap.front() = m_openHeap.back();
+  m_openHeap.pop_back();
+
+  if (!m_openHeap.empty()) {
+    m_nodes[m_openHeap.front()].heapIndex = 0;
+    moveDownOpenNode(0);
+  }
+
+  return polygonIndex;
+}
+
+void NavMeshQuery::moveUpOpenNode(std::uint32_t heapIndex) {
+  const std::uint32_t polygonIndex = m_openHeap[heapIndex];
+  const float totalCost = m_nodes[polygonIndex].totalCost;
+
+  while (heapIndex > 0) {
+    const std::uint32_t parentIndex = (heapIndex - 1) / 2;
+    const std::uint32_t parentPolygon = m_openHeap[parentIndex];
+
+    if (m_nodes[parentPolygon].totalCost <= totalCost)
+      break;
+
+    m_openHeap[heapIndex] = parentPolygon;
+    m_nodes[parentPolygon].heapIndex = heapIndex;
+    heapIndex = parentIndex;
+  }
+
+  m_openHeap[heapIndex] = polygonIndex;
+  m_nodes[polygonIndex].heapIndex = heapIndex;
+}
+
+void NavMeshQuery::moveDownOpenNode(std::uint32_t heapIndex) {
+  const std::uint32_t polygonIndex = m_openHeap[heapIndex];
+  const float totalCost = m_nodes[polygonIndex].totalCost;
+  const auto heapSize = static_cast<std::uint32_t>(m_openHeap.size());
+
+  while (true) {
+    std::uint32_t childIndex = heapIndex * 2 + 1;
+
+    if (childIndex >= heapSize)
+      break;
+
+    if (childIndex + 1 < heapSize && m_nodes[m_openHeap[childIndex + 1]].totalCost < m_nodes[m_openHeap[childIndex]].totalCost)
+      ++childIndex;
+
+    const std::uint32_t childPolygon = m_openHeap[childIndex];
+
+    if (m_nodes[childPolygon].totalCost >= totalCost)
+      break;
+
+    m_openHeap[heapIndex] = childPolygon;
+    m_nodes[childPolygon].heapIndex = heapIndex;
+    heapIndex = childIndex;
+  }
+
+  m_openHeap[heapIndex] = polygonIndex;
+  m_nodes[polygonIndex].heapIndex = heapIndex;
+}
+
+} // namespace Raz
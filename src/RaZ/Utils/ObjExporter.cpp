@@ -137,8 +137,10 @@ void Mesh::saveObj(std::ofstream& file, const std::string& filePath) const {
   std::map<std::array<float, 2>, std::size_t> texCorrespIndices;
   std::map<std::array<float, 3>, std::size_t> normCorrespIndices;
 
-  for (const auto& submesh : m_submeshes) {
-    for (const auto& vertex : submesh->getVertices()) {
+  for (const SubmeshPtr& submeshPtr : m_submeshes) {
+    const Submesh& submesh = *submeshPtr;
+
+    for (const auto& vertex : submesh.getVertices()) {
       const std::array<float, 3> pos = { vertex.position[0], vertex.position[1], vertex.position[2] };
 
       if (posCorrespIndices.find(pos) == posCorrespIndices.cend()) {
@@ -170,18 +172,18 @@ void Mesh::saveObj(std::ofstream& file, const std::string& filePath) const {
   const auto fileName = FileUtils::extractFileNameFromPath(filePath, false);
 
   for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
-    const auto& submesh = m_submeshes[submeshIndex];
+    const Submesh& submesh = *m_submeshes[submeshIndex];
 
     file << "\no " << fileName << '_' << submeshIndex << '\n';
 
     if (!m_materials.empty())
-      file << "usemtl " << fileName << '_' << submesh->getMaterialIndex() << '\n';
+      file << "usemtl " << fileName << '_' << submesh.getMaterialIndex() << '\n';
 
-    for (std::size_t i = 0; i < submesh->getIndexCount(); i += 3) {
+    for (std::size_t i = 0; i < submesh.getIndexCount(); i += 3) {
       file << "f ";
 
       // First vertex
-      auto vertex = submesh->getVertices()[submesh->getIndices()[i + 1]];
+      auto vertex = submesh.getVertices()[submesh.getIndices()[i + 1]];
 
       std::array<float, 3> pos  = { vertex.position[0], vertex.position[1], vertex.position[2] };
       std::array<float, 2> tex  = { vertex.texcoords[0], vertex.texcoords[1] };
@@ -194,7 +196,7 @@ void Mesh::saveObj(std::ofstream& file, const std::string& filePath) const {
       file << posIndex  << '/' << texIndex  << '/' << normIndex << ' ';
 
       // Second vertex
-      vertex = submesh->getVertices()[submesh->getIndices()[i]];
+      vertex = submesh.getVertices()[submesh.getIndices()[i]];
 
       pos  = { vertex.position[0], vertex.position[1], vertex.position[2] };
       tex  = { vertex.texcoords[0], vertex.texcoords[1] };
@@ -207,7 +209,7 @@ void Mesh::saveObj(std::ofstream& file, const std::string& filePath) const {
       file << posIndex  << '/' << texIndex  << '/' << normIndex << ' ';
 
       // Third vertex
-      vertex = submesh->getVertices()[submesh->getIndices()[i + 2]];
+      vertex = submesh.getVertices()[submesh.getIndices()[i + 2]];
 
       pos  = std::array<float, 3>({ vertex.position[0], vertex.position[1], vertex.position[2] });
       tex  = std::array<float, 2>({ vertex.texcoords[0], vertex.texcoords[1] });
@@ -0,0 +1,151 @@
+#include "RaZ/Math/Batch.hpp"
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Utils/PackUtils.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace Raz {
+
+namespace PackUtils {
+
+void packHalves(const std::vector<float>& values, std::vector<std::uint16_t>& result) {
+  const std::size_t size = values.size();
+  result.resize(size);
+
+  std::size_t index = 0;
+
+#if defined(__F16C__)
+  for (; index + 8 <= size; index += 8) {
+    const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(values.data() + index), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + index), halves);
+  }
+#endif
+
+  for (; index < size; ++index)
+    result[index] = packHalf(values[index]);
+}
+
+void unpackHalves(const std::vector<std::uint16_t>& halves, std::vector<float>& result) {
+  const std::size_t size = halves.size();
+  result.resize(size);
+
+  std::size_t index = 0;
+
+#if defined(__F16C__)
+  for (; index + 8 <= size; index += 8) {
+    const __m128i halfVals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves.data() + index));
+    _mm256_storeu_ps(result.data() + index, _mm256_cvtph_ps(halfVals));
+  }
+#endif
+
+  for (; index < size; ++index)
+    result[index] = unpackHalf(halves[index]);
+}
+
+void packSnorms16(const std::vector<float>& values, std::vector<std::int16_t>& result) {
+  const std::size_t size = values.size();
+  result.resize(size);
+
+  std::size_t index = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+  const __m128 minVals = _mm_set1_ps(-1.f);
+  const __m128 maxVals = _mm_set1_ps(1.f);
+  const __m128 scale   = _mm_set1_ps(32767.f);
+
+  // Processing 8 values at once, so that a whole register of 16-bit integers can be stored
+  for (; index + 8 <= size; index += 8) {
+    const __m128 firstVals  = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(values.data() + index), minVals), maxVals), scale);
+    const __m128 secondVals = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(values.data() + index + 4), minVals), maxVals), scale);
+
+    // The conversion rounds to nearest (ties to even) like std::nearbyint(); values being clamped, the saturating pack never saturates
+    const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(firstVals), _mm_cvtps_epi32(secondVals));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + index), packed);
+  }
+#endif
+
+  for (; index < size; ++index)
+    result[index] = packSnorm16(values[index]);
+}
+
+void unpackSnorms16(const std::vector<std::int16_t>& values, std::vector<float>& result) {
+  const std::size_t size = values.size();
+  result.resize(size);
+
+  std::size_t index = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+  const __m128 minVals = _mm_set1_ps(-1.f);
+  const __m128 divisor = _mm_set1_ps(32767.f);
+
+  for (; index + 8 <= size; index += 8) {
+    const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + index));
+
+    // Sign-extending each 16-bit integer to 32 bits, by interleaving it with itself & arithmetically shifting the result
+    const __m128i firstInts  = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+    const __m128i secondInts = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+
+    _mm_storeu_ps(result.data() + index, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(firstInts), divisor), minVals));
+    _mm_storeu_ps(result.data() + index + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(secondInts), divisor), minVals));
+  }
+#endif
+
+  for (; index < size; ++index)
+    result[index] = unpackSnorm16(values[index]);
+}
+
+void packOctahedrals(const Vec3fArray& normals, std::vector<std::uint32_t>& result) {
+  const std::size_t size = normals.getSize();
+  result.resize(size);
+
+  const float* xValues = normals.getX().data();
+  const float* yValues = normals.getY().data();
+  const float* zValues = normals.getZ().data();
+
+  std::size_t index = 0;
+
+  const Simd::Float zero     = Simd::set(0.f);
+  const Simd::Float one      = Simd::set(1.f);
+  const Simd::Float minusOne = Simd::set(-1.f);
+
+  for (; index + Simd::Width <= size; index += Simd::Width) {
+    const Simd::Float xVals = Simd::load(xValues + index);
+    const Simd::Float yVals = Simd::load(yValues + index);
+    const Simd::Float zVals = Simd::load(zValues + index);
+
+    const Simd::Float l1Norms = Simd::add(Simd::add(Simd::abs(xVals), Simd::abs(yVals)), Simd::abs(zVals));
+    const Simd::Float projX   = Simd::div(xVals, l1Norms);
+    const Simd::Float projY   = Simd::div(yVals, l1Norms);
+
+    const Simd::Float foldedX = Simd::mul(Simd::sub(one, Simd::abs(projY)), Simd::select(Simd::lessThan(projX, zero), minusOne, one));
+    const Simd::Float foldedY = Simd::mul(Simd::sub(one, Simd::abs(projX)), Simd::select(Simd::lessThan(projY, zero), minusOne, one));
+
+    const Simd::Float lowerHemisphere = Simd::lessThan(zVals, zero);
+
+    float encodedX[Simd::Width] {};
+    float encodedY[Simd::Width] {};
+    Simd::store(encodedX, Simd::select(lowerHemisphere, foldedX, projX));
+    Simd::store(encodedY, Simd::select(lowerHemisphere, foldedY, projY));
+
+    for (std::size_t i = 0; i < Simd::Width; ++i) {
+      result[index + i] = static_cast<std::uint32_t>(static_cast<std::uint16_t>(packSnorm16(encodedX[i])))
+                        | static_cast<std::uint32_t>(static_cast<std::uint16_t>(packSnorm16(encodedY[i]))) << 16;
+    }
+  }
+
+  for (; index < size; ++index)
+    result[index] = packOctahedral(Vec3f({ xValues[index], yValues[index], zValues[index] }));
+}
+
+void unpackOctahedrals(const std::vector<std::uint32_t>& packed, Vec3fArray& result) {
+  result.resize(packed.size());
+
+  for (std::size_t index = 0; index < packed.size(); ++index)
+    result.set(index, unpackOctahedral(packed[index]));
+}
+
+} // namespace PackUtils
+
+} // namespace Raz
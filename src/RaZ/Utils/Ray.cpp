@@ -38,12 +38,14 @@ bool Ray::intersects(const Vec3f& point) const {
   return FloatUtils::checkNearEquality(pointDir.dot(m_direction), 1.f);
 }
 
-bool Ray::intersects(const Line&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Line& line) const {
+  RayHit hit;
+  return intersect(line, hit);
 }
 
-bool Ray::intersects(const Plane&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Plane& plane) const {
+  RayHit hit;
+  return intersect(plane, hit);
 }
 
 bool Ray::intersects(const Sphere& sphere) const {
@@ -90,12 +92,12 @@ bool Ray::intersects(const Triangle& triangle) const {
   return (hitDist > 0.f);
 }
 
-bool Ray::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Quad& quad) const {
+  RayHit hit;
+  return intersect(quad, hit);
 }
 
 bool Ray::intersects(const AABB& aabb) const {
-  const Vec3f invDir({ 1.f / m_direction[0], 1.f / m_direction[1], 1.f / m_direction[2] });
   Vec3f minPos = aabb.getLeftBottomBackPos();
   Vec3f maxPos = aabb.getRightTopFrontPos();
 
@@ -108,8 +110,8 @@ bool Ray::intersects(const AABB& aabb) const {
   if (m_direction[2] < 0.f)
     std::swap(minPos[2], maxPos[2]);
 
-  const Vec3f minHitPos = (minPos - m_origin) * invDir;
-  const Vec3f maxHitPos = (maxPos - m_origin) * invDir;
+  const Vec3f minHitPos = (minPos - m_origin) * m_invDirection;
+  const Vec3f maxHitPos = (maxPos - m_origin) * m_invDirection;
 
   const float minHitDist = std::max(minHitPos[0], std::max(minHitPos[1], std::max(minHitPos[2], 0.f)));
   const float maxHitDist = std::min(maxHitPos[0], std::min(maxHitPos[1], maxHitPos[2]));
@@ -117,6 +119,208 @@ bool Ray::intersects(const AABB& aabb) const {
   return (minHitDist <= maxHitDist);
 }
 
+bool Ray::intersect(const Line& line, RayHit& hit, float maxDistance) const {
+  // Computing the closest points between the ray & the line, then checking if they are the same
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.9
+  const Vec3f lineDir   = line.getEndPos() - line.getBeginPos();
+  const Vec3f originDir = m_origin - line.getBeginPos();
+
+  const float rayDirSqLength  = m_direction.dot(m_direction);
+  const float lineDirSqLength = lineDir.dot(lineDir);
+  const float dirsAngle       = m_direction.dot(lineDir);
+  const float rayOriginProj   = m_direction.dot(originDir);
+  const float lineOriginProj  = lineDir.dot(originDir);
+
+  float rayDist  = 0.f;
+  float lineDist = 0.f;
+
+  if (lineDirSqLength <= std::numeric_limits<float>::epsilon()) {
+    // The line is degenerate, being a mere point
+    rayDist = std::max(-rayOriginProj / rayDirSqLength, 0.f);
+  } else {
+    const float denominator = rayDirSqLength * lineDirSqLength - dirsAngle * dirsAngle;
+
+    // If both are parallel, any point of the ray can be picked first
+    if (denominator != 0.f)
+      rayDist = std::max((dirsAngle * lineOriginProj - rayOriginProj * lineDirSqLength) / denominator, 0.f);
+
+    lineDist = (dirsAngle * rayDist + lineOriginProj) / lineDirSqLength;
+
+    // If the closest point is outside of the line, it is clamped to its nearest extremity & the ray's one is recomputed
+    if (lineDist < 0.f) {
+      lineDist = 0.f;
+      rayDist  = std::max(-rayOriginProj / rayDirSqLength, 0.f);
+    } else if (lineDist > 1.f) {
+      lineDist = 1.f;
+      rayDist  = std::max((dirsAngle - rayOriginProj) / rayDirSqLength, 0.f);
+    }
+  }
+
+  const Vec3f rayPoint  = m_origin + m_direction * rayDist;
+  const Vec3f linePoint = line.getBeginPos() + lineDir * lineDist;
+
+  if (rayPoint != linePoint || rayDist > maxDistance)
+    return false;
+
+  // The normal is the part of the direction towards the ray's origin which is perpendicular to the line
+  Vec3f normal = m_origin - linePoint;
+
+  if (lineDirSqLength > std::numeric_limits<float>::epsilon())
+    normal -= lineDir * (normal.dot(lineDir) / lineDirSqLength);
+
+  hit.position          = linePoint;
+  hit.normal            = (normal.computeSquaredLength() > std::numeric_limits<float>::epsilon() ? normal.normalize() : -m_direction);
+  hit.distance          = rayDist;
+  hit.barycentricCoords = Vec2f(0.f);
+
+  return true;
+}
+
+bool Ray::intersect(const Plane& plane, RayHit& hit, float maxDistance) const {
+  const float dirAngle = plane.getNormal().dot(m_direction);
+
+  // If the ray is parallel to the plane, there can be no hit
+  if (FloatUtils::checkNearEquality(dirAngle, 0.f))
+    return false;
+
+  const float hitDist = (plane.getDistance() - plane.getNormal().dot(m_origin)) / dirAngle;
+
+  if (hitDist < 0.f || hitDist > maxDistance)
+    return false;
+
+  hit.position          = m_origin + m_direction * hitDist;
+  hit.normal            = plane.getNormal();
+  hit.distance          = hitDist;
+  hit.barycentricCoords = Vec2f(0.f);
+
+  return true;
+}
+
+bool Ray::intersect(const Sphere& sphere, RayHit& hit, float maxDistance) const {
+  const Vec3f sphereDir = m_origin - sphere.getCenter();
+
+  const float raySqLength = m_direction.dot(m_direction);
+  const float rayDiff     = 2.f * m_direction.dot(sphereDir);
+  const float sphereDiff  = sphereDir.computeSquaredLength() - sphere.getRadius() * sphere.getRadius();
+
+  float firstHitDist {}, secondHitDist {};
+
+  if (!solveQuadratic(raySqLength, rayDiff, sphereDiff, firstHitDist, secondHitDist))
+    return false;
+
+  // The first hit being behind the ray's origin, the latter is inside the sphere & the second hit is taken
+  const float hitDist = (firstHitDist >= 0.f ? firstHitDist : secondHitDist);
+
+  if (hitDist < 0.f || hitDist > maxDistance)
+    return false;
+
+  hit.position          = m_origin + m_direction * hitDist;
+  hit.normal            = (hit.position - sphere.getCenter()) / sphere.getRadius();
+  hit.distance          = hitDist;
+  hit.barycentricCoords = Vec2f(0.f);
+
+  return true;
+}
+
+bool Ray::intersect(const Triangle& triangle, RayHit& hit, float maxDistance) const {
+  const Vec3f firstEdge   = triangle.getSecondPos() - triangle.getFirstPos();
+  const Vec3f secondEdge  = triangle.getThirdPos() - triangle.getFirstPos();
+  const Vec3f pVec        = m_direction.cross(secondEdge);
+  const float determinant = firstEdge.dot(pVec);
+
+  if (FloatUtils::checkNearEquality(std::abs(determinant), 0.f))
+    return false;
+
+  const float invDeterm = 1 / determinant;
+
+  const Vec3f invPlaneDir    = m_origin - triangle.getFirstPos();
+  const float firstBaryCoord = invPlaneDir.dot(pVec) * invDeterm;
+
+  if (firstBaryCoord < 0.f || firstBaryCoord > 1.f)
+    return false;
+
+  const Vec3f qVec = invPlaneDir.cross(firstEdge);
+  const float secondBaryCoord = qVec.dot(m_direction) * invDeterm;
+
+  if (secondBaryCoord < 0.f || firstBaryCoord + secondBaryCoord > 1.f)
+    return false;
+
+  const float hitDist = secondEdge.dot(qVec) * invDeterm;
+
+  if (hitDist <= 0.f || hitDist > maxDistance)
+    return false;
+
+  hit.position          = m_origin + m_direction * hitDist;
+  hit.normal            = firstEdge.cross(secondEdge).normalize();
+  hit.distance          = hitDist;
+  hit.barycentricCoords = Vec2f({ firstBaryCoord, secondBaryCoord });
+
+  return true;
+}
+
+bool Ray::intersect(const Quad& quad, RayHit& hit, float maxDistance) const {
+  const Triangle firstTriangle(quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos());
+  const Triangle secondTriangle(quad.getLeftTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos());
+
+  // Both halves cannot be hit at once unless the quad is not planar; the closest hit is kept in that case
+  bool isHit = intersect(firstTriangle, hit, maxDistance);
+  isHit = intersect(secondTriangle, hit, (isHit ? hit.distance : maxDistance)) || isHit;
+
+  if (isHit)
+    hit.barycentricCoords = Vec2f(0.f);
+
+  return isHit;
+}
+
+bool Ray::intersect(const AABB& aabb, RayHit& hit, float maxDistance) const {
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  float entryDist = -std::numeric_limits<float>::max();
+  float exitDist  = std::numeric_limits<float>::max();
+  std::size_t entryAxis = 0;
+  std::size_t exitAxis  = 0;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    float minHitDist = (minPos[axis] - m_origin[axis]) * m_invDirection[axis];
+    float maxHitDist = (maxPos[axis] - m_origin[axis]) * m_invDirection[axis];
+
+    if (minHitDist > maxHitDist)
+      std::swap(minHitDist, maxHitDist);
+
+    if (minHitDist > entryDist) {
+      entryDist = minHitDist;
+      entryAxis = axis;
+    }
+
+    if (maxHitDist < exitDist) {
+      exitDist = maxHitDist;
+      exitAxis = axis;
+    }
+  }
+
+  if (entryDist > exitDist || exitDist < 0.f)
+    return false;
+
+  // If the entry point is behind the ray's origin, the latter is inside the box & the exit point is taken
+  const bool isInside       = (entryDist < 0.f);
+  const float hitDist       = (isInside ? exitDist : entryDist);
+  const std::size_t hitAxis = (isInside ? exitAxis : entryAxis);
+
+  if (hitDist > maxDistance)
+    return false;
+
+  Vec3f normal(0.f);
+  normal[hitAxis] = ((m_direction[hitAxis] < 0.f) != isInside ? 1.f : -1.f);
+
+  hit.position          = m_origin + m_direction * hitDist;
+  hit.normal            = normal;
+  hit.distance          = hitDist;
+  hit.barycentricCoords = Vec2f(0.f);
+
+  return true;
+}
+
 Vec3f Ray::computeProjection(const Vec3f& point) const {
   const float pointDist = m_direction.dot(point - m_origin);
   return (m_origin + m_direction * std::max(pointDist, 0.f));
@@ -0,0 +1,273 @@
+#include "RaZ/Utils/RayPacket.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace Raz {
+
+namespace {
+
+// Registers on which the packets' rays are processed. Contrary to Simd::Float, their width is chosen according to the packet's size:
+//  a 4-ray packet must not use 8-wide AVX registers, & an 8-ray packet must still be processed if only SSE is available
+
+struct ScalarLanes {
+  using Float = float;
+  static constexpr std::size_t Width = 1;
+
+  static Float load(const float* values) { return *values; }
+  static void store(float* values, Float vals) { *values = vals; }
+  static Float set(float value) { return value; }
+  static Float add(Float vals1, Float vals2) { return vals1 + vals2; }
+  static Float sub(Float vals1, Float vals2) { return vals1 - vals2; }
+  static Float mul(Float vals1, Float vals2) { return vals1 * vals2; }
+  static Float div(Float vals1, Float vals2) { return vals1 / vals2; }
+  // As their SIMD counterparts, min() & max() return their second operand if any is NaN
+  static Float min(Float vals1, Float vals2) { return (vals1 < vals2 ? vals1 : vals2); }
+  static Float max(Float vals1, Float vals2) { return (vals1 > vals2 ? vals1 : vals2); }
+  static Float abs(Float vals) { return std::abs(vals); }
+  static Float lessEqual(Float vals1, Float vals2) { return (vals1 <= vals2 ? 1.f : 0.f); }
+  static Float lessThan(Float vals1, Float vals2) { return (vals1 < vals2 ? 1.f : 0.f); }
+  static Float logicalAnd(Float mask1, Float mask2) { return (mask1 != 0.f && mask2 != 0.f ? 1.f : 0.f); }
+  static Float select(Float mask, Float trueVals, Float falseVals) { return (mask != 0.f ? trueVals : falseVals); }
+  static std::uint32_t computeBitMask(Float mask) { return (mask != 0.f ? 1u : 0u); }
+};
+
+#if defined(__SSE2__) || defined(_M_X64)
+struct SseLanes {
+  using Float = __m128;
+  static constexpr std::size_t Width = 4;
+
+  static Float load(const float* values) { return _mm_loadu_ps(values); }
+  static void store(float* values, Float vals) { _mm_storeu_ps(values, vals); }
+  static Float set(float value) { return _mm_set1_ps(value); }
+  static Float add(Float vals1, Float vals2) { return _mm_add_ps(vals1, vals2); }
+  static Float sub(Float vals1, Float vals2) { return _mm_sub_ps(vals1, vals2); }
+  static Float mul(Float vals1, Float vals2) { return _mm_mul_ps(vals1, vals2); }
+  static Float div(Float vals1, Float vals2) { return _mm_div_ps(vals1, vals2); }
+  static Float min(Float vals1, Float vals2) { return _mm_min_ps(vals1, vals2); }
+  static Float max(Float vals1, Float vals2) { return _mm_max_ps(vals1, vals2); }
+  static Float abs(Float vals) { return _mm_andnot_ps(_mm_set1_ps(-0.f), vals); }
+  static Float lessEqual(Float vals1, Float vals2) { return _mm_cmple_ps(vals1, vals2); }
+  static Float lessThan(Float vals1, Float vals2) { return _mm_cmplt_ps(vals1, vals2); }
+  static Float logicalAnd(Float mask1, Float mask2) { return _mm_and_ps(mask1, mask2); }
+  static Float select(Float mask, Float trueVals, Float falseVals) { return _mm_or_ps(_mm_and_ps(mask, trueVals), _mm_andnot_ps(mask, falseVals)); }
+  static std::uint32_t computeBitMask(Float mask) { return static_cast<std::uint32_t>(_mm_movemask_ps(mask)); }
+};
+
+using Lanes4 = SseLanes;
+#else
+using Lanes4 = ScalarLanes;
+#endif
+
+#if defined(__AVX__)
+struct AvxLanes {
+  using Float = __m256;
+  static constexpr std::size_t Width = 8;
+
+  static Float load(const float* values) { return _mm256_loadu_ps(values); }
+  static void store(float* values, Float vals) { _mm256_storeu_ps(values, vals); }
+  static Float set(float value) { return _mm256_set1_ps(value); }
+  static Float add(Float vals1, Float vals2) { return _mm256_add_ps(vals1, vals2); }
+  static Float sub(Float vals1, Float vals2) { return _mm256_sub_ps(vals1, vals2); }
+  static Float mul(Float vals1, Float vals2) { return _mm256_mul_ps(vals1, vals2); }
+  static Float div(Float vals1, Float vals2) { return _mm256_div_ps(vals1, vals2); }
+  static Float min(Float vals1, Float vals2) { return _mm256_min_ps(vals1, vals2); }
+  static Float max(Float vals1, Float vals2) { return _mm256_max_ps(vals1, vals2); }
+  static Float abs(Float vals) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), vals); }
+  static Float lessEqual(Float vals1, Float vals2) { return _mm256_cmp_ps(vals1, vals2, _CMP_LE_OQ); }
+  static Float lessThan(Float vals1, Float vals2) { return _mm256_cmp_ps(vals1, vals2, _CMP_LT_OQ); }
+  static Float logicalAnd(Float mask1, Float mask2) { return _mm256_and_ps(mask1, mask2); }
+  static Float select(Float mask, Float trueVals, Float falseVals) { return _mm256_blendv_ps(falseVals, trueVals, mask); }
+  static std::uint32_t computeBitMask(Float mask) { return static_cast<std::uint32_t>(_mm256_movemask_ps(mask)); }
+};
+
+using Lanes8 = AvxLanes;
+#else
+using Lanes8 = Lanes4;
+#endif
+
+template <std::size_t Size>
+struct PacketLanes { using Type = Lanes4; };
+
+template <>
+struct PacketLanes<8> { using Type = Lanes8; };
+
+} // namespace
+
+template <std::size_t Size>
+RayPacket<Size>::RayPacket(const std::array<Ray, Size>& rays) {
+  for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex)
+    setRay(rayIndex, rays[rayIndex]);
+}
+
+template <std::size_t Size>
+Ray RayPacket<Size>::getRay(std::size_t index) const {
+  assert("Error: Ray index is out of the packet's bounds." && index < Size);
+
+  return Ray(Vec3f({ m_originsX[index], m_originsY[index], m_originsZ[index] }),
+             Vec3f({ m_directionsX[index], m_directionsY[index], m_directionsZ[index] }));
+}
+
+template <std::size_t Size>
+void RayPacket<Size>::setRay(std::size_t index, const Ray& ray) {
+  assert("Error: Ray index is out of the packet's bounds." && index < Size);
+
+  const Vec3f& origin       = ray.getOrigin();
+  const Vec3f& direction    = ray.getDirection();
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  m_originsX[index] = origin[0];
+  m_originsY[index] = origin[1];
+  m_originsZ[index] = origin[2];
+
+  m_directionsX[index] = direction[0];
+  m_directionsY[index] = direction[1];
+  m_directionsZ[index] = direction[2];
+
+  m_invDirectionsX[index] = invDirection[0];
+  m_invDirectionsY[index] = invDirection[1];
+  m_invDirectionsZ[index] = invDirection[2];
+}
+
+template <std::size_t Size>
+std::uint32_t RayPacket<Size>::intersects(const AABB& aabb, Distances& entryDistances) const {
+  Distances maxDistances {};
+  maxDistances.fill(std::numeric_limits<float>::max());
+
+  return intersects(aabb, maxDistances, entryDistances);
+}
+
+template <std::size_t Size>
+std::uint32_t RayPacket<Size>::intersects(const AABB& aabb, const Distances& maxDistances, Distances& entryDistances) const {
+  using Lanes = typename PacketLanes<Size>::Type;
+
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  const typename Lanes::Float minX = Lanes::set(minPos[0]);
+  const typename Lanes::Float minY = Lanes::set(minPos[1]);
+  const typename Lanes::Float minZ = Lanes::set(minPos[2]);
+  const typename Lanes::Float maxX = Lanes::set(maxPos[0]);
+  const typename Lanes::Float maxY = Lanes::set(maxPos[1]);
+  const typename Lanes::Float maxZ = Lanes::set(maxPos[2]);
+
+  std::uint32_t hitMask = 0;
+
+  for (std::size_t rayIndex = 0; rayIndex < Size; rayIndex += Lanes::Width) {
+    const typename Lanes::Float originsX = Lanes::load(m_originsX.data() + rayIndex);
+    const typename Lanes::Float originsY = Lanes::load(m_originsY.data() + rayIndex);
+    const typename Lanes::Float originsZ = Lanes::load(m_originsZ.data() + rayIndex);
+    const typename Lanes::Float invDirsX = Lanes::load(m_invDirectionsX.data() + rayIndex);
+    const typename Lanes::Float invDirsY = Lanes::load(m_invDirectionsY.data() + rayIndex);
+    const typename Lanes::Float invDirsZ = Lanes::load(m_invDirectionsZ.data() + rayIndex);
+
+    const typename Lanes::Float firstDistsX  = Lanes::mul(Lanes::sub(minX, originsX), invDirsX);
+    const typename Lanes::Float secondDistsX = Lanes::mul(Lanes::sub(maxX, originsX), invDirsX);
+    const typename Lanes::Float firstDistsY  = Lanes::mul(Lanes::sub(minY, originsY), invDirsY);
+    const typename Lanes::Float secondDistsY = Lanes::mul(Lanes::sub(maxY, originsY), invDirsY);
+    const typename Lanes::Float firstDistsZ  = Lanes::mul(Lanes::sub(minZ, originsZ), invDirsZ);
+    const typename Lanes::Float secondDistsZ = Lanes::mul(Lanes::sub(maxZ, originsZ), invDirsZ);
+
+    // The running distances are given as second operands: if a ray is parallel to & lies on a slab's boundary, the distance
+    //  to this slab is NaN & is then ignored
+    typename Lanes::Float entryDists = Lanes::set(0.f);
+    entryDists = Lanes::max(Lanes::min(firstDistsX, secondDistsX), entryDists);
+    entryDists = Lanes::max(Lanes::min(firstDistsY, secondDistsY), entryDists);
+    entryDists = Lanes::max(Lanes::min(firstDistsZ, secondDistsZ), entryDists);
+
+    typename Lanes::Float exitDists = Lanes::load(maxDistances.data() + rayIndex);
+    exitDists = Lanes::min(Lanes::max(firstDistsX, secondDistsX), exitDists);
+    exitDists = Lanes::min(Lanes::max(firstDistsY, secondDistsY), exitDists);
+    exitDists = Lanes::min(Lanes::max(firstDistsZ, secondDistsZ), exitDists);
+
+    const typename Lanes::Float hits = Lanes::lessEqual(entryDists, exitDists);
+
+    Lanes::store(entryDistances.data() + rayIndex, Lanes::select(hits, entryDists, Lanes::load(entryDistances.data() + rayIndex)));
+    hitMask |= Lanes::computeBitMask(hits) << rayIndex;
+  }
+
+  return hitMask;
+}
+
+template <std::size_t Size>
+std::uint32_t RayPacket<Size>::intersect(const Triangle& triangle, Distances& distances) const {
+  using Lanes = typename PacketLanes<Size>::Type;
+
+  const Vec3f firstEdge  = triangle.getSecondPos() - triangle.getFirstPos();
+  const Vec3f secondEdge = triangle.getThirdPos() - triangle.getFirstPos();
+
+  const typename Lanes::Float firstPosX    = Lanes::set(triangle.getFirstPos()[0]);
+  const typename Lanes::Float firstPosY    = Lanes::set(triangle.getFirstPos()[1]);
+  const typename Lanes::Float firstPosZ    = Lanes::set(triangle.getFirstPos()[2]);
+  const typename Lanes::Float firstEdgeX   = Lanes::set(firstEdge[0]);
+  const typename Lanes::Float firstEdgeY   = Lanes::set(firstEdge[1]);
+  const typename Lanes::Float firstEdgeZ   = Lanes::set(firstEdge[2]);
+  const typename Lanes::Float secondEdgeX  = Lanes::set(secondEdge[0]);
+  const typename Lanes::Float secondEdgeY  = Lanes::set(secondEdge[1]);
+  const typename Lanes::Float secondEdgeZ  = Lanes::set(secondEdge[2]);
+  const typename Lanes::Float zero         = Lanes::set(0.f);
+  const typename Lanes::Float one          = Lanes::set(1.f);
+  const typename Lanes::Float minDeterm    = Lanes::set(std::numeric_limits<float>::epsilon());
+
+  std::uint32_t hitMask = 0;
+
+  for (std::size_t rayIndex = 0; rayIndex < Size; rayIndex += Lanes::Width) {
+    const typename Lanes::Float dirsX = Lanes::load(m_directionsX.data() + rayIndex);
+    const typename Lanes::Float dirsY = Lanes::load(m_directionsY.data() + rayIndex);
+    const typename Lanes::Float dirsZ = Lanes::load(m_directionsZ.data() + rayIndex);
+
+    // pVec = direction x secondEdge
+    const typename Lanes::Float pVecsX = Lanes::sub(Lanes::mul(dirsY, secondEdgeZ), Lanes::mul(dirsZ, secondEdgeY));
+    const typename Lanes::Float pVecsY = Lanes::sub(Lanes::mul(dirsZ, secondEdgeX), Lanes::mul(dirsX, secondEdgeZ));
+    const typename Lanes::Float pVecsZ = Lanes::sub(Lanes::mul(dirsX, secondEdgeY), Lanes::mul(dirsY, secondEdgeX));
+
+    const typename Lanes::Float determs = Lanes::add(Lanes::add(Lanes::mul(firstEdgeX, pVecsX), Lanes::mul(firstEdgeY, pVecsY)),
+                                                     Lanes::mul(firstEdgeZ, pVecsZ));
+    const typename Lanes::Float invDeterms = Lanes::div(one, determs);
+
+    const typename Lanes::Float invPlaneDirsX = Lanes::sub(Lanes::load(m_originsX.data() + rayIndex), firstPosX);
+    const typename Lanes::Float invPlaneDirsY = Lanes::sub(Lanes::load(m_originsY.data() + rayIndex), firstPosY);
+    const typename Lanes::Float invPlaneDirsZ = Lanes::sub(Lanes::load(m_originsZ.data() + rayIndex), firstPosZ);
+
+    const typename Lanes::Float firstBaryCoords = Lanes::mul(Lanes::add(Lanes::add(Lanes::mul(invPlaneDirsX, pVecsX),
+                                                                                   Lanes::mul(invPlaneDirsY, pVecsY)),
+                                                                        Lanes::mul(invPlaneDirsZ, pVecsZ)), invDeterms);
+
+    // qVec = invPlaneDir x firstEdge
+    const typename Lanes::Float qVecsX = Lanes::sub(Lanes::mul(invPlaneDirsY, firstEdgeZ), Lanes::mul(invPlaneDirsZ, firstEdgeY));
+    const typename Lanes::Float qVecsY = Lanes::sub(Lanes::mul(invPlaneDirsZ, firstEdgeX), Lanes::mul(invPlaneDirsX, firstEdgeZ));
+    const typename Lanes::Float qVecsZ = Lanes::sub(Lanes::mul(invPlaneDirsX, firstEdgeY), Lanes::mul(invPlaneDirsY, firstEdgeX));
+
+    const typename Lanes::Float secondBaryCoords = Lanes::mul(Lanes::add(Lanes::add(Lanes::mul(dirsX, qVecsX), Lanes::mul(dirsY, qVecsY)),
+                                                                         Lanes::mul(dirsZ, qVecsZ)), invDeterms);
+    const typename Lanes::Float hitDists = Lanes::mul(Lanes::add(Lanes::add(Lanes::mul(secondEdgeX, qVecsX), Lanes::mul(secondEdgeY, qVecsY)),
+                                                                 Lanes::mul(secondEdgeZ, qVecsZ)), invDeterms);
+
+    const typename Lanes::Float closestDists = Lanes::load(distances.data() + rayIndex);
+
+    // All conditions are evaluated on every ray; those whose determinant is null produce NaNs, for which all comparisons fail
+    typename Lanes::Float hits = Lanes::lessThan(minDeterm, Lanes::abs(determs));
+    hits = Lanes::logicalAnd(hits, Lanes::lessEqual(zero, firstBaryCoords));
+    hits = Lanes::logicalAnd(hits, Lanes::lessEqual(zero, secondBaryCoords));
+    hits = Lanes::logicalAnd(hits, Lanes::lessEqual(Lanes::add(firstBaryCoords, secondBaryCoords), one));
+    hits = Lanes::logicalAnd(hits, Lanes::lessThan(zero, hitDists));
+    hits = Lanes::logicalAnd(hits, Lanes::lessThan(hitDists, closestDists));
+
+    Lanes::store(distances.data() + rayIndex, Lanes::select(hits, hitDists, closestDists));
+    hitMask |= Lanes::computeBitMask(hits) << rayIndex;
+  }
+
+  return hitMask;
+}
+
+template class RayPacket<4>;
+template class RayPacket<8>;
+
+} // namespace Raz
@@ -1,11 +1,146 @@
+#include "RaZ/Physics/Gjk.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace Raz {
 
+namespace {
+
+/// Checks if a convex shape intersects a plane, that is if its furthest points on both sides of the plane are not on the same side.
+inline bool intersectsPlane(const Plane& plane, const Shape& shape) {
+  const Vec3f& normal = plane.getNormal();
+
+  const float frontDist = normal.dot(shape.computeSupportPoint(normal)) - plane.getDistance();
+  const float backDist  = normal.dot(shape.computeSupportPoint(-normal)) - plane.getDistance();
+
+  return (backDist <= 0.f && frontDist >= 0.f);
+}
+
+/// Computes the signed distances of a triangle's vertices to another triangle's plane, as used by Möller's triangle-triangle test.
+/// Distances close enough to 0 relatively to the triangles' size are snapped to it, so that nearly coplanar vertices are handled consistently.
+/// \param normal Non-normalized normal of the plane.
+/// \param planePos Any point of the plane.
+/// \param triangle Triangle whose vertices' distances are computed.
+/// \return Distances of the vertices, scaled by the normal's length.
+inline std::array<float, 3> computePlaneDistances(const Vec3f& normal, const Vec3f& planePos, const Triangle& triangle) {
+  const std::array<Vec3f, 3> directions = { triangle.getFirstPos() - planePos, triangle.getSecondPos() - planePos, triangle.getThirdPos() - planePos };
+  std::array<float, 3> distances {};
+  float maxSqLength = 0.f;
+
+  for (std::size_t vertIndex = 0; vertIndex < 3; ++vertIndex) {
+    distances[vertIndex] = normal.dot(directions[vertIndex]);
+    maxSqLength = std::max(maxSqLength, directions[vertIndex].computeSquaredLength());
+  }
+
+  const float tolerance = 1e-6f * std::sqrt(normal.computeSquaredLength() * maxSqLength);
+
+  for (float& distance : distances) {
+    if (std::abs(distance) <= tolerance)
+      distance = 0.f;
+  }
+
+  return distances;
+}
+
+/// Computes the interval over which a triangle crosses the line on which both triangles' planes intersect.
+/// \param projections Coordinates of the triangle's vertices on the line.
+/// \param distances Signed distances of the triangle's vertices to the other triangle's plane.
+/// \param minBound Lower bound of the interval.
+/// \param maxBound Upper bound of the interval.
+/// \return True if the interval has been computed, false if the triangle lies in the other one's plane.
+inline bool computeLineInterval(const std::array<float, 3>& projections, const std::array<float, 3>& distances, float& minBound, float& maxBound) {
+  // Finding the vertex lying alone on its side of the plane; the interval's bounds are where its two edges cross the plane
+  std::size_t loneIndex {};
+
+  if (distances[0] * distances[1] > 0.f)
+    loneIndex = 2;
+  else if (distances[0] * distances[2] > 0.f)
+    loneIndex = 1;
+  else if (distances[1] * distances[2] > 0.f || distances[0] != 0.f)
+    loneIndex = 0;
+  else if (distances[1] != 0.f)
+    loneIndex = 1;
+  else if (distances[2] != 0.f)
+    loneIndex = 2;
+  else
+    return false;
+
+  const std::size_t firstIndex  = (loneIndex + 1) % 3;
+  const std::size_t secondIndex = (loneIndex + 2) % 3;
+  const float loneProj = projections[loneIndex];
+  const float loneDist = distances[loneIndex];
+
+  minBound = loneProj + (projections[firstIndex] - loneProj) * loneDist / (loneDist - distances[firstIndex]);
+  maxBound = loneProj + (projections[secondIndex] - loneProj) * loneDist / (loneDist - distances[secondIndex]);
+
+  if (minBound > maxBound)
+    std::swap(minBound, maxBound);
+
+  return true;
+}
+
+/// Checks if two coplanar triangles intersect, projecting them onto the axis-aligned plane in which they are the largest.
+/// \param normal Normal of the triangles' plane.
+inline bool intersectCoplanarTriangles(const Triangle& firstTriangle, const Triangle& secondTriangle, const Vec3f& normal) {
+  const Vec3f absNormal({ std::abs(normal[0]), std::abs(normal[1]), std::abs(normal[2]) });
+  const std::size_t droppedAxis = (absNormal[0] > absNormal[1] ? (absNormal[0] > absNormal[2] ? 0 : 2) : (absNormal[1] > absNormal[2] ? 1 : 2));
+  const std::size_t firstAxis   = (droppedAxis + 1) % 3;
+  const std::size_t secondAxis  = (droppedAxis + 2) % 3;
+
+  const auto project = [firstAxis, secondAxis] (const Triangle& triangle) {
+    return std::array<Vec2f, 3>{{ Vec2f({ triangle.getFirstPos()[firstAxis], triangle.getFirstPos()[secondAxis] }),
+                                  Vec2f({ triangle.getSecondPos()[firstAxis], triangle.getSecondPos()[secondAxis] }),
+                                  Vec2f({ triangle.getThirdPos()[firstAxis], triangle.getThirdPos()[secondAxis] }) }};
+  };
+
+  const std::array<Vec2f, 3> firstPoints  = project(firstTriangle);
+  const std::array<Vec2f, 3> secondPoints = project(secondTriangle);
+
+  const auto computeOrientation = [] (const Vec2f& firstPos, const Vec2f& secondPos, const Vec2f& point) {
+    return (secondPos[0] - firstPos[0]) * (point[1] - firstPos[1]) - (secondPos[1] - firstPos[1]) * (point[0] - firstPos[0]);
+  };
+
+  const auto containsPoint = [&computeOrientation] (const std::array<Vec2f, 3>& points, const Vec2f& point) {
+    const float firstOrient  = computeOrientation(points[0], points[1], point);
+    const float secondOrient = computeOrientation(points[1], points[2], point);
+    const float thirdOrient  = computeOrientation(points[2], points[0], point);
+
+    return ((firstOrient >= 0.f && secondOrient >= 0.f && thirdOrient >= 0.f) || (firstOrient <= 0.f && secondOrient <= 0.f && thirdOrient <= 0.f));
+  };
+
+  // Edges crossing each other strictly; any contact at an endpoint is found by the containment checks below
+  for (std::size_t firstIndex = 0; firstIndex < 3; ++firstIndex) {
+    const Vec2f& firstBegin = firstPoints[firstIndex];
+    const Vec2f& firstEnd   = firstPoints[(firstIndex + 1) % 3];
+
+    for (std::size_t secondIndex = 0; secondIndex < 3; ++secondIndex) {
+      const Vec2f& secondBegin = secondPoints[secondIndex];
+      const Vec2f& secondEnd   = secondPoints[(secondIndex + 1) % 3];
+
+      const float beginOrient1 = computeOrientation(secondBegin, secondEnd, firstBegin);
+      const float endOrient1   = computeOrientation(secondBegin, secondEnd, firstEnd);
+      const float beginOrient2 = computeOrientation(firstBegin, firstEnd, secondBegin);
+      const float endOrient2   = computeOrientation(firstBegin, firstEnd, secondEnd);
+
+      if (beginOrient1 * endOrient1 < 0.f && beginOrient2 * endOrient2 < 0.f)
+        return true;
+    }
+  }
+
+  return (containsPoint(secondPoints, firstPoints[0]) || containsPoint(firstPoints, secondPoints[0])
+       || containsPoint(secondPoints, firstPoints[1]) || containsPoint(firstPoints, secondPoints[1])
+       || containsPoint(secondPoints, firstPoints[2]) || containsPoint(firstPoints, secondPoints[2]));
+}
+
+} // namespace
+
 // Line functions
 
-bool Line::intersects(const Line&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Line& line) const {
+  return Gjk::intersects(*this, line);
 }
 
 bool Line::intersects(const Plane& plane) const {
@@ -29,16 +164,16 @@ bool Line::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Line::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Triangle& triangle) const {
+  return Gjk::intersects(*this, triangle);
 }
 
-bool Line::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
 }
 
-bool Line::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
 Vec3f Line::computeProjection(const Vec3f& point) const {
@@ -58,6 +193,10 @@ Vec3f Line::computeProjection(const Vec3f& point) const {
   return m_beginPos + lineVec * std::min(1.f, std::max(pointDist, 0.f));
 }
 
+Vec3f Line::computeSupportPoint(const Vec3f& direction) const {
+  return (direction.dot(m_endPos - m_beginPos) > 0.f ? m_endPos : m_beginPos);
+}
+
 // Plane functions
 
 bool Plane::intersects(const Plane& plane) const {
@@ -70,12 +209,12 @@ bool Plane::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Plane::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Triangle& triangle) const {
+  return intersectsPlane(*this, triangle);
 }
 
-bool Plane::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Quad& quad) const {
+  return intersectsPlane(*this, quad);
 }
 
 bool Plane::intersects(const AABB& aabb) const {
@@ -98,7 +237,8 @@ bool Sphere::contains(const Raz::Vec3f& point) const {
 
 bool Sphere::intersects(const Sphere& sphere) const {
   const float sqDist  = (m_centerPos - sphere.getCenter()).computeSquaredLength();
-  const float sqRadii = (m_radius * m_radius) + (sphere.getRadius() * sphere.getRadius());
+  const float sumRadii = m_radius + sphere.getRadius();
+  const float sqRadii  = sumRadii * sumRadii;
 
   return (sqDist <= sqRadii);
 }
@@ -118,36 +258,146 @@ bool Sphere::intersects(const AABB& aabb) const {
   return contains(projPoint);
 }
 
+Vec3f Sphere::computeSupportPoint(const Vec3f& direction) const {
+  const float sqDirLength = direction.computeSquaredLength();
+
+  // Any point of the surface is valid if no direction is given
+  if (sqDirLength == 0.f)
+    return m_centerPos + Axis::X * m_radius;
+
+  return m_centerPos + direction * (m_radius / std::sqrt(sqDirLength));
+}
+
 // Triangle functions
 
-bool Triangle::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Triangle& triangle) const {
+  // Möller's interval overlap test; see "A Fast Triangle-Triangle Intersection Test" (Tomas Möller, 1997)
+  const Vec3f firstNormal  = (m_secondPos - m_firstPos).cross(m_thirdPos - m_firstPos);
+  const Vec3f secondNormal = (triangle.m_secondPos - triangle.m_firstPos).cross(triangle.m_thirdPos - triangle.m_firstPos);
+
+  // Degenerate triangles have no plane to be tested against
+  if (firstNormal.computeSquaredLength() == 0.f || secondNormal.computeSquaredLength() == 0.f)
+    return Gjk::intersects(*this, triangle);
+
+  // If all vertices of a triangle lie strictly on the same side of the other's plane, they can't intersect
+  const std::array<float, 3> secondDistances = computePlaneDistances(firstNormal, m_firstPos, triangle);
+
+  if ((secondDistances[0] > 0.f && secondDistances[1] > 0.f && secondDistances[2] > 0.f)
+   || (secondDistances[0] < 0.f && secondDistances[1] < 0.f && secondDistances[2] < 0.f))
+    return false;
+
+  const std::array<float, 3> firstDistances = computePlaneDistances(secondNormal, triangle.m_firstPos, *this);
+
+  if ((firstDistances[0] > 0.f && firstDistances[1] > 0.f && firstDistances[2] > 0.f)
+   || (firstDistances[0] < 0.f && firstDistances[1] < 0.f && firstDistances[2] < 0.f))
+    return false;
+
+  // Both triangles cross the line on which their planes intersect; they intersect if their intervals on it overlap
+  // The vertices are projected onto the axis to which the line is the most aligned, which keeps the intervals' order
+  const Vec3f lineDir = firstNormal.cross(secondNormal);
+  const std::size_t axis = (std::abs(lineDir[0]) > std::abs(lineDir[1]) ? (std::abs(lineDir[0]) > std::abs(lineDir[2]) ? 0 : 2)
+                                                                        : (std::abs(lineDir[1]) > std::abs(lineDir[2]) ? 1 : 2));
+
+  float firstMin {}, firstMax {}, secondMin {}, secondMax {};
+
+  if (!computeLineInterval({{ m_firstPos[axis], m_secondPos[axis], m_thirdPos[axis] }}, firstDistances, firstMin, firstMax)
+   || !computeLineInterval({{ triangle.m_firstPos[axis], triangle.m_secondPos[axis], triangle.m_thirdPos[axis] }}, secondDistances, secondMin, secondMax))
+    return intersectCoplanarTriangles(*this, triangle, firstNormal);
+
+  return (firstMin <= secondMax && secondMin <= firstMax);
 }
 
-bool Triangle::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
 }
 
-bool Triangle::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
-Vec3f Triangle::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Triangle::computeProjection(const Vec3f& point) const {
+  // Finding the Voronoi region of the triangle (vertex, edge or face) in which the point lies, & projecting it onto the matching feature
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.5
+  const Vec3f firstEdge  = m_secondPos - m_firstPos;
+  const Vec3f secondEdge = m_thirdPos - m_firstPos;
+
+  const Vec3f firstDir = point - m_firstPos;
+  const float firstDot1 = firstEdge.dot(firstDir);
+  const float firstDot2 = secondEdge.dot(firstDir);
+
+  if (firstDot1 <= 0.f && firstDot2 <= 0.f)
+    return m_firstPos;
+
+  const Vec3f secondDir = point - m_secondPos;
+  const float secondDot1 = firstEdge.dot(secondDir);
+  const float secondDot2 = secondEdge.dot(secondDir);
+
+  if (secondDot1 >= 0.f && secondDot2 <= secondDot1)
+    return m_secondPos;
+
+  const float thirdArea = firstDot1 * secondDot2 - secondDot1 * firstDot2;
+
+  if (thirdArea <= 0.f && firstDot1 >= 0.f && secondDot1 <= 0.f)
+    return m_firstPos + firstEdge * (firstDot1 / (firstDot1 - secondDot1));
+
+  const Vec3f thirdDir = point - m_thirdPos;
+  const float thirdDot1 = firstEdge.dot(thirdDir);
+  const float thirdDot2 = secondEdge.dot(thirdDir);
+
+  if (thirdDot2 >= 0.f && thirdDot1 <= thirdDot2)
+    return m_thirdPos;
+
+  const float secondArea = thirdDot1 * firstDot2 - firstDot1 * thirdDot2;
+
+  if (secondArea <= 0.f && firstDot2 >= 0.f && thirdDot2 <= 0.f)
+    return m_firstPos + secondEdge * (firstDot2 / (firstDot2 - thirdDot2));
+
+  const float firstArea = secondDot1 * thirdDot2 - thirdDot1 * secondDot2;
+
+  if (firstArea <= 0.f && (secondDot2 - secondDot1) >= 0.f && (thirdDot1 - thirdDot2) >= 0.f) {
+    const float edgeRatio = (secondDot2 - secondDot1) / ((secondDot2 - secondDot1) + (thirdDot1 - thirdDot2));
+    return m_secondPos + (m_thirdPos - m_secondPos) * edgeRatio;
+  }
+
+  // The point projects inside the face; its barycentric coordinates are given by the ratios of the sub-triangles' areas
+  const float invArea = 1.f / (firstArea + secondArea + thirdArea);
+  return m_firstPos + firstEdge * (secondArea * invArea) + secondEdge * (thirdArea * invArea);
+}
+
+Vec3f Triangle::computeSupportPoint(const Vec3f& direction) const {
+  const float firstDist  = direction.dot(m_firstPos);
+  const float secondDist = direction.dot(m_secondPos);
+  const float thirdDist  = direction.dot(m_thirdPos);
+
+  if (firstDist >= secondDist)
+    return (firstDist >= thirdDist ? m_firstPos : m_thirdPos);
+
+  return (secondDist >= thirdDist ? m_secondPos : m_thirdPos);
 }
 
 // Quad functions
 
-bool Quad::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
 }
 
-bool Quad::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
-Vec3f Quad::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Quad::computeProjection(const Vec3f& point) const {
+  // The quad being planar & convex, its projection is the closest one onto either of the two triangles it is made of
+  const Vec3f firstProj  = Triangle(m_leftTopPos, m_rightTopPos, m_rightBottomPos).computeProjection(point);
+  const Vec3f secondProj = Triangle(m_leftTopPos, m_rightBottomPos, m_leftBottomPos).computeProjection(point);
+
+  return ((firstProj - point).computeSquaredLength() <= (secondProj - point).computeSquaredLength() ? firstProj : secondProj);
+}
+
+Vec3f Quad::computeSupportPoint(const Vec3f& direction) const {
+  const Vec3f& firstSupport  = (direction.dot(m_rightTopPos - m_leftTopPos) > 0.f ? m_rightTopPos : m_leftTopPos);
+  const Vec3f& secondSupport = (direction.dot(m_leftBottomPos - m_rightBottomPos) > 0.f ? m_leftBottomPos : m_rightBottomPos);
+
+  return (direction.dot(secondSupport - firstSupport) > 0.f ? secondSupport : firstSupport);
 }
 
 // AABB functions
@@ -200,4 +450,28 @@ Vec3f AABB::computeProjection(const Vec3f& point) const {
   return Vec3f({ closestX, closestY, closestZ });
 }
 
+Vec3f AABB::computeSupportPoint(const Vec3f& direction) const {
+  return Vec3f({ (direction[0] > 0.f ? m_rightTopFrontPos[0] : m_leftBottomBackPos[0]),
+                 (direction[1] > 0.f ? m_rightTopFrontPos[1] : m_leftBottomBackPos[1]),
+                 (direction[2] > 0.f ? m_rightTopFrontPos[2] : m_leftBottomBackPos[2]) });
+}
+
+AABB AABB::computeTransformed(const Mat4f& transform) const {
+  // Arvo's method: each element of the matrix extends the box on its column's axis, by either of the original extremities
+  Vec3f minPos({ transform[12], transform[13], transform[14] });
+  Vec3f maxPos = minPos;
+
+  for (std::size_t column = 0; column < 3; ++column) {
+    for (std::size_t row = 0; row < 3; ++row) {
+      const float firstVal  = transform[row * 4 + column] * m_leftBottomBackPos[row];
+      const float secondVal = transform[row * 4 + column] * m_rightTopFrontPos[row];
+
+      minPos[column] += std::min(firstVal, secondVal);
+      maxPos[column] += std::max(firstVal, secondVal);
+    }
+  }
+
+  return AABB(maxPos, minPos);
+}
+
 } // namespace Raz
@@ -0,0 +1,257 @@
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Utils/ShapeArray.hpp"
+
+namespace Raz {
+
+namespace {
+
+/// Runs a test on all elements of an array, writing the results of each whole register at once.
+/// \param size Number of elements to be tested.
+/// \param testSimd Function testing Simd::Width elements from the given index, returning a mask of the intersecting ones.
+/// \param testScalar Function testing the element at the given index, for the remaining ones which could not fill a whole register.
+/// \param result Mask of the intersecting elements.
+template <typename SimdTestT, typename ScalarTestT>
+void testElements(std::size_t size, const SimdTestT& testSimd, const ScalarTestT& testScalar, BitMask& result) {
+  result.reset(size);
+
+  std::size_t index = 0;
+
+  for (; index + Simd::Width <= size; index += Simd::Width)
+    result.enableBits(index, Simd::getMaskBits(testSimd(index)));
+
+  for (; index < size; ++index) {
+    if (testScalar(index))
+      result.setBit(index);
+  }
+}
+
+/// Computes the squared distances between a point & several boxes, which are 0 for boxes containing it.
+inline Simd::Float computeSquaredDistances(Simd::Float pointX, Simd::Float pointY, Simd::Float pointZ,
+                                           Simd::Float minX, Simd::Float minY, Simd::Float minZ,
+                                           Simd::Float maxX, Simd::Float maxY, Simd::Float maxZ) {
+  const Simd::Float zero = Simd::set(0.f);
+
+  // On each axis, at most one of the differences is positive
+  const Simd::Float distX = Simd::add(Simd::max(Simd::sub(minX, pointX), zero), Simd::max(Simd::sub(pointX, maxX), zero));
+  const Simd::Float distY = Simd::add(Simd::max(Simd::sub(minY, pointY), zero), Simd::max(Simd::sub(pointY, maxY), zero));
+  const Simd::Float distZ = Simd::add(Simd::max(Simd::sub(minZ, pointZ), zero), Simd::max(Simd::sub(pointZ, maxZ), zero));
+
+  return Simd::add(Simd::add(Simd::mul(distX, distX), Simd::mul(distY, distY)), Simd::mul(distZ, distZ));
+}
+
+} // namespace
+
+AABBArray::AABBArray(const std::vector<AABB>& aabbs) : AABBArray(aabbs.size()) {
+  for (std::size_t i = 0; i < aabbs.size(); ++i)
+    set(i, aabbs[i]);
+}
+
+void AABBArray::resize(std::size_t size) {
+  m_minX.resize(size);
+  m_minY.resize(size);
+  m_minZ.resize(size);
+  m_maxX.resize(size);
+  m_maxY.resize(size);
+  m_maxZ.resize(size);
+}
+
+void AABBArray::reserve(std::size_t size) {
+  m_minX.reserve(size);
+  m_minY.reserve(size);
+  m_minZ.reserve(size);
+  m_maxX.reserve(size);
+  m_maxY.reserve(size);
+  m_maxZ.reserve(size);
+}
+
+void AABBArray::add(const AABB& aabb) {
+  m_minX.push_back(aabb.getLeftBottomBackPos()[0]);
+  m_minY.push_back(aabb.getLeftBottomBackPos()[1]);
+  m_minZ.push_back(aabb.getLeftBottomBackPos()[2]);
+  m_maxX.push_back(aabb.getRightTopFrontPos()[0]);
+  m_maxY.push_back(aabb.getRightTopFrontPos()[1]);
+  m_maxZ.push_back(aabb.getRightTopFrontPos()[2]);
+}
+
+void AABBArray::set(std::size_t index, const AABB& aabb) {
+  m_minX[index] = aabb.getLeftBottomBackPos()[0];
+  m_minY[index] = aabb.getLeftBottomBackPos()[1];
+  m_minZ[index] = aabb.getLeftBottomBackPos()[2];
+  m_maxX[index] = aabb.getRightTopFrontPos()[0];
+  m_maxY[index] = aabb.getRightTopFrontPos()[1];
+  m_maxZ[index] = aabb.getRightTopFrontPos()[2];
+}
+
+SphereArray::SphereArray(const std::vector<Sphere>& spheres) : SphereArray(spheres.size()) {
+  for (std::size_t i = 0; i < spheres.size(); ++i)
+    set(i, spheres[i]);
+}
+
+void SphereArray::resize(std::size_t size) {
+  m_centerX.resize(size);
+  m_centerY.resize(size);
+  m_centerZ.resize(size);
+  m_radii.resize(size);
+}
+
+void SphereArray::reserve(std::size_t size) {
+  m_centerX.reserve(size);
+  m_centerY.reserve(size);
+  m_centerZ.reserve(size);
+  m_radii.reserve(size);
+}
+
+void SphereArray::add(const Sphere& sphere) {
+  m_centerX.push_back(sphere.getCenter()[0]);
+  m_centerY.push_back(sphere.getCenter()[1]);
+  m_centerZ.push_back(sphere.getCenter()[2]);
+  m_radii.push_back(sphere.getRadius());
+}
+
+void SphereArray::set(std::size_t index, const Sphere& sphere) {
+  m_centerX[index] = sphere.getCenter()[0];
+  m_centerY[index] = sphere.getCenter()[1];
+  m_centerZ[index] = sphere.getCenter()[2];
+  m_radii[index]   = sphere.getRadius();
+}
+
+namespace Batch {
+
+void intersects(const Sphere& sphere, const AABBArray& aabbs, BitMask& result) {
+  const Simd::Float centerX  = Simd::set(sphere.getCenter()[0]);
+  const Simd::Float centerY  = Simd::set(sphere.getCenter()[1]);
+  const Simd::Float centerZ  = Simd::set(sphere.getCenter()[2]);
+  const Simd::Float sqRadius = Simd::set(sphere.getRadius() * sphere.getRadius());
+
+  testElements(aabbs.getSize(), [&] (std::size_t index) {
+    const Simd::Float sqDists = computeSquaredDistances(centerX, centerY, centerZ,
+                                                        Simd::load(aabbs.getMinX().data() + index),
+                                                        Simd::load(aabbs.getMinY().data() + index),
+                                                        Simd::load(aabbs.getMinZ().data() + index),
+                                                        Simd::load(aabbs.getMaxX().data() + index),
+                                                        Simd::load(aabbs.getMaxY().data() + index),
+                                                        Simd::load(aabbs.getMaxZ().data() + index));
+    return Simd::lessOrEqual(sqDists, sqRadius);
+  }, [&sphere, &aabbs] (std::size_t index) { return sphere.intersects(aabbs[index]); }, result);
+}
+
+void intersects(const Sphere& sphere, const SphereArray& spheres, BitMask& result) {
+  const Simd::Float centerX = Simd::set(sphere.getCenter()[0]);
+  const Simd::Float centerY = Simd::set(sphere.getCenter()[1]);
+  const Simd::Float centerZ = Simd::set(sphere.getCenter()[2]);
+  const Simd::Float radius  = Simd::set(sphere.getRadius());
+
+  testElements(spheres.getSize(), [&] (std::size_t index) {
+    const Simd::Float diffX = Simd::sub(Simd::load(spheres.getCenterX().data() + index), centerX);
+    const Simd::Float diffY = Simd::sub(Simd::load(spheres.getCenterY().data() + index), centerY);
+    const Simd::Float diffZ = Simd::sub(Simd::load(spheres.getCenterZ().data() + index), centerZ);
+    const Simd::Float radii = Simd::add(Simd::load(spheres.getRadii().data() + index), radius);
+
+    const Simd::Float sqDists = Simd::add(Simd::add(Simd::mul(diffX, diffX), Simd::mul(diffY, diffY)), Simd::mul(diffZ, diffZ));
+    return Simd::lessOrEqual(sqDists, Simd::mul(radii, radii));
+  }, [&sphere, &spheres] (std::size_t index) { return sphere.intersects(spheres[index]); }, result);
+}
+
+void intersects(const AABB& aabb, const AABBArray& aabbs, BitMask& result) {
+  const Simd::Float minX = Simd::set(aabb.getLeftBottomBackPos()[0]);
+  const Simd::Float minY = Simd::set(aabb.getLeftBottomBackPos()[1]);
+  const Simd::Float minZ = Simd::set(aabb.getLeftBottomBackPos()[2]);
+  const Simd::Float maxX = Simd::set(aabb.getRightTopFrontPos()[0]);
+  const Simd::Float maxY = Simd::set(aabb.getRightTopFrontPos()[1]);
+  const Simd::Float maxZ = Simd::set(aabb.getRightTopFrontPos()[2]);
+
+  testElements(aabbs.getSize(), [&] (std::size_t index) {
+    const Simd::Float overlapX = Simd::andMasks(Simd::lessOrEqual(minX, Simd::load(aabbs.getMaxX().data() + index)),
+                                                Simd::lessOrEqual(Simd::load(aabbs.getMinX().data() + index), maxX));
+    const Simd::Float overlapY = Simd::andMasks(Simd::lessOrEqual(minY, Simd::load(aabbs.getMaxY().data() + index)),
+                                                Simd::lessOrEqual(Simd::load(aabbs.getMinY().data() + index), maxY));
+    const Simd::Float overlapZ = Simd::andMasks(Simd::lessOrEqual(minZ, Simd::load(aabbs.getMaxZ().data() + index)),
+                                                Simd::lessOrEqual(Simd::load(aabbs.getMinZ().data() + index), maxZ));
+
+    return Simd::andMasks(Simd::andMasks(overlapX, overlapY), overlapZ);
+  }, [&aabb, &aabbs] (std::size_t index) { return aabb.intersects(aabbs[index]); }, result);
+}
+
+void intersects(const AABB& aabb, const SphereArray& spheres, BitMask& result) {
+  const Simd::Float minX = Simd::set(aabb.getLeftBottomBackPos()[0]);
+  const Simd::Float minY = Simd::set(aabb.getLeftBottomBackPos()[1]);
+  const Simd::Float minZ = Simd::set(aabb.getLeftBottomBackPos()[2]);
+  const Simd::Float maxX = Simd::set(aabb.getRightTopFrontPos()[0]);
+  const Simd::Float maxY = Simd::set(aabb.getRightTopFrontPos()[1]);
+  const Simd::Float maxZ = Simd::set(aabb.getRightTopFrontPos()[2]);
+
+  testElements(spheres.getSize(), [&] (std::size_t index) {
+    const Simd::Float sqDists = computeSquaredDistances(Simd::load(spheres.getCenterX().data() + index),
+                                                        Simd::load(spheres.getCenterY().data() + index),
+                                                        Simd::load(spheres.getCenterZ().data() + index),
+                                                        minX, minY, minZ, maxX, maxY, maxZ);
+    const Simd::Float radii = Simd::load(spheres.getRadii().data() + index);
+
+    return Simd::lessOrEqual(sqDists, Simd::mul(radii, radii));
+  }, [&aabb, &spheres] (std::size_t index) { return spheres[index].intersects(aabb); }, result);
+}
+
+void intersects(const std::array<Plane, 6>& frustumPlanes, const AABBArray& aabbs, BitMask& result) {
+  testElements(aabbs.getSize(), [&] (std::size_t index) {
+    // All boxes are considered inside until found entirely behind a plane
+    Simd::Float isInside = Simd::lessOrEqual(Simd::set(0.f), Simd::set(0.f));
+
+    for (const Plane& plane : frustumPlanes) {
+      const Vec3f& normal = plane.getNormal();
+
+      // The box's corner the furthest along the plane's normal is the last one to cross it; the box is outside only if this corner is
+      const Simd::Float cornerX = Simd::load((normal[0] > 0.f ? aabbs.getMaxX() : aabbs.getMinX()).data() + index);
+      const Simd::Float cornerY = Simd::load((normal[1] > 0.f ? aabbs.getMaxY() : aabbs.getMinY()).data() + index);
+      const Simd::Float cornerZ = Simd::load((normal[2] > 0.f ? aabbs.getMaxZ() : aabbs.getMinZ()).data() + index);
+
+      const Simd::Float cornerDists = Simd::add(Simd::add(Simd::mul(cornerX, Simd::set(normal[0])), Simd::mul(cornerY, Simd::set(normal[1]))),
+                                                Simd::mul(cornerZ, Simd::set(normal[2])));
+      isInside = Simd::andMasks(isInside, Simd::lessOrEqual(Simd::set(plane.getDistance()), cornerDists));
+    }
+
+    return isInside;
+  }, [&frustumPlanes, &aabbs] (std::size_t index) {
+    const AABB aabb = aabbs[index];
+
+    for (const Plane& plane : frustumPlanes) {
+      if (plane.getNormal().dot(aabb.computeSupportPoint(plane.getNormal())) < plane.getDistance())
+        return false;
+    }
+
+    return true;
+  }, result);
+}
+
+void intersects(const std::array<Plane, 6>& frustumPlanes, const SphereArray& spheres, BitMask& result) {
+  testElements(spheres.getSize(), [&] (std::size_t index) {
+    const Simd::Float centerX = Simd::load(spheres.getCenterX().data() + index);
+    const Simd::Float centerY = Simd::load(spheres.getCenterY().data() + index);
+    const Simd::Float centerZ = Simd::load(spheres.getCenterZ().data() + index);
+    const Simd::Float radii   = Simd::load(spheres.getRadii().data() + index);
+
+    Simd::Float isInside = Simd::lessOrEqual(Simd::set(0.f), Simd::set(0.f));
+
+    for (const Plane& plane : frustumPlanes) {
+      const Vec3f& normal = plane.getNormal();
+
+      const Simd::Float centerDists = Simd::add(Simd::add(Simd::mul(centerX, Simd::set(normal[0])), Simd::mul(centerY, Simd::set(normal[1]))),
+                                                Simd::mul(centerZ, Simd::set(normal[2])));
+      isInside = Simd::andMasks(isInside, Simd::lessOrEqual(Simd::set(plane.getDistance()), Simd::add(centerDists, radii)));
+    }
+
+    return isInside;
+  }, [&frustumPlanes, &spheres] (std::size_t index) {
+    const Sphere sphere = spheres[index];
+
+    for (const Plane& plane : frustumPlanes) {
+      if (plane.getNormal().dot(sphere.getCenter()) + sphere.getRadius() < plane.getDistance())
+        return false;
+    }
+
+    return true;
+  }, result);
+}
+
+} // namespace Batch
+
+} // namespace Raz
@@ -0,0 +1,582 @@
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/SignedDistanceField.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace Raz {
+
+namespace {
+
+// Barycentric coordinate under which a point is considered to lie on the opposite edge of its triangle
+constexpr float FeatureTolerance = 0.0001f;
+
+// Index of the bricks having no fine distances
+constexpr std::uint32_t CoarseBrick = std::numeric_limits<std::uint32_t>::max();
+
+// Relative margin added to the distance bounds deduced from neighbor samples, for them to remain valid despite floating-point errors
+constexpr float BoundMargin = 1.001f;
+
+constexpr float interpolate(float first, float second, float coeff) { return first + (second - first) * coeff; }
+
+inline Simd::Float interpolateBatch(Simd::Float first, Simd::Float second, Simd::Float coeff) {
+  return Simd::add(first, Simd::mul(Simd::sub(second, first), coeff));
+}
+
+/// Trilinearly interpolates the values at the corners of a box, in the order of increasing X, then Y, then Z.
+float interpolate(const std::array<float, 8>& values, float coeffX, float coeffY, float coeffZ) {
+  const float bottom = interpolate(interpolate(values[0], values[1], coeffX), interpolate(values[2], values[3], coeffX), coeffY);
+  const float top    = interpolate(interpolate(values[4], values[5], coeffX), interpolate(values[6], values[7], coeffX), coeffY);
+  return interpolate(bottom, top, coeffZ);
+}
+
+/// Signed distance to a triangle mesh, its sign being given by the angle-weighted pseudonormal of the closest feature.
+/// See: Signed Distance Computation Using the Angle Weighted Pseudonormal (J. Andreas Bærentzen & Henrik Aanæs)
+class MeshDistance {
+public:
+  MeshDistance(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+
+  /// Checks if the surface lies within a given distance of a point.
+  /// \param point Point to check the distance from.
+  /// \param distance Maximal distance to the surface.
+  /// \return True if any triangle is within the given distance, false otherwise.
+  bool isSurfaceWithin(const Vec3f& point, float distance) const {
+    TriangleBvh::ClosestPoint closestPoint;
+    return m_bvh.findClosestPoint(point, closestPoint, distance);
+  }
+
+  /// Computes the signed distance from a point to the surface.
+  /// \param point Point to compute the distance from.
+  /// \param maxDistance Upper bound of the unsigned distance, speeding up the search. The full search is made if it proves to be wrong.
+  /// \return Signed distance, negative if inside of the mesh.
+  float compute(const Vec3f& point, float maxDistance = std::numeric_limits<float>::max()) const;
+
+private:
+  struct TriangleNormals {
+    Vec3f faceNormal {};
+    std::array<Vec3f, 3> edgeNormals {}; ///< Pseudonormals of the edges joining each vertex to the next one.
+    std::array<std::uint32_t, 3> vertexIds {}; ///< Indices of the vertices' pseudonormals, vertices at the same position sharing theirs.
+  };
+
+  const std::vector<Vertex>& m_vertices;
+  const std::vector<unsigned int>& m_indices;
+  TriangleBvh m_bvh {};
+  std::vector<TriangleNormals> m_triangleNormals {};
+  std::vector<Vec3f> m_vertexNormals {};
+};
+
+MeshDistance::MeshDistance(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+  : m_vertices{ vertices }, m_indices{ indices }, m_bvh(vertices, indices) {
+  // Vertices are usually duplicated along hard edges & texture seams; those at the same position are welded for the pseudonormals
+  // to take into account all the faces around them
+  std::vector<std::uint32_t> sortedVertices(vertices.size());
+  std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+  std::sort(sortedVertices.begin(), sortedVertices.end(), [&vertices] (std::uint32_t firstIndex, std::uint32_t secondIndex) {
+    const Vec3f& firstPos  = vertices[firstIndex].position;
+    const Vec3f& secondPos = vertices[secondIndex].position;
+    return std::lexicographical_compare(firstPos.getData().cbegin(), firstPos.getData().cend(),
+                                        secondPos.getData().cbegin(), secondPos.getData().cend());
+  });
+
+  std::vector<std::uint32_t> weldedIds(vertices.size());
+  std::uint32_t weldedCount = 0;
+
+  for (std::size_t i = 0; i < sortedVertices.size(); ++i) {
+    if (i > 0 && !(vertices[sortedVertices[i]].position == vertices[sortedVertices[i - 1]].position))
+      ++weldedCount;
+
+    weldedIds[sortedVertices[i]] = weldedCount;
+  }
+
+  m_vertexNormals.resize(vertices.empty() ? 0 : weldedCount + 1, Vec3f(0.f));
+  m_triangleNormals.resize(indices.size() / 3);
+
+  std::unordered_map<std::uint64_t, Vec3f> edgeNormals;
+
+  const auto computeEdgeKey = [] (std::uint32_t firstId, std::uint32_t secondId) {
+    return (static_cast<std::uint64_t>(std::min(firstId, secondId)) << 32u) | std::max(firstId, secondId);
+  };
+
+  for (std::size_t triIndex = 0; triIndex < m_triangleNormals.size(); ++triIndex) {
+    TriangleNormals& triangle = m_triangleNormals[triIndex];
+    std::array<Vec3f, 3> positions {};
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int vertIndex = indices[triIndex * 3 + i];
+      positions[i]          = vertices[vertIndex].position;
+      triangle.vertexIds[i] = weldedIds[vertIndex];
+    }
+
+    const Vec3f normal       = (positions[1] - positions[0]).cross(positions[2] - positions[0]);
+    const float normalLength = normal.computeLength();
+
+    // Degenerate triangles have no normal, & thus don't contribute to their neighbors' pseudonormals
+    if (normalLength <= 0.f)
+      continue;
+
+    triangle.faceNormal = normal / normalLength;
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      const Vec3f firstEdge  = positions[(i + 1) % 3] - positions[i];
+      const Vec3f secondEdge = positions[(i + 2) % 3] - positions[i];
+      const float cosAngle   = firstEdge.dot(secondEdge) / (firstEdge.computeLength() * secondEdge.computeLength());
+
+      m_vertexNormals[triangle.vertexIds[i]] += triangle.faceNormal * std::acos(std::max(-1.f, std::min(cosAngle, 1.f)));
+      edgeNormals[computeEdgeKey(triangle.vertexIds[i], triangle.vertexIds[(i + 1) % 3])] += triangle.faceNormal;
+    }
+  }
+
+  for (TriangleNormals& triangle : m_triangleNormals) {
+    for (std::size_t i = 0; i < 3; ++i)
+      triangle.edgeNormals[i] = edgeNormals[computeEdgeKey(triangle.vertexIds[i], triangle.vertexIds[(i + 1) % 3])];
+  }
+}
+
+float MeshDistance::compute(const Vec3f& point, float maxDistance) const {
+  TriangleBvh::ClosestPoint closestPoint;
+
+  if (!m_bvh.findClosestPoint(point, closestPoint, maxDistance) && !m_bvh.findClosestPoint(point, closestPoint))
+    return std::numeric_limits<float>::max();
+
+  const std::size_t firstIndex    = closestPoint.triangleIndex * 3;
+  const Vec3f& firstPos           = m_vertices[m_indices[firstIndex]].position;
+  const TriangleNormals& triangle = m_triangleNormals[closestPoint.triangleIndex];
+
+  // The closest point's barycentric coordinates tell on which feature it lies: a null coordinate means it is on the opposite edge,
+  //  two null ones that it is on the remaining vertex
+  const Vec3f firstEdge  = m_vertices[m_indices[firstIndex + 1]].position - firstPos;
+  const Vec3f secondEdge = m_vertices[m_indices[firstIndex + 2]].position - firstPos;
+  const Vec3f pointDir   = closestPoint.position - firstPos;
+
+  const float firstDot1  = firstEdge.dot(firstEdge);
+  const float firstDot2  = firstEdge.dot(secondEdge);
+  const float secondDot2 = secondEdge.dot(secondEdge);
+  const float pointDot1  = pointDir.dot(firstEdge);
+  const float pointDot2  = pointDir.dot(secondEdge);
+  const float denominator = firstDot1 * secondDot2 - firstDot2 * firstDot2;
+
+  Vec3f pseudonormal = triangle.faceNormal;
+
+  if (denominator > 0.f) {
+    const float secondCoord = (secondDot2 * pointDot1 - firstDot2 * pointDot2) / denominator;
+    const float thirdCoord  = (firstDot1 * pointDot2 - firstDot2 * pointDot1) / denominator;
+    const std::array<float, 3> baryCoords = { 1.f - secondCoord - thirdCoord, secondCoord, thirdCoord };
+
+    std::size_t nullCoordCount = 0;
+    std::size_t nullCoordIndex = 0;
+    std::size_t maxCoordIndex  = 0;
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      if (baryCoords[i] < FeatureTolerance) {
+        ++nullCoordCount;
+        nullCoordIndex = i;
+      }
+
+      if (baryCoords[i] > baryCoords[maxCoordIndex])
+        maxCoordIndex = i;
+    }
+
+    if (nullCoordCount >= 2)
+      pseudonormal = m_vertexNormals[triangle.vertexIds[maxCoordIndex]];
+    else if (nullCoordCount == 1)
+      pseudonormal = triangle.edgeNormals[(nullCoordIndex + 1) % 3];
+  }
+
+  return ((point - closestPoint.position).dot(pseudonormal) < 0.f ? -closestPoint.distance : closestPoint.distance);
+}
+
+} // namespace
+
+Vec3f SignedDistanceField::getMaxBounds() const {
+  return m_minBounds + Vec3f({ static_cast<float>(m_cellCounts[0]),
+                               static_cast<float>(m_cellCounts[1]),
+                               static_cast<float>(m_cellCounts[2]) }) * m_cellSize;
+}
+
+void SignedDistanceField::bake(const Mesh& mesh, float cellSize, float bandWidth) {
+  std::size_t vertexCount = 0;
+  std::size_t indexCount  = 0;
+
+  for (const SubmeshPtr& submesh : mesh.getSubmeshes()) {
+    vertexCount += submesh->getVertexCount();
+    indexCount  += submesh->getIndexCount();
+  }
+
+  std::vector<Vertex> vertices;
+  std::vector<unsigned int> indices;
+  vertices.reserve(vertexCount);
+  indices.reserve(indexCount);
+
+  for (const SubmeshPtr& submeshPtr : mesh.getSubmeshes()) {
+    const Submesh& submesh = *submeshPtr; // Accessed as const, so that its cached bounds are kept
+    const auto indexOffset = static_cast<unsigned int>(vertices.size());
+    const std::vector<unsigned int>& submeshIndices = submesh.getIndices();
+
+    vertices.insert(vertices.end(), submesh.getVertices().cbegin(), submesh.getVertices().cend());
+
+    // Any incomplete triangle is skipped, as it would otherwise shift all the following ones
+    for (std::size_t i = 0; i + 2 < submeshIndices.size(); i += 3) {
+      indices.push_back(submeshIndices[i] + indexOffset);
+      indices.push_back(submeshIndices[i + 1] + indexOffset);
+      indices.push_back(submeshIndices[i + 2] + indexOffset);
+    }
+  }
+
+  bake(vertices, indices, cellSize, bandWidth);
+}
+
+void SignedDistanceField::bake(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, float cellSize, float bandWidth) {
+  assert("Error: The distance field's cell size must be strictly positive." && cellSize > 0.f);
+
+  m_coarseDistances.clear();
+  m_brickIndices.clear();
+  m_brickDistances.clear();
+  m_cellCounts  = {};
+  m_brickCounts = {};
+
+  const std::size_t indexCount = indices.size() - indices.size() % 3;
+
+  if (indexCount == 0)
+    return;
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (std::size_t i = 0; i < indexCount; ++i) {
+    const Vec3f& position = vertices[indices[i]].position;
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      minPos[axis] = std::min(minPos[axis], position[axis]);
+      maxPos[axis] = std::max(maxPos[axis], position[axis]);
+    }
+  }
+
+  const float margin      = bandWidth + cellSize;
+  const float brickExtent = cellSize * static_cast<float>(BrickSize);
+
+  m_minBounds   = minPos - margin;
+  m_cellSize    = cellSize;
+  m_invCellSize = 1.f / cellSize;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float extent  = maxPos[axis] - minPos[axis] + margin * 2.f;
+    m_brickCounts[axis] = std::max(static_cast<std::size_t>(std::ceil(extent / brickExtent)), static_cast<std::size_t>(1));
+    m_cellCounts[axis]  = m_brickCounts[axis] * BrickSize;
+  }
+
+  const MeshDistance meshDistance(vertices, indices);
+
+  // Computing the distances at all bricks' corners. As the distance to a surface can't vary faster than the distance between two points,
+  //  that from the previous corner gives an upper bound for the next one, greatly reducing the number of triangles to be checked
+
+  const std::size_t coarseCountX = m_brickCounts[0] + 1;
+  const std::size_t coarseCountY = m_brickCounts[1] + 1;
+  m_coarseDistances.resize(coarseCountX * coarseCountY * (m_brickCounts[2] + 1));
+
+  Threading::parallelize(0, m_coarseDistances.size(), [this, &meshDistance, coarseCountX, coarseCountY, brickExtent] (std::size_t beginIndex,
+                                                                                                                     std::size_t endIndex) {
+    for (std::size_t cornerIndex = beginIndex; cornerIndex < endIndex; ++cornerIndex) {
+      const std::size_t cornerX = cornerIndex % coarseCountX;
+      const Vec3f position = m_minBounds + Vec3f({ static_cast<float>(cornerX),
+                                                   static_cast<float>((cornerIndex / coarseCountX) % coarseCountY),
+                                                   static_cast<float>(cornerIndex / (coarseCountX * coarseCountY)) }) * brickExtent;
+
+      const float maxDistance = (cornerIndex > beginIndex && cornerX > 0
+                              ? (std::abs(m_coarseDistances[cornerIndex - 1]) + brickExtent) * BoundMargin
+                              : std::numeric_limits<float>::max());
+      m_coarseDistances[cornerIndex] = meshDistance.compute(position, maxDistance);
+    }
+  });
+
+  // Finding the bricks close enough to the surface to be stored at full resolution; since a brick's center can't be closer to the surface
+  //  than its corners minus half its diagonal, most empty bricks can be skipped without searching the triangles
+
+  const float halfDiagonal = brickExtent * std::sqrt(3.f) * 0.5f;
+  const float brickReach   = halfDiagonal + bandWidth;
+  std::vector<std::uint8_t> fineBrickFlags(m_brickCounts[0] * m_brickCounts[1] * m_brickCounts[2]);
+
+  Threading::parallelize(0, fineBrickFlags.size(), [this, &meshDistance, &fineBrickFlags, coarseCountX, coarseCountY, brickExtent,
+                                                    halfDiagonal, brickReach] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t brickIndex = beginIndex; brickIndex < endIndex; ++brickIndex) {
+      const std::size_t brickX = brickIndex % m_brickCounts[0];
+      const std::size_t brickY = (brickIndex / m_brickCounts[0]) % m_brickCounts[1];
+      const std::size_t brickZ = brickIndex / (m_brickCounts[0] * m_brickCounts[1]);
+
+      float minCornerDistance = std::numeric_limits<float>::max();
+
+      for (std::size_t corner = 0; corner < 8; ++corner) {
+        const std::size_t coarseIndex = ((brickZ + (corner >> 2u)) * coarseCountY + brickY + ((corner >> 1u) & 1u)) * coarseCountX
+                                      + brickX + (corner & 1u);
+        minCornerDistance = std::min(minCornerDistance, std::abs(m_coarseDistances[coarseIndex]));
+      }
+
+      if (minCornerDistance - halfDiagonal > brickReach)
+        continue;
+
+      const Vec3f center = m_minBounds + Vec3f({ static_cast<float>(brickX) + 0.5f,
+                                                 static_cast<float>(brickY) + 0.5f,
+                                                 static_cast<float>(brickZ) + 0.5f }) * brickExtent;
+      fineBrickFlags[brickIndex] = meshDistance.isSurfaceWithin(center, brickReach);
+    }
+  });
+
+  std::vector<std::size_t> fineBricks;
+  m_brickIndices.resize(fineBrickFlags.size(), CoarseBrick);
+
+  for (std::size_t brickIndex = 0; brickIndex < fineBrickFlags.size(); ++brickIndex) {
+    if (!fineBrickFlags[brickIndex])
+      continue;
+
+    m_brickIndices[brickIndex] = static_cast<std::uint32_t>(fineBricks.size());
+    fineBricks.push_back(brickIndex);
+  }
+
+  // Computing the distances at all cells' corners of the fine bricks, bounded by the previous one along X as for the coarse distances
+
+  m_brickDistances.resize(fineBricks.size() * BrickSampleCount);
+
+  Threading::parallelize(0, fineBricks.size(), [this, &meshDistance, &fineBricks] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t fineIndex = beginIndex; fineIndex < endIndex; ++fineIndex) {
+      const std::size_t brickIndex = fineBricks[fineIndex];
+      const Vec3f brickOrigin = m_minBounds + Vec3f({ static_cast<float>(brickIndex % m_brickCounts[0]),
+                                                      static_cast<float>((brickIndex / m_brickCounts[0]) % m_brickCounts[1]),
+                                                      static_cast<float>(brickIndex / (m_brickCounts[0] * m_brickCounts[1])) })
+                                                  * (m_cellSize * static_cast<float>(BrickSize));
+      float* brickDistances = m_brickDistances.data() + fineIndex * BrickSampleCount;
+
+      for (std::size_t sampleIndex = 0; sampleIndex < BrickSampleCount; ++sampleIndex) {
+        const std::size_t sampleX = sampleIndex % (BrickSize + 1);
+        const Vec3f position = brickOrigin + Vec3f({ static_cast<float>(sampleX),
+                                                     static_cast<float>((sampleIndex / (BrickSize + 1)) % (BrickSize + 1)),
+                                                     static_cast<float>(sampleIndex / ((BrickSize + 1) * (BrickSize + 1))) }) * m_cellSize;
+
+        const float maxDistance = (sampleX > 0 ? (std::abs(brickDistances[sampleIndex - 1]) + m_cellSize) * BoundMargin
+                                               : std::numeric_limits<float>::max());
+        brickDistances[sampleIndex] = meshDistance.compute(position, maxDistance);
+      }
+    }
+  });
+}
+
+float SignedDistanceField::computeDistance(const Vec3f& point) const {
+  return sample(point, nullptr);
+}
+
+float SignedDistanceField::computeDistance(const Vec3f& point, Vec3f& normal) const {
+  Vec3f gradient;
+  const float distance = sample(point, &gradient);
+
+  const float gradientLength = gradient.computeLength();
+  normal = (gradientLength > 0.f ? gradient / gradientLength : Vec3f(0.f));
+
+  return distance;
+}
+
+Vec3f SignedDistanceField::computeNormal(const Vec3f& point) const {
+  Vec3f normal;
+  computeDistance(point, normal);
+  return normal;
+}
+
+void SignedDistanceField::computeDistances(const Vec3fArray& points, std::vector<float>& distances) const {
+  sampleBatch(points, distances, nullptr);
+}
+
+void SignedDistanceField::computeDistances(const Vec3fArray& points, std::vector<float>& distances, Vec3fArray& normals) const {
+  sampleBatch(points, distances, &normals);
+}
+
+void SignedDistanceField::fetchCellDistances(std::size_t cellX, std::size_t cellY, std::size_t cellZ, std::array<float, 8>& distances) const {
+  const std::size_t brickX = cellX / BrickSize;
+  const std::size_t brickY = cellY / BrickSize;
+  const std::size_t brickZ = cellZ / BrickSize;
+  const std::size_t localX = cellX % BrickSize;
+  const std::size_t localY = cellY % BrickSize;
+  const std::size_t localZ = cellZ % BrickSize;
+
+  const std::uint32_t fineIndex = m_brickIndices[(brickZ * m_brickCounts[1] + brickY) * m_brickCounts[0] + brickX];
+
+  if (fineIndex != CoarseBrick) {
+    constexpr std::size_t rowStride   = BrickSize + 1;
+    constexpr std::size_t sliceStride = rowStride * rowStride;
+
+    const float* firstDistance = m_brickDistances.data() + fineIndex * BrickSampleCount + localZ * sliceStride + localY * rowStride + localX;
+    distances = { firstDistance[0],                         firstDistance[1],
+                  firstDistance[rowStride],                 firstDistance[rowStride + 1],
+                  firstDistance[sliceStride],               firstDistance[sliceStride + 1],
+                  firstDistance[sliceStride + rowStride],   firstDistance[sliceStride + rowStride + 1] };
+    return;
+  }
+
+  // The cell's corners are interpolated from the brick's ones; the trilinear interpolation of these gives exactly that of the brick
+  const std::size_t rowStride   = m_brickCounts[0] + 1;
+  const std::size_t sliceStride = rowStride * (m_brickCounts[1] + 1);
+
+  const float* firstDistance = m_coarseDistances.data() + brickZ * sliceStride + brickY * rowStride + brickX;
+  const std::array<float, 8> brickDistances = { firstDistance[0],                         firstDistance[1],
+                                                firstDistance[rowStride],                 firstDistance[rowStride + 1],
+                                                firstDistance[sliceStride],               firstDistance[sliceStride + 1],
+                                                firstDistance[sliceStride + rowStride],   firstDistance[sliceStride + rowStride + 1] };
+
+  constexpr float invBrickSize = 1.f / static_cast<float>(BrickSize);
+
+  for (std::size_t corner = 0; corner < 8; ++corner) {
+    distances[corner] = interpolate(brickDistances,
+                                    static_cast<float>(localX + (corner & 1u)) * invBrickSize,
+                                    static_cast<float>(localY + ((corner >> 1u) & 1u)) * invBrickSize,
+                                    static_cast<float>(localZ + (corner >> 2u)) * invBrickSize);
+  }
+}
+
+float SignedDistanceField::sample(const Vec3f& point, Vec3f* gradient) const {
+  if (isEmpty()) {
+    if (gradient)
+      *gradient = Vec3f(0.f);
+
+    return std::numeric_limits<float>::max();
+  }
+
+  std::array<std::size_t, 3> cell {};
+  std::array<float, 3> coeffs {};
+  float sqOutsideDistance = 0.f;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float maxCoord     = static_cast<float>(m_cellCounts[axis]);
+    const float gridCoord    = (point[axis] - m_minBounds[axis]) * m_invCellSize;
+    const float clampedCoord = std::min(std::max(gridCoord, 0.f), maxCoord);
+    const float cellCoord    = std::min(std::floor(clampedCoord), maxCoord - 1.f);
+
+    const float outsideDistance = (gridCoord - clampedCoord) * m_cellSize;
+    sqOutsideDistance += outsideDistance * outsideDistance;
+
+    cell[axis]   = static_cast<std::size_t>(cellCoord);
+    coeffs[axis] = clampedCoord - cellCoord;
+  }
+
+  std::array<float, 8> distances {};
+  fetchCellDistances(cell[0], cell[1], cell[2], distances);
+
+  if (gradient) {
+    // Derivatives of the trilinear interpolation along each axis; their common scale doesn't matter, the gradient being normalized afterward
+    (*gradient)[0] = interpolate(interpolate(distances[1] - distances[0], distances[3] - distances[2], coeffs[1]),
+                                 interpolate(distances[5] - distances[4], distances[7] - distances[6], coeffs[1]), coeffs[2]);
+    (*gradient)[1] = interpolate(interpolate(distances[2] - distances[0], distances[3] - distances[1], coeffs[0]),
+                                 interpolate(distances[6] - distances[4], distances[7] - distances[5], coeffs[0]), coeffs[2]);
+    (*gradient)[2] = interpolate(interpolate(distances[4] - distances[0], distances[5] - distances[1], coeffs[0]),
+                                 interpolate(distances[6] - distances[2], distances[7] - distances[3], coeffs[0]), coeffs[1]);
+  }
+
+  return interpolate(distances, coeffs[0], coeffs[1], coeffs[2]) + std::sqrt(sqOutsideDistance);
+}
+
+void SignedDistanceField::sampleBatch(const Vec3fArray& points, std::vector<float>& distances, Vec3fArray* normals) const {
+  const std::size_t pointCount = points.getSize();
+  distances.resize(pointCount);
+
+  if (normals)
+    normals->resize(pointCount);
+
+  if (isEmpty()) {
+    std::fill(distances.begin(), distances.end(), std::numeric_limits<float>::max());
+
+    if (normals) {
+      std::fill(normals->getX().begin(), normals->getX().end(), 0.f);
+      std::fill(normals->getY().begin(), normals->getY().end(), 0.f);
+      std::fill(normals->getZ().begin(), normals->getZ().end(), 0.f);
+    }
+
+    return;
+  }
+
+  // Grid coordinates & interpolations are computed Simd::Width points at a time; only the cells' distances are fetched point by point,
+  //  their location depending on whether their brick is fine or coarse
+
+  const std::array<const float*, 3> coords = { points.getX().data(), points.getY().data(), points.getZ().data() };
+  const std::size_t simdPointCount = pointCount - pointCount % Simd::Width;
+
+  std::array<std::array<float, Simd::Width>, 3> cells {};
+  std::array<std::array<float, Simd::Width>, 8> cornerDistances {};
+  std::array<float, 8> cellDistances {};
+
+  for (std::size_t pointIndex = 0; pointIndex < simdPointCount; pointIndex += Simd::Width) {
+    Simd::Float coeffs[3];
+    Simd::Float sqOutsideDistances = Simd::set(0.f);
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      const Simd::Float maxCoord      = Simd::set(static_cast<float>(m_cellCounts[axis]));
+      const Simd::Float gridCoords    = Simd::mul(Simd::sub(Simd::load(coords[axis] + pointIndex), Simd::set(m_minBounds[axis])),
+                                                  Simd::set(m_invCellSize));
+      const Simd::Float clampedCoords = Simd::min(Simd::max(gridCoords, Simd::set(0.f)), maxCoord);
+      const Simd::Float cellCoords    = Simd::min(Simd::floor(clampedCoords), Simd::sub(maxCoord, Simd::set(1.f)));
+
+      const Simd::Float outsideDistances = Simd::mul(Simd::sub(gridCoords, clampedCoords), Simd::set(m_cellSize));
+      sqOutsideDistances = Simd::add(sqOutsideDistances, Simd::mul(outsideDistances, outsideDistances));
+
+      Simd::store(cells[axis].data(), cellCoords);
+      coeffs[axis] = Simd::sub(clampedCoords, cellCoords);
+    }
+
+    for (std::size_t lane = 0; lane < Simd::Width; ++lane) {
+      fetchCellDistances(static_cast<std::size_t>(cells[0][lane]),
+                         static_cast<std::size_t>(cells[1][lane]),
+                         static_cast<std::size_t>(cells[2][lane]),
+                         cellDistances);
+
+      for (std::size_t corner = 0; corner < 8; ++corner)
+        cornerDistances[corner][lane] = cellDistances[corner];
+    }
+
+    Simd::Float corners[8];
+
+    for (std::size_t corner = 0; corner < 8; ++corner)
+      corners[corner] = Simd::load(cornerDistances[corner].data());
+
+    const Simd::Float bottom = interpolateBatch(interpolateBatch(corners[0], corners[1], coeffs[0]), interpolateBatch(corners[2], corners[3], coeffs[0]), coeffs[1]);
+    const Simd::Float top    = interpolateBatch(interpolateBatch(corners[4], corners[5], coeffs[0]), interpolateBatch(corners[6], corners[7], coeffs[0]), coeffs[1]);
+    Simd::store(distances.data() + pointIndex, Simd::add(interpolateBatch(bottom, top, coeffs[2]), Simd::sqrt(sqOutsideDistances)));
+
+    if (!normals)
+      continue;
+
+    const Simd::Float gradientX = interpolateBatch(interpolateBatch(Simd::sub(corners[1], corners[0]), Simd::sub(corners[3], corners[2]), coeffs[1]),
+                                              interpolateBatch(Simd::sub(corners[5], corners[4]), Simd::sub(corners[7], corners[6]), coeffs[1]),
+                                              coeffs[2]);
+    const Simd::Float gradientY = interpolateBatch(interpolateBatch(Simd::sub(corners[2], corners[0]), Simd::sub(corners[3], corners[1]), coeffs[0]),
+                                              interpolateBatch(Simd::sub(corners[6], corners[4]), Simd::sub(corners[7], corners[5]), coeffs[0]),
+                                              coeffs[2]);
+    const Simd::Float gradientZ = interpolateBatch(interpolateBatch(Simd::sub(corners[4], corners[0]), Simd::sub(corners[5], corners[1]), coeffs[0]),
+                                              interpolateBatch(Simd::sub(corners[6], corners[2]), Simd::sub(corners[7], corners[3]), coeffs[0]),
+                                              coeffs[1]);
+
+    // Flat areas have a null gradient, whose normal is left null
+    const Simd::Float sqLengths = Simd::add(Simd::add(Simd::mul(gradientX, gradientX), Simd::mul(gradientY, gradientY)),
+                                            Simd::mul(gradientZ, gradientZ));
+    const Simd::Float invLengths = Simd::select(Simd::lessOrEqual(sqLengths, Simd::set(0.f)),
+                                                Simd::set(0.f),
+                                                Simd::div(Simd::set(1.f), Simd::sqrt(sqLengths)));
+
+    Simd::store(normals->getX().data() + pointIndex, Simd::mul(gradientX, invLengths));
+    Simd::store(normals->getY().data() + pointIndex, Simd::mul(gradientY, invLengths));
+    Simd::store(normals->getZ().data() + pointIndex, Simd::mul(gradientZ, invLengths));
+  }
+
+  for (std::size_t pointIndex = simdPointCount; pointIndex < pointCount; ++pointIndex) {
+    if (!normals) {
+      distances[pointIndex] = sample(points[pointIndex], nullptr);
+      continue;
+    }
+
+    Vec3f normal;
+    distances[pointIndex] = computeDistance(points[pointIndex], normal);
+    normals->set(pointIndex, normal);
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RaZ/Utils/Threading.hpp"
+
+namespace Raz {
+
+namespace Threading {
+
+namespace {
+
+/// Tasks submitted together, whose completion is awaited by the thread which submitted them.
+struct TaskGroup {
+  std::size_t remainingTaskCount {};
+  /// First exception thrown by any of the tasks, to be rethrown to the submitting thread.
+  std::exception_ptr exception {};
+};
+
+/// Pool of threads waiting for tasks to execute, created on first use & living until the program exits, so that no thread is spawned per call.
+/// Threads waiting for their tasks to complete execute pending ones in the meantime; nested submissions thus never deadlock, even with no worker.
+class ThreadPool {
+public:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+
+  static ThreadPool& get() {
+    // The calling thread always executes tasks as well
+    static ThreadPool pool(getSystemThreadCount() - 1);
+    return pool;
+  }
+
+  /// Executes a function for each task index, the calling thread executing the last one itself & helping with pending tasks until all are done.
+  /// If any task throws, the first exception is rethrown once all tasks have completed.
+  /// \param taskCount Number of tasks to be executed.
+  /// \param function Function to be called with each task's index.
+  void execute(std::size_t taskCount, const std::function<void(std::size_t)>& function) {
+    if (taskCount == 0)
+      return;
+
+    TaskGroup group;
+    group.remainingTaskCount = taskCount;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (std::size_t taskIndex = 0; taskIndex < taskCount - 1; ++taskIndex)
+      m_tasks.push_back(Task{ &function, taskIndex, &group });
+
+    m_taskCondition.notify_all();
+
+    executeTask(Task{ &function, taskCount - 1, &group }, lock);
+
+    while (group.remainingTaskCount > 0) {
+      if (m_tasks.empty()) {
+        m_groupCondition.wait(lock);
+        continue;
+      }
+
+      // The most recently submitted tasks are taken first, as they are most likely to be the awaited ones
+      const Task task = m_tasks.back();
+      m_tasks.pop_back();
+      executeTask(task, lock);
+    }
+
+    if (group.exception)
+      std::rethrow_exception(group.exception);
+  }
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isStopping = true;
+    }
+
+    m_taskCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+      worker.join();
+  }
+
+private:
+  struct Task {
+    const std::function<void(std::size_t)>* function;
+    std::size_t index;
+    TaskGroup* group;
+  };
+
+  explicit ThreadPool(unsigned int workerCount) {
+    m_workers.reserve(workerCount);
+
+    for (unsigned int workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+      m_workers.emplace_back([this] () { runWorker(); });
+  }
+
+  void runWorker() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true) {
+      m_taskCondition.wait(lock, [this] () { return (m_isStopping || !m_tasks.empty()); });
+
+      if (m_tasks.empty())
+        return;
+
+      const Task task = m_tasks.front();
+      m_tasks.pop_front();
+      executeTask(task, lock);
+    }
+  }
+
+  /// Executes a task, the lock being released meanwhile.
+  /// \param task Task to be executed.
+  /// \param lock Lock on the pool's mutex, held before & after the call.
+  void executeTask(const Task& task, std::unique_lock<std::mutex>& lock) {
+    lock.unlock();
+
+    std::exception_ptr exception;
+
+    try {
+      (*task.function)(task.index);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    lock.lock();
+
+    if (exception && !task.group->exception)
+      task.group->exception = exception;
+
+    if (--task.group->remainingTaskCount == 0)
+      m_groupCondition.notify_all();
+  }
+
+  std::vector<std::thread> m_workers {};
+  std::deque<Task> m_tasks {};
+  std::mutex m_mutex {};
+  std::condition_variable m_taskCondition {};
+  std::condition_variable m_groupCondition {};
+  bool m_isStopping = false;
+};
+
+} // namespace
+
+unsigned int getSystemThreadCount() {
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void parallelize(std::size_t beginIndex, std::size_t endIndex,
+                 const std::function<void(std::size_t, std::size_t)>& action,
+                 unsigned int threadCount) {
+  if (endIndex <= beginIndex)
+    return;
+
+  const std::size_t rangeSize  = endIndex - beginIndex;
+  const std::size_t chunkCount = std::min(static_cast<std::size_t>(threadCount == 0 ? getSystemThreadCount() : threadCount), rangeSize);
+  const std::size_t chunkSize  = rangeSize / chunkCount;
+  const std::size_t remainder  = rangeSize % chunkCount;
+
+  ThreadPool::get().execute(chunkCount, [beginIndex, chunkSize, remainder, &action] (std::size_t chunkIndex) {
+    // The remainder is spread over the first chunks, so that no chunk is more than one element larger than another
+    const std::size_t chunkBegin = beginIndex + chunkIndex * chunkSize + std::min(chunkIndex, remainder);
+    const std::size_t chunkEnd   = chunkBegin + chunkSize + (chunkIndex < remainder ? 1 : 0);
+
+    action(chunkBegin, chunkEnd);
+  });
+}
+
+void parallelizeDynamic(std::size_t indexCount, const std::function<void(std::size_t, std::size_t)>& action, unsigned int threadCount) {
+  const std::size_t usedThreadCount = std::min(static_cast<std::size_t>(threadCount == 0 ? getSystemThreadCount() : threadCount), indexCount);
+  std::atomic<std::size_t> nextIndex(0);
+
+  ThreadPool::get().execute(usedThreadCount, [indexCount, &action, &nextIndex] (std::size_t threadIndex) {
+    for (std::size_t index = nextIndex++; index < indexCount; index = nextIndex++)
+      action(index, threadIndex);
+  });
+}
+
+void parallelize(std::initializer_list<std::function<void()>> actions) {
+  ThreadPool::get().execute(actions.size(), [&actions] (std::size_t actionIndex) {
+    (*(actions.begin() + actionIndex))();
+  });
+}
+
+} // namespace Threading
+
+} // namespace Raz
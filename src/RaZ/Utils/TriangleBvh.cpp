@@ -0,0 +1,1117 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "RaZ/Render/Submesh.hpp"
+#include "RaZ/Utils/BvhUtils.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+namespace Raz {
+
+static_assert(sizeof(TriangleBvh::Node) == 32, "Error: A BVH node is expected to be 32 bytes large.");
+
+namespace {
+
+constexpr std::size_t BinCount             = 16;
+constexpr std::size_t MaxLeafTriangles     = 8;
+constexpr std::size_t MinParallelTriangles = 16384;
+
+// Past this depth, triangles are split in halves: the remaining depth being logarithmic, the traversal stack can never overflow
+constexpr std::size_t MaxSahDepth       = 32;
+constexpr std::size_t MaxTraversalDepth = 64;
+
+// Minimum number of node pairs per thread from which two hierarchies are traversed in parallel, their subtrees' costs being very uneven
+constexpr std::size_t MinNodePairsPerThread = 16;
+
+// Relative costs of traversing a node & of intersecting a triangle, used by the surface area heuristic
+constexpr float TraversalCost    = 1.f;
+constexpr float IntersectionCost = 1.f;
+
+struct Bounds {
+  Vec3f min = Vec3f(std::numeric_limits<float>::max());
+  Vec3f max = Vec3f(std::numeric_limits<float>::lowest());
+
+  void extend(const Vec3f& point) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      min[i] = std::min(min[i], point[i]);
+      max[i] = std::max(max[i], point[i]);
+    }
+  }
+
+  void extend(const Bounds& bounds) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      min[i] = std::min(min[i], bounds.min[i]);
+      max[i] = std::max(max[i], bounds.max[i]);
+    }
+  }
+
+  float computeHalfArea() const {
+    const Vec3f extent = max - min;
+    return (extent[0] < 0.f ? 0.f : extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0]);
+  }
+};
+
+struct BuildTriangle {
+  Bounds bounds {};
+  Vec3f centroid {};
+  std::uint32_t index {};
+};
+
+struct Bin {
+  Bounds bounds {};
+  std::size_t triangleCount {};
+};
+
+class BvhBuilder {
+public:
+  explicit BvhBuilder(std::vector<BuildTriangle>& triangles) : m_triangles{ triangles } {}
+
+  /// Builds the subtree over the given range of triangles, reordering them so that each leaf's triangles are contiguous.
+  /// \param nodes Nodes of the subtree, the first one being its root. Their offsets are relative to the beginning of this list.
+  /// \param depth Depth of the subtree's root in the whole hierarchy.
+  /// \param parallelDepth Number of levels for which both children are built in parallel.
+  void build(std::size_t beginIndex, std::size_t endIndex, std::vector<TriangleBvh::Node>& nodes, std::size_t depth, unsigned int parallelDepth) const {
+    const std::size_t nodeIndex = nodes.size();
+    nodes.emplace_back();
+
+    Bounds bounds;
+    Bounds centroidBounds;
+
+    for (std::size_t triIndex = beginIndex; triIndex < endIndex; ++triIndex) {
+      bounds.extend(m_triangles[triIndex].bounds);
+      centroidBounds.extend(m_triangles[triIndex].centroid);
+    }
+
+    nodes[nodeIndex].minBounds = bounds.min;
+    nodes[nodeIndex].maxBounds = bounds.max;
+
+    const std::size_t triangleCount = endIndex - beginIndex;
+    const std::size_t middleIndex   = (depth < MaxSahDepth ? findSplit(beginIndex, endIndex, bounds, centroidBounds)
+                                                           : splitMiddle(beginIndex, endIndex, centroidBounds));
+
+    if (middleIndex == beginIndex || middleIndex == endIndex) {
+      nodes[nodeIndex].offset        = static_cast<std::uint32_t>(beginIndex);
+      nodes[nodeIndex].triangleCount = static_cast<std::uint32_t>(triangleCount);
+      return;
+    }
+
+    if (parallelDepth > 0 && triangleCount >= MinParallelTriangles) {
+      // The right subtree is built into its own list as a task of the thread pool, then appended after the left one, built by the calling thread
+      std::vector<TriangleBvh::Node> rightNodes;
+
+      Threading::parallelize({
+        [this, middleIndex, endIndex, &rightNodes, depth, parallelDepth] () { build(middleIndex, endIndex, rightNodes, depth + 1, parallelDepth - 1); },
+        [this, beginIndex, middleIndex, &nodes, depth, parallelDepth] () { build(beginIndex, middleIndex, nodes, depth + 1, parallelDepth - 1); }
+      });
+
+      const auto rightOffset = static_cast<std::uint32_t>(nodes.size());
+      nodes[nodeIndex].offset = rightOffset;
+
+      for (TriangleBvh::Node& node : rightNodes) {
+        if (!node.isLeaf())
+          node.offset += rightOffset;
+      }
+
+      nodes.insert(nodes.end(), rightNodes.cbegin(), rightNodes.cend());
+    } else {
+      build(beginIndex, middleIndex, nodes, depth + 1, 0);
+
+      nodes[nodeIndex].offset = static_cast<std::uint32_t>(nodes.size());
+      build(middleIndex, endIndex, nodes, depth + 1, 0);
+    }
+  }
+
+private:
+  /// Finds the best split of the given triangles according to the surface area heuristic, & partitions them accordingly.
+  /// \return Index of the first triangle of the right subset; if equal to either end of the range, a leaf should be made instead.
+  std::size_t findSplit(std::size_t beginIndex, std::size_t endIndex, const Bounds& bounds, const Bounds& centroidBounds) const {
+    const std::size_t triangleCount = endIndex - beginIndex;
+
+    float bestCost = std::numeric_limits<float>::max();
+    std::size_t bestAxis  = 0;
+    std::size_t bestSplit = 0;
+
+    // Binning the triangles on all axes at once, so that they are only read once
+    std::array<std::array<Bin, BinCount>, 3> axisBins {};
+    const Vec3f centroidExtent = centroidBounds.max - centroidBounds.min;
+    const Vec3f binScales({ (centroidExtent[0] > 0.f ? static_cast<float>(BinCount) / centroidExtent[0] : 0.f),
+                            (centroidExtent[1] > 0.f ? static_cast<float>(BinCount) / centroidExtent[1] : 0.f),
+                            (centroidExtent[2] > 0.f ? static_cast<float>(BinCount) / centroidExtent[2] : 0.f) });
+
+    for (std::size_t triIndex = beginIndex; triIndex < endIndex; ++triIndex) {
+      const BuildTriangle& triangle = m_triangles[triIndex];
+
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        Bin& bin = axisBins[axis][computeBinIndex(triangle.centroid[axis], centroidBounds.min[axis], binScales[axis])];
+        bin.bounds.extend(triangle.bounds);
+        ++bin.triangleCount;
+      }
+    }
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if (centroidExtent[axis] <= 0.f)
+        continue;
+
+      const std::array<Bin, BinCount>& bins = axisBins[axis];
+
+      // Sweeping from the right to accumulate the costs of each right subset, then from the left to evaluate every split plane
+      std::array<float, BinCount> rightCosts {};
+      std::array<std::size_t, BinCount> rightCounts {};
+      Bounds rightBounds;
+      std::size_t rightCount = 0;
+
+      for (std::size_t binIndex = BinCount - 1; binIndex > 0; --binIndex) {
+        rightBounds.extend(bins[binIndex].bounds);
+        rightCount += bins[binIndex].triangleCount;
+        rightCosts[binIndex]  = rightBounds.computeHalfArea() * static_cast<float>(rightCount);
+        rightCounts[binIndex] = rightCount;
+      }
+
+      Bounds leftBounds;
+      std::size_t leftCount = 0;
+
+      for (std::size_t binIndex = 0; binIndex < BinCount - 1; ++binIndex) {
+        leftBounds.extend(bins[binIndex].bounds);
+        leftCount += bins[binIndex].triangleCount;
+
+        if (leftCount == 0 || rightCounts[binIndex + 1] == 0)
+          continue;
+
+        const float cost = leftBounds.computeHalfArea() * static_cast<float>(leftCount) + rightCosts[binIndex + 1];
+
+        if (cost < bestCost) {
+          bestCost  = cost;
+          bestAxis  = axis;
+          bestSplit = binIndex + 1;
+        }
+      }
+    }
+
+    // If no split is worth more than intersecting all triangles at once, a leaf is made if small enough
+    const float leafCost  = static_cast<float>(triangleCount) * IntersectionCost;
+    const float splitCost = TraversalCost + bestCost * IntersectionCost / bounds.computeHalfArea();
+
+    if (triangleCount <= MaxLeafTriangles && splitCost >= leafCost)
+      return beginIndex;
+
+    // If all centroids are identical, no split can be found; the leaf would be too large, so the triangles are split in halves
+    if (bestCost == std::numeric_limits<float>::max())
+      return splitMiddle(beginIndex, endIndex, centroidBounds);
+
+    const float minCentroid = centroidBounds.min[bestAxis];
+    const float binScale    = static_cast<float>(BinCount) / (centroidBounds.max[bestAxis] - minCentroid);
+
+    const auto middleIter = std::partition(m_triangles.begin() + static_cast<std::ptrdiff_t>(beginIndex),
+                                           m_triangles.begin() + static_cast<std::ptrdiff_t>(endIndex),
+                                           [bestAxis, bestSplit, minCentroid, binScale] (const BuildTriangle& triangle) {
+      return (computeBinIndex(triangle.centroid[bestAxis], minCentroid, binScale) < bestSplit);
+    });
+
+    return static_cast<std::size_t>(middleIter - m_triangles.begin());
+  }
+
+  /// Splits the given triangles in two halves along the axis on which their centroids are the most spread.
+  /// \return Index of the first triangle of the right half.
+  std::size_t splitMiddle(std::size_t beginIndex, std::size_t endIndex, const Bounds& centroidBounds) const {
+    const std::size_t triangleCount = endIndex - beginIndex;
+
+    if (triangleCount <= MaxLeafTriangles)
+      return beginIndex;
+
+    const Vec3f centroidExtent = centroidBounds.max - centroidBounds.min;
+    const std::size_t axis = (centroidExtent[0] > centroidExtent[1] ? (centroidExtent[0] > centroidExtent[2] ? 0 : 2)
+                                                                    : (centroidExtent[1] > centroidExtent[2] ? 1 : 2));
+
+    const std::size_t middleIndex = beginIndex + triangleCount / 2;
+    std::nth_element(m_triangles.begin() + static_cast<std::ptrdiff_t>(beginIndex),
+                     m_triangles.begin() + static_cast<std::ptrdiff_t>(middleIndex),
+                     m_triangles.begin() + static_cast<std::ptrdiff_t>(endIndex),
+                     [axis] (const BuildTriangle& tri1, const BuildTriangle& tri2) { return tri1.centroid[axis] < tri2.centroid[axis]; });
+
+    return middleIndex;
+  }
+
+  static std::size_t computeBinIndex(float centroid, float minCentroid, float binScale) {
+    return std::min(static_cast<std::size_t>((centroid - minCentroid) * binScale), BinCount - 1);
+  }
+
+  std::vector<BuildTriangle>& m_triangles;
+};
+
+/// Computes the time at which a shape moving from the origin enters a node's box, expanded by the shape's extent along each axis.
+/// \return Entry time, or the maximal float value if the expanded box is missed or is entered beyond the given maximal time.
+inline float computeEntryTime(const TriangleBvh::Node& node, const Vec3f& origin, const Vec3f& invDisplacement, const Vec3f& extent, float maxTime) {
+  float minTime = 0.f;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    float firstTime  = (node.minBounds[axis] - extent[axis] - origin[axis]) * invDisplacement[axis];
+    float secondTime = (node.maxBounds[axis] + extent[axis] - origin[axis]) * invDisplacement[axis];
+
+    if (firstTime > secondTime)
+      std::swap(firstTime, secondTime);
+
+    minTime = (firstTime > minTime ? firstTime : minTime);
+    maxTime = (secondTime < maxTime ? secondTime : maxTime);
+  }
+
+  return (minTime <= maxTime ? minTime : std::numeric_limits<float>::max());
+}
+
+inline float computeSquaredDistance(const TriangleBvh::Node& node, const Vec3f& position) {
+  float sqDistance = 0.f;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    const float distance = std::max(node.minBounds[axis] - position[axis], 0.f) + std::max(position[axis] - node.maxBounds[axis], 0.f);
+    sqDistance += distance * distance;
+  }
+
+  return sqDistance;
+}
+
+/// Möller-Trumbore ray-triangle intersection test.
+/// \return True if the triangle is hit strictly in front of the ray's origin & closer than the given distance, false otherwise.
+inline bool intersectTriangle(const TriangleBvh::Triangle& triangle, const Ray& ray, float maxDistance,
+                              float& hitDistance, float& firstBaryCoord, float& secondBaryCoord) {
+  const Vec3f pVec        = ray.getDirection().cross(triangle.secondEdge);
+  const float determinant = triangle.firstEdge.dot(pVec);
+
+  if (determinant == 0.f)
+    return false;
+
+  const float invDeterm = 1.f / determinant;
+
+  const Vec3f invPlaneDir = ray.getOrigin() - triangle.firstPos;
+  firstBaryCoord = invPlaneDir.dot(pVec) * invDeterm;
+
+  if (firstBaryCoord < 0.f || firstBaryCoord > 1.f)
+    return false;
+
+  const Vec3f qVec = invPlaneDir.cross(triangle.firstEdge);
+  secondBaryCoord = ray.getDirection().dot(qVec) * invDeterm;
+
+  if (secondBaryCoord < 0.f || firstBaryCoord + secondBaryCoord > 1.f)
+    return false;
+
+  hitDistance = triangle.secondEdge.dot(qVec) * invDeterm;
+
+  return (hitDistance > 0.f && hitDistance < maxDistance);
+}
+
+/// Sweeps a sphere against a point, which amounts to casting a ray from the sphere's center against a sphere centered on the point.
+inline bool sweepSpherePoint(const Vec3f& center, float radius, const Vec3f& displacement, const Vec3f& point,
+                             float& hitTime, Vec3f& hitNormal) {
+  const Vec3f relativePos  = center - point;
+  const float sqDispLength = displacement.dot(displacement);
+  const float halfB        = relativePos.dot(displacement);
+
+  if (sqDispLength == 0.f || halfB >= 0.f)
+    return false;
+
+  const float discriminant = halfB * halfB - sqDispLength * (relativePos.dot(relativePos) - radius * radius);
+
+  if (discriminant < 0.f)
+    return false;
+
+  const float time = (-halfB - std::sqrt(discriminant)) / sqDispLength;
+
+  if (time < 0.f || time >= hitTime)
+    return false;
+
+  hitTime   = time;
+  hitNormal = (relativePos + displacement * time).normalize();
+  return true;
+}
+
+/// Sweeps a sphere against a segment, which amounts to casting a ray from the sphere's center against a capsule around the segment.
+inline bool sweepSphereSegment(const Vec3f& center, float radius, const Vec3f& displacement, const Vec3f& firstPos, const Vec3f& secondPos,
+                               float& hitTime, Vec3f& hitNormal) {
+  const Vec3f edge         = secondPos - firstPos;
+  const Vec3f relativePos  = center - firstPos;
+  const float sqEdgeLength = edge.dot(edge);
+  const float edgeDisp     = edge.dot(displacement);
+  const float edgeRelPos   = edge.dot(relativePos);
+
+  bool hasHit = false;
+
+  // Infinite cylinder around the segment, any hit being kept only if it lies between both ends
+  const float quadA = sqEdgeLength * displacement.dot(displacement) - edgeDisp * edgeDisp;
+
+  if (quadA > 0.f) {
+    const float halfB        = sqEdgeLength * relativePos.dot(displacement) - edgeRelPos * edgeDisp;
+    const float quadC        = sqEdgeLength * (relativePos.dot(relativePos) - radius * radius) - edgeRelPos * edgeRelPos;
+    const float discriminant = halfB * halfB - quadA * quadC;
+
+    if (halfB < 0.f && discriminant >= 0.f) {
+      const float time     = (-halfB - std::sqrt(discriminant)) / quadA;
+      const float edgeCoef = (edgeRelPos + time * edgeDisp) / sqEdgeLength;
+
+      if (time >= 0.f && time < hitTime && edgeCoef >= 0.f && edgeCoef <= 1.f) {
+        hitTime   = time;
+        hitNormal = (relativePos + displacement * time - edge * edgeCoef).normalize();
+        hasHit    = true;
+      }
+    }
+  }
+
+  // Spheres capping both ends
+  hasHit |= sweepSpherePoint(center, radius, displacement, firstPos, hitTime, hitNormal);
+  hasHit |= sweepSpherePoint(center, radius, displacement, secondPos, hitTime, hitNormal);
+
+  return hasHit;
+}
+
+/// Sweeps a sphere against a triangle, which amounts to casting a ray from the sphere's center against the triangle inflated by the radius:
+///  the triangle's face offset along its normal, & capsules around its edges.
+/// \return True if the triangle is touched before the given time, which is then replaced, false otherwise.
+inline bool sweepSphereTriangle(const TriangleBvh::Triangle& triangle, const Vec3f& center, float radius, const Vec3f& displacement,
+                                float& hitTime, Vec3f& hitNormal) {
+  const Vec3f secondPos = triangle.firstPos + triangle.firstEdge;
+  const Vec3f thirdPos  = triangle.firstPos + triangle.secondEdge;
+
+  const Vec3f projection  = Raz::Triangle(triangle.firstPos, secondPos, thirdPos).computeProjection(center);
+  const Vec3f separation  = center - projection;
+  const float sqSepLength = separation.computeSquaredLength();
+  Vec3f faceNormal        = triangle.firstEdge.cross(triangle.secondEdge);
+  const float sqNormalLength = faceNormal.computeSquaredLength();
+
+  if (sqSepLength < radius * radius) {
+    // Already overlapping: the contact is immediate if moving towards the triangle, otherwise the sphere is let free to escape it
+    if (hitTime <= 0.f)
+      return false;
+
+    Vec3f normal = (sqSepLength > 0.f ? separation / std::sqrt(sqSepLength)
+                                      : (sqNormalLength > 0.f ? faceNormal / std::sqrt(sqNormalLength) : -displacement.normalize()));
+
+    if (sqSepLength == 0.f && normal.dot(displacement) > 0.f)
+      normal = -normal;
+
+    if (normal.dot(displacement) >= 0.f)
+      return false;
+
+    hitTime   = 0.f;
+    hitNormal = normal;
+    return true;
+  }
+
+  bool hasHit = false;
+
+  if (sqNormalLength > 0.f) {
+    faceNormal /= std::sqrt(sqNormalLength);
+
+    float planeDist = faceNormal.dot(center - triangle.firstPos);
+
+    if (planeDist < 0.f) {
+      faceNormal = -faceNormal;
+      planeDist  = -planeDist;
+    }
+
+    const float normalSpeed = faceNormal.dot(displacement);
+
+    if (normalSpeed < 0.f) {
+      const float time = (planeDist - radius) / -normalSpeed;
+
+      if (time >= 0.f && time < hitTime) {
+        // The contact point must lie within the triangle, which is checked with its barycentric coordinates
+        const Vec3f contactPos   = center + displacement * time - faceNormal * radius - triangle.firstPos;
+        const float firstDot     = triangle.firstEdge.dot(triangle.firstEdge);
+        const float crossDot     = triangle.firstEdge.dot(triangle.secondEdge);
+        const float secondDot    = triangle.secondEdge.dot(triangle.secondEdge);
+        const float firstPosDot  = triangle.firstEdge.dot(contactPos);
+        const float secondPosDot = triangle.secondEdge.dot(contactPos);
+        const float invDenom     = 1.f / (firstDot * secondDot - crossDot * crossDot);
+        const float firstCoord   = (secondDot * firstPosDot - crossDot * secondPosDot) * invDenom;
+        const float secondCoord  = (firstDot * secondPosDot - crossDot * firstPosDot) * invDenom;
+
+        if (firstCoord >= 0.f && secondCoord >= 0.f && firstCoord + secondCoord <= 1.f) {
+          hitTime   = time;
+          hitNormal = faceNormal;
+          hasHit    = true;
+        }
+      }
+    }
+  }
+
+  // If the face has been hit, an edge can only be touched at the same time; they are tested anyway, as the face may have been missed
+  hasHit |= sweepSphereSegment(center, radius, displacement, triangle.firstPos, secondPos, hitTime, hitNormal);
+  hasHit |= sweepSphereSegment(center, radius, displacement, secondPos, thirdPos, hitTime, hitNormal);
+  hasHit |= sweepSphereSegment(center, radius, displacement, thirdPos, triangle.firstPos, hitTime, hitNormal);
+
+  return hasHit;
+}
+
+/// Sweeps an axis-aligned box against a triangle, with the separating axis theorem extended over time: on each potentially separating axis,
+///  the projections of both shapes overlap during a time interval; they touch when all intervals overlap, at the latest entry time.
+/// \return True if the triangle is touched before the given time, which is then replaced, false otherwise.
+inline bool sweepBoxTriangle(const TriangleBvh::Triangle& triangle, const Vec3f& center, const Vec3f& halfExtents, const Vec3f& displacement,
+                             float& hitTime, Vec3f& hitNormal) {
+  // The box is centered on the origin, the triangle being expressed relatively to it
+  const std::array<Vec3f, 3> positions = { triangle.firstPos - center,
+                                           triangle.firstPos + triangle.firstEdge - center,
+                                           triangle.firstPos + triangle.secondEdge - center };
+  const std::array<Vec3f, 3> edges = { triangle.firstEdge, triangle.secondEdge - triangle.firstEdge, triangle.secondEdge };
+
+  std::array<Vec3f, 13> axes = { Axis::X, Axis::Y, Axis::Z, triangle.firstEdge.cross(triangle.secondEdge) };
+
+  for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+    axes[4 + edgeIndex * 3]     = Axis::X.cross(edges[edgeIndex]);
+    axes[4 + edgeIndex * 3 + 1] = Axis::Y.cross(edges[edgeIndex]);
+    axes[4 + edgeIndex * 3 + 2] = Axis::Z.cross(edges[edgeIndex]);
+  }
+
+  const float maxSqEdgeLength = std::max(std::max(edges[0].computeSquaredLength(), edges[1].computeSquaredLength()), edges[2].computeSquaredLength());
+
+  float entryTime = std::numeric_limits<float>::lowest();
+  float exitTime  = std::numeric_limits<float>::max();
+  Vec3f entryNormal;
+
+  float minPenetration = std::numeric_limits<float>::max();
+  Vec3f penetrationNormal;
+
+  for (Vec3f axis : axes) {
+    const float sqAxisLength = axis.computeSquaredLength();
+
+    // Cross products of nearly parallel directions cannot separate anything that the other axes do not
+    if (sqAxisLength <= std::numeric_limits<float>::epsilon() * maxSqEdgeLength)
+      continue;
+
+    axis /= std::sqrt(sqAxisLength);
+
+    const float firstProj  = axis.dot(positions[0]);
+    const float secondProj = axis.dot(positions[1]);
+    const float thirdProj  = axis.dot(positions[2]);
+    const float boxRadius  = halfExtents[0] * std::abs(axis[0]) + halfExtents[1] * std::abs(axis[1]) + halfExtents[2] * std::abs(axis[2]);
+
+    // The box, projected as [-boxRadius, boxRadius] & moving at the given speed, overlaps the triangle when its offset lies in [lower, upper]
+    const float lowerOffset = std::min(std::min(firstProj, secondProj), thirdProj) - boxRadius;
+    const float upperOffset = std::max(std::max(firstProj, secondProj), thirdProj) + boxRadius;
+    const float speed       = axis.dot(displacement);
+
+    if (lowerOffset <= 0.f && upperOffset >= 0.f) {
+      // Pushing the box by either offset would separate them, the smallest one giving the penetration depth
+      if (upperOffset < minPenetration) {
+        minPenetration    = upperOffset;
+        penetrationNormal = axis;
+      }
+
+      if (-lowerOffset < minPenetration) {
+        minPenetration    = -lowerOffset;
+        penetrationNormal = -axis;
+      }
+    }
+
+    if (speed == 0.f) {
+      if (lowerOffset > 0.f || upperOffset < 0.f)
+        return false;
+
+      continue;
+    }
+
+    float axisEntryTime = lowerOffset / speed;
+    float axisExitTime  = upperOffset / speed;
+
+    if (axisEntryTime > axisExitTime)
+      std::swap(axisEntryTime, axisExitTime);
+
+    if (axisEntryTime > entryTime) {
+      entryTime   = axisEntryTime;
+      entryNormal = (speed > 0.f ? -axis : axis);
+    }
+
+    exitTime = std::min(exitTime, axisExitTime);
+
+    if (entryTime > exitTime || exitTime < 0.f || entryTime >= hitTime)
+      return false;
+  }
+
+  if (entryTime >= 0.f) {
+    hitTime   = entryTime;
+    hitNormal = entryNormal;
+    return true;
+  }
+
+  // Already overlapping: as for spheres, the box is let free to escape the triangle
+  if (hitTime <= 0.f || penetrationNormal.dot(displacement) >= 0.f)
+    return false;
+
+  hitTime   = 0.f;
+  hitNormal = penetrationNormal;
+  return true;
+}
+
+/// Sweeps a shape through the hierarchy, nodes being expanded by the shape's extent & tested in the order they are entered.
+/// \param sweepTriangle Function sweeping the shape against a triangle, returning true if touched before the given time & replacing it.
+template <typename SweepFunc>
+bool sweepHierarchy(const std::vector<TriangleBvh::Node>& nodes, const std::vector<TriangleBvh::Triangle>& triangles,
+                    const Vec3f& origin, const Vec3f& displacement, const Vec3f& extent, TriangleBvh::SweepHit& hit, SweepFunc&& sweepTriangle) {
+  if (nodes.empty())
+    return false;
+
+  const Vec3f invDisplacement({ 1.f / displacement[0], 1.f / displacement[1], 1.f / displacement[2] });
+
+  // A displacement slightly longer than 1 is allowed by the boxes, contacts beyond it being rejected by the triangle tests
+  constexpr float MaxTime = 1.f;
+
+  float closestTime = std::nextafter(MaxTime, std::numeric_limits<float>::max());
+  std::size_t closestTriIndex = triangles.size();
+  Vec3f closestNormal;
+
+  const float rootTime = computeEntryTime(nodes.front(), origin, invDisplacement, extent, closestTime);
+
+  if (rootTime == std::numeric_limits<float>::max())
+    return false;
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::array<float, MaxTraversalDepth> stackTimes {};
+  std::size_t stackSize = 0;
+  stack[0]      = 0;
+  stackTimes[0] = rootTime;
+  ++stackSize;
+
+  while (stackSize > 0) {
+    --stackSize;
+
+    if (stackTimes[stackSize] >= closestTime)
+      continue;
+
+    const std::uint32_t nodeIndex = stack[stackSize];
+    const TriangleBvh::Node& node = nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (std::uint32_t triIndex = node.offset; triIndex < node.offset + node.triangleCount; ++triIndex) {
+        if (sweepTriangle(triangles[triIndex], closestTime, closestNormal))
+          closestTriIndex = triIndex;
+      }
+
+      continue;
+    }
+
+    std::uint32_t nearIndex = nodeIndex + 1;
+    std::uint32_t farIndex  = node.offset;
+    float nearTime = computeEntryTime(nodes[nearIndex], origin, invDisplacement, extent, closestTime);
+    float farTime  = computeEntryTime(nodes[farIndex], origin, invDisplacement, extent, closestTime);
+
+    if (farTime < nearTime) {
+      std::swap(nearIndex, farIndex);
+      std::swap(nearTime, farTime);
+    }
+
+    if (farTime != std::numeric_limits<float>::max()) {
+      stack[stackSize]      = farIndex;
+      stackTimes[stackSize] = farTime;
+      ++stackSize;
+    }
+
+    if (nearTime != std::numeric_limits<float>::max()) {
+      stack[stackSize]      = nearIndex;
+      stackTimes[stackSize] = nearTime;
+      ++stackSize;
+    }
+  }
+
+  if (closestTriIndex == triangles.size() || closestTime > MaxTime)
+    return false;
+
+  hit.time          = closestTime;
+  hit.normal        = closestNormal;
+  hit.triangleIndex = triangles[closestTriIndex].index;
+
+  return true;
+}
+
+/// Pair of nodes traversed together, the first one from this hierarchy & the second one from the other.
+using NodePair = std::pair<std::uint32_t, std::uint32_t>;
+
+/// Simultaneous traversal of two hierarchies, the second one's boxes & triangles being brought into the first one's space.
+class HierarchyPairTraverser {
+public:
+  HierarchyPairTraverser(const TriangleBvh& firstBvh, const TriangleBvh& secondBvh, const Mat4f& transform)
+    : m_firstNodes{ firstBvh.getNodes() }, m_firstTriangles{ firstBvh.getTriangles() },
+      m_secondNodes{ secondBvh.getNodes() }, m_secondTriangles{ secondBvh.getTriangles() },
+      m_transform{ transform } {}
+
+  /// Finds the pairs of nodes from which the traversal can be distributed, splitting them level by level from the roots.
+  /// \param minPairCount Number of pairs beyond which no more splitting is done.
+  /// \return Pairs of overlapping nodes, which may be less numerous than required if the hierarchies are small.
+  std::vector<NodePair> computeRootPairs(std::size_t minPairCount) const {
+    std::vector<NodePair> nodePairs;
+
+    if (!overlaps(m_firstNodes.front(), computeTransformedBounds(m_secondNodes.front())))
+      return nodePairs;
+
+    nodePairs.emplace_back(0, 0);
+
+    std::vector<NodePair> nextNodePairs;
+    bool hasSplit = true;
+
+    while (hasSplit && nodePairs.size() < minPairCount) {
+      nextNodePairs.clear();
+      hasSplit = false;
+
+      for (const NodePair& nodePair : nodePairs) {
+        if (split(nodePair, [&nextNodePairs] (const NodePair& childPair) { nextNodePairs.emplace_back(childPair); }))
+          hasSplit = true;
+        else
+          nextNodePairs.emplace_back(nodePair);
+      }
+
+      std::swap(nodePairs, nextNodePairs);
+    }
+
+    return nodePairs;
+  }
+
+  /// Finds the pairs of intersecting triangles under a pair of overlapping nodes.
+  /// \param rootPair Pair of nodes to start from.
+  /// \param stopFlag Flag checked at each step, allowing another thread to stop the traversal.
+  /// \param onIntersection Function called with the original indices of both intersecting triangles, returning false to stop the traversal.
+  /// \return False if the traversal has been stopped, true otherwise.
+  template <typename IntersectionFunc>
+  bool traverse(const NodePair& rootPair, const std::atomic<bool>& stopFlag, IntersectionFunc&& onIntersection) const {
+    // Splitting a pair replaces it by at most 2 others, one level deeper in either hierarchy
+    std::array<NodePair, MaxTraversalDepth * 2> stack {};
+    std::size_t stackSize = 0;
+    stack[stackSize++] = rootPair;
+
+    while (stackSize > 0) {
+      if (stopFlag.load(std::memory_order_relaxed))
+        return false;
+
+      const NodePair nodePair = stack[--stackSize];
+
+      if (split(nodePair, [&stack, &stackSize] (const NodePair& childPair) { stack[stackSize++] = childPair; }))
+        continue;
+
+      if (!intersectLeaves(m_firstNodes[nodePair.first], m_secondNodes[nodePair.second], onIntersection))
+        return false;
+    }
+
+    return true;
+  }
+
+private:
+  /// Computes the box bounding a node of the second hierarchy once transformed, with Arvo's method; see InstanceBvh.
+  Bounds computeTransformedBounds(const TriangleBvh::Node& node) const {
+    Bounds bounds;
+
+    for (std::size_t column = 0; column < 3; ++column) {
+      bounds.min[column] = m_transform[12 + column];
+      bounds.max[column] = bounds.min[column];
+
+      for (std::size_t row = 0; row < 3; ++row) {
+        const float firstVal  = m_transform[row * 4 + column] * node.minBounds[row];
+        const float secondVal = m_transform[row * 4 + column] * node.maxBounds[row];
+
+        bounds.min[column] += std::min(firstVal, secondVal);
+        bounds.max[column] += std::max(firstVal, secondVal);
+      }
+    }
+
+    return bounds;
+  }
+
+  static bool overlaps(const TriangleBvh::Node& node, const Bounds& bounds) {
+    return (node.minBounds[0] <= bounds.max[0] && node.maxBounds[0] >= bounds.min[0]
+         && node.minBounds[1] <= bounds.max[1] && node.maxBounds[1] >= bounds.min[1]
+         && node.minBounds[2] <= bounds.max[2] && node.maxBounds[2] >= bounds.min[2]);
+  }
+
+  /// Splits a pair of nodes into the pairs of their children which overlap. The largest of both nodes is split, unless it is a leaf.
+  /// \param addPair Function called with each overlapping pair of children.
+  /// \return True if a node has been split, false if both are leaves.
+  template <typename AddPairFunc>
+  bool split(const NodePair& nodePair, AddPairFunc&& addPair) const {
+    const TriangleBvh::Node& firstNode  = m_firstNodes[nodePair.first];
+    const TriangleBvh::Node& secondNode = m_secondNodes[nodePair.second];
+
+    if (firstNode.isLeaf() && secondNode.isLeaf())
+      return false;
+
+    const Bounds secondBounds = computeTransformedBounds(secondNode);
+    bool splitFirst = secondNode.isLeaf();
+
+    if (!firstNode.isLeaf() && !splitFirst) {
+      Bounds firstBounds;
+      firstBounds.min = firstNode.minBounds;
+      firstBounds.max = firstNode.maxBounds;
+
+      splitFirst = (firstBounds.computeHalfArea() >= secondBounds.computeHalfArea());
+    }
+
+    if (splitFirst) {
+      const std::array<std::uint32_t, 2> childIndices = { nodePair.first + 1, firstNode.offset };
+
+      for (const std::uint32_t childIndex : childIndices) {
+        if (overlaps(m_firstNodes[childIndex], secondBounds))
+          addPair(NodePair(childIndex, nodePair.second));
+      }
+    } else {
+      const std::array<std::uint32_t, 2> childIndices = { nodePair.second + 1, secondNode.offset };
+
+      for (const std::uint32_t childIndex : childIndices) {
+        if (overlaps(firstNode, computeTransformedBounds(m_secondNodes[childIndex])))
+          addPair(NodePair(nodePair.first, childIndex));
+      }
+    }
+
+    return true;
+  }
+
+  template <typename IntersectionFunc>
+  bool intersectLeaves(const TriangleBvh::Node& firstLeaf, const TriangleBvh::Node& secondLeaf, IntersectionFunc&& onIntersection) const {
+    for (std::uint32_t secondTriIndex = secondLeaf.offset; secondTriIndex < secondLeaf.offset + secondLeaf.triangleCount; ++secondTriIndex) {
+      const TriangleBvh::Triangle& secondTriangle = m_secondTriangles[secondTriIndex];
+      const Raz::Triangle transformedTriangle(BvhUtils::transformPoint(secondTriangle.firstPos, m_transform),
+                                              BvhUtils::transformPoint(secondTriangle.firstPos + secondTriangle.firstEdge, m_transform),
+                                              BvhUtils::transformPoint(secondTriangle.firstPos + secondTriangle.secondEdge, m_transform));
+
+      for (std::uint32_t firstTriIndex = firstLeaf.offset; firstTriIndex < firstLeaf.offset + firstLeaf.triangleCount; ++firstTriIndex) {
+        const TriangleBvh::Triangle& firstTriangle = m_firstTriangles[firstTriIndex];
+        const Raz::Triangle triangle(firstTriangle.firstPos, firstTriangle.firstPos + firstTriangle.firstEdge, firstTriangle.firstPos + firstTriangle.secondEdge);
+
+        if (triangle.intersects(transformedTriangle) && !onIntersection(firstTriangle.index, secondTriangle.index))
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  const std::vector<TriangleBvh::Node>& m_firstNodes;
+  const std::vector<TriangleBvh::Triangle>& m_firstTriangles;
+  const std::vector<TriangleBvh::Node>& m_secondNodes;
+  const std::vector<TriangleBvh::Triangle>& m_secondTriangles;
+  const Mat4f& m_transform;
+};
+
+} // namespace
+
+TriangleBvh::TriangleBvh(const Submesh& submesh) : TriangleBvh(submesh.getVertices(), submesh.getIndices()) {}
+
+void TriangleBvh::build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  m_nodes.clear();
+  m_triangles.clear();
+
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount == 0)
+    return;
+
+  std::vector<BuildTriangle> buildTriangles(triangleCount);
+
+  Threading::parallelize(0, triangleCount, [&vertices, &indices, &buildTriangles] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t triIndex = beginIndex; triIndex < endIndex; ++triIndex) {
+      BuildTriangle& buildTriangle = buildTriangles[triIndex];
+
+      const Vec3f& firstPos  = vertices[indices[triIndex * 3]].position;
+      const Vec3f& secondPos = vertices[indices[triIndex * 3 + 1]].position;
+      const Vec3f& thirdPos  = vertices[indices[triIndex * 3 + 2]].position;
+
+      buildTriangle.bounds.extend(firstPos);
+      buildTriangle.bounds.extend(secondPos);
+      buildTriangle.bounds.extend(thirdPos);
+      buildTriangle.centroid = (firstPos + secondPos + thirdPos) / 3.f;
+      buildTriangle.index    = static_cast<std::uint32_t>(triIndex);
+    }
+  });
+
+  // Subtrees are built in parallel down to the level where there are at least as many of them as threads
+  unsigned int parallelDepth = 0;
+  while ((1u << parallelDepth) < Threading::getSystemThreadCount())
+    ++parallelDepth;
+
+  m_nodes.reserve(triangleCount * 2 / MaxLeafTriangles + 1);
+  BvhBuilder(buildTriangles).build(0, triangleCount, m_nodes, 0, parallelDepth);
+  m_nodes.shrink_to_fit();
+
+  // Storing the triangles in the order of the leaves, for them to be read contiguously during traversals
+  m_triangles.resize(triangleCount);
+
+  Threading::parallelize(0, triangleCount, [this, &vertices, &indices, &buildTriangles] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t triIndex = beginIndex; triIndex < endIndex; ++triIndex) {
+      const std::uint32_t origIndex = buildTriangles[triIndex].index;
+      const Vec3f& firstPos = vertices[indices[origIndex * 3]].position;
+
+      Triangle& triangle  = m_triangles[triIndex];
+      triangle.firstPos   = firstPos;
+      triangle.firstEdge  = vertices[indices[origIndex * 3 + 1]].position - firstPos;
+      triangle.secondEdge = vertices[indices[origIndex * 3 + 2]].position - firstPos;
+      triangle.index      = origIndex;
+    }
+  });
+}
+
+bool TriangleBvh::intersects(const Ray& ray, float maxDistance) const {
+  if (m_nodes.empty())
+    return false;
+
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const Node& node = m_nodes[stack[--stackSize]];
+
+    if (BvhUtils::computeEntryDistance(node, ray.getOrigin(), invDirection, maxDistance) == std::numeric_limits<float>::max())
+      continue;
+
+    if (node.isLeaf()) {
+      for (std::uint32_t triIndex = node.offset; triIndex < node.offset + node.triangleCount; ++triIndex) {
+        float hitDistance {}, firstBaryCoord {}, secondBaryCoord {};
+
+        if (intersectTriangle(m_triangles[triIndex], ray, maxDistance, hitDistance, firstBaryCoord, secondBaryCoord))
+          return true;
+      }
+
+      continue;
+    }
+
+    const auto nodeIndex = static_cast<std::uint32_t>(&node - m_nodes.data());
+    stack[stackSize++] = node.offset;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+
+  return false;
+}
+
+bool TriangleBvh::intersect(const Ray& ray, RayHit& hit, float maxDistance) const {
+  if (m_nodes.empty())
+    return false;
+
+  const Vec3f& direction    = ray.getDirection();
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  float closestDistance = maxDistance;
+  std::size_t closestTriIndex = m_triangles.size();
+  Vec2f closestBaryCoords;
+
+  const float rootDistance = BvhUtils::computeEntryDistance(m_nodes.front(), ray.getOrigin(), invDirection, closestDistance);
+
+  if (rootDistance == std::numeric_limits<float>::max())
+    return false;
+
+  // Each node is stacked alongside its entry distance, so that it can be skipped if a closer hit has been found in the meantime
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::array<float, MaxTraversalDepth> stackDistances {};
+  std::size_t stackSize = 0;
+  stack[0]          = 0;
+  stackDistances[0] = rootDistance;
+  ++stackSize;
+
+  while (stackSize > 0) {
+    --stackSize;
+
+    if (stackDistances[stackSize] >= closestDistance)
+      continue;
+
+    const std::uint32_t nodeIndex = stack[stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (std::uint32_t triIndex = node.offset; triIndex < node.offset + node.triangleCount; ++triIndex) {
+        float hitDistance {}, firstBaryCoord {}, secondBaryCoord {};
+
+        if (intersectTriangle(m_triangles[triIndex], ray, closestDistance, hitDistance, firstBaryCoord, secondBaryCoord)) {
+          closestDistance   = hitDistance;
+          closestTriIndex   = triIndex;
+          closestBaryCoords = Vec2f({ firstBaryCoord, secondBaryCoord });
+        }
+      }
+
+      continue;
+    }
+
+    // Both children are tested before being pushed, the nearest one being visited first so that farther ones can be culled early
+    std::uint32_t nearIndex = nodeIndex + 1;
+    std::uint32_t farIndex  = node.offset;
+    float nearDistance = BvhUtils::computeEntryDistance(m_nodes[nearIndex], ray.getOrigin(), invDirection, closestDistance);
+    float farDistance  = BvhUtils::computeEntryDistance(m_nodes[farIndex], ray.getOrigin(), invDirection, closestDistance);
+
+    if (farDistance < nearDistance) {
+      std::swap(nearIndex, farIndex);
+      std::swap(nearDistance, farDistance);
+    }
+
+    if (farDistance != std::numeric_limits<float>::max()) {
+      stack[stackSize]          = farIndex;
+      stackDistances[stackSize] = farDistance;
+      ++stackSize;
+    }
+
+    if (nearDistance != std::numeric_limits<float>::max()) {
+      stack[stackSize]          = nearIndex;
+      stackDistances[stackSize] = nearDistance;
+      ++stackSize;
+    }
+  }
+
+  if (closestTriIndex == m_triangles.size())
+    return false;
+
+  const Triangle& triangle = m_triangles[closestTriIndex];
+
+  hit.position          = ray.getOrigin() + direction * closestDistance;
+  hit.normal            = triangle.firstEdge.cross(triangle.secondEdge).normalize();
+  hit.distance          = closestDistance;
+  hit.barycentricCoords = closestBaryCoords;
+  hit.triangleIndex     = triangle.index;
+
+  return true;
+}
+
+bool TriangleBvh::findClosestPoint(const Vec3f& position, ClosestPoint& closestPoint, float maxDistance) const {
+  if (m_nodes.empty())
+    return false;
+
+  float closestSqDistance = maxDistance * maxDistance;
+  std::size_t closestTriIndex = m_triangles.size();
+  Vec3f closestPosition;
+
+  // As for ray casts, nodes are stacked alongside their squared distance to the position, the nearest child being visited first
+  std::array<std::uint32_t, MaxTraversalDepth> stack {};
+  std::array<float, MaxTraversalDepth> stackDistances {};
+  std::size_t stackSize = 0;
+  stack[0]          = 0;
+  stackDistances[0] = computeSquaredDistance(m_nodes.front(), position);
+  ++stackSize;
+
+  while (stackSize > 0) {
+    --stackSize;
+
+    if (stackDistances[stackSize] > closestSqDistance)
+      continue;
+
+    const std::uint32_t nodeIndex = stack[stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (std::uint32_t triIndex = node.offset; triIndex < node.offset + node.triangleCount; ++triIndex) {
+        const Triangle& triangle = m_triangles[triIndex];
+        const Vec3f projection   = Raz::Triangle(triangle.firstPos,
+                                                 triangle.firstPos + triangle.firstEdge,
+                                                 triangle.firstPos + triangle.secondEdge).computeProjection(position);
+        const float sqDistance   = (projection - position).computeSquaredLength();
+
+        if (sqDistance <= closestSqDistance) {
+          closestSqDistance = sqDistance;
+          closestTriIndex   = triIndex;
+          closestPosition   = projection;
+        }
+      }
+
+      continue;
+    }
+
+    std::uint32_t nearIndex = nodeIndex + 1;
+    std::uint32_t farIndex  = node.offset;
+    float nearDistance = computeSquaredDistance(m_nodes[nearIndex], position);
+    float farDistance  = computeSquaredDistance(m_nodes[farIndex], position);
+
+    if (farDistance < nearDistance) {
+      std::swap(nearIndex, farIndex);
+      std::swap(nearDistance, farDistance);
+    }
+
+    if (farDistance <= closestSqDistance) {
+      stack[stackSize]          = farIndex;
+      stackDistances[stackSize] = farDistance;
+      ++stackSize;
+    }
+
+    if (nearDistance <= closestSqDistance) {
+      stack[stackSize]          = nearIndex;
+      stackDistances[stackSize] = nearDistance;
+      ++stackSize;
+    }
+  }
+
+  if (closestTriIndex == m_triangles.size())
+    return false;
+
+  closestPoint.position      = closestPosition;
+  closestPoint.distance      = std::sqrt(closestSqDistance);
+  closestPoint.triangleIndex = m_triangles[closestTriIndex].index;
+
+  return true;
+}
+
+bool TriangleBvh::sweep(const Sphere& sphere, const Vec3f& displacement, SweepHit& hit) const {
+  const Vec3f& center = sphere.getCenter();
+  const float radius  = sphere.getRadius();
+
+  return sweepHierarchy(m_nodes, m_triangles, center, displacement, Vec3f(radius), hit,
+                        [&center, radius, &displacement] (const Triangle& triangle, float& hitTime, Vec3f& hitNormal) {
+    return sweepSphereTriangle(triangle, center, radius, displacement, hitTime, hitNormal);
+  });
+}
+
+bool TriangleBvh::sweep(const AABB& box, const Vec3f& displacement, SweepHit& hit) const {
+  const Vec3f center      = (box.getRightTopFrontPos() + box.getLeftBottomBackPos()) * 0.5f;
+  const Vec3f halfExtents = (box.getRightTopFrontPos() - box.getLeftBottomBackPos()) * 0.5f;
+
+  return sweepHierarchy(m_nodes, m_triangles, center, displacement, halfExtents, hit,
+                        [&center, &halfExtents, &displacement] (const Triangle& triangle, float& hitTime, Vec3f& hitNormal) {
+    return sweepBoxTriangle(triangle, center, halfExtents, displacement, hitTime, hitNormal);
+  });
+}
+
+bool TriangleBvh::intersects(const TriangleBvh& bvh, const Mat4f& transform) const {
+  if (m_nodes.empty() || bvh.m_nodes.empty())
+    return false;
+
+  const HierarchyPairTraverser traverser(*this, bvh, transform);
+
+  // The pairs near the roots are distributed among threads, each fetching the next available one; the first intersection found stops them all
+  const unsigned int threadCount = Threading::getSystemThreadCount();
+  const std::vector<NodePair> rootPairs = traverser.computeRootPairs(threadCount * MinNodePairsPerThread);
+  std::atomic<bool> isIntersecting(false);
+
+  // Once an intersection has been found, the remaining pairs are fetched but immediately skipped
+  Threading::parallelizeDynamic(rootPairs.size(), [&traverser, &rootPairs, &isIntersecting] (std::size_t pairIndex, std::size_t) {
+    traverser.traverse(rootPairs[pairIndex], isIntersecting, [&isIntersecting] (std::size_t, std::size_t) {
+      isIntersecting.store(true, std::memory_order_relaxed);
+      return false;
+    });
+  }, threadCount);
+
+  return isIntersecting;
+}
+
+bool TriangleBvh::intersect(const TriangleBvh& bvh, std::vector<TrianglePair>& trianglePairs, const Mat4f& transform) const {
+  trianglePairs.clear();
+
+  if (m_nodes.empty() || bvh.m_nodes.empty())
+    return false;
+
+  const HierarchyPairTraverser traverser(*this, bvh, transform);
+
+  const unsigned int threadCount = Threading::getSystemThreadCount();
+  const std::vector<NodePair> rootPairs = traverser.computeRootPairs(threadCount * MinNodePairsPerThread);
+  const std::atomic<bool> isStopped(false);
+
+  // Each thread gathers its own pairs, which are concatenated afterwards
+  std::vector<std::vector<TrianglePair>> threadTrianglePairs(threadCount);
+
+  Threading::parallelizeDynamic(rootPairs.size(), [&traverser, &rootPairs, &isStopped, &threadTrianglePairs] (std::size_t pairIndex, std::size_t threadIndex) {
+    std::vector<TrianglePair>& localTrianglePairs = threadTrianglePairs[threadIndex];
+
+    traverser.traverse(rootPairs[pairIndex], isStopped, [&localTrianglePairs] (std::size_t firstTriIndex, std::size_t secondTriIndex) {
+      localTrianglePairs.emplace_back(firstTriIndex, secondTriIndex);
+      return true;
+    });
+  }, threadCount);
+
+  for (const std::vector<TrianglePair>& localTrianglePairs : threadTrianglePairs)
+    trianglePairs.insert(trianglePairs.end(), localTrianglePairs.cbegin(), localTrianglePairs.cend());
+
+  // Which thread found which pairs varies between calls; sorting them makes the result deterministic
+  std::sort(trianglePairs.begin(), trianglePairs.end());
+
+  return !trianglePairs.empty();
+}
+
+} // namespace Raz
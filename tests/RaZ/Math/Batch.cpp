@@ -0,0 +1,122 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Batch.hpp"
+#include "RaZ/Math/Simd.hpp"
+
+#include <cmath>
+
+namespace {
+
+// Declaring vectors to be tested; 11 of them, so that both the SIMD & the remaining scalar parts are processed
+const std::vector<Raz::Vec3f> vectors1 = { Raz::Vec3f({ 1.f, 2.f, 3.f }),      Raz::Vec3f({ -4.f, 0.5f, 2.f }),    Raz::Vec3f({ 0.25f, -8.f, 1.f }),
+                                           Raz::Vec3f({ 3.f, 3.f, -3.f }),     Raz::Vec3f({ 10.f, -2.f, 0.75f }),  Raz::Vec3f({ -1.f, -1.f, -1.f }),
+                                           Raz::Vec3f({ 0.f, 6.f, 0.5f }),     Raz::Vec3f({ 7.f, 0.f, -12.f }),    Raz::Vec3f({ -0.5f, 4.f, 9.f }),
+                                           Raz::Vec3f({ 2.f, -16.f, 5.f }),    Raz::Vec3f({ -6.f, 1.f, 1.f }) };
+const std::vector<Raz::Vec3f> vectors2 = { Raz::Vec3f({ -2.f, 1.f, 0.5f }),    Raz::Vec3f({ 1.f, 1.f, 1.f }),      Raz::Vec3f({ 4.f, 0.f, -2.f }),
+                                           Raz::Vec3f({ 0.5f, 8.f, 2.f }),     Raz::Vec3f({ -3.f, 3.f, 0.f }),     Raz::Vec3f({ 12.f, -4.f, 1.f }),
+                                           Raz::Vec3f({ 1.f, 0.f, 0.f }),      Raz::Vec3f({ 0.25f, 2.f, 2.f }),    Raz::Vec3f({ -1.f, -2.f, 3.f }),
+                                           Raz::Vec3f({ 5.f, 5.f, -1.f }),     Raz::Vec3f({ 0.f, 0.f, 10.f }) };
+
+const Raz::Mat4f transformMat({{ 0.f, 1.f, 0.f, 0.f },
+                               { -2.f, 0.f, 0.f, 0.f },
+                               { 0.f, 0.f, 0.5f, 0.f },
+                               { 3.f, -1.f, 4.f, 1.f }});
+
+float computeFirstSimdValue(Raz::Simd::Float vals) {
+  float values[Raz::Simd::Width] {};
+  Raz::Simd::store(values, vals);
+  return values[0];
+}
+
+} // namespace
+
+TEST_CASE("Simd rounding") {
+  for (float val : { -2.5f, -1.f, -0.75f, -0.f, 0.25f, 1.f, 1.5f, 41.99f }) {
+    CHECK(computeFirstSimdValue(Raz::Simd::floor(Raz::Simd::set(val))) == std::floor(val));
+    CHECK(computeFirstSimdValue(Raz::Simd::round(Raz::Simd::set(val))) == std::nearbyint(val));
+  }
+}
+
+TEST_CASE("Vec3fArray basic") {
+  Raz::Vec3fArray array(vectors1);
+  REQUIRE(array.getSize() == vectors1.size());
+
+  for (std::size_t i = 0; i < vectors1.size(); ++i)
+    REQUIRE(array[i] == vectors1[i]);
+
+  array.add(Raz::Vec3f(42.f));
+  REQUIRE(array.getSize() == vectors1.size() + 1);
+  REQUIRE(array[vectors1.size()] == Raz::Vec3f(42.f));
+
+  array.clear();
+  REQUIRE(array.isEmpty());
+
+  struct Element { Raz::Vec3f position; float weight; };
+  const std::vector<Element> elements = { { Raz::Vec3f(1.f), 0.f }, { Raz::Vec3f(2.f), 1.f } };
+
+  const Raz::Vec3fArray gatheredArray = Raz::Vec3fArray::gather(elements, &Element::position);
+  REQUIRE(gatheredArray.getSize() == 2);
+  REQUIRE(gatheredArray[0] == Raz::Vec3f(1.f));
+  REQUIRE(gatheredArray[1] == Raz::Vec3f(2.f));
+}
+
+TEST_CASE("Vec3fArray transformations") {
+  const Raz::Vec3fArray array(vectors1);
+  Raz::Vec3fArray result;
+
+  Raz::Batch::transformPoints(array, transformMat, result);
+  REQUIRE(result.getSize() == array.getSize());
+
+  for (std::size_t i = 0; i < vectors1.size(); ++i)
+    REQUIRE(result[i] == Raz::Vec3f(Raz::Vec4f(vectors1[i], 1.f) * transformMat));
+
+  Raz::Batch::transformDirections(array, transformMat, result);
+
+  for (std::size_t i = 0; i < vectors1.size(); ++i)
+    REQUIRE(result[i] == Raz::Vec3f(Raz::Vec4f(vectors1[i], 0.f) * transformMat));
+
+  // Transforming in-place
+  Raz::Vec3fArray inPlaceArray(vectors1);
+  Raz::Batch::transformNormals(inPlaceArray, transformMat, inPlaceArray);
+
+  for (std::size_t i = 0; i < vectors1.size(); ++i)
+    REQUIRE(inPlaceArray[i] == Raz::Vec3f(Raz::Vec4f(vectors1[i], 0.f) * transformMat).normalize());
+}
+
+TEST_CASE("Vec3fArray operations") {
+  const Raz::Vec3fArray array1(vectors1);
+  const Raz::Vec3fArray array2(vectors2);
+
+  std::vector<float> dotProducts;
+  Raz::Batch::computeDotProducts(array1, array2, dotProducts);
+  REQUIRE(dotProducts.size() == vectors1.size());
+
+  Raz::Vec3fArray crossProducts;
+  Raz::Batch::computeCrossProducts(array1, array2, crossProducts);
+  REQUIRE(crossProducts.getSize() == vectors1.size());
+
+  Raz::Vec3fArray normalized = array1;
+  Raz::Batch::normalize(normalized);
+
+  Raz::Vec3fArray fastNormalized = array1;
+  Raz::Batch::normalizeFast(fastNormalized);
+
+  for (std::size_t i = 0; i < vectors1.size(); ++i) {
+    REQUIRE(Raz::FloatUtils::checkNearEquality(dotProducts[i], vectors1[i].dot(vectors2[i])));
+    REQUIRE(crossProducts[i] == vectors1[i].cross(vectors2[i]));
+    REQUIRE(normalized[i] == vectors1[i].normalize());
+    REQUIRE(fastNormalized[i].computeLength() == Approx(1.f).epsilon(0.000001f));
+  }
+}
+
+TEST_CASE("Vec3fArray bounds") {
+  Raz::Vec3f minPoint;
+  Raz::Vec3f maxPoint;
+
+  Raz::Batch::computeBounds(Raz::Vec3fArray(vectors1), minPoint, maxPoint);
+  REQUIRE(minPoint == Raz::Vec3f({ -6.f, -16.f, -12.f }));
+  REQUIRE(maxPoint == Raz::Vec3f({ 10.f, 6.f, 9.f }));
+
+  Raz::Batch::computeBounds(Raz::Vec3fArray(vectors2), minPoint, maxPoint);
+  REQUIRE(minPoint == Raz::Vec3f({ -3.f, -4.f, -2.f }));
+  REQUIRE(maxPoint == Raz::Vec3f({ 12.f, 8.f, 10.f }));
+}
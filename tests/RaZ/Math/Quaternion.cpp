@@ -0,0 +1,81 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+
+namespace {
+
+// Declaring quaternions to be tested
+const Raz::Quaternionf quat1(90.f, Raz::Axis::Y);
+const Raz::Quaternionf quat2(45.f, Raz::Vec3f({ 1.f, 1.f, 0.f }).normalize());
+const Raz::Quaternionf quat3(-120.f, Raz::Vec3f({ 0.5f, -2.f, 1.f }).normalize());
+
+const Raz::Vec3f vec({ 1.f, -2.5f, 3.75f });
+
+void checkVectors(const Raz::Vec3f& vec1, const Raz::Vec3f& vec2) {
+  CHECK(vec1[0] == Approx(vec2[0]).margin(0.00001f));
+  CHECK(vec1[1] == Approx(vec2[1]).margin(0.00001f));
+  CHECK(vec1[2] == Approx(vec2[2]).margin(0.00001f));
+}
+
+void checkQuaternions(const Raz::Quaternionf& quat1, const Raz::Quaternionf& quat2) {
+  CHECK(quat1.getReal() == Approx(quat2.getReal()).margin(0.00001f));
+  checkVectors(quat1.getComplexes(), quat2.getComplexes());
+}
+
+} // namespace
+
+TEST_CASE("Quaternion basic") {
+  const Raz::Quaternionf identity = Raz::Quaternionf::identity();
+  REQUIRE(identity.getReal() == 1.f);
+  REQUIRE(identity.getComplexes() == Raz::Vec3f(0.f));
+  REQUIRE(identity.computeMatrix() == Raz::Mat4f::identity());
+
+  REQUIRE(quat1.computeNorm() == Approx(1.f));
+  REQUIRE(quat1 == Raz::Quaternionf::fromComponents(quat1.getReal(), quat1.getComplexes()[0], quat1.getComplexes()[1], quat1.getComplexes()[2]));
+  REQUIRE(quat1 != quat2);
+
+  checkQuaternions(quat2 * quat2.inverse(), identity);
+  checkQuaternions(quat3 * quat3.conjugate(), identity);
+}
+
+TEST_CASE("Quaternion rotations") {
+  // A rotation of 90° around Y turns X into -Z
+  checkVectors(quat1 * Raz::Axis::X, -Raz::Axis::Z);
+
+  // Rotating a vector directly must give the same result as applying the rotation matrix
+  for (const Raz::Quaternionf& quat : { quat1, quat2, quat3 })
+    checkVectors(quat * vec, Raz::Vec3f(Raz::Vec4f(vec, 1.f) * quat.computeMatrix()));
+
+  // Combining rotations applies the right-hand one first
+  checkVectors((quat1 * quat2) * vec, quat1 * (quat2 * vec));
+  checkVectors(Raz::Vec3f(Raz::Vec4f(vec, 1.f) * (quat2 * quat3).computeMatrix()),
+               Raz::Vec3f(Raz::Vec4f(vec, 1.f) * quat3.computeMatrix() * quat2.computeMatrix()));
+
+  Raz::Quaternionf accumulated = Raz::Quaternionf::identity();
+  accumulated *= quat2;
+  accumulated *= quat3;
+  checkQuaternions(accumulated, quat2 * quat3);
+}
+
+TEST_CASE("Quaternion interpolations") {
+  const Raz::Quaternionf identity = Raz::Quaternionf::identity();
+
+  checkQuaternions(identity.slerp(quat1, 0.f), identity);
+  checkQuaternions(identity.slerp(quat1, 1.f), quat1);
+  checkQuaternions(identity.slerp(quat1, 0.5f), Raz::Quaternionf(45.f, Raz::Axis::Y));
+  checkQuaternions(identity.slerp(quat1, 0.25f), Raz::Quaternionf(22.5f, Raz::Axis::Y));
+
+  // nlerp follows the same path, but not at a constant speed: only the halfway point & the extremities match
+  checkQuaternions(identity.nlerp(quat1, 0.f), identity);
+  checkQuaternions(identity.nlerp(quat1, 0.5f), Raz::Quaternionf(45.f, Raz::Axis::Y));
+  checkQuaternions(identity.nlerp(quat1, 1.f), quat1);
+  REQUIRE(identity.nlerp(quat3, 0.3f).computeNorm() == Approx(1.f));
+
+  // The shortest path must be taken even if the target quaternion is on the opposite hemisphere
+  const Raz::Quaternionf negQuat1 = Raz::Quaternionf::fromComponents(-quat1.getReal(), -quat1.getComplexes()[0],
+                                                                     -quat1.getComplexes()[1], -quat1.getComplexes()[2]);
+  checkVectors(identity.slerp(negQuat1, 0.5f) * vec, Raz::Quaternionf(45.f, Raz::Axis::Y) * vec);
+  checkVectors(identity.nlerp(negQuat1, 0.5f) * vec, Raz::Quaternionf(45.f, Raz::Axis::Y) * vec);
+
+  // Nearly identical quaternions fall back to a linear interpolation
+  checkQuaternions(quat1.slerp(Raz::Quaternionf(90.01f, Raz::Axis::Y), 0.5f), Raz::Quaternionf(90.005f, Raz::Axis::Y));
+}
@@ -0,0 +1,92 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace {
+
+const Raz::Quaternionf quat1(90.f, Raz::Axis::Y);
+const Raz::Vec3f vec({ 1.f, -2.5f, 3.75f });
+
+void checkVectors(const Raz::Vec3f& vec1, const Raz::Vec3f& vec2) {
+  CHECK(vec1[0] == Approx(vec2[0]).margin(0.00001f));
+  CHECK(vec1[1] == Approx(vec2[1]).margin(0.00001f));
+  CHECK(vec1[2] == Approx(vec2[2]).margin(0.00001f));
+}
+
+void checkMatrices(const Raz::Mat4f& mat1, const Raz::Mat4f& mat2) {
+  for (std::size_t i = 0; i < 16; ++i)
+    CHECK(mat1[i] == Approx(mat2[i]).margin(0.00001f));
+}
+
+} // namespace
+
+TEST_CASE("Transform rotations") {
+  Raz::Transform transform(Raz::Vec3f({ 1.f, 2.f, 3.f }), quat1, Raz::Vec3f(2.f));
+
+  // Moving is done relatively to the current rotation: going forward (-Z) with a rotation of 90° around Y goes to -X
+  transform.move(0.f, 0.f, -1.f);
+  checkVectors(transform.getPosition(), Raz::Vec3f({ 0.f, 2.f, 3.f }));
+
+  // The transform matrix applies in order the scale, the rotation & the translation
+  const Raz::Vec3f transformedVec = Raz::Vec3f(Raz::Vec4f(vec, 1.f) * transform.computeTransformMatrix());
+  checkVectors(transformedVec, quat1 * (vec * 2.f) + transform.getPosition());
+
+  transform.rotate(90.f, Raz::Axis::Y);
+  REQUIRE(transform.getRotation() == Raz::Quaternionf(180.f, Raz::Axis::Y));
+
+  transform.setRotation(Raz::Quaternionf::identity());
+  transform.rotate(90.f, 0.f, 90.f);
+  checkVectors(transform.getRotation() * Raz::Axis::Y, Raz::Axis::Z);
+}
+
+TEST_CASE("Transform cached matrices") {
+  Raz::Transform transform(Raz::Vec3f({ 1.f, 2.f, 3.f }), quat1, Raz::Vec3f({ 2.f, 0.5f, 4.f }));
+
+  checkMatrices(transform.getTransformMatrix(), transform.computeTransformMatrix());
+
+  // The normal matrix is the inverse transpose of the transform matrix, without any translation
+  Raz::Mat4f expectedNormalMat = transform.computeTransformMatrix();
+  expectedNormalMat[12] = 0.f;
+  expectedNormalMat[13] = 0.f;
+  expectedNormalMat[14] = 0.f;
+  checkMatrices(transform.getNormalMatrix(), expectedNormalMat.inverse().transpose());
+
+  // Any modification must make the cached matrices be recomputed
+  const auto checkUpdate = [&transform] () {
+    checkMatrices(transform.getTransformMatrix(), transform.computeTransformMatrix());
+  };
+
+  transform.translate(1.f, -1.f, 0.5f);
+  checkUpdate();
+  transform.move(0.f, 0.f, -2.f);
+  checkUpdate();
+  transform.rotate(30.f, Raz::Axis::X);
+  checkUpdate();
+  transform.scale(0.5f);
+  checkUpdate();
+  transform.setPosition(Raz::Vec3f(0.f));
+  checkUpdate();
+  transform.setRotation(45.f, Raz::Axis::Z);
+  checkUpdate();
+  transform.setScale(1.f, 3.f, 1.f);
+  checkUpdate();
+}
+
+TEST_CASE("Transform bounds") {
+  Raz::Transform transform(Raz::Vec3f({ 1.f, 2.f, 3.f }), quat1, Raz::Vec3f({ 1.f, 2.f, 3.f }));
+
+  // Rotated by 90° around Y, the box's X extent becomes its Z one & vice versa, after having been scaled
+  const Raz::AABB box(Raz::Vec3f({ 1.f, 1.f, 1.f }), Raz::Vec3f({ -1.f, 0.f, -1.f }));
+  const Raz::AABB transformedBox = transform.computeTransformedBox(box);
+  checkVectors(transformedBox.getLeftBottomBackPos(), Raz::Vec3f({ -2.f, 2.f, 2.f }));
+  checkVectors(transformedBox.getRightTopFrontPos(), Raz::Vec3f({ 4.f, 4.f, 4.f }));
+
+  // The sphere's radius is scaled by the largest scale component
+  const Raz::Sphere transformedSphere = transform.computeTransformedSphere(Raz::Sphere(Raz::Vec3f({ 1.f, 0.f, 0.f }), 2.f));
+  checkVectors(transformedSphere.getCenter(), quat1 * Raz::Vec3f({ 1.f, 0.f, 0.f }) + transform.getPosition());
+  CHECK(transformedSphere.getRadius() == Approx(6.f));
+
+  // Bounds follow the transform's changes
+  transform.setPosition(Raz::Vec3f(0.f));
+  checkVectors(transform.computeTransformedBox(box).getRightTopFrontPos(), Raz::Vec3f({ 3.f, 2.f, 1.f }));
+}
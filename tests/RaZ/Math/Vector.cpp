@@ -82,6 +82,10 @@ TEST_CASE("Vector manipulations") {
   REQUIRE(Raz::FloatUtils::checkNearEquality(vec41.normalize().computeSquaredLength(), 1.f));
   REQUIRE(Raz::FloatUtils::checkNearEquality(Raz::Vec3f({ 0.f, 1.f, 0.f }).computeLength(), 1.f));
 
+  // The fast normalization is only approximate; computing the length adds its own rounding errors
+  REQUIRE(vec31.normalizeFast().computeLength() == Approx(1.f).epsilon(Raz::FloatUtils::FastRsqrtMaxError * 3.f));
+  REQUIRE(vec41.normalizeFast().computeLength() == Approx(1.f).epsilon(Raz::FloatUtils::FastRsqrtMaxError * 3.f));
+
   // Testing Vector::reflect():
   //
   // IncVec  N  Reflection
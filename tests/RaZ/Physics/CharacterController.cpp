@@ -0,0 +1,128 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/CharacterController.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+#include <cmath>
+
+namespace {
+
+// Adds a parallelogram made of two triangles, starting at the given corner & spanned by both edges
+void addQuad(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices,
+             const Raz::Vec3f& corner, const Raz::Vec3f& firstEdge, const Raz::Vec3f& secondEdge) {
+  const auto firstIndex = static_cast<unsigned int>(vertices.size());
+
+  for (const Raz::Vec3f& position : { corner, corner + firstEdge, corner + secondEdge, corner + firstEdge + secondEdge }) {
+    Raz::Vertex vertex;
+    vertex.position = position;
+    vertices.push_back(vertex);
+  }
+
+  indices.insert(indices.end(), { firstIndex, firstIndex + 1, firstIndex + 2, firstIndex + 1, firstIndex + 3, firstIndex + 2 });
+}
+
+// Floor at Y = 0, with walls at X = 2 & Z = 2
+Raz::TriangleBvh createRoom() {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+
+  addQuad(vertices, indices, Raz::Vec3f({ -10.f, 0.f, -10.f }), Raz::Vec3f({ 20.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 20.f }));
+  addQuad(vertices, indices, Raz::Vec3f({ 2.f, 0.f, -10.f }), Raz::Vec3f({ 0.f, 5.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 20.f }));
+  addQuad(vertices, indices, Raz::Vec3f({ -10.f, 0.f, 2.f }), Raz::Vec3f({ 20.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 5.f, 0.f }));
+
+  return Raz::TriangleBvh(vertices, indices);
+}
+
+} // namespace
+
+TEST_CASE("CharacterController free movement") {
+  const Raz::TriangleBvh room = createRoom();
+  const Raz::CharacterController controller(0.5f);
+
+  Raz::Transform transform(Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  const Raz::CharacterController::MoveResult result = controller.move(transform, Raz::Vec3f({ -1.f, 2.f, -3.f }), room);
+
+  CHECK_FALSE(result.hasCollided);
+  CHECK_FALSE(result.isGrounded);
+  CHECK(result.displacement == Raz::Vec3f({ -1.f, 2.f, -3.f }));
+  CHECK(transform.getPosition() == Raz::Vec3f({ -1.f, 3.f, -3.f }));
+}
+
+TEST_CASE("CharacterController ground") {
+  const Raz::TriangleBvh room = createRoom();
+  const Raz::CharacterController controller(0.5f);
+
+  // Falling fast enough to cross the floor in a single step, the character stops on it, a skin width above
+  Raz::Transform transform(Raz::Vec3f({ 0.f, 2.f, 0.f }));
+  Raz::CharacterController::MoveResult result = controller.move(transform, Raz::Vec3f({ 0.f, -50.f, 0.f }), room);
+
+  CHECK(result.hasCollided);
+  CHECK(result.isGrounded);
+  CHECK(transform.getPosition()[1] == Approx(0.5f + controller.getSkinWidth()));
+  CHECK(result.displacement[1] == Approx(transform.getPosition()[1] - 2.f));
+
+  // Moving diagonally downwards, the character slides along the floor without losing its horizontal movement
+  result = controller.move(transform, Raz::Vec3f({ 1.f, -1.f, -0.5f }), room);
+
+  CHECK(result.isGrounded);
+  CHECK(transform.getPosition()[0] == Approx(1.f));
+  CHECK(transform.getPosition()[1] == Approx(0.5f + controller.getSkinWidth()));
+  CHECK(transform.getPosition()[2] == Approx(-0.5f));
+}
+
+TEST_CASE("CharacterController walls") {
+  const Raz::TriangleBvh room = createRoom();
+  const Raz::CharacterController controller(0.5f);
+
+  // Running into the wall at X = 2, the character slides along it
+  Raz::Transform transform(Raz::Vec3f({ 0.f, 1.f, -2.f }));
+  Raz::CharacterController::MoveResult result = controller.move(transform, Raz::Vec3f({ 4.f, 0.f, 1.f }), room);
+
+  CHECK(result.hasCollided);
+  CHECK_FALSE(result.isGrounded);
+  CHECK(transform.getPosition()[0] == Approx(1.5f - controller.getSkinWidth()));
+  CHECK(transform.getPosition()[1] == Approx(1.f));
+  CHECK(transform.getPosition()[2] == Approx(-1.f));
+
+  // Running into the corner, the character is stuck in it
+  transform.setPosition(0.f, 1.f, 0.f);
+  result = controller.move(transform, Raz::Vec3f({ 5.f, 0.f, 3.f }), room);
+
+  CHECK(result.hasCollided);
+  CHECK(transform.getPosition()[0] == Approx(1.5f).margin(0.01f));
+  CHECK(transform.getPosition()[1] == Approx(1.f));
+  CHECK(transform.getPosition()[2] == Approx(1.5f).margin(0.01f));
+  CHECK(transform.getPosition()[0] < 1.5f);
+  CHECK(transform.getPosition()[2] < 1.5f);
+
+  // Moving away from the walls is not hindered
+  result = controller.move(transform, Raz::Vec3f({ -1.f, 0.f, -1.f }), room);
+  CHECK_FALSE(result.hasCollided);
+}
+
+TEST_CASE("CharacterController slopes") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+
+  // Slopes of 30° & 60°, going up along X
+  const float gentleHeight = 10.f * std::tan(Raz::PI<float> / 6.f);
+  const float steepHeight  = 10.f * std::tan(Raz::PI<float> / 3.f);
+  addQuad(vertices, indices, Raz::Vec3f({ 0.f, 0.f, -5.f }), Raz::Vec3f({ 10.f, gentleHeight, 0.f }), Raz::Vec3f({ 0.f, 0.f, 4.f }));
+  addQuad(vertices, indices, Raz::Vec3f({ 0.f, 0.f, 1.f }), Raz::Vec3f({ 10.f, steepHeight, 0.f }), Raz::Vec3f({ 0.f, 0.f, 4.f }));
+  const Raz::TriangleBvh slopes(vertices, indices);
+
+  Raz::CharacterController controller(0.5f);
+
+  Raz::Transform gentleTransform(Raz::Vec3f({ 5.f, 10.f, -3.f }));
+  CHECK(controller.move(gentleTransform, Raz::Vec3f({ 0.f, -20.f, 0.f }), slopes).isGrounded);
+
+  Raz::Transform steepTransform(Raz::Vec3f({ 2.f, 10.f, 3.f }));
+  const Raz::CharacterController::MoveResult steepResult = controller.move(steepTransform, Raz::Vec3f({ 0.f, -20.f, 0.f }), slopes);
+  CHECK(steepResult.hasCollided);
+  CHECK_FALSE(steepResult.isGrounded);
+
+  controller.setMaxSlopeAngle(70.f);
+  steepTransform.setPosition(2.f, 10.f, 3.f);
+  CHECK(controller.move(steepTransform, Raz::Vec3f({ 0.f, -20.f, 0.f }), slopes).isGrounded);
+}
@@ -0,0 +1,197 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/DynamicAabbTree.hpp"
+#include "RaZ/Render/Camera.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+// Checks the links, bounds & heights of a subtree, returning its number of leaves
+std::size_t checkSubtree(const Raz::DynamicAabbTree& tree, std::uint32_t nodeIndex, std::uint32_t parentIndex) {
+  const Raz::DynamicAabbTree::Node& node = tree.getNodes()[nodeIndex];
+  REQUIRE(node.parentIndex == parentIndex);
+
+  if (node.isLeaf()) {
+    REQUIRE(node.height == 0);
+    return 1;
+  }
+
+  const Raz::DynamicAabbTree::Node& leftChild  = tree.getNodes()[node.leftChildIndex];
+  const Raz::DynamicAabbTree::Node& rightChild = tree.getNodes()[node.rightChildIndex];
+
+  REQUIRE(node.height == 1 + std::max(leftChild.height, rightChild.height));
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    REQUIRE(node.minBounds[axis] == std::min(leftChild.minBounds[axis], rightChild.minBounds[axis]));
+    REQUIRE(node.maxBounds[axis] == std::max(leftChild.maxBounds[axis], rightChild.maxBounds[axis]));
+  }
+
+  return checkSubtree(tree, node.leftChildIndex, nodeIndex) + checkSubtree(tree, node.rightChildIndex, nodeIndex);
+}
+
+void checkTree(const Raz::DynamicAabbTree& tree) {
+  if (tree.isEmpty()) {
+    REQUIRE(tree.getProxyCount() == 0);
+    return;
+  }
+
+  REQUIRE(checkSubtree(tree, tree.getRootIndex(), Raz::DynamicAabbTree::NullIndex) == tree.getProxyCount());
+}
+
+std::vector<std::uint32_t> sortProxies(std::vector<std::uint32_t> proxyIndices) {
+  std::sort(proxyIndices.begin(), proxyIndices.end());
+  return proxyIndices;
+}
+
+} // namespace
+
+TEST_CASE("DynamicAabbTree basic") {
+  Raz::DynamicAabbTree tree(0.5f);
+  REQUIRE(tree.isEmpty());
+
+  std::vector<std::uint32_t> proxyIndices;
+  tree.queryOverlaps(Raz::AABB(Raz::Vec3f(1.f), Raz::Vec3f(-1.f)), proxyIndices);
+  REQUIRE(proxyIndices.empty());
+
+  const std::uint32_t firstProxy  = tree.insertProxy(Raz::AABB(Raz::Vec3f(1.f), Raz::Vec3f(0.f)));
+  const std::uint32_t secondProxy = tree.insertProxy(Raz::AABB(Raz::Vec3f({ 11.f, 1.f, 1.f }), Raz::Vec3f({ 10.f, 0.f, 0.f })));
+  REQUIRE(tree.getProxyCount() == 2);
+  REQUIRE(tree.getHeight() == 1);
+  checkTree(tree);
+
+  // The boxes are enlarged by the margin
+  CHECK(tree.getFatBox(firstProxy).getLeftBottomBackPos() == Raz::Vec3f(-0.5f));
+  CHECK(tree.getFatBox(firstProxy).getRightTopFrontPos() == Raz::Vec3f(1.5f));
+
+  tree.queryOverlaps(Raz::AABB(Raz::Vec3f(1.25f), Raz::Vec3f(1.2f)), proxyIndices);
+  REQUIRE(proxyIndices == std::vector<std::uint32_t>({ firstProxy }));
+
+  // Moving a box within its fat one leaves the tree untouched
+  REQUIRE_FALSE(tree.moveProxy(firstProxy, Raz::AABB(Raz::Vec3f(1.4f), Raz::Vec3f(0.4f))));
+  REQUIRE(tree.moveProxy(firstProxy, Raz::AABB(Raz::Vec3f(2.f), Raz::Vec3f(1.f)), Raz::Vec3f({ 1.f, 0.f, 0.f })));
+  CHECK(tree.getFatBox(firstProxy).getLeftBottomBackPos() == Raz::Vec3f(0.5f));
+  CHECK(tree.getFatBox(firstProxy).getRightTopFrontPos() == Raz::Vec3f({ 4.5f, 2.5f, 2.5f }));
+
+  proxyIndices.clear();
+  tree.queryRay(Raz::Ray(Raz::Vec3f({ -5.f, 0.5f, 0.5f }), Raz::Axis::X), proxyIndices);
+  REQUIRE(sortProxies(proxyIndices) == std::vector<std::uint32_t>({ firstProxy, secondProxy }));
+
+  proxyIndices.clear();
+  tree.queryRay(Raz::Ray(Raz::Vec3f({ -5.f, 0.5f, 0.5f }), Raz::Axis::X), proxyIndices, 10.f);
+  REQUIRE(proxyIndices == std::vector<std::uint32_t>({ firstProxy }));
+
+  tree.removeProxy(firstProxy);
+  REQUIRE_FALSE(tree.isProxyValid(firstProxy));
+  REQUIRE(tree.getProxyCount() == 1);
+  checkTree(tree);
+
+  proxyIndices.clear();
+  tree.queryRay(Raz::Ray(Raz::Vec3f({ -5.f, 0.5f, 0.5f }), Raz::Axis::X), proxyIndices);
+  REQUIRE(proxyIndices == std::vector<std::uint32_t>({ secondProxy }));
+
+  tree.removeProxy(secondProxy);
+  REQUIRE(tree.isEmpty());
+}
+
+TEST_CASE("DynamicAabbTree moving boxes") {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-50.f, 50.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.5f, 2.f);
+  std::uniform_real_distribution<float> moveDistrib(-0.5f, 0.5f);
+
+  const auto createBox = [&] () {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+    const Raz::Vec3f halfExtents({ sizeDistrib(randGenerator), sizeDistrib(randGenerator), sizeDistrib(randGenerator) });
+    return Raz::AABB(center + halfExtents, center - halfExtents);
+  };
+
+  Raz::DynamicAabbTree tree;
+  std::vector<std::uint32_t> proxies;
+
+  for (std::size_t i = 0; i < 1000; ++i)
+    proxies.push_back(tree.insertProxy(createBox()));
+
+  checkTree(tree);
+  // Rotations must keep the tree balanced, its height remaining close to log2(1000)
+  CHECK(tree.getHeight() <= 15);
+
+  std::size_t reinsertionCount = 0;
+
+  for (std::size_t frameIndex = 0; frameIndex < 10; ++frameIndex) {
+    for (std::uint32_t proxyIndex : proxies) {
+      const Raz::AABB fatBox = tree.getFatBox(proxyIndex);
+      const Raz::Vec3f offset({ moveDistrib(randGenerator), moveDistrib(randGenerator), moveDistrib(randGenerator) });
+
+      // The fat box is shrunk back to retrieve the tight one before moving it
+      const float margin = tree.getMargin();
+      reinsertionCount += tree.moveProxy(proxyIndex, Raz::AABB(fatBox.getRightTopFrontPos() - margin + offset,
+                                                               fatBox.getLeftBottomBackPos() + margin + offset), offset);
+    }
+
+    // Replacing a few boxes
+    for (std::size_t i = frameIndex; i < proxies.size(); i += 50) {
+      tree.removeProxy(proxies[i]);
+      proxies[i] = tree.insertProxy(createBox());
+    }
+
+    checkTree(tree);
+  }
+
+  CHECK(reinsertionCount > 0);
+  CHECK(tree.getHeight() <= 15);
+
+  // Every query must return exactly the proxies whose fat boxes match
+  std::vector<std::uint32_t> proxyIndices;
+
+  for (std::size_t i = 0; i < 50; ++i) {
+    const Raz::AABB queryBox = createBox();
+
+    std::vector<std::uint32_t> expectedIndices;
+
+    for (std::uint32_t proxyIndex : proxies) {
+      if (tree.getFatBox(proxyIndex).intersects(queryBox))
+        expectedIndices.push_back(proxyIndex);
+    }
+
+    proxyIndices.clear();
+    tree.queryOverlaps(queryBox, proxyIndices);
+    REQUIRE(sortProxies(proxyIndices) == sortProxies(expectedIndices));
+  }
+
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  for (std::size_t i = 0; i < 50; ++i) {
+    const Raz::Ray ray(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }),
+                       Raz::Vec3f({ dirDistrib(randGenerator), dirDistrib(randGenerator), dirDistrib(randGenerator) }).normalize());
+
+    std::vector<std::uint32_t> expectedIndices;
+
+    for (std::uint32_t proxyIndex : proxies) {
+      if (ray.intersects(tree.getFatBox(proxyIndex)))
+        expectedIndices.push_back(proxyIndex);
+    }
+
+    proxyIndices.clear();
+    tree.queryRay(ray, proxyIndices);
+    REQUIRE(sortProxies(proxyIndices) == sortProxies(expectedIndices));
+  }
+}
+
+TEST_CASE("DynamicAabbTree frustum query") {
+  Raz::Camera camera(800, 600, 60.f, 0.1f, 50.f);
+  camera.computeLookAt(Raz::Vec3f(0.f), Raz::Vec3f({ 0.f, 0.f, 1.f }));
+
+  Raz::DynamicAabbTree tree(0.f);
+
+  const std::uint32_t frontProxy  = tree.insertProxy(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 11.f }), Raz::Vec3f({ -1.f, -1.f, 9.f })));
+  const std::uint32_t edgeProxy   = tree.insertProxy(Raz::AABB(Raz::Vec3f({ 1.f, 0.5f, 49.5f }), Raz::Vec3f({ -1.f, -0.5f, 48.f })));
+  tree.insertProxy(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, -9.f }), Raz::Vec3f({ -1.f, -1.f, -11.f })));  // Behind
+  tree.insertProxy(Raz::AABB(Raz::Vec3f({ 21.f, 1.f, 11.f }), Raz::Vec3f({ 19.f, -1.f, 9.f })));   // Far on the side
+  tree.insertProxy(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 61.f }), Raz::Vec3f({ -1.f, -1.f, 59.f })));   // Beyond the far plane
+  const std::uint32_t sideProxy = tree.insertProxy(Raz::AABB(Raz::Vec3f({ 8.f, 1.f, 11.f }), Raz::Vec3f({ 6.f, -1.f, 9.f })));
+
+  std::vector<std::uint32_t> proxyIndices;
+  tree.queryFrustum(camera.computeFrustumPlanes(), proxyIndices);
+  REQUIRE(sortProxies(proxyIndices) == sortProxies({ frontProxy, edgeProxy, sideProxy }));
+}
@@ -0,0 +1,144 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/Gjk.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+TEST_CASE("Gjk spheres") {
+  const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
+  const Raz::Sphere sphere2(Raz::Vec3f({ 1.5f, 0.f, 0.f }), 1.f);
+  const Raz::Sphere sphere3(Raz::Vec3f({ 0.f, 2.5f, 0.f }), 1.f);
+
+  CHECK(Raz::Gjk::intersects(sphere1, sphere2));
+  CHECK_FALSE(Raz::Gjk::intersects(sphere1, sphere3));
+  CHECK_FALSE(Raz::Gjk::intersects(sphere2, sphere3)); // Centers distant of ~2.92
+
+  Raz::Gjk::Contact contact;
+  REQUIRE(Raz::Gjk::computeContact(sphere1, sphere2, contact));
+
+  // The spheres being curved, the polytope only approximates their surface
+  CHECK(contact.depth == Approx(0.5f).margin(0.01f));
+  CHECK(contact.normal[0] == Approx(1.f).margin(0.01f));
+  CHECK(contact.firstPoint[0] == Approx(1.f).margin(0.01f));
+  CHECK(contact.secondPoint[0] == Approx(0.5f).margin(0.01f));
+
+  // Swapping the shapes reverses the normal
+  REQUIRE(Raz::Gjk::computeContact(sphere2, sphere1, contact));
+  CHECK(contact.depth == Approx(0.5f).margin(0.01f));
+  CHECK(contact.normal[0] == Approx(-1.f).margin(0.01f));
+
+  REQUIRE_FALSE(Raz::Gjk::computeContact(sphere1, sphere3, contact));
+}
+
+TEST_CASE("Gjk boxes") {
+  const Raz::AABB aabb1(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+  const Raz::AABB aabb2(Raz::Vec3f({ 2.5f, 1.5f, 1.f }), Raz::Vec3f({ 0.7f, -0.5f, -1.f }));
+  const Raz::AABB aabb3(Raz::Vec3f({ 3.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, -1.f, -1.f })); // Touching aabb1
+  const Raz::AABB aabb4(Raz::Vec3f({ 3.f, 1.f, 1.f }), Raz::Vec3f({ 1.1f, -1.f, -1.f }));
+
+  CHECK(Raz::Gjk::intersects(aabb1, aabb2));
+  CHECK(Raz::Gjk::intersects(aabb1, aabb3));
+  CHECK_FALSE(Raz::Gjk::intersects(aabb1, aabb4));
+
+  Raz::Gjk::Contact contact;
+  REQUIRE(Raz::Gjk::computeContact(aabb1, aabb2, contact));
+  CHECK(contact.depth == Approx(0.3f));
+  CHECK(contact.normal[0] == Approx(1.f));
+
+  REQUIRE(Raz::Gjk::computeContact(aabb1, aabb3, contact));
+  CHECK(contact.depth == Approx(0.f).margin(0.0001f));
+
+  // Boxes sharing the same center are separated along their axis of least overlap
+  const Raz::AABB aabb5(Raz::Vec3f({ 0.5f, 3.f, 3.f }), Raz::Vec3f({ -0.5f, -3.f, -3.f }));
+  REQUIRE(Raz::Gjk::computeContact(aabb1, aabb5, contact));
+  CHECK(contact.depth == Approx(1.5f));
+  CHECK(std::abs(contact.normal[0]) == Approx(1.f));
+}
+
+TEST_CASE("Gjk flat shapes") {
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, 0.f, -1.f }), Raz::Vec3f({ 1.f, 0.f, -1.f }), Raz::Vec3f({ 0.f, 0.f, 1.f }));
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ -1.f, -1.f, 0.f }));
+  const Raz::Line line(Raz::Vec3f({ 0.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  const Raz::AABB aabb(Raz::Vec3f({ 0.5f, 2.f, 0.5f }), Raz::Vec3f({ -0.5f, 0.5f, -0.5f }));
+
+  CHECK(Raz::Gjk::intersects(triangle, quad));
+  CHECK(Raz::Gjk::intersects(triangle, line));
+  CHECK(Raz::Gjk::intersects(quad, line));
+  CHECK(Raz::Gjk::intersects(quad, aabb));
+  CHECK_FALSE(Raz::Gjk::intersects(triangle, aabb));
+  CHECK_FALSE(Raz::Gjk::intersects(line, Raz::Line(Raz::Vec3f({ 1.f, 0.f, 1.f }), Raz::Vec3f({ -1.f, 0.f, 1.f }))));
+  CHECK(Raz::Gjk::intersects(line, Raz::Line(Raz::Vec3f({ 1.f, 0.f, 0.f }), Raz::Vec3f({ -1.f, 0.f, 0.f }))));
+
+  // The box sinks into the triangle from above: it must be pushed back upwards
+  const Raz::AABB sinkingAabb(Raz::Vec3f({ 0.25f, 1.f, 0.25f }), Raz::Vec3f({ -0.25f, -0.2f, -0.25f }));
+
+  Raz::Gjk::Contact contact;
+  REQUIRE(Raz::Gjk::computeContact(triangle, sinkingAabb, contact));
+  CHECK(contact.depth == Approx(0.2f));
+  CHECK(contact.normal[1] == Approx(1.f));
+
+  // Coplanar flat shapes can only touch each other
+  const Raz::Triangle coplanarTriangle(Raz::Vec3f({ 0.f, 0.f, 0.f }), Raz::Vec3f({ 2.f, 0.f, 0.f }), Raz::Vec3f({ 2.f, 0.f, 2.f }));
+  REQUIRE(Raz::Gjk::computeContact(triangle, coplanarTriangle, contact));
+  CHECK(contact.depth == 0.f);
+  CHECK(std::abs(contact.normal[1]) == Approx(1.f));
+}
+
+TEST_CASE("Gjk random shapes") {
+  std::mt19937 randGenerator(1234); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-3.f, 3.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.1f, 2.f);
+
+  const auto generateAabb = [&randGenerator, &posDistrib, &sizeDistrib] () {
+    const Raz::Vec3f minPos({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+    return Raz::AABB(minPos + Raz::Vec3f({ sizeDistrib(randGenerator), sizeDistrib(randGenerator), sizeDistrib(randGenerator) }), minPos);
+  };
+
+  for (std::size_t i = 0; i < 500; ++i) {
+    const Raz::AABB aabb1 = generateAabb();
+    const Raz::AABB aabb2 = generateAabb();
+
+    const bool areIntersecting = aabb1.intersects(aabb2);
+    REQUIRE(Raz::Gjk::intersects(aabb1, aabb2) == areIntersecting);
+
+    Raz::Gjk::Contact contact;
+    REQUIRE(Raz::Gjk::computeContact(aabb1, aabb2, contact) == areIntersecting);
+
+    if (!areIntersecting)
+      continue;
+
+    // The penetration depth of two boxes is the smallest distance to move one of them by on any axis for them to be separated
+    float expectedDepth = std::numeric_limits<float>::max();
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      const float separationDist = std::min(aabb1.getRightTopFrontPos()[axis] - aabb2.getLeftBottomBackPos()[axis],
+                                            aabb2.getRightTopFrontPos()[axis] - aabb1.getLeftBottomBackPos()[axis]);
+      expectedDepth = std::min(expectedDepth, separationDist);
+    }
+
+    CHECK(contact.depth == Approx(expectedDepth).margin(0.0005f));
+    CHECK(contact.normal.computeLength() == Approx(1.f));
+  }
+
+  for (std::size_t i = 0; i < 500; ++i) {
+    const Raz::Sphere sphere1(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }), sizeDistrib(randGenerator));
+    const Raz::Sphere sphere2(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }), sizeDistrib(randGenerator));
+
+    const float centersDist = (sphere2.getCenter() - sphere1.getCenter()).computeLength();
+    const float expectedDepth = sphere1.getRadius() + sphere2.getRadius() - centersDist;
+
+    // Shapes almost touching each other are skipped, being within the algorithm's tolerance
+    if (std::abs(expectedDepth) < 0.001f)
+      continue;
+
+    Raz::Gjk::Contact contact;
+    REQUIRE(Raz::Gjk::computeContact(sphere1, sphere2, contact) == (expectedDepth > 0.f));
+    REQUIRE(sphere1.intersects(sphere2) == (expectedDepth > 0.f));
+
+    if (expectedDepth > 0.f)
+      CHECK(contact.depth == Approx(expectedDepth).margin(0.01f));
+  }
+}
@@ -0,0 +1,172 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/LooseOctree.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+float computeSquaredDistance(const Raz::Vec3f& point, const Raz::AABB& aabb) {
+  const Raz::Vec3f projection = aabb.computeProjection(point);
+  return (projection - point).computeSquaredLength();
+}
+
+std::vector<std::uint32_t> sortIndices(std::vector<std::uint32_t>::const_iterator begin, std::vector<std::uint32_t>::const_iterator end) {
+  std::vector<std::uint32_t> indices(begin, end);
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+} // namespace
+
+TEST_CASE("LooseOctree basic") {
+  Raz::LooseOctree octree(Raz::Vec3f(0.f), 64.f, 4);
+  REQUIRE(octree.getNodeCount() == 1);
+
+  // A box 1 unit large fits in the cells of the deepest level (8 units large), which requires creating a node on each level
+  const std::uint32_t smallObject = octree.addObject(Raz::AABB(Raz::Vec3f(1.5f), Raz::Vec3f(0.5f)));
+  REQUIRE(octree.getNodeCount() == 5);
+
+  const Raz::LooseOctree::Node& smallNode = octree.getNodes()[octree.getObjectNodeIndex(smallObject)];
+  CHECK(smallNode.halfSize == 4.f);
+  CHECK(smallNode.center == Raz::Vec3f(4.f));
+
+  // A box as large as the root cell stays in the root, as does a box out of the octree's bounds
+  const std::uint32_t largeObject = octree.addObject(Raz::AABB(Raz::Vec3f(60.f), Raz::Vec3f(-60.f)));
+  const std::uint32_t farObject   = octree.addObject(Raz::AABB(Raz::Vec3f({ 201.f, 1.f, 1.f }), Raz::Vec3f({ 200.f, 0.f, 0.f })));
+  CHECK(octree.getObjectNodeIndex(largeObject) == 0);
+  CHECK(octree.getObjectNodeIndex(farObject) == 0);
+  REQUIRE(octree.getObjectCount() == 3);
+
+  // Moving the small box within its cell leaves it in the same node
+  REQUIRE_FALSE(octree.moveObject(smallObject, Raz::AABB(Raz::Vec3f(7.5f), Raz::Vec3f(6.5f))));
+  REQUIRE(octree.moveObject(smallObject, Raz::AABB(Raz::Vec3f(-6.5f), Raz::Vec3f(-7.5f))));
+  CHECK(octree.getNodes()[octree.getObjectNodeIndex(smallObject)].center == Raz::Vec3f(-4.f));
+  REQUIRE(octree.getNodeCount() == 5); // The nodes left empty have been removed
+
+  std::vector<std::uint32_t> objectIndices;
+  octree.queryRadius(Raz::Vec3f(-10.f), 5.f, objectIndices);
+  REQUIRE(sortIndices(objectIndices.cbegin(), objectIndices.cend()) == std::vector<std::uint32_t>({ smallObject, largeObject }));
+
+  objectIndices.clear();
+  octree.queryBox(Raz::AABB(Raz::Vec3f({ 300.f, 10.f, 10.f }), Raz::Vec3f({ 100.f, -10.f, -10.f })), objectIndices);
+  REQUIRE(objectIndices == std::vector<std::uint32_t>({ farObject }));
+
+  octree.removeObject(smallObject);
+  REQUIRE_FALSE(octree.isObjectValid(smallObject));
+  REQUIRE(octree.getNodeCount() == 1);
+  REQUIRE(octree.getObjectCount() == 2);
+
+  // The removed object's index is reused
+  REQUIRE(octree.addObject(Raz::AABB(Raz::Vec3f(1.f), Raz::Vec3f(0.f))) == smallObject);
+
+  CHECK_THROWS(Raz::LooseOctree(Raz::Vec3f(0.f), 1.f, Raz::LooseOctree::MaxDepth + 1));
+}
+
+TEST_CASE("LooseOctree growing objects") {
+  Raz::LooseOctree octree(Raz::Vec3f(0.f), 8.f, 4);
+
+  const std::uint32_t object = octree.addObject(Raz::AABB(Raz::Vec3f(5.1f), Raz::Vec3f(4.9f)));
+  const std::size_t deepNodeCount = octree.getNodeCount();
+  REQUIRE(deepNodeCount == 5);
+
+  // Growing the box moves it into one of its current node's ancestors, which must be kept while the nodes below it are removed
+  REQUIRE(octree.moveObject(object, Raz::AABB(Raz::Vec3f(6.5f), Raz::Vec3f(3.5f))));
+  CHECK(octree.getNodeCount() > 1);
+  CHECK(octree.getNodeCount() < deepNodeCount);
+
+  const Raz::LooseOctree::Node& node = octree.getNodes()[octree.getObjectNodeIndex(object)];
+  CHECK(node.halfSize == 2.f);
+  CHECK(node.center == Raz::Vec3f(6.f));
+
+  std::vector<std::uint32_t> objectIndices;
+  octree.queryBox(Raz::AABB(Raz::Vec3f(7.f), Raz::Vec3f(3.f)), objectIndices);
+  CHECK(objectIndices == std::vector<std::uint32_t>({ object }));
+
+  objectIndices.clear();
+  octree.queryRadius(Raz::Vec3f(5.f), 0.5f, objectIndices);
+  CHECK(objectIndices == std::vector<std::uint32_t>({ object }));
+}
+
+TEST_CASE("LooseOctree moving objects") {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-110.f, 110.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.1f, 5.f);
+  std::uniform_real_distribution<float> moveDistrib(-2.f, 2.f);
+
+  const auto createBox = [&] () {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+    const Raz::Vec3f halfExtents({ sizeDistrib(randGenerator), sizeDistrib(randGenerator), sizeDistrib(randGenerator) });
+    return Raz::AABB(center + halfExtents, center - halfExtents);
+  };
+
+  // Some objects are out of the octree's bounds
+  Raz::LooseOctree octree(Raz::Vec3f(0.f), 100.f, 6);
+  std::vector<Raz::AABB> boxes;
+
+  for (std::size_t i = 0; i < 2000; ++i) {
+    boxes.push_back(createBox());
+    REQUIRE(octree.addObject(boxes.back()) == i);
+  }
+
+  std::size_t relocationCount = 0;
+
+  for (std::size_t frameIndex = 0; frameIndex < 5; ++frameIndex) {
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+      const Raz::Vec3f offset({ moveDistrib(randGenerator), moveDistrib(randGenerator), moveDistrib(randGenerator) });
+      boxes[i] = Raz::AABB(boxes[i].getRightTopFrontPos() + offset, boxes[i].getLeftBottomBackPos() + offset);
+      relocationCount += octree.moveObject(i, boxes[i]);
+    }
+  }
+
+  // Most moves are small enough to stay in the same cell
+  CHECK(relocationCount > 0);
+  CHECK(relocationCount < boxes.size() * 5 / 2);
+
+  std::vector<Raz::Vec3f> centers;
+  std::vector<Raz::AABB> queryBoxes;
+
+  for (std::size_t i = 0; i < 50; ++i) {
+    centers.emplace_back(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }));
+    queryBoxes.emplace_back(createBox());
+  }
+
+  std::vector<std::uint32_t> objectIndices;
+  std::vector<std::size_t> queryOffsets;
+
+  octree.queryRadius(centers, 10.f, objectIndices, queryOffsets);
+  REQUIRE(queryOffsets.size() == centers.size() + 1);
+
+  for (std::size_t queryIndex = 0; queryIndex < centers.size(); ++queryIndex) {
+    std::vector<std::uint32_t> expectedIndices;
+
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+      if (computeSquaredDistance(centers[queryIndex], boxes[i]) <= 100.f)
+        expectedIndices.push_back(i);
+    }
+
+    REQUIRE(sortIndices(objectIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[queryIndex]),
+                        objectIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[queryIndex + 1])) == expectedIndices);
+  }
+
+  octree.queryBox(queryBoxes, objectIndices, queryOffsets);
+  REQUIRE(queryOffsets.size() == queryBoxes.size() + 1);
+
+  for (std::size_t queryIndex = 0; queryIndex < queryBoxes.size(); ++queryIndex) {
+    std::vector<std::uint32_t> expectedIndices;
+
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+      if (boxes[i].intersects(queryBoxes[queryIndex]))
+        expectedIndices.push_back(i);
+    }
+
+    REQUIRE(sortIndices(objectIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[queryIndex]),
+                        objectIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[queryIndex + 1])) == expectedIndices);
+  }
+
+  for (std::uint32_t i = 0; i < boxes.size(); ++i)
+    octree.removeObject(i);
+
+  REQUIRE(octree.getObjectCount() == 0);
+  REQUIRE(octree.getNodeCount() == 1);
+}
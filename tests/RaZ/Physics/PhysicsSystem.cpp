@@ -0,0 +1,235 @@
+#include "catch/catch.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <cmath>
+
+namespace {
+
+constexpr float TimeStep = 1.f / 60.f;
+
+Raz::Entity& addBody(Raz::World& world, const Raz::Vec3f& position, const Raz::Collider& collider, float mass) {
+  Raz::Entity& entity = world.addEntity();
+  entity.addComponent<Raz::Transform>(position);
+
+  switch (collider.getType()) {
+    case Raz::ColliderType::SPHERE:
+      entity.addComponent<Raz::Collider>(collider.getShape<Raz::Sphere>());
+      break;
+
+    case Raz::ColliderType::BOX:
+      entity.addComponent<Raz::Collider>(collider.getShape<Raz::AABB>());
+      break;
+
+    case Raz::ColliderType::PLANE:
+      entity.addComponent<Raz::Collider>(collider.getShape<Raz::Plane>());
+      break;
+  }
+
+  if (mass > 0.f)
+    entity.addComponent<Raz::RigidBody>(mass);
+
+  return entity;
+}
+
+void simulate(Raz::World& world, float duration) {
+  const auto stepCount = static_cast<std::size_t>(std::round(duration / TimeStep));
+
+  for (std::size_t stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+    world.update(TimeStep);
+}
+
+const Raz::Collider unitBox(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(-0.5f)));
+const Raz::Collider floorPlane(Raz::Plane(0.f));
+
+} // namespace
+
+TEST_CASE("PhysicsSystem free fall") {
+  Raz::World world(8);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  Raz::Entity& body = addBody(world, Raz::Vec3f({ 0.f, 10.f, 0.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.5f)), 1.f);
+  body.getComponent<Raz::RigidBody>().setLinearDamping(0.f);
+
+  // Less than a step has elapsed: nothing is simulated yet
+  world.update(TimeStep * 0.5f);
+  CHECK(body.getComponent<Raz::Transform>().getPosition()[1] == 10.f);
+
+  world.update(TimeStep * 0.5f);
+  CHECK(physics.getBodyCount() == 1);
+  CHECK(physics.getIslandCount() == 1);
+  CHECK(physics.getContactCount() == 0);
+
+  simulate(world, 59.f * TimeStep);
+
+  // After a second, the body has fallen by about g / 2 (the semi-implicit Euler integration being slightly ahead) & goes at g m/s
+  CHECK(body.getComponent<Raz::RigidBody>().getLinearVelocity()[1] == Approx(-9.81f).epsilon(0.01f));
+  CHECK(body.getComponent<Raz::Transform>().getPosition()[1] == Approx(10.f - 9.81f * 0.5f).epsilon(0.02f));
+  CHECK(body.getComponent<Raz::Transform>().getPosition()[0] == 0.f);
+
+  // Static bodies are never moved
+  Raz::Entity& staticBody = addBody(world, Raz::Vec3f({ 5.f, 0.f, 0.f }), unitBox, 0.f);
+  simulate(world, 1.f);
+  CHECK(staticBody.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f({ 5.f, 0.f, 0.f }));
+}
+
+TEST_CASE("PhysicsSystem resting & sleeping") {
+  Raz::World world(8);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  addBody(world, Raz::Vec3f(0.f), floorPlane, 0.f);
+  Raz::Entity& sphere = addBody(world, Raz::Vec3f({ 0.f, 2.f, 0.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.5f)), 1.f);
+  Raz::Entity& box    = addBody(world, Raz::Vec3f({ 3.f, 1.f, 0.f }), unitBox, 2.f);
+
+  simulate(world, 3.f);
+
+  // Both bodies lie on the floor, with a slight penetration at most
+  CHECK(sphere.getComponent<Raz::Transform>().getPosition()[1] == Approx(0.5f).margin(0.01f));
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[1] == Approx(0.5f).margin(0.01f));
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[0] == Approx(3.f).margin(0.001f));
+
+  // Having stopped moving, they have been put to sleep
+  CHECK(sphere.getComponent<Raz::RigidBody>().isSleeping());
+  CHECK(box.getComponent<Raz::RigidBody>().isSleeping());
+  CHECK(physics.getIslandCount() == 0);
+
+  // Giving a body a velocity wakes it up
+  box.getComponent<Raz::RigidBody>().setLinearVelocity(Raz::Vec3f({ 0.f, 5.f, 0.f }));
+  CHECK_FALSE(box.getComponent<Raz::RigidBody>().isSleeping());
+
+  world.update(TimeStep);
+  CHECK(physics.getIslandCount() == 1);
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[1] > 0.55f);
+  CHECK(sphere.getComponent<Raz::RigidBody>().isSleeping());
+
+  // The box lands back on the floor & falls asleep again
+  simulate(world, 3.f);
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[1] == Approx(0.5f).margin(0.01f));
+  CHECK(box.getComponent<Raz::RigidBody>().isSleeping());
+}
+
+TEST_CASE("PhysicsSystem stacking") {
+  Raz::World world(8);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  addBody(world, Raz::Vec3f(0.f), floorPlane, 0.f);
+
+  std::vector<Raz::Entity*> boxes;
+
+  for (std::size_t boxIndex = 0; boxIndex < 5; ++boxIndex)
+    boxes.push_back(&addBody(world, Raz::Vec3f({ 0.f, 0.5f + static_cast<float>(boxIndex) * 1.01f, 0.f }), unitBox, 1.f));
+
+  world.update(TimeStep);
+  CHECK(physics.getBodyCount() == 6);
+  // The whole stack is a single island, touching the floor at 4 points & each other box at 4 points
+  CHECK(physics.getIslandCount() == 1);
+  CHECK(physics.getContactCount() == 5);
+
+  simulate(world, 4.f);
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex) {
+    const Raz::Transform& transform = boxes[boxIndex]->getComponent<Raz::Transform>();
+
+    CHECK(transform.getPosition()[0] == Approx(0.f).margin(0.01f));
+    CHECK(transform.getPosition()[1] == Approx(0.5f + static_cast<float>(boxIndex)).margin(0.03f));
+    CHECK(transform.getPosition()[2] == Approx(0.f).margin(0.01f));
+    CHECK(boxes[boxIndex]->getComponent<Raz::RigidBody>().isSleeping());
+  }
+
+  // Removing the bottom box from the simulation & waking the one above it up, the rest of the stack falls onto the floor
+  boxes.front()->removeComponent<Raz::Collider>();
+  boxes.front()->removeComponent<Raz::RigidBody>();
+  boxes.erase(boxes.begin());
+  boxes.front()->getComponent<Raz::RigidBody>().wakeUp();
+
+  simulate(world, 4.f);
+  CHECK(physics.getBodyCount() == 5);
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+    CHECK(boxes[boxIndex]->getComponent<Raz::Transform>().getPosition()[1] == Approx(0.5f + static_cast<float>(boxIndex)).margin(0.03f));
+}
+
+TEST_CASE("PhysicsSystem collisions") {
+  Raz::World world(8);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+
+  // Two spheres of different masses collide head-on
+  Raz::Entity& light = addBody(world, Raz::Vec3f({ -2.f, 0.f, 0.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.5f)), 1.f);
+  Raz::Entity& heavy = addBody(world, Raz::Vec3f({ 2.f, 0.f, 0.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.5f)), 3.f);
+
+  for (Raz::Entity* entity : { &light, &heavy }) {
+    auto& rigidBody = entity->getComponent<Raz::RigidBody>();
+    rigidBody.setRestitution(1.f);
+    rigidBody.setLinearDamping(0.f);
+  }
+
+  light.getComponent<Raz::RigidBody>().setLinearVelocity(Raz::Vec3f({ 4.f, 0.f, 0.f }));
+  heavy.getComponent<Raz::RigidBody>().setLinearVelocity(Raz::Vec3f({ -4.f, 0.f, 0.f }));
+
+  simulate(world, 1.f);
+
+  const Raz::Vec3f& lightVelocity = light.getComponent<Raz::RigidBody>().getLinearVelocity();
+  const Raz::Vec3f& heavyVelocity = heavy.getComponent<Raz::RigidBody>().getLinearVelocity();
+
+  // The momentum is conserved, & with a perfectly elastic collision, so is the kinetic energy: the light sphere is sent back at 8 m/s & the heavy one stops
+  CHECK(lightVelocity[0] + 3.f * heavyVelocity[0] == Approx(-8.f).epsilon(0.001f));
+  CHECK(lightVelocity[0] == Approx(-8.f).epsilon(0.02f));
+  CHECK(heavyVelocity[0] == Approx(0.f).margin(0.1f));
+  CHECK(lightVelocity[1] == 0.f);
+  CHECK(light.getComponent<Raz::Transform>().getPosition()[0] < heavy.getComponent<Raz::Transform>().getPosition()[0] - 1.f);
+
+  // A sphere hitting a box's edge is deflected & makes it spin
+  physics.setGravity(Raz::Vec3f({ 0.f, -9.81f, 0.f }));
+  light.disable();
+  heavy.disable();
+
+  addBody(world, Raz::Vec3f(0.f), floorPlane, 0.f);
+  Raz::Entity& box = addBody(world, Raz::Vec3f({ 0.f, 0.5f, 0.f }), unitBox, 1.f);
+  box.getComponent<Raz::RigidBody>().setFriction(1.f);
+
+  Raz::Entity& ball = addBody(world, Raz::Vec3f({ -3.f, 0.9f, 0.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.25f)), 1.f);
+  ball.getComponent<Raz::RigidBody>().setLinearVelocity(Raz::Vec3f({ 15.f, 0.f, 0.f }));
+
+  world.update(TimeStep);
+  CHECK(physics.getBodyCount() == 5);
+  CHECK(physics.getIslandCount() == 2);
+
+  simulate(world, 0.25f);
+
+  // The box is pushed to the right & tilted around -Z, being hit above its center of mass
+  const Raz::Transform& boxTransform = box.getComponent<Raz::Transform>();
+  CHECK(boxTransform.getPosition()[0] > 0.05f);
+  CHECK((boxTransform.getRotation() * Raz::Axis::Y)[0] > 0.05f);
+  CHECK(ball.getComponent<Raz::Transform>().getPosition()[0] < boxTransform.getPosition()[0]);
+}
+
+TEST_CASE("PhysicsSystem friction") {
+  Raz::World world(8);
+  world.addSystem<Raz::PhysicsSystem>();
+
+  addBody(world, Raz::Vec3f(0.f), floorPlane, 0.f);
+
+  // Sliding at 5 m/s with a friction coefficient of 0.5, a box decelerates at 0.5 * g & stops after 25 / 9.81 ~= 2.55 m
+  Raz::Entity& box = addBody(world, Raz::Vec3f({ 0.f, 0.5f, 0.f }), unitBox, 1.f);
+  auto& rigidBody = box.getComponent<Raz::RigidBody>();
+  rigidBody.setLinearDamping(0.f);
+  rigidBody.setLinearVelocity(Raz::Vec3f({ 5.f, 0.f, 0.f }));
+
+  // Without friction, a sphere keeps sliding
+  Raz::Entity& sphere = addBody(world, Raz::Vec3f({ 0.f, 0.5f, 5.f }), Raz::Collider(Raz::Sphere(Raz::Vec3f(0.f), 0.5f)), 1.f);
+  auto& sphereBody = sphere.getComponent<Raz::RigidBody>();
+  sphereBody.setFriction(0.f);
+  sphereBody.setLinearDamping(0.f);
+  sphereBody.setLinearVelocity(Raz::Vec3f({ 5.f, 0.f, 0.f }));
+
+  simulate(world, 2.f);
+
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[0] == Approx(2.55f).margin(0.1f));
+  CHECK(box.getComponent<Raz::Transform>().getPosition()[1] == Approx(0.5f).margin(0.01f));
+  CHECK(rigidBody.getLinearVelocity()[0] == Approx(0.f).margin(0.01f));
+  CHECK(sphereBody.getLinearVelocity()[0] == Approx(5.f).epsilon(0.01f));
+}
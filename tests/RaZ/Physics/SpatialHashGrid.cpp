@@ -0,0 +1,181 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+
+std::vector<std::uint32_t> sortIndices(std::vector<std::uint32_t>::const_iterator begin, std::vector<std::uint32_t>::const_iterator end) {
+  std::vector<std::uint32_t> indices(begin, end);
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+std::vector<std::uint32_t> findPointsAround(const std::vector<Raz::Vec3f>& positions, const Raz::Vec3f& center, float radius) {
+  std::vector<std::uint32_t> indices;
+
+  for (std::uint32_t pointIndex = 0; pointIndex < positions.size(); ++pointIndex) {
+    if ((positions[pointIndex] - center).computeSquaredLength() <= radius * radius)
+      indices.push_back(pointIndex);
+  }
+
+  return indices;
+}
+
+std::vector<Raz::Vec3f> generatePositions(std::size_t pointCount, float extent) {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  std::uniform_real_distribution<float> distribution(-extent, extent);
+
+  std::vector<Raz::Vec3f> positions(pointCount);
+
+  for (Raz::Vec3f& position : positions)
+    position = Raz::Vec3f({ distribution(randGenerator), distribution(randGenerator), distribution(randGenerator) });
+
+  return positions;
+}
+
+} // namespace
+
+TEST_CASE("SpatialHashGrid basic") {
+  Raz::SpatialHashGrid grid(1.f);
+  CHECK(grid.getCellSize() == 1.f);
+  CHECK(grid.getPointCount() == 0);
+
+  std::vector<std::uint32_t> pointIndices;
+  grid.queryRadius(Raz::Vec3f(0.f), 1.f, pointIndices);
+  CHECK(pointIndices.empty());
+
+  // Points on both sides of the cells' boundaries, negative coordinates included
+  const std::vector<Raz::Vec3f> positions = { Raz::Vec3f({ 0.1f, 0.1f, 0.1f }), Raz::Vec3f({ -0.1f, 0.1f, 0.1f }), Raz::Vec3f({ 0.9f, -0.9f, 0.f }),
+                                              Raz::Vec3f({ 1.5f, 0.f, 0.f }), Raz::Vec3f({ -5.f, -5.f, -5.f }), Raz::Vec3f({ 0.1f, 0.1f, 0.1f }) };
+  grid.rebuild(positions);
+  CHECK(grid.getPointCount() == 6);
+  CHECK(grid.getBucketCount() == 64);
+
+  grid.queryRadius(Raz::Vec3f(0.f), 1.f, pointIndices);
+  CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == std::vector<std::uint32_t>({ 0, 1, 5 }));
+
+  // Points exactly at the radius are included
+  pointIndices.clear();
+  grid.queryRadius(Raz::Vec3f({ 0.5f, 0.f, 0.f }), 1.f, pointIndices);
+  CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == std::vector<std::uint32_t>({ 0, 1, 2, 3, 5 }));
+
+  pointIndices.clear();
+  grid.queryRadius(Raz::Vec3f(-4.5f), 0.5f, pointIndices);
+  CHECK(pointIndices.empty());
+
+  grid.queryRadius(Raz::Vec3f(-4.5f), 0.9f, pointIndices);
+  CHECK(pointIndices == std::vector<std::uint32_t>({ 4 }));
+
+  // Results are appended to the given list
+  grid.queryRadius(Raz::Vec3f({ 1.5f, 0.f, 0.f }), 0.1f, pointIndices);
+  CHECK(pointIndices == std::vector<std::uint32_t>({ 4, 3 }));
+
+  // Rebuilding replaces all points
+  grid.rebuild(std::vector<Raz::Vec3f>({ Raz::Vec3f(10.f) }));
+  CHECK(grid.getPointCount() == 1);
+
+  pointIndices.clear();
+  grid.queryRadius(Raz::Vec3f(0.f), 1.f, pointIndices);
+  CHECK(pointIndices.empty());
+
+  grid.queryRadius(Raz::Vec3f(10.5f), 1.f, pointIndices);
+  CHECK(pointIndices == std::vector<std::uint32_t>({ 0 }));
+}
+
+TEST_CASE("SpatialHashGrid structure of arrays") {
+  const std::vector<Raz::Vec3f> positions = generatePositions(2000, 10.f);
+
+  std::vector<float> xPositions;
+  std::vector<float> yPositions;
+  std::vector<float> zPositions;
+
+  for (const Raz::Vec3f& position : positions) {
+    xPositions.push_back(position[0]);
+    yPositions.push_back(position[1]);
+    zPositions.push_back(position[2]);
+  }
+
+  Raz::SpatialHashGrid grid(0.75f);
+  grid.rebuild(xPositions, yPositions, zPositions);
+  CHECK(grid.getPointCount() == 2000);
+  CHECK(grid.getBucketCount() == 2048);
+
+  for (const Raz::Vec3f& center : generatePositions(100, 10.f)) {
+    std::vector<std::uint32_t> pointIndices;
+    grid.queryRadius(center, 0.75f, pointIndices);
+    CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == findPointsAround(positions, center, 0.75f));
+  }
+}
+
+TEST_CASE("SpatialHashGrid hash collisions") {
+  const std::vector<Raz::Vec3f> positions = generatePositions(500, 3.f);
+
+  // With very few buckets, most cells share one with others; the points of other cells are discarded, & no point is found twice
+  Raz::SpatialHashGrid grid(1.f, 3);
+  grid.rebuild(positions);
+  CHECK(grid.getBucketCount() == 64);
+
+  Raz::SpatialHashGrid smallGrid(0.5f, 100);
+  smallGrid.rebuild(positions);
+  CHECK(smallGrid.getBucketCount() == 128);
+
+  for (const Raz::Vec3f& center : generatePositions(50, 3.f)) {
+    std::vector<std::uint32_t> pointIndices;
+    grid.queryRadius(center, 1.f, pointIndices);
+    CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == findPointsAround(positions, center, 1.f));
+
+    pointIndices.clear();
+    smallGrid.queryRadius(center, 0.3f, pointIndices);
+    CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == findPointsAround(positions, center, 0.3f));
+  }
+}
+
+TEST_CASE("SpatialHashGrid query rounding") {
+  // Points on a lattice aligned with the cells' boundaries
+  std::vector<Raz::Vec3f> positions;
+
+  for (int z = -3; z <= 3; ++z) {
+    for (int y = -3; y <= 3; ++y) {
+      for (int x = -3; x <= 3; ++x)
+        positions.emplace_back(Raz::Vec3f({ static_cast<float>(x), static_cast<float>(y), static_cast<float>(z) }));
+    }
+  }
+
+  Raz::SpatialHashGrid grid(1.f, 65536);
+  grid.rebuild(positions);
+
+  // Just below a boundary, the query's box is rounded over 4 cells per axis, all of which may hold points within the rounded radius
+  const Raz::Vec3f center(std::nextafter(1.f, 0.f));
+
+  std::vector<std::uint32_t> pointIndices;
+  grid.queryRadius(center, 1.f, pointIndices);
+  CHECK(sortIndices(pointIndices.cbegin(), pointIndices.cend()) == findPointsAround(positions, center, 1.f));
+}
+
+TEST_CASE("SpatialHashGrid multiple queries") {
+  const std::vector<Raz::Vec3f> positions = generatePositions(20000, 20.f);
+
+  Raz::SpatialHashGrid grid(1.f);
+  grid.rebuild(positions);
+
+  // Finding the neighbors of all points at once gives the same results as querying them one by one
+  std::vector<std::uint32_t> pointIndices;
+  std::vector<std::size_t> queryOffsets;
+  grid.queryRadius(positions, 0.8f, pointIndices, queryOffsets);
+
+  REQUIRE(queryOffsets.size() == positions.size() + 1);
+  CHECK(queryOffsets.front() == 0);
+  CHECK(queryOffsets.back() == pointIndices.size());
+
+  for (std::size_t pointIndex = 0; pointIndex < positions.size(); pointIndex += 97) {
+    const std::vector<std::uint32_t> expectedIndices = findPointsAround(positions, positions[pointIndex], 0.8f);
+
+    // Each point finds itself
+    CHECK(std::find(expectedIndices.cbegin(), expectedIndices.cend(), pointIndex) != expectedIndices.cend());
+    CHECK(sortIndices(pointIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[pointIndex]),
+                      pointIndices.cbegin() + static_cast<std::ptrdiff_t>(queryOffsets[pointIndex + 1])) == expectedIndices);
+  }
+}
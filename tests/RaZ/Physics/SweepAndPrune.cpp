@@ -0,0 +1,164 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+std::vector<Raz::SweepAndPrune::Pair> findPairsBruteForce(const std::vector<Raz::AABB>& boxes, const std::vector<bool>& validBoxes) {
+  std::vector<Raz::SweepAndPrune::Pair> pairs;
+
+  for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+    if (!validBoxes[i])
+      continue;
+
+    for (std::uint32_t j = i + 1; j < boxes.size(); ++j) {
+      if (validBoxes[j] && boxes[i].intersects(boxes[j]))
+        pairs.emplace_back(i, j);
+    }
+  }
+
+  return pairs;
+}
+
+std::vector<Raz::SweepAndPrune::Pair> getSortedPairs(const Raz::SweepAndPrune& sweepAndPrune) {
+  std::vector<Raz::SweepAndPrune::Pair> pairs = sweepAndPrune.getOverlappingPairs();
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+} // namespace
+
+TEST_CASE("SweepAndPrune basic") {
+  Raz::SweepAndPrune sweepAndPrune;
+  sweepAndPrune.update();
+  REQUIRE(sweepAndPrune.getOverlappingPairs().empty());
+
+  const std::uint32_t firstProxy  = sweepAndPrune.addProxy(Raz::AABB(Raz::Vec3f(1.f), Raz::Vec3f(0.f)));
+  const std::uint32_t secondProxy = sweepAndPrune.addProxy(Raz::AABB(Raz::Vec3f(1.5f), Raz::Vec3f(0.5f)));
+  const std::uint32_t thirdProxy  = sweepAndPrune.addProxy(Raz::AABB(Raz::Vec3f({ 1.f, 5.f, 1.f }), Raz::Vec3f({ 0.f, 4.f, 0.f })));
+  REQUIRE(sweepAndPrune.getProxyCount() == 3);
+
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == std::vector<Raz::SweepAndPrune::Pair>({ { firstProxy, secondProxy } }));
+
+  // Moving the third box onto the second one; touching boxes are considered overlapping
+  sweepAndPrune.updateProxy(thirdProxy, Raz::AABB(Raz::Vec3f({ 1.f, 2.5f, 1.f }), Raz::Vec3f({ 0.f, 1.5f, 0.f })));
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == std::vector<Raz::SweepAndPrune::Pair>({ { firstProxy, secondProxy }, { secondProxy, thirdProxy } }));
+
+  sweepAndPrune.removeProxy(secondProxy);
+  REQUIRE_FALSE(sweepAndPrune.isProxyValid(secondProxy));
+  REQUIRE(sweepAndPrune.getProxyCount() == 2);
+
+  sweepAndPrune.update();
+  REQUIRE(sweepAndPrune.getOverlappingPairs().empty());
+
+  // The removed proxy's index is reused
+  REQUIRE(sweepAndPrune.addProxy(Raz::AABB(Raz::Vec3f(3.f), Raz::Vec3f(-3.f))) == secondProxy);
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == std::vector<Raz::SweepAndPrune::Pair>({ { firstProxy, secondProxy }, { secondProxy, thirdProxy } }));
+}
+
+TEST_CASE("SweepAndPrune moving boxes") {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-50.f, 50.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.5f, 4.f);
+  std::uniform_real_distribution<float> moveDistrib(-1.f, 1.f);
+
+  const auto createBox = [&] (const Raz::Vec3f& center) {
+    const Raz::Vec3f halfExtents({ sizeDistrib(randGenerator), sizeDistrib(randGenerator), sizeDistrib(randGenerator) });
+    return Raz::AABB(center + halfExtents, center - halfExtents);
+  };
+
+  Raz::SweepAndPrune sweepAndPrune;
+  std::vector<Raz::AABB> boxes;
+  std::vector<bool> validBoxes;
+
+  for (std::size_t i = 0; i < 1000; ++i) {
+    boxes.emplace_back(createBox(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) })));
+    validBoxes.push_back(true);
+    REQUIRE(sweepAndPrune.addProxy(boxes.back()) == i);
+  }
+
+  for (std::size_t frameIndex = 0; frameIndex < 10; ++frameIndex) {
+    // Slightly moving every box, then removing some & adding others
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+      if (!validBoxes[i])
+        continue;
+
+      const Raz::Vec3f offset({ moveDistrib(randGenerator), moveDistrib(randGenerator), moveDistrib(randGenerator) });
+      boxes[i] = Raz::AABB(boxes[i].getRightTopFrontPos() + offset, boxes[i].getLeftBottomBackPos() + offset);
+      sweepAndPrune.updateProxy(i, boxes[i]);
+    }
+
+    if (frameIndex % 2 == 0) {
+      for (std::uint32_t i = static_cast<std::uint32_t>(frameIndex); i < boxes.size(); i += 97) {
+        if (validBoxes[i]) {
+          sweepAndPrune.removeProxy(i);
+          validBoxes[i] = false;
+        }
+      }
+    } else {
+      // Removed proxies' indices are reused first
+      for (std::size_t i = 0; i < 20; ++i) {
+        const Raz::AABB box = createBox(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }));
+        const std::uint32_t proxyIndex = sweepAndPrune.addProxy(box);
+
+        if (proxyIndex == boxes.size()) {
+          boxes.push_back(box);
+          validBoxes.push_back(true);
+          continue;
+        }
+
+        REQUIRE_FALSE(validBoxes[proxyIndex]);
+        boxes[proxyIndex] = box;
+        validBoxes[proxyIndex] = true;
+      }
+    }
+
+    sweepAndPrune.update();
+    REQUIRE(getSortedPairs(sweepAndPrune) == findPairsBruteForce(boxes, validBoxes));
+  }
+}
+
+TEST_CASE("SweepAndPrune sweep axis change") {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> spreadDistrib(-100.f, 100.f);
+  std::uniform_real_distribution<float> narrowDistrib(-2.f, 2.f);
+
+  Raz::SweepAndPrune sweepAndPrune;
+  std::vector<Raz::AABB> boxes;
+  const std::vector<bool> validBoxes(500, true);
+
+  // The boxes are first spread along X, then along Z; the sweep axis must follow, the boxes being sorted again along the new one
+  for (std::size_t i = 0; i < validBoxes.size(); ++i) {
+    const Raz::Vec3f center({ spreadDistrib(randGenerator), narrowDistrib(randGenerator), narrowDistrib(randGenerator) });
+    boxes.emplace_back(center + Raz::Vec3f(1.f), center - Raz::Vec3f(1.f));
+    sweepAndPrune.addProxy(boxes.back());
+  }
+
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == findPairsBruteForce(boxes, validBoxes));
+
+  for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+    const Raz::Vec3f center({ narrowDistrib(randGenerator), narrowDistrib(randGenerator), spreadDistrib(randGenerator) });
+    boxes[i] = Raz::AABB(center + Raz::Vec3f(1.f), center - Raz::Vec3f(1.f));
+    sweepAndPrune.updateProxy(i, boxes[i]);
+  }
+
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == findPairsBruteForce(boxes, validBoxes));
+
+  // Removing a box moves another in its place, which must be sorted back
+  std::vector<bool> remainingBoxes = validBoxes;
+
+  for (std::uint32_t i = 0; i < boxes.size(); i += 7) {
+    sweepAndPrune.removeProxy(i);
+    remainingBoxes[i] = false;
+  }
+
+  sweepAndPrune.update();
+  REQUIRE(getSortedPairs(sweepAndPrune) == findPairsBruteForce(boxes, remainingBoxes));
+}
@@ -0,0 +1,67 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/Camera.hpp"
+
+#include <algorithm>
+
+TEST_CASE("Camera ray computation") {
+  Raz::Camera camera(800, 600, 45.f, 0.1f, 100.f);
+
+  const Raz::Vec3f camPos({ 1.f, 2.f, 5.f });
+  const Raz::Vec3f target({ 0.f, 1.f, 0.f });
+  camera.computeLookAt(camPos, target);
+  camera.computeInverseViewMatrix();
+
+  // The ray going through the center of the screen points straight towards the target, starting on the near plane
+  const Raz::Ray centerRay = camera.computeRay(Raz::Vec2f(0.f));
+  const Raz::Vec3f targetDir = (target - camPos).normalize();
+
+  CHECK_THAT(centerRay.getDirection().dot(targetDir), Catch::WithinAbs(1.f, 0.00001f));
+  CHECK_THAT((centerRay.getOrigin() - camPos).computeLength(), Catch::WithinAbs(0.1f, 0.00001f));
+
+  // Any point along a ray must be projected back onto the screen position it has been computed from
+  const Raz::Mat4f viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
+
+  for (const Raz::Vec2f& ndcPos : { Raz::Vec2f({ -1.f, -1.f }), Raz::Vec2f({ 0.5f, -0.25f }), Raz::Vec2f({ 1.f, 1.f }) }) {
+    const Raz::Ray ray = camera.computeRay(ndcPos);
+
+    for (float distance : { 1.f, 10.f, 50.f }) {
+      const Raz::Vec3f point = ray.getOrigin() + ray.getDirection() * distance;
+      const Raz::Vec4f projPoint = Raz::Vec4f({ point[0], point[1], point[2], 1.f }) * viewProjMat;
+
+      CHECK_THAT(projPoint[0] / projPoint[3], Catch::WithinAbs(ndcPos[0], 0.0001f));
+      CHECK_THAT(projPoint[1] / projPoint[3], Catch::WithinAbs(ndcPos[1], 0.0001f));
+    }
+  }
+}
+
+TEST_CASE("Camera frustum planes") {
+  Raz::Camera camera(800, 600, 45.f, 0.1f, 100.f);
+  camera.computeLookAt(Raz::Vec3f({ 1.f, 2.f, 5.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  camera.computeInverseViewMatrix();
+
+  const std::array<Raz::Plane, 6> planes = camera.computeFrustumPlanes();
+
+  const auto isInside = [&planes] (const Raz::Vec3f& point) {
+    return std::all_of(planes.cbegin(), planes.cend(), [&point] (const Raz::Plane& plane) {
+      return (plane.getNormal().dot(point) >= plane.getDistance());
+    });
+  };
+
+  for (const Raz::Plane& plane : planes)
+    CHECK_THAT(plane.getNormal().computeLength(), Catch::WithinAbs(1.f, 0.00001f));
+
+  // Points slightly inside the screen's borders are in the frustum, while those slightly outside are not
+  for (const Raz::Vec2f& ndcPos : { Raz::Vec2f({ -0.99f, -0.99f }), Raz::Vec2f({ 0.5f, -0.25f }), Raz::Vec2f({ 0.99f, 0.99f }) }) {
+    const Raz::Ray ray = camera.computeRay(ndcPos);
+
+    CHECK(isInside(ray.getOrigin() + ray.getDirection() * 0.01f));
+    CHECK(isInside(ray.getOrigin() + ray.getDirection() * 50.f));
+    CHECK_FALSE(isInside(ray.getOrigin() - ray.getDirection() * 0.01f));
+    CHECK_FALSE(isInside(ray.getOrigin() + ray.getDirection() * 200.f));
+  }
+
+  for (const Raz::Vec2f& ndcPos : { Raz::Vec2f({ -1.01f, 0.f }), Raz::Vec2f({ 0.f, 1.01f }), Raz::Vec2f({ 1.01f, -1.01f }) }) {
+    const Raz::Ray ray = camera.computeRay(ndcPos);
+    CHECK_FALSE(isInside(ray.getOrigin() + ray.getDirection() * 10.f));
+  }
+}
@@ -0,0 +1,115 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Window.hpp"
+
+#include <cmath>
+
+namespace {
+
+Raz::SubmeshPtr createTetrahedron(const Raz::Vec3f& offset) {
+  Raz::SubmeshPtr submesh = Raz::Submesh::create();
+
+  for (const Raz::Vec3f& position : { Raz::Vec3f({ 0.f, 0.f, 0.f }), Raz::Vec3f({ 2.f, 0.f, 0.f }),
+                                      Raz::Vec3f({ 0.f, 2.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 2.f }) }) {
+    Raz::Vertex vertex {};
+    vertex.position = position + offset;
+    submesh->getVertices().push_back(vertex);
+  }
+
+  submesh->getIndices() = { 0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3 };
+
+  return submesh;
+}
+
+} // namespace
+
+TEST_CASE("Submesh bounds") {
+  // Window created to setup the OpenGL context, which Raz::Submesh needs to be instantiated
+  Raz::Window window(1, 1);
+
+  Raz::SubmeshPtr submeshPtr = createTetrahedron(Raz::Vec3f(0.f));
+  const Raz::Submesh& submesh = *submeshPtr;
+
+  CHECK(submesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(0.f));
+  CHECK(submesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(2.f));
+  CHECK(submesh.getBoundingSphere().getCenter() == Raz::Vec3f(1.f));
+  CHECK_THAT(submesh.getBoundingSphere().getRadius(), Catch::WithinAbs(std::sqrt(3.f), 0.00001f));
+
+  // Reading the vertices through a constant submesh keeps the cached bounds
+  const Raz::AABB* cachedBox = &submesh.getBoundingBox();
+  CHECK(submesh.getVertices().size() == 4);
+  CHECK(&submesh.getBoundingBox() == cachedBox);
+  CHECK(submesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(2.f));
+
+  // Modifying the vertices after the bounds have been cached must update them on their next access
+  submeshPtr->getVertices()[1].position = Raz::Vec3f({ 4.f, 0.f, 0.f });
+  CHECK(submesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 4.f, 2.f, 2.f }));
+  CHECK(submesh.getBoundingSphere().getCenter() == Raz::Vec3f({ 2.f, 1.f, 1.f }));
+
+  for (Raz::Vertex& vertex : submeshPtr->getVbo().getVertices())
+    vertex.position -= Raz::Vec3f(1.f);
+
+  CHECK(submesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.f));
+  CHECK(submesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 3.f, 1.f, 1.f }));
+}
+
+TEST_CASE("Submesh convex hull") {
+  Raz::Window window(1, 1);
+
+  Raz::SubmeshPtr submeshPtr = createTetrahedron(Raz::Vec3f(0.f));
+  const Raz::Submesh& submesh = *submeshPtr;
+
+  CHECK(submesh.getConvexHull().getVertexCount() == 4);
+  CHECK(submesh.getConvexHull().getFaceCount() == 4);
+  CHECK(submesh.getConvexHull().contains(Raz::Vec3f(0.25f)));
+  CHECK_FALSE(submesh.getConvexHull().contains(Raz::Vec3f(1.f)));
+
+  // A vertex added outside of the cached hull must be taken into account on the hull's next access
+  Raz::Vertex outsideVertex {};
+  outsideVertex.position = Raz::Vec3f(2.f);
+  submeshPtr->getVertices().push_back(outsideVertex);
+
+  CHECK(submesh.getConvexHull().getVertexCount() == 5);
+  CHECK(submesh.getConvexHull().contains(Raz::Vec3f(1.f)));
+
+  // The hull is recomputed with the parameters it has last been computed with
+  submesh.computeConvexHull(4);
+  CHECK(submesh.getConvexHull().getVertexCount() <= 4);
+
+  submeshPtr->getVertices()[4].position = Raz::Vec3f(3.f);
+  CHECK(submesh.getConvexHull().getVertexCount() <= 4);
+}
+
+TEST_CASE("Mesh bounds") {
+  Raz::Window window(1, 1);
+
+  Raz::Mesh mesh;
+  mesh.getSubmeshes().front() = createTetrahedron(Raz::Vec3f(0.f));
+  mesh.addSubmesh(createTetrahedron(Raz::Vec3f({ 4.f, 0.f, 0.f })));
+
+  const Raz::AABB meshBox = mesh.computeBoundingBox();
+  CHECK(meshBox.getLeftBottomBackPos() == Raz::Vec3f(0.f));
+  CHECK(meshBox.getRightTopFrontPos() == Raz::Vec3f({ 6.f, 2.f, 2.f }));
+
+  const Raz::Sphere meshSphere = mesh.computeBoundingSphere();
+  CHECK(meshSphere.getCenter() == Raz::Vec3f({ 3.f, 1.f, 1.f }));
+
+  for (const Raz::SubmeshPtr& submesh : mesh.getSubmeshes()) {
+    const Raz::Sphere& submeshSphere = static_cast<const Raz::Submesh&>(*submesh).getBoundingSphere();
+    CHECK((submeshSphere.getCenter() - meshSphere.getCenter()).computeLength() + submeshSphere.getRadius() <= meshSphere.getRadius() + 0.0001f);
+  }
+
+  // Moving a submesh's vertices after the bounds have been cached must be reflected in the mesh's bounds
+  for (Raz::Vertex& vertex : mesh.getSubmeshes().back()->getVertices())
+    vertex.position += Raz::Vec3f({ 0.f, 0.f, 4.f });
+
+  const Raz::AABB movedMeshBox = mesh.computeBoundingBox();
+  CHECK(movedMeshBox.getLeftBottomBackPos() == Raz::Vec3f(0.f));
+  CHECK(movedMeshBox.getRightTopFrontPos() == Raz::Vec3f({ 6.f, 2.f, 6.f }));
+
+  // A mesh created from a shape has its bounds computed
+  const Raz::Mesh boxMesh(Raz::AABB(Raz::Vec3f({ 1.f, 2.f, 3.f }), Raz::Vec3f({ -1.f, -2.f, -3.f })));
+  CHECK(boxMesh.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 1.f, 2.f, 3.f }));
+  CHECK(boxMesh.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  CHECK(boxMesh.computeBoundingSphere().getCenter() == Raz::Vec3f(0.f));
+}
@@ -0,0 +1,119 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Occluder.hpp"
+#include "RaZ/Render/OcclusionCuller.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+
+namespace {
+
+Raz::Mat4f computeViewProjMatrix() {
+  Raz::Camera camera(256, 128, 45.f, 0.1f, 100.f);
+  camera.computeLookAt(Raz::Vec3f(0.f), Raz::Vec3f({ 0.f, 0.f, 1.f }));
+
+  return camera.getViewMatrix() * camera.getProjectionMatrix();
+}
+
+} // namespace
+
+TEST_CASE("OcclusionCuller resolution") {
+  Raz::OcclusionCuller occlusionCuller(100, 50);
+
+  // The resolution is rounded up to fit whole tiles
+  CHECK(occlusionCuller.getWidth() == 128);
+  CHECK(occlusionCuller.getHeight() == 64);
+  CHECK(occlusionCuller.getDepthBuffer().size() == 128 * 64);
+
+  REQUIRE(occlusionCuller.getLevelCount() == 8);
+  CHECK(occlusionCuller.getLevel(1).width == 64);
+  CHECK(occlusionCuller.getLevel(1).height == 32);
+  CHECK(occlusionCuller.getLevel(7).width == 1);
+  CHECK(occlusionCuller.getLevel(7).height == 1);
+
+  CHECK(std::all_of(occlusionCuller.getDepthBuffer().cbegin(), occlusionCuller.getDepthBuffer().cend(), [] (float depth) { return depth == 1.f; }));
+}
+
+TEST_CASE("OcclusionCuller occlusion") {
+  const Raz::Mat4f viewProjMat = computeViewProjMatrix();
+
+  Raz::OcclusionCuller occlusionCuller;
+  const Raz::AABB hiddenBox(Raz::Vec3f({ 0.5f, 0.5f, 10.5f }), Raz::Vec3f({ -0.5f, -0.5f, 9.5f }));
+
+  // Without any occluder, nothing can be hidden
+  occlusionCuller.rasterize();
+  CHECK_FALSE(occlusionCuller.isOccluded(hiddenBox, viewProjMat));
+
+  // A wall in front of the camera, covering its center
+  const Raz::Occluder wall(Raz::AABB(Raz::Vec3f({ 2.f, 2.f, 5.5f }), Raz::Vec3f({ -2.f, -2.f, 5.f })));
+  occlusionCuller.addOccluder(wall, viewProjMat);
+  CHECK(occlusionCuller.getTriangleCount() == 12);
+
+  occlusionCuller.rasterize();
+
+  // The center of the screen holds the depth of the wall's nearest face
+  const std::vector<float>& depthBuffer = occlusionCuller.getDepthBuffer();
+  const float wallDepth = (100.f / (100.f - 0.1f)) * (1.f - 0.1f / 5.f);
+  const std::size_t centerIndex = (occlusionCuller.getHeight() / 2) * occlusionCuller.getWidth() + occlusionCuller.getWidth() / 2;
+  CHECK(depthBuffer[centerIndex] == Approx(wallDepth));
+  CHECK(depthBuffer.front() == 1.f);
+  CHECK(depthBuffer.back() == 1.f);
+
+  // The pyramid's top holds the furthest depth of the whole buffer
+  CHECK(occlusionCuller.getLevel(occlusionCuller.getLevelCount() - 1).depths.front() == 1.f);
+
+  CHECK(occlusionCuller.isOccluded(hiddenBox, viewProjMat));
+  // A box larger than the wall's projection behind it
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 6.f, 1.f, 21.f }), Raz::Vec3f({ -6.f, -1.f, 20.f })), viewProjMat));
+  // A box beside the wall
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 6.f, 0.5f, 10.5f }), Raz::Vec3f({ 5.f, -0.5f, 9.5f })), viewProjMat));
+  // A box partly sticking out of the wall
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 4.5f, 0.5f, 10.5f }), Raz::Vec3f({ 3.5f, -0.5f, 9.5f })), viewProjMat));
+  // A box in front of the wall
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 0.5f, 0.5f, 3.f }), Raz::Vec3f({ -0.5f, -0.5f, 2.f })), viewProjMat));
+  // Boxes crossing the near plane or behind the camera
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 0.5f, 0.5f, 1.f }), Raz::Vec3f({ -0.5f, -0.5f, -1.f })), viewProjMat));
+  CHECK_FALSE(occlusionCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 0.5f, 0.5f, -9.5f }), Raz::Vec3f({ -0.5f, -0.5f, -10.5f })), viewProjMat));
+
+  // Once cleared, the box is visible again
+  occlusionCuller.clear();
+  CHECK(occlusionCuller.getTriangleCount() == 0);
+  CHECK_FALSE(occlusionCuller.isOccluded(hiddenBox, viewProjMat));
+}
+
+TEST_CASE("OcclusionCuller occluders") {
+  const Raz::Mat4f viewProjMat = computeViewProjMatrix();
+
+  // Triangles are rasterized whatever their winding
+  const std::vector<Raz::Vec3f> positions = { Raz::Vec3f({ -3.f, -3.f, 5.f }), Raz::Vec3f({ 3.f, -3.f, 5.f }),
+                                              Raz::Vec3f({ 3.f, 3.f, 5.f }), Raz::Vec3f({ -3.f, 3.f, 5.f }) };
+
+  Raz::OcclusionCuller counterClockwiseCuller;
+  counterClockwiseCuller.addOccluder(positions, { 0, 1, 2, 0, 2, 3 }, viewProjMat);
+  counterClockwiseCuller.rasterize();
+
+  Raz::OcclusionCuller clockwiseCuller;
+  clockwiseCuller.addOccluder(positions, { 0, 2, 1, 0, 3, 2 }, viewProjMat);
+  clockwiseCuller.rasterize();
+
+  CHECK(counterClockwiseCuller.getDepthBuffer() == clockwiseCuller.getDepthBuffer());
+
+  const Raz::AABB hiddenBox(Raz::Vec3f({ 1.f, 1.f, 11.f }), Raz::Vec3f({ -1.f, -1.f, 9.f }));
+  CHECK(counterClockwiseCuller.isOccluded(hiddenBox, viewProjMat));
+
+  // Triangles crossing the near plane are ignored
+  Raz::OcclusionCuller nearCuller;
+  nearCuller.addOccluder({ Raz::Vec3f({ -3.f, -3.f, -1.f }), Raz::Vec3f({ 3.f, -3.f, 5.f }), Raz::Vec3f({ 0.f, 3.f, 5.f }) }, { 0, 1, 2 }, viewProjMat);
+  CHECK(nearCuller.getTriangleCount() == 0);
+
+  // An occluder moved by its model matrix
+  Raz::Mat4f modelMat = Raz::Mat4f::identity();
+  modelMat[14] = 10.f;
+
+  Raz::OcclusionCuller movedCuller;
+  movedCuller.addOccluder(positions, { 0, 1, 2, 0, 2, 3 }, modelMat * viewProjMat);
+  movedCuller.rasterize();
+
+  CHECK_FALSE(movedCuller.isOccluded(hiddenBox, viewProjMat));
+  CHECK(movedCuller.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 21.f }), Raz::Vec3f({ -1.f, -1.f, 19.f })), viewProjMat));
+}
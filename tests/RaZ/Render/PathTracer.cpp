@@ -0,0 +1,201 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Render/PathTracer.hpp"
+
+namespace {
+
+// Square of half extent 1 in the XY plane, facing +Z
+void createSquare(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  vertices.resize(4);
+
+  for (unsigned int i = 0; i < 4; ++i) {
+    vertices[i].position = Raz::Vec3f({ (i & 1u ? 1.f : -1.f), (i & 2u ? 1.f : -1.f), 0.f });
+    vertices[i].normal   = Raz::Vec3f({ 0.f, 0.f, 1.f });
+  }
+
+  indices = { 0, 1, 2,  1, 3, 2 };
+}
+
+Raz::Mat4f computeTransform(float scale, const Raz::Vec3f& translation) {
+  return Raz::Mat4f({ { scale, 0.f,   0.f,   0.f },
+                      { 0.f,   scale, 0.f,   0.f },
+                      { 0.f,   0.f,   scale, 0.f },
+                      { translation[0], translation[1], translation[2], 1.f } });
+}
+
+// Camera placed at the origin & looking towards -Z
+Raz::Camera createCamera(unsigned int width, unsigned int height) {
+  Raz::Camera camera(width, height, 45.f, 0.1f, 100.f);
+  camera.computeLookAt(Raz::Vec3f(0.f), Raz::Vec3f({ 0.f, 0.f, -1.f }));
+  camera.computeInverseViewMatrix();
+  return camera;
+}
+
+// Wall facing the camera, lit head-on by a directional light; a square placed behind the camera casts its shadow onto the wall's center
+void createShadowedScene(Raz::PathTracer& pathTracer) {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createSquare(vertices, indices);
+
+  const std::size_t squareIndex = pathTracer.addGeometry(vertices, indices);
+  pathTracer.addInstance(squareIndex, computeTransform(10.f, Raz::Vec3f({ 0.f, 0.f, -5.f })), Raz::PathTracer::Surface());
+  pathTracer.addInstance(squareIndex, computeTransform(1.f, Raz::Vec3f({ 0.f, 0.f, 1.f })), Raz::PathTracer::Surface());
+
+  pathTracer.addLight(Raz::Light(Raz::LightType::DIRECTIONAL, Raz::Vec3f({ 0.f, 0.f, -1.f }), Raz::PI<float>), Raz::Vec3f(0.f));
+  pathTracer.setCamera(createCamera(pathTracer.getWidth(), pathTracer.getHeight()));
+}
+
+} // namespace
+
+TEST_CASE("PathTracer empty scene") {
+  Raz::PathTracer pathTracer(20, 10);
+  CHECK(pathTracer.getSampleCount() == 0);
+
+  // A camera is required to render
+  CHECK_THROWS(pathTracer.render());
+
+  pathTracer.setCamera(createCamera(20, 10));
+  pathTracer.setBackgroundColor(Raz::Vec3f({ 0.25f, 0.5f, 1.f }));
+  pathTracer.render(2);
+  CHECK(pathTracer.getSampleCount() == 2);
+
+  // Without anything to hit, all paths escape & bring back the background's radiance
+  for (unsigned int y = 0; y < 10; ++y) {
+    for (unsigned int x = 0; x < 20; ++x)
+      CHECK(pathTracer.getPixelRadiance(x, y) == Raz::Vec3f({ 0.25f, 0.5f, 1.f }));
+  }
+
+  pathTracer.resetAccumulation();
+  CHECK(pathTracer.getSampleCount() == 0);
+  CHECK(pathTracer.getPixelRadiance(0, 0) == Raz::Vec3f(0.f));
+}
+
+TEST_CASE("PathTracer direct lighting") {
+  Raz::PathTracer pathTracer(32, 32);
+  createShadowedScene(pathTracer);
+  pathTracer.setMaxBounceCount(0);
+
+  CHECK(pathTracer.getGeometryCount() == 1);
+  CHECK(pathTracer.getInstanceCount() == 2);
+  CHECK(pathTracer.getLightCount() == 1);
+
+  pathTracer.render(4);
+
+  // The wall's center is in the shadow of the square behind the camera; without any bounce, nothing else lights it
+  CHECK(pathTracer.getPixelRadiance(16, 16) == Raz::Vec3f(0.f));
+
+  // Lit almost head-on by a light of energy pi, a white rough dielectric reflects (1 - F) / pi + D * F * G / 4 = 0.96 / pi + 0.04 / (4 * pi),
+  //  the view & light directions being nearly identical; the remaining difference comes from the slightly oblique view
+  const Raz::Vec3f litRadiance = pathTracer.getPixelRadiance(16, 2);
+  CHECK(litRadiance[0] == Approx(0.97f).margin(0.02f));
+  CHECK(litRadiance[1] == Approx(litRadiance[0]));
+  CHECK(litRadiance[2] == Approx(litRadiance[0]));
+
+  // The surface's color filters the light
+  pathTracer.clearScene();
+  CHECK(pathTracer.getGeometryCount() == 0);
+  CHECK(pathTracer.getInstanceCount() == 0);
+  CHECK(pathTracer.getLightCount() == 0);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createSquare(vertices, indices);
+
+  Raz::PathTracer::Surface redSurface;
+  redSurface.baseColor = Raz::Vec3f({ 1.f, 0.f, 0.f });
+  pathTracer.addInstance(pathTracer.addGeometry(vertices, indices), computeTransform(10.f, Raz::Vec3f({ 0.f, 0.f, -5.f })), redSurface);
+  pathTracer.addLight(Raz::Light(Raz::LightType::DIRECTIONAL, Raz::Vec3f({ 0.f, 0.f, -1.f }), Raz::PI<float>), Raz::Vec3f(0.f));
+  pathTracer.render();
+
+  const Raz::Vec3f redRadiance = pathTracer.getPixelRadiance(16, 16);
+  CHECK(redRadiance[0] == Approx(0.97f).margin(0.02f));
+  // Only the specular reflection remains in the other channels
+  CHECK(redRadiance[1] == Approx(0.01f).margin(0.002f));
+  CHECK(redRadiance[2] == Approx(redRadiance[1]));
+}
+
+TEST_CASE("PathTracer point light") {
+  Raz::PathTracer pathTracer(16, 16);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createSquare(vertices, indices);
+
+  pathTracer.addInstance(pathTracer.addGeometry(vertices, indices), computeTransform(10.f, Raz::Vec3f({ 0.f, 0.f, -5.f })), Raz::PathTracer::Surface());
+  pathTracer.setCamera(createCamera(16, 16));
+  pathTracer.setMaxBounceCount(0);
+
+  // The light's energy is attenuated by the squared distance, as in the rasterizer: at 2 units from the wall, 4 pi gives pi
+  pathTracer.addLight(Raz::Light(Raz::LightType::POINT, 4.f * Raz::PI<float>), Raz::Vec3f({ 0.f, 0.f, -3.f }));
+  pathTracer.render();
+
+  CHECK(pathTracer.getPixelRadiance(8, 8)[0] == Approx(0.97f).margin(0.02f));
+
+  // A light behind the wall doesn't light its front
+  pathTracer.clearScene();
+  pathTracer.addInstance(pathTracer.addGeometry(vertices, indices), computeTransform(10.f, Raz::Vec3f({ 0.f, 0.f, -5.f })), Raz::PathTracer::Surface());
+  pathTracer.addLight(Raz::Light(Raz::LightType::POINT, 4.f * Raz::PI<float>), Raz::Vec3f({ 0.f, 0.f, -7.f }));
+  pathTracer.render();
+
+  CHECK(pathTracer.getPixelRadiance(8, 8) == Raz::Vec3f(0.f));
+}
+
+TEST_CASE("PathTracer progressive determinism") {
+  Raz::PathTracer pathTracer(40, 24);
+  createShadowedScene(pathTracer);
+  pathTracer.setBackgroundColor(Raz::Vec3f(0.2f));
+
+  // With bounces, the shadowed center receives light reflected by the rest of the scene
+  pathTracer.setThreadCount(1);
+  pathTracer.render();
+  pathTracer.render();
+  CHECK(pathTracer.getSampleCount() == 2);
+  CHECK(pathTracer.getPixelRadiance(20, 12)[0] > 0.f);
+
+  std::vector<Raz::Vec3f> singleThreadedRadiances;
+
+  for (unsigned int y = 0; y < pathTracer.getHeight(); ++y) {
+    for (unsigned int x = 0; x < pathTracer.getWidth(); ++x)
+      singleThreadedRadiances.emplace_back(pathTracer.getPixelRadiance(x, y));
+  }
+
+  // Rendering all samples at once with several threads gives exactly the same result
+  pathTracer.resetAccumulation();
+  pathTracer.setThreadCount(4);
+  pathTracer.render(2);
+  REQUIRE(pathTracer.getSampleCount() == 2);
+
+  for (unsigned int y = 0; y < pathTracer.getHeight(); ++y) {
+    for (unsigned int x = 0; x < pathTracer.getWidth(); ++x)
+      CHECK(pathTracer.getPixelRadiance(x, y) == singleThreadedRadiances[y * pathTracer.getWidth() + x]);
+  }
+}
+
+TEST_CASE("PathTracer image") {
+  Raz::PathTracer pathTracer(20, 10);
+  pathTracer.setCamera(createCamera(20, 10));
+  pathTracer.setBackgroundColor(Raz::Vec3f({ 1.f, 0.f, 3.f }));
+  pathTracer.render();
+
+  const Raz::Image image = pathTracer.computeImage();
+  CHECK(image.getWidth() == 20);
+  CHECK(image.getHeight() == 10);
+  CHECK(image.getColorspace() == Raz::ImageColorspace::RGB);
+  CHECK(image.getDataType() == Raz::ImageDataType::BYTE);
+  CHECK(image.getChannelCount() == 3);
+
+  // Reinhard tone mapping gives 1 / 2 & 3 / 4, gamma corrected to 0.5^(1/2.2) & 0.75^(1/2.2)
+  const auto* imageData = static_cast<const uint8_t*>(image.getDataPtr());
+  CHECK(imageData[0] == 186);
+  CHECK(imageData[1] == 0);
+  CHECK(imageData[2] == 224);
+  CHECK(imageData[20 * 10 * 3 - 1] == 224);
+
+  const Raz::Image hdrImage = pathTracer.computeImage(false);
+  CHECK(hdrImage.getDataType() == Raz::ImageDataType::FLOAT);
+
+  const auto* hdrImageData = static_cast<const float*>(hdrImage.getDataPtr());
+  CHECK(hdrImageData[0] == 1.f);
+  CHECK(hdrImageData[1] == 0.f);
+  CHECK(hdrImageData[2] == 3.f);
+}
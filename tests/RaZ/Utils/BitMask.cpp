@@ -0,0 +1,38 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/BitMask.hpp"
+
+TEST_CASE("BitMask basic") {
+  Raz::BitMask mask(130);
+  REQUIRE(mask.getSize() == 130);
+  REQUIRE(mask.getWords().size() == 3);
+  REQUIRE(mask.getEnabledBitCount() == 0);
+
+  mask.setBit(0);
+  mask.setBit(63);
+  mask.setBit(64);
+  mask.setBit(129);
+  CHECK(mask.isSet(0));
+  CHECK(mask.isSet(63));
+  CHECK(mask.isSet(64));
+  CHECK(mask.isSet(129));
+  CHECK_FALSE(mask.isSet(1));
+  CHECK(mask.getEnabledBitCount() == 4);
+
+  mask.setBit(63, false);
+  CHECK_FALSE(mask.isSet(63));
+
+  // Groups of bits are written from the given index, the lowest bit first
+  mask.enableBits(8, 0b1011);
+  CHECK(mask.isSet(8));
+  CHECK(mask.isSet(9));
+  CHECK_FALSE(mask.isSet(10));
+  CHECK(mask.isSet(11));
+
+  std::vector<std::uint32_t> indices;
+  mask.getEnabledIndices(indices);
+  CHECK(indices == std::vector<std::uint32_t>({ 0, 8, 9, 11, 64, 129 }));
+
+  mask.reset(10);
+  CHECK(mask.getSize() == 10);
+  CHECK(mask.getEnabledBitCount() == 0);
+}
@@ -0,0 +1,158 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/Gjk.hpp"
+#include "RaZ/Utils/ConvexHull.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+// Every edge being shared by exactly two triangular faces, a closed convex polyhedron follows Euler's formula V - E + F = 2, with E = 3F / 2
+void checkTopology(const Raz::ConvexHull& hull) {
+  REQUIRE(hull.getIndices().size() == hull.getFaceCount() * 3);
+  CHECK(hull.getVertexCount() * 2 == hull.getFaceCount() + 4);
+}
+
+} // namespace
+
+TEST_CASE("ConvexHull cube") {
+  std::vector<Raz::Vec3f> points;
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+    points.emplace_back(Raz::Vec3f({ (cornerIndex & 1u ? 1.f : -1.f), (cornerIndex & 2u ? 1.f : -1.f), (cornerIndex & 4u ? 1.f : -1.f) }));
+
+  // Points inside the cube or on its faces must not become vertices
+  std::mt19937 randGenerator(1234); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> distrib(-1.f, 1.f);
+
+  for (std::size_t i = 0; i < 500; ++i)
+    points.emplace_back(Raz::Vec3f({ distrib(randGenerator), distrib(randGenerator), distrib(randGenerator) }));
+
+  points.emplace_back(Raz::Vec3f({ 1.f, 0.5f, -0.25f }));
+  points.emplace_back(Raz::Vec3f({ 0.f, 0.f, 1.f }));
+
+  const Raz::ConvexHull hull(points);
+  CHECK_FALSE(hull.isFlat());
+  CHECK(hull.getVertexCount() == 8);
+  CHECK(hull.getFaceCount() == 12);
+  checkTopology(hull);
+
+  for (const Raz::Vec3f& point : points)
+    CHECK(hull.contains(point));
+
+  CHECK_FALSE(hull.contains(Raz::Vec3f({ 1.01f, 0.f, 0.f })));
+
+  // Faces' normals point outwards, each being aligned with an axis
+  for (const Raz::Plane& plane : hull.getFacePlanes()) {
+    CHECK(plane.getDistance() == Approx(1.f));
+    CHECK(std::abs(plane.getNormal()[0]) + std::abs(plane.getNormal()[1]) + std::abs(plane.getNormal()[2]) == Approx(1.f));
+  }
+
+  const Raz::Vec3f centroid = hull.computeCentroid();
+  CHECK(centroid[0] == Approx(0.f).margin(0.00001f));
+  CHECK(centroid[1] == Approx(0.f).margin(0.00001f));
+  CHECK(centroid[2] == Approx(0.f).margin(0.00001f));
+
+  CHECK(hull.computeSupportPoint(Raz::Vec3f({ 1.f, -1.f, 1.f })) == Raz::Vec3f({ 1.f, -1.f, 1.f }));
+  CHECK(hull.computeProjection(Raz::Vec3f({ 3.f, 0.5f, 0.f })) == Raz::Vec3f({ 1.f, 0.5f, 0.f }));
+  CHECK(hull.computeProjection(Raz::Vec3f({ 0.5f, 0.5f, 0.f })) == Raz::Vec3f({ 0.5f, 0.5f, 0.f }));
+
+  const Raz::AABB box = hull.computeBoundingBox();
+  CHECK(box.getLeftBottomBackPos() == Raz::Vec3f(-1.f));
+  CHECK(box.getRightTopFrontPos() == Raz::Vec3f(1.f));
+}
+
+TEST_CASE("ConvexHull sphere") {
+  std::mt19937 randGenerator(4321); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::normal_distribution<float> distrib(0.f, 1.f);
+
+  std::vector<Raz::Vec3f> points;
+
+  for (std::size_t i = 0; i < 2000; ++i)
+    points.emplace_back(Raz::Vec3f({ distrib(randGenerator), distrib(randGenerator), distrib(randGenerator) }).normalize() * 2.f);
+
+  const Raz::ConvexHull hull(points);
+  CHECK(hull.getVertexCount() > 1000);
+  checkTopology(hull);
+
+  for (const Raz::Vec3f& point : points)
+    REQUIRE(hull.contains(point));
+
+  // Limiting the vertex count gives a smaller hull, keeping the points furthest outside of it & thus approximating the sphere
+  const Raz::ConvexHull limitedHull(points, 32);
+  CHECK(limitedHull.getVertexCount() == 32);
+  checkTopology(limitedHull);
+  CHECK(limitedHull.computeProjection(Raz::Vec3f({ 0.f, 0.f, 10.f }))[2] > 1.5f);
+
+  for (const Raz::Vec3f& vertex : limitedHull.getVertices())
+    CHECK(hull.contains(vertex));
+
+  // A tolerance ignores the points too close to the hull, simplifying it
+  const Raz::ConvexHull simplifiedHull(points, 0, 0.1f);
+  CHECK(simplifiedHull.getVertexCount() < hull.getVertexCount());
+  checkTopology(simplifiedHull);
+
+  for (const Raz::Vec3f& point : points)
+    CHECK((simplifiedHull.computeProjection(point) - point).computeLength() <= 0.1f + 0.0001f);
+}
+
+TEST_CASE("ConvexHull degenerate") {
+  CHECK(Raz::ConvexHull(std::vector<Raz::Vec3f>()).isEmpty());
+
+  const Raz::ConvexHull pointHull({ Raz::Vec3f(1.f), Raz::Vec3f(1.f) });
+  CHECK(pointHull.getVertexCount() == 1);
+  CHECK(pointHull.computeSupportPoint(Raz::Axis::X) == Raz::Vec3f(1.f));
+
+  const Raz::ConvexHull lineHull({ Raz::Vec3f(0.f), Raz::Vec3f(0.5f), Raz::Vec3f(2.f) });
+  CHECK(lineHull.getVertexCount() == 2);
+  CHECK(lineHull.getFaceCount() == 0);
+  CHECK(lineHull.contains(Raz::Vec3f(1.f)));
+
+  // Coplanar points give a flat polygon
+  const Raz::ConvexHull flatHull({ Raz::Vec3f({ -1.f, 0.f, -1.f }), Raz::Vec3f({ 1.f, 0.f, -1.f }), Raz::Vec3f({ 1.f, 0.f, 1.f }),
+                                   Raz::Vec3f({ -1.f, 0.f, 1.f }), Raz::Vec3f({ 0.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 1.f }) });
+  CHECK(flatHull.isFlat());
+  CHECK(flatHull.getVertexCount() == 4);
+  CHECK(flatHull.getFaceCount() == 2);
+  CHECK(flatHull.contains(Raz::Vec3f({ 0.5f, 0.f, 0.5f })));
+  CHECK_FALSE(flatHull.contains(Raz::Vec3f({ 0.5f, 0.1f, 0.5f })));
+  CHECK(flatHull.intersects(Raz::Line(Raz::Vec3f({ 0.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }))));
+}
+
+TEST_CASE("ConvexHull intersections") {
+  // Octahedron of "radius" 1
+  const Raz::ConvexHull hull({ Raz::Vec3f({ 1.f, 0.f, 0.f }), Raz::Vec3f({ -1.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }),
+                               Raz::Vec3f({ 0.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 1.f }), Raz::Vec3f({ 0.f, 0.f, -1.f }) });
+  REQUIRE(hull.getFaceCount() == 8);
+
+  CHECK(hull.intersects(Raz::Sphere(Raz::Vec3f({ 1.4f, 0.f, 0.f }), 0.5f)));
+  CHECK_FALSE(hull.intersects(Raz::Sphere(Raz::Vec3f(0.6f), 0.2f))); // Beyond the face x + y + z = 1
+  CHECK(hull.intersects(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(0.3f))));
+  CHECK_FALSE(hull.intersects(Raz::AABB(Raz::Vec3f(0.8f), Raz::Vec3f(0.4f))));
+  CHECK(hull.intersects(Raz::Plane(0.9f, Raz::Axis::X)));
+  CHECK_FALSE(hull.intersects(Raz::Plane(1.1f, Raz::Axis::X)));
+  CHECK(hull.intersects(Raz::Triangle(Raz::Vec3f({ 0.f, 0.f, 0.5f }), Raz::Vec3f({ 2.f, 0.f, 0.5f }), Raz::Vec3f({ 2.f, 2.f, 0.5f }))));
+
+  // Moving the hull by its transform
+  Raz::Mat4f transform = Raz::Mat4f::identity();
+  transform[12] = 1.5f;
+
+  const Raz::ConvexHull movedHull = hull.computeTransformed(transform);
+  CHECK(hull.intersects(movedHull));
+  CHECK(movedHull.contains(Raz::Vec3f({ 2.f, 0.f, 0.f })));
+  CHECK_FALSE(movedHull.contains(Raz::Vec3f(0.f)));
+
+  // A mirroring transform keeps the faces' normals pointing outwards
+  Raz::Mat4f mirror = Raz::Mat4f::identity();
+  mirror[0] = -2.f;
+
+  const Raz::ConvexHull mirroredHull = hull.computeTransformed(mirror);
+  CHECK(mirroredHull.contains(Raz::Vec3f({ -1.5f, 0.f, 0.f })));
+  CHECK_FALSE(mirroredHull.contains(Raz::Vec3f({ 0.f, 0.f, 1.5f })));
+
+  // The octahedra are separated the soonest along the normal of one of their faces, the distance to move by being shorter than along X
+  Raz::Gjk::Contact contact;
+  REQUIRE(Raz::Gjk::computeContact(hull, movedHull, contact));
+  CHECK(contact.depth == Approx(0.5f / std::sqrt(3.f)).margin(0.001f));
+  CHECK(contact.normal[0] == Approx(1.f / std::sqrt(3.f)).margin(0.001f));
+}
@@ -0,0 +1,62 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Utils/FloatUtils.hpp"
+
+namespace {
+
+float computeFirstSimdValue(Raz::Simd::Float vals) {
+  float values[Raz::Simd::Width] {};
+  Raz::Simd::store(values, vals);
+  return values[0];
+}
+
+} // namespace
+
+TEST_CASE("FloatUtils near-equality") {
+  REQUIRE(Raz::FloatUtils::checkNearEquality(1.f, 1.f + std::numeric_limits<float>::epsilon()));
+  REQUIRE_FALSE(Raz::FloatUtils::checkNearEquality(1.f, 1.00001f));
+  REQUIRE(Raz::FloatUtils::checkNearEquality(1000000.f, 1000000.05f));
+}
+
+TEST_CASE("FloatUtils fast inverse square root & reciprocal") {
+  for (float val = 0.00001f; val < 100000.f; val *= 1.37f) {
+    const double invSqrt = 1.0 / std::sqrt(static_cast<double>(val));
+    const double inv     = 1.0 / static_cast<double>(val);
+
+    // The bounds without SSE are much looser; both are checked against the widest one
+    CHECK(Raz::FloatUtils::fastRsqrt(val) == Approx(invSqrt).epsilon(0.002));
+    CHECK(Raz::FloatUtils::fastReciprocal(val) == Approx(inv).epsilon(0.00001));
+
+    CHECK(computeFirstSimdValue(Raz::Simd::fastRsqrt(Raz::Simd::set(val))) == Approx(invSqrt).epsilon(0.002));
+    CHECK(computeFirstSimdValue(Raz::Simd::fastReciprocal(Raz::Simd::set(val))) == Approx(inv).epsilon(0.00001));
+  }
+}
+
+TEST_CASE("FloatUtils fast trigonometry") {
+  for (float angle = -1000.f; angle < 1000.f; angle += 0.77f) {
+    const double sin = std::sin(static_cast<double>(angle));
+    const double cos = std::cos(static_cast<double>(angle));
+
+    CHECK(Raz::FloatUtils::fastSin(angle) == Approx(sin).margin(0.0000005));
+    CHECK(Raz::FloatUtils::fastCos(angle) == Approx(cos).margin(0.0000005));
+
+    CHECK(computeFirstSimdValue(Raz::Simd::fastSin(Raz::Simd::set(angle))) == Approx(sin).margin(0.0000005));
+    CHECK(computeFirstSimdValue(Raz::Simd::fastCos(Raz::Simd::set(angle))) == Approx(cos).margin(0.0000005));
+  }
+
+  // Checking every quadrant, with points at various distances from the origin
+  for (float angle = -3.14f; angle < 3.14f; angle += 0.01f) {
+    for (float dist : { 0.001f, 1.f, 1000.f }) {
+      const float y = dist * std::sin(angle);
+      const float x = dist * std::cos(angle);
+      const double atan2 = std::atan2(static_cast<double>(y), static_cast<double>(x));
+
+      CHECK(Raz::FloatUtils::fastAtan2(y, x) == Approx(atan2).margin(0.000002));
+      CHECK(computeFirstSimdValue(Raz::Simd::fastAtan2(Raz::Simd::set(y), Raz::Simd::set(x))) == Approx(atan2).margin(0.000002));
+    }
+  }
+
+  REQUIRE(Raz::FloatUtils::fastAtan2(0.f, 0.f) == 0.f);
+  REQUIRE(Raz::FloatUtils::fastAtan2(1.f, 0.f) == Approx(1.57079632f));
+  REQUIRE(Raz::FloatUtils::fastAtan2(0.f, -1.f) == Approx(3.14159265f));
+}
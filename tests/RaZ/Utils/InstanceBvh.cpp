@@ -0,0 +1,157 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/InstanceBvh.hpp"
+
+#include <random>
+
+namespace {
+
+// Unit cube centered on the origin, made of 12 triangles facing outwards
+void createCube(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  vertices.resize(8);
+
+  for (unsigned int i = 0; i < 8; ++i)
+    vertices[i].position = Raz::Vec3f({ (i & 1u ? 0.5f : -0.5f), (i & 2u ? 0.5f : -0.5f), (i & 4u ? 0.5f : -0.5f) });
+
+  indices = { 0, 2, 1,  1, 2, 3,   // Back (-Z)
+              4, 5, 6,  5, 7, 6,   // Front (+Z)
+              0, 1, 4,  1, 5, 4,   // Bottom (-Y)
+              2, 6, 3,  3, 6, 7,   // Top (+Y)
+              0, 4, 2,  2, 4, 6,   // Left (-X)
+              1, 3, 5,  3, 7, 5 }; // Right (+X)
+}
+
+Raz::Vec3f transformPoint(const Raz::Vec3f& point, const Raz::Mat4f& matrix) {
+  return Raz::Vec3f(Raz::Vec4f({ point[0], point[1], point[2], 1.f }) * matrix);
+}
+
+// Brute-force reference, intersecting every triangle of every instance transformed in world space
+bool intersectBruteForce(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices,
+                         const std::vector<Raz::Mat4f>& transforms, const Raz::Ray& ray, Raz::RayHit& closestHit, std::size_t& closestIndex) {
+  bool hasHit = false;
+
+  for (std::size_t instanceIndex = 0; instanceIndex < transforms.size(); ++instanceIndex) {
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+      const Raz::Triangle triangle(transformPoint(vertices[indices[i]].position, transforms[instanceIndex]),
+                                   transformPoint(vertices[indices[i + 1]].position, transforms[instanceIndex]),
+                                   transformPoint(vertices[indices[i + 2]].position, transforms[instanceIndex]));
+
+      if (ray.intersect(triangle, closestHit, closestHit.distance)) {
+        closestIndex = instanceIndex;
+        hasHit = true;
+      }
+    }
+  }
+
+  return hasHit;
+}
+
+} // namespace
+
+TEST_CASE("InstanceBvh basic") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createCube(vertices, indices);
+
+  const Raz::TriangleBvh cubeBvh(vertices, indices);
+  const Raz::TriangleBvh emptyBvh;
+
+  Raz::InstanceBvh bvh;
+  REQUIRE_FALSE(bvh.intersects(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z)));
+
+  // A cube scaled by 2 & moved 10 units along Z, & a second one rotated by 45 degrees around Y, 20 units along Z
+  const Raz::Transform firstTransform(Raz::Vec3f({ 0.f, 0.f, 10.f }), Raz::Quaternionf::identity(), Raz::Vec3f(2.f));
+  const Raz::Transform secondTransform(Raz::Vec3f({ 0.f, 0.f, 20.f }), Raz::Quaternionf(45.f, Raz::Axis::Y));
+
+  REQUIRE(bvh.addInstance(cubeBvh, firstTransform.getTransformMatrix()) == 0);
+  REQUIRE(bvh.addInstance(emptyBvh, Raz::Mat4f::identity()) == 1);
+  REQUIRE(bvh.addInstance(cubeBvh, secondTransform.getTransformMatrix()) == 2);
+  bvh.build();
+
+  REQUIRE(bvh.getInstanceCount() == 3);
+  CHECK(bvh.getInstances()[0].minBounds == Raz::Vec3f({ -1.f, -1.f, 9.f }));
+  CHECK(bvh.getInstances()[0].maxBounds == Raz::Vec3f({ 1.f, 1.f, 11.f }));
+
+  Raz::RayHit hit;
+  std::size_t instanceIndex {};
+
+  REQUIRE(bvh.intersect(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z), hit, instanceIndex));
+  CHECK(instanceIndex == 0);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(9.f, 0.00001f));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 0.f, 9.f }));
+  CHECK(hit.normal == -Raz::Axis::Z);
+
+  // Passing beside the first cube, the second one is hit on one of its rotated faces
+  REQUIRE(bvh.intersect(Raz::Ray(Raz::Vec3f({ 0.2f, 3.f, 0.f }), Raz::Vec3f({ 0.f, -3.f, 20.f }).normalize()), hit, instanceIndex));
+  CHECK(instanceIndex == 2);
+  CHECK_THAT(std::abs(hit.normal[0]), Catch::WithinAbs(std::sqrt(2.f) / 2.f, 0.00001f));
+  CHECK_THAT(hit.normal[1], Catch::WithinAbs(0.f, 0.00001f));
+
+  REQUIRE_FALSE(bvh.intersect(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z), hit, instanceIndex, 8.f));
+  REQUIRE_FALSE(bvh.intersects(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z)));
+
+  // Moving the first cube out of the way
+  bvh.setInstanceTransform(0, Raz::Transform(Raz::Vec3f({ 5.f, 0.f, 10.f })).getTransformMatrix());
+  bvh.build();
+
+  REQUIRE(bvh.intersect(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z), hit, instanceIndex));
+  CHECK(instanceIndex == 2);
+
+  bvh.clear();
+  REQUIRE(bvh.isEmpty());
+  REQUIRE_FALSE(bvh.intersects(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z)));
+}
+
+TEST_CASE("InstanceBvh scene") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createCube(vertices, indices);
+
+  const Raz::TriangleBvh cubeBvh(vertices, indices);
+
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-20.f, 20.f);
+  std::uniform_real_distribution<float> angleDistrib(0.f, 360.f);
+  std::uniform_real_distribution<float> scaleDistrib(0.2f, 2.f);
+
+  // 500 cubes randomly placed, rotated & non-uniformly scaled
+  Raz::InstanceBvh bvh;
+  std::vector<Raz::Mat4f> transforms;
+
+  for (std::size_t i = 0; i < 500; ++i) {
+    const Raz::Vec3f axis = Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }).normalize();
+    const Raz::Transform transform(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }),
+                                   Raz::Quaternionf(angleDistrib(randGenerator), axis),
+                                   Raz::Vec3f({ scaleDistrib(randGenerator), scaleDistrib(randGenerator), scaleDistrib(randGenerator) }));
+
+    transforms.emplace_back(transform.getTransformMatrix());
+    bvh.addInstance(cubeBvh, transforms.back());
+  }
+
+  bvh.build();
+
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  for (std::size_t i = 0; i < 200; ++i) {
+    const Raz::Ray ray(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }) * 1.5f,
+                       Raz::Vec3f({ dirDistrib(randGenerator), dirDistrib(randGenerator), dirDistrib(randGenerator) }).normalize());
+
+    Raz::RayHit expectedHit;
+    std::size_t expectedIndex {};
+    const bool expectedResult = intersectBruteForce(vertices, indices, transforms, ray, expectedHit, expectedIndex);
+
+    Raz::RayHit hit;
+    std::size_t instanceIndex {};
+    REQUIRE(bvh.intersect(ray, hit, instanceIndex) == expectedResult);
+    REQUIRE(bvh.intersects(ray) == expectedResult);
+
+    if (!expectedResult)
+      continue;
+
+    CHECK(instanceIndex == expectedIndex);
+    CHECK(hit.distance == Approx(expectedHit.distance).epsilon(0.0001f));
+
+    // The world normal must be perpendicular to the hit face, & face the same way as the one computed in world space
+    CHECK(hit.normal.dot(expectedHit.normal) == Approx(1.f).epsilon(0.0001f));
+  }
+}
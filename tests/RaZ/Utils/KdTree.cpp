@@ -0,0 +1,149 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/KdTree.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+std::vector<Raz::KdTree::Neighbor> findNearestBruteForce(const std::vector<Raz::Vec3f>& points, const Raz::Vec3f& position) {
+  std::vector<Raz::KdTree::Neighbor> neighbors;
+
+  for (std::uint32_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+    neighbors.push_back({ pointIndex, (points[pointIndex] - position).computeSquaredLength() });
+
+  std::sort(neighbors.begin(), neighbors.end(), [] (const Raz::KdTree::Neighbor& neighbor1, const Raz::KdTree::Neighbor& neighbor2) {
+    return (neighbor1.sqDistance < neighbor2.sqDistance);
+  });
+
+  return neighbors;
+}
+
+} // namespace
+
+TEST_CASE("KdTree basic") {
+  Raz::KdTree kdTree;
+  REQUIRE(kdTree.isEmpty());
+
+  Raz::KdTree::Neighbor neighbor;
+  REQUIRE_FALSE(kdTree.findNearest(Raz::Vec3f(0.f), neighbor));
+
+  // A single leaf holding a few points
+  kdTree.build(std::vector<Raz::Vec3f>({ Raz::Vec3f({ 5.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 2.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, -3.f }) }));
+  REQUIRE(kdTree.getPointCount() == 3);
+  REQUIRE(kdTree.getNodes().empty());
+
+  REQUIRE(kdTree.findNearest(Raz::Vec3f(0.f), neighbor));
+  CHECK(neighbor.index == 1);
+  CHECK(neighbor.sqDistance == 4.f);
+
+  REQUIRE_FALSE(kdTree.findNearest(Raz::Vec3f(0.f), neighbor, 1.5f));
+
+  std::vector<Raz::KdTree::Neighbor> neighbors;
+  kdTree.findNearest(Raz::Vec3f(0.f), 2, neighbors);
+  REQUIRE(neighbors.size() == 2);
+  CHECK(neighbors[0].index == 1);
+  CHECK(neighbors[1].index == 2);
+
+  kdTree.findInRadius(Raz::Vec3f({ 4.f, 0.f, 0.f }), 1.f, neighbors);
+  REQUIRE(neighbors.size() == 1);
+  CHECK(neighbors[0].index == 0);
+}
+
+TEST_CASE("KdTree random points") {
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-100.f, 100.f);
+
+  // Enough points for the tree to be built in parallel, some of them being duplicated
+  std::vector<Raz::Vec3f> points;
+
+  for (std::size_t i = 0; i < 20000; ++i)
+    points.emplace_back(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }));
+
+  for (std::size_t i = 0; i < 100; ++i)
+    points.push_back(points[i]);
+
+  const Raz::KdTree kdTree(points);
+  REQUIRE(kdTree.getPointCount() == points.size());
+
+  std::vector<Raz::KdTree::Neighbor> neighbors;
+
+  for (std::size_t i = 0; i < 50; ++i) {
+    const Raz::Vec3f position({ posDistrib(randGenerator) * 1.2f, posDistrib(randGenerator) * 1.2f, posDistrib(randGenerator) * 1.2f });
+    const std::vector<Raz::KdTree::Neighbor> expectedNeighbors = findNearestBruteForce(points, position);
+
+    Raz::KdTree::Neighbor neighbor;
+    REQUIRE(kdTree.findNearest(position, neighbor));
+    CHECK(neighbor.sqDistance == expectedNeighbors.front().sqDistance);
+
+    // Distances are compared rather than indices, which may differ between equidistant points
+    kdTree.findNearest(position, 10, neighbors);
+    REQUIRE(neighbors.size() == 10);
+
+    for (std::size_t neighborIndex = 0; neighborIndex < 10; ++neighborIndex) {
+      CHECK(neighbors[neighborIndex].sqDistance == expectedNeighbors[neighborIndex].sqDistance);
+      CHECK(neighbors[neighborIndex].sqDistance == (points[neighbors[neighborIndex].index] - position).computeSquaredLength());
+    }
+
+    kdTree.findInRadius(position, 15.f, neighbors);
+
+    const auto expectedCount = static_cast<std::size_t>(std::count_if(expectedNeighbors.cbegin(), expectedNeighbors.cend(),
+                                                                      [] (const Raz::KdTree::Neighbor& expected) {
+                                                                        return (expected.sqDistance <= 225.f);
+                                                                      }));
+    REQUIRE(neighbors.size() == expectedCount);
+
+    for (const Raz::KdTree::Neighbor& radiusNeighbor : neighbors)
+      CHECK(radiusNeighbor.sqDistance <= 225.f);
+  }
+}
+
+TEST_CASE("KdTree closest point on mesh") {
+  // Grid of 2 * 50 * 50 triangles, slightly bumped
+  constexpr unsigned int gridSize = 50;
+
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> heightDistrib(-0.5f, 0.5f);
+
+  std::vector<Raz::Vertex> vertices((gridSize + 1) * (gridSize + 1));
+
+  for (unsigned int j = 0; j <= gridSize; ++j) {
+    for (unsigned int i = 0; i <= gridSize; ++i)
+      vertices[j * (gridSize + 1) + i].position = Raz::Vec3f({ static_cast<float>(i), heightDistrib(randGenerator), static_cast<float>(j) });
+  }
+
+  std::vector<unsigned int> indices;
+
+  for (unsigned int j = 0; j < gridSize; ++j) {
+    for (unsigned int i = 0; i < gridSize; ++i) {
+      const unsigned int topLeft = j * (gridSize + 1) + i;
+      indices.insert(indices.end(), { topLeft, topLeft + 1, topLeft + gridSize + 1 });
+      indices.insert(indices.end(), { topLeft + 1, topLeft + gridSize + 2, topLeft + gridSize + 1 });
+    }
+  }
+
+  const Raz::KdTree kdTree(vertices);
+  const Raz::TriangleBvh bvh(vertices, indices);
+
+  std::uniform_real_distribution<float> posDistrib(-5.f, static_cast<float>(gridSize) + 5.f);
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    const Raz::Vec3f position({ posDistrib(randGenerator), heightDistrib(randGenerator) * 10.f, posDistrib(randGenerator) });
+
+    // The closest vertex bounds the distance to the mesh, limiting the triangles to be checked
+    Raz::KdTree::Neighbor neighbor;
+    REQUIRE(kdTree.findNearest(position, neighbor));
+
+    // A small tolerance is added, the vertex's distance possibly being slightly different once recomputed from its projection
+    const float vertexDistance = std::sqrt(neighbor.sqDistance) + 0.0001f;
+
+    Raz::TriangleBvh::ClosestPoint closestPoint;
+    REQUIRE(bvh.findClosestPoint(position, closestPoint, vertexDistance));
+    CHECK(closestPoint.distance <= vertexDistance);
+
+    Raz::TriangleBvh::ClosestPoint unboundedPoint;
+    REQUIRE(bvh.findClosestPoint(position, unboundedPoint));
+    CHECK(closestPoint.distance == Approx(unboundedPoint.distance));
+  }
+}
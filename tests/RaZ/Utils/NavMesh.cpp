@@ -0,0 +1,323 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/NavMesh.hpp"
+#include "RaZ/Utils/NavMeshQuery.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <random>
+
+namespace {
+
+struct Geometry {
+  std::vector<Raz::Vertex> vertices {};
+  std::vector<unsigned int> indices {};
+};
+
+void addQuad(Geometry& geometry, const Raz::Vec3f& firstPos, const Raz::Vec3f& secondPos, const Raz::Vec3f& thirdPos, const Raz::Vec3f& fourthPos) {
+  const auto firstIndex = static_cast<unsigned int>(geometry.vertices.size());
+
+  for (const Raz::Vec3f& position : { firstPos, secondPos, thirdPos, fourthPos })
+    geometry.vertices.push_back(Raz::Vertex{ position });
+
+  geometry.indices.insert(geometry.indices.end(), { firstIndex, firstIndex + 1, firstIndex + 2, firstIndex, firstIndex + 2, firstIndex + 3 });
+}
+
+// Horizontal quad facing upwards
+void addGround(Geometry& geometry, float minX, float minZ, float maxX, float maxZ, float height) {
+  addQuad(geometry,
+          Raz::Vec3f({ minX, height, minZ }),
+          Raz::Vec3f({ minX, height, maxZ }),
+          Raz::Vec3f({ maxX, height, maxZ }),
+          Raz::Vec3f({ maxX, height, minZ }));
+}
+
+// Box standing on the ground, made of its top & sides
+void addBox(Geometry& geometry, const Raz::Vec3f& minPos, const Raz::Vec3f& maxPos) {
+  addGround(geometry, minPos[0], minPos[2], maxPos[0], maxPos[2], maxPos[1]);
+
+  const std::array<Raz::Vec3f, 4> bottomCorners = {{ Raz::Vec3f({ minPos[0], minPos[1], minPos[2] }), Raz::Vec3f({ minPos[0], minPos[1], maxPos[2] }),
+                                                     Raz::Vec3f({ maxPos[0], minPos[1], maxPos[2] }), Raz::Vec3f({ maxPos[0], minPos[1], minPos[2] }) }};
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    const Raz::Vec3f& firstCorner  = bottomCorners[i];
+    const Raz::Vec3f& secondCorner = bottomCorners[(i + 1) % 4];
+
+    addQuad(geometry,
+            firstCorner,
+            Raz::Vec3f({ firstCorner[0], maxPos[1], firstCorner[2] }),
+            Raz::Vec3f({ secondCorner[0], maxPos[1], secondCorner[2] }),
+            secondCorner);
+  }
+}
+
+Raz::NavMeshSettings createSettings() {
+  Raz::NavMeshSettings settings;
+  settings.tileCellCount = 32;
+  return settings;
+}
+
+float computePathLength(const std::vector<Raz::Vec3f>& path) {
+  float length = 0.f;
+
+  for (std::size_t i = 1; i < path.size(); ++i)
+    length += (path[i] - path[i - 1]).computeLength();
+
+  return length;
+}
+
+} // namespace
+
+TEST_CASE("NavMesh flat ground") {
+  Geometry geometry;
+  addGround(geometry, -10.f, -10.f, 10.f, 10.f, 0.f);
+
+  const Raz::NavMesh navMesh(geometry.vertices, geometry.indices, createSettings());
+  CHECK(navMesh.getTileCount() == 9);
+  CHECK(navMesh.getPolygonCount() >= 9);
+  CHECK(navMesh.getLinkCount() >= 24); // Each tile is connected to its neighbors in both directions
+
+  for (std::size_t polygonIndex = 0; polygonIndex < navMesh.getPolygonCount(); ++polygonIndex) {
+    const std::vector<Raz::Vec3f> polygonVertices = navMesh.computePolygonVertices(polygonIndex);
+    REQUIRE(polygonVertices.size() >= 3);
+    REQUIRE(polygonVertices.size() <= static_cast<std::size_t>(Raz::NavMesh::MaxPolygonVertexCount));
+
+    for (std::size_t i = 0; i < polygonVertices.size(); ++i) {
+      // The walkable area is shrunk by the agents' radius, & lies on the ground, both up to a voxel's size
+      CHECK(std::abs(polygonVertices[i][0]) <= 9.7f);
+      CHECK(std::abs(polygonVertices[i][2]) <= 9.7f);
+      CHECK_THAT(polygonVertices[i][1], Catch::WithinAbs(0.f, 0.25f));
+
+      // Polygons are convex, in counter-clockwise order when seen from above
+      const Raz::Vec3f& vertex     = polygonVertices[i];
+      const Raz::Vec3f& nextVertex = polygonVertices[(i + 1) % polygonVertices.size()];
+      const Raz::Vec3f& lastVertex = polygonVertices[(i + 2) % polygonVertices.size()];
+      CHECK((nextVertex[2] - vertex[2]) * (lastVertex[0] - vertex[0]) - (nextVertex[0] - vertex[0]) * (lastVertex[2] - vertex[2]) > 0.f);
+    }
+  }
+
+  Raz::NavMeshQuery query(navMesh);
+
+  Raz::Vec3f closestPos;
+  CHECK(query.findClosestPolygon(Raz::Vec3f({ 2.f, 5.f, 3.f }), closestPos) < navMesh.getPolygonCount());
+  CHECK_THAT(closestPos[0], Catch::WithinAbs(2.f, 0.001f));
+  CHECK_THAT(closestPos[1], Catch::WithinAbs(0.f, 0.25f));
+  CHECK_THAT(closestPos[2], Catch::WithinAbs(3.f, 0.001f));
+
+  // Points out of the mesh are brought back onto it
+  query.findClosestPolygon(Raz::Vec3f({ 20.f, 0.f, 0.f }), closestPos);
+  CHECK(closestPos[0] <= 9.7f);
+  CHECK(closestPos[0] >= 9.1f);
+
+  // The ground being fully walkable, paths are straight lines
+  std::vector<Raz::Vec3f> path;
+  REQUIRE(query.findPath(Raz::Vec3f({ -8.f, 0.f, 0.5f }), Raz::Vec3f({ 8.f, 0.f, 0.5f }), path));
+  REQUIRE(path.size() == 2);
+  CHECK_THAT(path.front()[0], Catch::WithinAbs(-8.f, 0.001f));
+  CHECK_THAT(path.front()[2], Catch::WithinAbs(0.5f, 0.001f));
+  CHECK_THAT(path.back()[0], Catch::WithinAbs(8.f, 0.001f));
+  CHECK_THAT(path.back()[2], Catch::WithinAbs(0.5f, 0.001f));
+
+  REQUIRE(query.findPath(Raz::Vec3f({ 1.f, 0.f, 1.f }), Raz::Vec3f({ 1.5f, 0.f, 2.f }), path));
+  CHECK(path.size() == 2);
+
+  const Raz::NavMesh emptyNavMesh;
+  CHECK(emptyNavMesh.isEmpty());
+  CHECK_FALSE(Raz::NavMeshQuery(emptyNavMesh).findPath(Raz::Vec3f(0.f), Raz::Vec3f(1.f), path));
+  CHECK(path.empty());
+}
+
+TEST_CASE("NavMesh obstacle") {
+  // A wall stands between both ends of the path, which must go around it
+  Geometry geometry;
+  addGround(geometry, -10.f, -10.f, 10.f, 10.f, 0.f);
+  addBox(geometry, Raz::Vec3f({ -0.5f, 0.f, -6.f }), Raz::Vec3f({ 0.5f, 3.f, 6.f }));
+
+  const Raz::NavMesh navMesh(geometry.vertices, geometry.indices, createSettings());
+  Raz::NavMeshQuery query(navMesh);
+
+  const Raz::Vec3f startPos({ -5.f, 0.f, 1.f });
+  const Raz::Vec3f endPos({ 5.f, 0.f, 0.f });
+
+  std::vector<Raz::Vec3f> path;
+  REQUIRE(query.findPath(startPos, endPos, path));
+  REQUIRE(path.size() > 2);
+  CHECK(computePathLength(path) > 15.f);
+  CHECK(computePathLength(path) < 18.f);
+
+  // No part of the path crosses the wall, which is avoided by at least the agents' radius
+  for (std::size_t i = 1; i < path.size(); ++i) {
+    for (float ratio = 0.f; ratio <= 1.f; ratio += 0.05f) {
+      const Raz::Vec3f point = path[i - 1] + (path[i] - path[i - 1]) * ratio;
+      CHECK_FALSE((std::abs(point[0]) < 0.9f && std::abs(point[2]) < 6.4f));
+    }
+  }
+
+  Raz::Vec3f closestStartPos;
+  Raz::Vec3f closestEndPos;
+  const std::size_t startPolygon = query.findClosestPolygon(startPos, closestStartPos);
+  const std::size_t endPolygon   = query.findClosestPolygon(endPos, closestEndPos);
+
+  std::vector<std::size_t> polygonPath;
+  REQUIRE(query.findPolygonPath(startPolygon, closestStartPos, endPolygon, closestEndPos, polygonPath));
+  REQUIRE(polygonPath.size() >= 2);
+  CHECK(polygonPath.front() == startPolygon);
+  CHECK(polygonPath.back() == endPolygon);
+
+  // The same query object can be reused, the previous search's state being ignored
+  REQUIRE(query.findPath(endPos, startPos, path));
+  CHECK(path.size() > 2);
+  REQUIRE(query.findPath(Raz::Vec3f({ -5.f, 0.f, -2.f }), startPos, path));
+  CHECK(path.size() == 2);
+}
+
+TEST_CASE("NavMesh disconnected areas") {
+  // Two platforms separated by a gap, & a third one too high to be climbed onto
+  Geometry geometry;
+  addGround(geometry, -10.f, -5.f, -1.f, 5.f, 0.f);
+  addGround(geometry, 1.f, -5.f, 10.f, 5.f, 0.f);
+  addBox(geometry, Raz::Vec3f({ 4.f, 0.f, -2.f }), Raz::Vec3f({ 8.f, 1.5f, 2.f }));
+
+  const Raz::NavMesh navMesh(geometry.vertices, geometry.indices, createSettings());
+  Raz::NavMeshQuery query(navMesh);
+
+  std::vector<Raz::Vec3f> path;
+  CHECK_FALSE(query.findPath(Raz::Vec3f({ -5.f, 0.f, 0.f }), Raz::Vec3f({ 2.5f, 0.f, 0.f }), path));
+  CHECK(path.empty());
+  CHECK_FALSE(query.findPath(Raz::Vec3f({ 2.5f, 0.f, 0.f }), Raz::Vec3f({ 6.f, 1.5f, 0.f }), path));
+
+  REQUIRE(query.findPath(Raz::Vec3f({ 2.5f, 0.f, -4.f }), Raz::Vec3f({ 9.f, 0.f, 3.f }), path));
+  CHECK(path.size() > 2);
+
+  // The box's top is walkable, but isolated
+  REQUIRE(query.findPath(Raz::Vec3f({ 5.f, 1.5f, -1.f }), Raz::Vec3f({ 7.f, 1.5f, 1.f }), path));
+  CHECK(path.size() == 2);
+  CHECK_THAT(path.front()[1], Catch::WithinAbs(1.5f, 0.25f));
+}
+
+TEST_CASE("NavMesh rebuild") {
+  Geometry groundGeometry;
+  addGround(groundGeometry, -10.f, -10.f, 10.f, 10.f, 0.f);
+
+  Geometry wallGeometry = groundGeometry;
+  addBox(wallGeometry, Raz::Vec3f({ -0.5f, 0.f, -6.f }), Raz::Vec3f({ 0.5f, 3.f, 6.f }));
+
+  const Raz::NavMesh groundNavMesh(groundGeometry.vertices, groundGeometry.indices, createSettings());
+  const Raz::NavMesh wallNavMesh(wallGeometry.vertices, wallGeometry.indices, createSettings());
+  const Raz::AABB wallBox(Raz::Vec3f({ 0.5f, 3.f, 6.f }), Raz::Vec3f({ -0.5f, 0.f, -6.f }));
+
+  Raz::NavMesh navMesh(wallGeometry.vertices, wallGeometry.indices, createSettings());
+  Raz::NavMeshQuery query(navMesh);
+
+  std::vector<Raz::Vec3f> path;
+  REQUIRE(query.findPath(Raz::Vec3f({ -5.f, 0.f, 0.f }), Raz::Vec3f({ 5.f, 0.f, 0.f }), path));
+  CHECK(path.size() > 2);
+
+  // Removing the wall only rebuilds the tiles around it, giving the same result as building everything again
+  const std::size_t rebuiltTileCount = navMesh.rebuild(groundGeometry.vertices, groundGeometry.indices, wallBox);
+  CHECK(rebuiltTileCount > 0);
+  CHECK(rebuiltTileCount < navMesh.getTileCount());
+  CHECK(navMesh.getPolygonCount() == groundNavMesh.getPolygonCount());
+  CHECK(navMesh.getLinkCount() == groundNavMesh.getLinkCount());
+
+  REQUIRE(query.findPath(Raz::Vec3f({ -5.f, 0.f, 0.f }), Raz::Vec3f({ 5.f, 0.f, 0.f }), path));
+  CHECK(path.size() == 2);
+
+  // Adding it back restores the initial mesh
+  CHECK(navMesh.rebuild(wallGeometry.vertices, wallGeometry.indices, wallBox) == rebuiltTileCount);
+  CHECK(navMesh.getPolygonCount() == wallNavMesh.getPolygonCount());
+  CHECK(navMesh.getLinkCount() == wallNavMesh.getLinkCount());
+
+  REQUIRE(query.findPath(Raz::Vec3f({ -5.f, 0.f, 0.f }), Raz::Vec3f({ 5.f, 0.f, 0.f }), path));
+  CHECK(path.size() > 2);
+
+  // Modifications away from the mesh affect no tile
+  CHECK(navMesh.rebuild(wallGeometry.vertices, wallGeometry.indices, Raz::AABB(Raz::Vec3f(60.f), Raz::Vec3f(50.f))) == 0);
+}
+
+TEST_CASE("NavMesh partial relinking") {
+  Geometry groundGeometry;
+  addGround(groundGeometry, -30.f, -30.f, 30.f, 30.f, 0.f);
+
+  Geometry pillarGeometry = groundGeometry;
+  addBox(pillarGeometry, Raz::Vec3f({ -1.f, 0.f, -1.f }), Raz::Vec3f({ 1.f, 3.f, 1.f }));
+
+  const Raz::NavMesh groundNavMesh(groundGeometry.vertices, groundGeometry.indices, createSettings());
+  Raz::NavMesh navMesh(pillarGeometry.vertices, pillarGeometry.indices, createSettings());
+
+  // Only the tiles around the pillar & their direct neighbors are relinked, the other tiles' links being kept
+  const std::size_t rebuiltTileCount = navMesh.rebuild(groundGeometry.vertices, groundGeometry.indices,
+                                                       Raz::AABB(Raz::Vec3f({ 1.f, 3.f, 1.f }), Raz::Vec3f({ -1.f, 0.f, -1.f })));
+  REQUIRE(rebuiltTileCount > 0);
+  CHECK(rebuiltTileCount * 9 < navMesh.getTileCount());
+  CHECK(navMesh.getPolygonCount() == groundNavMesh.getPolygonCount());
+  CHECK(navMesh.getLinkCount() == groundNavMesh.getLinkCount());
+
+  // The kept links must lead to the same polygons as if everything had been built again, their indices having possibly shifted
+  Raz::NavMeshQuery query(navMesh);
+  Raz::NavMeshQuery groundQuery(groundNavMesh);
+  std::vector<Raz::Vec3f> path;
+  std::vector<Raz::Vec3f> groundPath;
+
+  for (const Raz::Vec3f& startPos : { Raz::Vec3f({ -29.f, 0.f, -29.f }), Raz::Vec3f({ 29.f, 0.f, -29.f }), Raz::Vec3f({ -29.f, 0.f, 25.f }) }) {
+    for (const Raz::Vec3f& endPos : { Raz::Vec3f({ 29.f, 0.f, 29.f }), Raz::Vec3f({ -25.f, 0.f, -29.f }), Raz::Vec3f({ 0.f, 0.f, 0.f }) }) {
+      REQUIRE(query.findPath(startPos, endPos, path));
+      REQUIRE(groundQuery.findPath(startPos, endPos, groundPath));
+      CHECK(path == groundPath);
+    }
+  }
+
+  for (std::size_t polygonIndex = 0; polygonIndex < navMesh.getPolygonCount(); ++polygonIndex)
+    CHECK(navMesh.computePolygonVertices(polygonIndex) == groundNavMesh.computePolygonVertices(polygonIndex));
+}
+
+TEST_CASE("NavMesh parallel queries") {
+  // Ground covered with pillars, across which many agents find their paths at once
+  Geometry geometry;
+  addGround(geometry, -20.f, -20.f, 20.f, 20.f, 0.f);
+
+  for (float x = -15.f; x <= 15.f; x += 5.f) {
+    for (float z = -15.f; z <= 15.f; z += 5.f)
+      addBox(geometry, Raz::Vec3f({ x - 0.5f, 0.f, z - 0.5f }), Raz::Vec3f({ x + 0.5f, 3.f, z + 0.5f }));
+  }
+
+  const Raz::NavMesh navMesh(geometry.vertices, geometry.indices, createSettings());
+  CHECK(navMesh.getTileCount() == 25);
+
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  std::uniform_real_distribution<float> distribution(-18.f, 18.f);
+
+  constexpr std::size_t agentCount = 256;
+  std::vector<Raz::Vec3f> startPositions(agentCount);
+  std::vector<Raz::Vec3f> endPositions(agentCount);
+
+  for (std::size_t agentIndex = 0; agentIndex < agentCount; ++agentIndex) {
+    startPositions[agentIndex] = Raz::Vec3f({ distribution(randGenerator), 0.f, distribution(randGenerator) });
+    endPositions[agentIndex]   = Raz::Vec3f({ distribution(randGenerator), 0.f, distribution(randGenerator) });
+  }
+
+  std::vector<std::vector<Raz::Vec3f>> expectedPaths(agentCount);
+  Raz::NavMeshQuery query(navMesh);
+
+  for (std::size_t agentIndex = 0; agentIndex < agentCount; ++agentIndex)
+    REQUIRE(query.findPath(startPositions[agentIndex], endPositions[agentIndex], expectedPaths[agentIndex]));
+
+  // Each thread has its own query, all sharing the same navigation mesh
+  std::vector<std::vector<Raz::Vec3f>> paths(agentCount);
+  std::vector<char> results(agentCount, 0);
+
+  Raz::Threading::parallelize(0, agentCount, [&] (std::size_t beginIndex, std::size_t endIndex) {
+    Raz::NavMeshQuery threadQuery(navMesh);
+
+    for (std::size_t agentIndex = beginIndex; agentIndex < endIndex; ++agentIndex)
+      results[agentIndex] = threadQuery.findPath(startPositions[agentIndex], endPositions[agentIndex], paths[agentIndex]);
+  });
+
+  for (std::size_t agentIndex = 0; agentIndex < agentCount; ++agentIndex) {
+    CHECK(results[agentIndex]);
+    CHECK(paths[agentIndex] == expectedPaths[agentIndex]);
+
+    // Paths never get much longer than the straight line, the pillars being small
+    const float straightLength = (expectedPaths[agentIndex].back() - expectedPaths[agentIndex].front()).computeLength();
+    CHECK(computePathLength(expectedPaths[agentIndex]) <= straightLength * 1.2f + 1.f);
+  }
+}
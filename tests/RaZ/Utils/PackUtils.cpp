@@ -0,0 +1,129 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Batch.hpp"
+#include "RaZ/Utils/PackUtils.hpp"
+
+#include <limits>
+
+TEST_CASE("PackUtils half-precision floats") {
+  // Exactly representable values
+  REQUIRE(Raz::PackUtils::packHalf(0.f) == 0x0000);
+  REQUIRE(Raz::PackUtils::packHalf(-0.f) == 0x8000);
+  REQUIRE(Raz::PackUtils::packHalf(1.f) == 0x3C00);
+  REQUIRE(Raz::PackUtils::packHalf(-2.f) == 0xC000);
+  REQUIRE(Raz::PackUtils::packHalf(65504.f) == 0x7BFF); // Highest half value
+  REQUIRE(Raz::PackUtils::packHalf(0.00006103515625f) == 0x0400); // Lowest normal half value
+  REQUIRE(Raz::PackUtils::packHalf(0.000000059604645f) == 0x0001); // Lowest subnormal half value
+
+  // Rounding, overflow & special values
+  REQUIRE(Raz::PackUtils::packHalf(1.0004883f) == 0x3C00); // Tie between 0x3C00 & 0x3C01, rounded to even
+  REQUIRE(Raz::PackUtils::packHalf(1.0006f) == 0x3C01);
+  REQUIRE(Raz::PackUtils::packHalf(100000.f) == 0x7C00);
+  REQUIRE(Raz::PackUtils::packHalf(-std::numeric_limits<float>::infinity()) == 0xFC00);
+  REQUIRE((Raz::PackUtils::packHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7FFF) > 0x7C00);
+  REQUIRE(Raz::PackUtils::packHalf(0.00000001f) == 0x0000);
+
+  REQUIRE(Raz::PackUtils::unpackHalf(0x3C00) == 1.f);
+  REQUIRE(Raz::PackUtils::unpackHalf(0xC000) == -2.f);
+  REQUIRE(Raz::PackUtils::unpackHalf(0x7BFF) == 65504.f);
+  REQUIRE(Raz::PackUtils::unpackHalf(0x0001) == 0.000000059604645f);
+  REQUIRE(Raz::PackUtils::unpackHalf(0x7C00) == std::numeric_limits<float>::infinity());
+  REQUIRE(std::isnan(Raz::PackUtils::unpackHalf(0x7E00)));
+
+  // Every finite half must survive a round trip
+  for (std::uint32_t half = 0; half < 0x10000; ++half) {
+    if ((half & 0x7C00) == 0x7C00)
+      continue;
+
+    REQUIRE(Raz::PackUtils::packHalf(Raz::PackUtils::unpackHalf(static_cast<std::uint16_t>(half))) == half);
+  }
+
+  // The batch conversions must give the same results as the scalar ones
+  std::vector<float> values;
+  for (float value = -70000.f; value < 70000.f; value += 123.456f)
+    values.push_back(value / 1000.f);
+
+  std::vector<std::uint16_t> halves;
+  Raz::PackUtils::packHalves(values, halves);
+  REQUIRE(halves.size() == values.size());
+
+  std::vector<float> unpackedValues;
+  Raz::PackUtils::unpackHalves(halves, unpackedValues);
+  REQUIRE(unpackedValues.size() == values.size());
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    REQUIRE(halves[i] == Raz::PackUtils::packHalf(values[i]));
+    REQUIRE(unpackedValues[i] == Raz::PackUtils::unpackHalf(halves[i]));
+  }
+}
+
+TEST_CASE("PackUtils normalized integers") {
+  REQUIRE(Raz::PackUtils::packSnorm8(1.f) == 127);
+  REQUIRE(Raz::PackUtils::packSnorm8(-1.f) == -127);
+  REQUIRE(Raz::PackUtils::packSnorm8(0.f) == 0);
+  REQUIRE(Raz::PackUtils::packSnorm8(5.f) == 127);
+  REQUIRE(Raz::PackUtils::unpackSnorm8(-128) == -1.f);
+  REQUIRE(Raz::PackUtils::unpackSnorm8(Raz::PackUtils::packSnorm8(0.5f)) == Approx(0.5f).margin(0.5f / 127.f));
+
+  REQUIRE(Raz::PackUtils::packSnorm16(1.f) == 32767);
+  REQUIRE(Raz::PackUtils::packSnorm16(-3.f) == -32767);
+  REQUIRE(Raz::PackUtils::unpackSnorm16(-32768) == -1.f);
+  REQUIRE(Raz::PackUtils::unpackSnorm16(Raz::PackUtils::packSnorm16(-0.25f)) == Approx(-0.25f).margin(0.5f / 32767.f));
+
+  REQUIRE(Raz::PackUtils::packUnorm8(1.f) == 255);
+  REQUIRE(Raz::PackUtils::packUnorm8(-1.f) == 0);
+  REQUIRE(Raz::PackUtils::unpackUnorm8(Raz::PackUtils::packUnorm8(0.3f)) == Approx(0.3f).margin(0.5f / 255.f));
+
+  REQUIRE(Raz::PackUtils::packUnorm16(1.f) == 65535);
+  REQUIRE(Raz::PackUtils::packUnorm16(2.f) == 65535);
+  REQUIRE(Raz::PackUtils::unpackUnorm16(Raz::PackUtils::packUnorm16(0.7f)) == Approx(0.7f).margin(0.5f / 65535.f));
+
+  std::vector<float> values;
+  for (float value = -1.2f; value < 1.2f; value += 0.0123f)
+    values.push_back(value);
+
+  std::vector<std::int16_t> snorms;
+  Raz::PackUtils::packSnorms16(values, snorms);
+  REQUIRE(snorms.size() == values.size());
+
+  std::vector<float> unpackedValues;
+  Raz::PackUtils::unpackSnorms16(snorms, unpackedValues);
+  REQUIRE(unpackedValues.size() == values.size());
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    REQUIRE(snorms[i] == Raz::PackUtils::packSnorm16(values[i]));
+    REQUIRE(unpackedValues[i] == Raz::PackUtils::unpackSnorm16(snorms[i]));
+  }
+}
+
+TEST_CASE("PackUtils octahedral encoding") {
+  REQUIRE(Raz::PackUtils::encodeOctahedral(Raz::Axis::Z) == Raz::Vec2f(0.f));
+  REQUIRE(Raz::PackUtils::decodeOctahedral(Raz::Vec2f(0.f)) == Raz::Axis::Z);
+  REQUIRE(Raz::PackUtils::unpackOctahedral(Raz::PackUtils::packOctahedral(-Raz::Axis::Z)) == -Raz::Axis::Z);
+  REQUIRE(Raz::PackUtils::unpackOctahedral(Raz::PackUtils::packOctahedral(Raz::Axis::X)) == Raz::Axis::X);
+
+  std::vector<Raz::Vec3f> normals;
+
+  for (float theta = 0.05f; theta < 3.14f; theta += 0.1f) {
+    for (float phi = -3.14f; phi < 3.14f; phi += 0.1f)
+      normals.push_back(Raz::Vec3f({ std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta) }));
+  }
+
+  const Raz::Vec3fArray normalArray(normals);
+  std::vector<std::uint32_t> packedNormals;
+  Raz::PackUtils::packOctahedrals(normalArray, packedNormals);
+  REQUIRE(packedNormals.size() == normals.size());
+
+  Raz::Vec3fArray unpackedNormals;
+  Raz::PackUtils::unpackOctahedrals(packedNormals, unpackedNormals);
+  REQUIRE(unpackedNormals.getSize() == normals.size());
+
+  for (std::size_t i = 0; i < normals.size(); ++i) {
+    // The encoded vector must decode almost exactly; the packed one must be within 0.005 degree of the original
+    const Raz::Vec3f decodedNormal = Raz::PackUtils::decodeOctahedral(Raz::PackUtils::encodeOctahedral(normals[i]));
+    CHECK(decodedNormal.dot(normals[i]) == Approx(1.f).margin(0.000001f));
+
+    CHECK(packedNormals[i] == Raz::PackUtils::packOctahedral(normals[i]));
+    // The angle is checked through the cross product's length, its cosine being too close to 1 to be compared in single precision
+    CHECK(unpackedNormals[i].cross(normals[i]).computeLength() <= std::sin(0.005f * 3.14159265f / 180.f));
+  }
+}
@@ -157,3 +157,145 @@ TEST_CASE("Point projection") {
   REQUIRE(ray3.computeProjection(topPoint) == ray3.getOrigin());
   REQUIRE(ray3.computeProjection(topRightPoint) == ray3.getOrigin());
 }
+
+TEST_CASE("Ray-line hit") {
+  //        ^
+  //        |
+  //  ------+------ line1 (y = 2)
+  //        |
+  //        x < [ 0; 0 ]
+  const Raz::Line line1(Raz::Vec3f({ -1.f, 2.f, 0.f }), Raz::Vec3f({ 1.f, 2.f, 0.f }));
+  const Raz::Line line2(Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 3.f, 0.f }));
+  const Raz::Line line3(Raz::Vec3f({ 0.f, 1.f, 0.f }), Raz::Vec3f({ 0.f, 3.f, 0.f }));
+
+  REQUIRE(ray1.intersects(line1));
+  REQUIRE_FALSE(ray1.intersects(line2));
+  REQUIRE(ray2.intersects(line2));
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersect(line1, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 2.f, 0.f }));
+  CHECK(hit.normal == Raz::Vec3f({ 0.f, -1.f, 0.f }));
+  CHECK_THAT(hit.distance, Catch::WithinAbs(2.f, 0.000001f));
+
+  REQUIRE_FALSE(ray1.intersect(line1, hit, 1.5f));
+  REQUIRE_FALSE(ray3.intersect(line1, hit));
+
+  // A collinear line is hit at its closest extremity
+  REQUIRE(ray1.intersect(line3, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  CHECK(hit.normal == -Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(1.f, 0.000001f));
+}
+
+TEST_CASE("Ray-plane hit") {
+  const Raz::Plane plane1(1.f);
+  const Raz::Plane plane2(-0.5f, Raz::Axis::X);
+  const Raz::Plane plane3(Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }).normalize());
+
+  REQUIRE(ray1.intersects(plane1));
+  REQUIRE_FALSE(ray1.intersects(plane2)); // Parallel
+  REQUIRE(ray2.intersects(plane2));
+  REQUIRE_FALSE(ray3.intersects(Raz::Plane(2.f))); // Behind
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersect(plane1, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(1.f, 0.000001f));
+
+  REQUIRE(ray2.intersect(plane3, hit));
+  CHECK(hit.position == Raz::Vec3f({ 1.f, 1.f, 0.f }));
+  CHECK_THAT(hit.distance, Catch::WithinAbs(2.f * std::sqrt(2.f), 0.000001f));
+
+  REQUIRE_FALSE(ray2.intersect(plane3, hit, 2.f));
+}
+
+TEST_CASE("Ray-sphere hit") {
+  const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
+  const Raz::Sphere sphere2(Raz::Vec3f({ 0.f, 5.f, 0.f }), 2.f);
+
+  Raz::RayHit hit;
+
+  // The ray's origin is inside the first sphere: the exit point is given
+  REQUIRE(ray1.intersect(sphere1, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(1.f, 0.000001f));
+
+  REQUIRE(ray1.intersect(sphere2, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 3.f, 0.f }));
+  CHECK(hit.normal == -Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(3.f, 0.000001f));
+
+  REQUIRE_FALSE(ray1.intersect(sphere2, hit, 2.5f));
+  REQUIRE_FALSE(ray3.intersect(sphere2, hit));
+}
+
+TEST_CASE("Ray-triangle hit") {
+  const Raz::Triangle triangle(Raz::Vec3f({ -3.f, 0.5f, 3.f }), Raz::Vec3f({ 3.f, 0.5f, 3.f }), Raz::Vec3f({ 0.f, 0.5f, -3.f }));
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersect(triangle, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 0.5f, 0.f }));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(0.5f, 0.000001f));
+
+  // The hit position can be recovered from the barycentric coordinates
+  const Raz::Vec3f baryPos = triangle.getFirstPos() * (1.f - hit.barycentricCoords[0] - hit.barycentricCoords[1])
+                           + triangle.getSecondPos() * hit.barycentricCoords[0]
+                           + triangle.getThirdPos() * hit.barycentricCoords[1];
+  CHECK(baryPos == hit.position);
+  CHECK_THAT(hit.barycentricCoords[0], Catch::WithinAbs(0.25f, 0.000001f));
+  CHECK_THAT(hit.barycentricCoords[1], Catch::WithinAbs(0.5f, 0.000001f));
+
+  REQUIRE_FALSE(ray1.intersect(triangle, hit, 0.25f));
+}
+
+TEST_CASE("Ray-quad hit") {
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 2.f, -1.f }), Raz::Vec3f({ 1.f, 2.f, -1.f }),
+                       Raz::Vec3f({ 1.f, 2.f, 1.f }), Raz::Vec3f({ -1.f, 2.f, 1.f }));
+  const Raz::Quad farQuad(Raz::Vec3f({ 2.f, 3.f, -1.f }), Raz::Vec3f({ 4.f, 3.f, -1.f }),
+                          Raz::Vec3f({ 4.f, 3.f, 1.f }), Raz::Vec3f({ 2.f, 3.f, 1.f }));
+
+  REQUIRE(ray1.intersects(quad));
+  REQUIRE_FALSE(ray1.intersects(farQuad));
+  REQUIRE(ray2.intersects(farQuad));
+  REQUIRE_FALSE(ray3.intersects(quad));
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersect(quad, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 2.f, 0.f }));
+  CHECK(hit.normal == -Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(2.f, 0.000001f));
+
+  // The hit lies on the diagonal shared by both halves of the quad
+  REQUIRE(ray2.intersect(farQuad, hit));
+  CHECK(hit.position == Raz::Vec3f({ 3.f, 3.f, 0.f }));
+  CHECK_THAT(hit.distance, Catch::WithinAbs(4.f * std::sqrt(2.f), 0.00001f));
+}
+
+TEST_CASE("Ray-AABB hit") {
+  const Raz::AABB aabb1(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+  const Raz::AABB aabb2(Raz::Vec3f(5.f), Raz::Vec3f({ 3.f, 3.f, -5.f }));
+
+  Raz::RayHit hit;
+
+  // The ray's origin is inside the box: the exit point is given
+  REQUIRE(ray1.intersect(aabb1, hit));
+  CHECK(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(1.f, 0.000001f));
+
+  REQUIRE(ray2.intersect(aabb2, hit));
+  CHECK(hit.position == Raz::Vec3f({ 3.f, 3.f, 0.f }));
+  CHECK(hit.normal == -Raz::Axis::X);
+  CHECK_THAT(hit.distance, Catch::WithinAbs(4.f * std::sqrt(2.f), 0.00001f));
+
+  REQUIRE_FALSE(ray2.intersect(aabb2, hit, 5.f));
+  REQUIRE_FALSE(ray3.intersect(aabb2, hit));
+}
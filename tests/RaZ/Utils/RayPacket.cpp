@@ -0,0 +1,128 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+
+#include <random>
+
+namespace {
+
+// Builds a packet of rays starting around [ 0; 0; -5 ] & pointing roughly towards the origin
+template <std::size_t Size>
+Raz::RayPacket<Size> createRandomPacket(std::mt19937& randGenerator) {
+  std::uniform_real_distribution<float> originDistrib(-1.f, 1.f);
+  std::uniform_real_distribution<float> dirDistrib(-0.4f, 0.4f);
+
+  Raz::RayPacket<Size> packet;
+
+  for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+    const Raz::Vec3f origin({ originDistrib(randGenerator), originDistrib(randGenerator), -5.f });
+    const Raz::Vec3f direction = Raz::Vec3f({ dirDistrib(randGenerator), dirDistrib(randGenerator), 1.f }).normalize();
+    packet.setRay(rayIndex, Raz::Ray(origin, direction));
+  }
+
+  return packet;
+}
+
+// Checks that every ray of the packet gives the same results as if cast alone
+template <std::size_t Size>
+void checkPacket(const Raz::RayPacket<Size>& packet, const Raz::AABB& aabb, const Raz::Triangle& triangle) {
+  typename Raz::RayPacket<Size>::Distances entryDistances {};
+  const std::uint32_t boxMask = packet.intersects(aabb, entryDistances);
+
+  typename Raz::RayPacket<Size>::Distances triDistances {};
+  triDistances.fill(std::numeric_limits<float>::max());
+  const std::uint32_t triMask = packet.intersect(triangle, triDistances);
+
+  for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+    const Raz::Ray ray = packet.getRay(rayIndex);
+
+    Raz::RayHit boxHit;
+    const bool isBoxHit = ray.intersects(aabb);
+    REQUIRE(((boxMask >> rayIndex) & 1u) == (isBoxHit ? 1u : 0u));
+
+    if (isBoxHit && ray.intersect(aabb, boxHit) && aabb.contains(ray.getOrigin()) == false)
+      CHECK_THAT(entryDistances[rayIndex], Catch::WithinAbs(boxHit.distance, 0.0001f));
+
+    Raz::RayHit triHit;
+    const bool isTriHit = ray.intersect(triangle, triHit);
+    REQUIRE(((triMask >> rayIndex) & 1u) == (isTriHit ? 1u : 0u));
+
+    if (isTriHit)
+      CHECK_THAT(triDistances[rayIndex], Catch::WithinAbs(triHit.distance, 0.0001f));
+    else
+      CHECK(triDistances[rayIndex] == std::numeric_limits<float>::max());
+  }
+}
+
+} // namespace
+
+TEST_CASE("RayPacket rays") {
+  const Raz::Ray ray(Raz::Vec3f({ 1.f, 2.f, 3.f }), Raz::Vec3f({ 0.f, -1.f, 0.f }));
+
+  Raz::RayPacket4 packet;
+  packet.setRay(2, ray);
+
+  CHECK(packet.getRay(2).getOrigin() == ray.getOrigin());
+  CHECK(packet.getRay(2).getDirection() == ray.getDirection());
+  CHECK(packet.getOriginsY()[2] == 2.f);
+  CHECK(packet.getDirectionsY()[2] == -1.f);
+}
+
+TEST_CASE("RayPacket-AABB intersection") {
+  // Rays going up, down, towards the box & away from it; the last one starts inside the box
+  const Raz::AABB aabb(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+
+  const Raz::RayPacket4 packet({ Raz::Ray(Raz::Vec3f({ 0.f, -5.f, 0.f }), Raz::Axis::Y),
+                                 Raz::Ray(Raz::Vec3f({ 0.f, -5.f, 0.f }), -Raz::Axis::Y),
+                                 Raz::Ray(Raz::Vec3f({ 3.f, -2.f, 0.f }), Raz::Vec3f({ -1.f, 1.f, 0.f }).normalize()),
+                                 Raz::Ray(Raz::Vec3f(0.5f), Raz::Axis::X) });
+
+  Raz::RayPacket4::Distances entryDistances {};
+  CHECK(packet.intersects(aabb, entryDistances) == 0b1101);
+  CHECK(entryDistances[0] == 4.f);
+  CHECK_THAT(entryDistances[2], Catch::WithinAbs(2.f * std::sqrt(2.f), 0.000001f));
+  CHECK(entryDistances[3] == 0.f);
+
+  // Hits further than the maximum distances are ignored
+  const Raz::RayPacket4::Distances maxDistances = { 3.f, 10.f, 10.f, 10.f };
+  CHECK(packet.intersects(aabb, maxDistances, entryDistances) == 0b1100);
+
+  // A ray parallel to a face & lying on it is still considered hitting the box
+  const Raz::RayPacket4 edgePacket({ Raz::Ray(Raz::Vec3f({ 1.f, -5.f, 0.f }), Raz::Axis::Y),
+                                     Raz::Ray(Raz::Vec3f({ 1.1f, -5.f, 0.f }), Raz::Axis::Y),
+                                     Raz::Ray(Raz::Vec3f({ 0.f, 0.f, -5.f }), Raz::Axis::Z),
+                                     Raz::Ray(Raz::Vec3f({ 0.f, 0.f, 5.f }), Raz::Axis::Z) });
+  CHECK(edgePacket.intersects(aabb, entryDistances) == 0b0101);
+}
+
+TEST_CASE("RayPacket-triangle intersection") {
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+
+  const Raz::RayPacket4 packet({ Raz::Ray(Raz::Vec3f({ 0.f, 0.f, -2.f }), Raz::Axis::Z),
+                                 Raz::Ray(Raz::Vec3f({ 0.f, 0.f, -2.f }), -Raz::Axis::Z),
+                                 Raz::Ray(Raz::Vec3f({ 0.9f, 0.9f, -2.f }), Raz::Axis::Z),
+                                 Raz::Ray(Raz::Vec3f({ 0.f, 0.f, -2.f }), Raz::Axis::X) });
+
+  Raz::RayPacket4::Distances distances {};
+  distances.fill(std::numeric_limits<float>::max());
+
+  CHECK(packet.intersect(triangle, distances) == 0b0001);
+  CHECK(distances[0] == 2.f);
+  CHECK(distances[1] == std::numeric_limits<float>::max());
+
+  // Hits further than the current closest distances are ignored, which are then left untouched
+  distances = { 1.f, 10.f, 10.f, 10.f };
+  CHECK(packet.intersect(triangle, distances) == 0);
+  CHECK(distances[0] == 1.f);
+}
+
+TEST_CASE("RayPacket consistency with single rays") {
+  std::mt19937 randGenerator(42);
+
+  const Raz::AABB aabb(Raz::Vec3f({ 0.5f, 0.3f, 1.f }), Raz::Vec3f({ -0.4f, -0.6f, -1.f }));
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, -0.5f, 0.5f }), Raz::Vec3f({ 0.f, 1.f, -0.5f }));
+
+  for (std::size_t packetIndex = 0; packetIndex < 100; ++packetIndex) {
+    checkPacket(createRandomPacket<4>(randGenerator), aabb, triangle);
+    checkPacket(createRandomPacket<8>(randGenerator), aabb, triangle);
+  }
+}
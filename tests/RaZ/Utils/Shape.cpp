@@ -1,4 +1,5 @@
 #include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace {
@@ -111,6 +112,70 @@ TEST_CASE("Plane-plane intersection") {
   REQUIRE_FALSE(plane3.intersects(plane3));
 }
 
+TEST_CASE("Triangle projection") {
+  const Raz::Triangle triangle(Raz::Vec3f(0.f), Raz::Vec3f({ 1.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+
+  // Points above the face are projected straight onto it
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 0.2f, 0.2f, 5.f })) == Raz::Vec3f({ 0.2f, 0.2f, 0.f }));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 0.25f, 0.5f, -1.f })) == Raz::Vec3f({ 0.25f, 0.5f, 0.f }));
+
+  // Points beside the triangle are projected onto its closest vertex or edge
+  CHECK(triangle.computeProjection(Raz::Vec3f({ -1.f, -1.f, 0.f })) == Raz::Vec3f(0.f));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 2.f, -1.f, 1.f })) == Raz::Vec3f({ 1.f, 0.f, 0.f }));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 0.f, 3.f, 0.f })) == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 0.5f, -1.f, 0.f })) == Raz::Vec3f({ 0.5f, 0.f, 0.f }));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ -1.f, 0.5f, 3.f })) == Raz::Vec3f({ 0.f, 0.5f, 0.f }));
+  CHECK(triangle.computeProjection(Raz::Vec3f({ 1.f, 1.f, 0.f })) == Raz::Vec3f({ 0.5f, 0.5f, 0.f }));
+
+  CHECK(triangle.contains(Raz::Vec3f({ 0.25f, 0.25f, 0.f })));
+  CHECK(triangle.contains(Raz::Vec3f({ 1.f, 0.f, 0.f })));
+  CHECK_FALSE(triangle.contains(Raz::Vec3f({ 0.25f, 0.25f, 0.1f })));
+  CHECK_FALSE(triangle.contains(Raz::Vec3f({ 1.f, 1.f, 0.f })));
+}
+
+TEST_CASE("Quad projection") {
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ -1.f, -1.f, 0.f }));
+
+  CHECK(quad.computeProjection(Raz::Vec3f({ 0.5f, -0.5f, 2.f })) == Raz::Vec3f({ 0.5f, -0.5f, 0.f }));
+  CHECK(quad.computeProjection(Raz::Vec3f({ -0.5f, 0.5f, -2.f })) == Raz::Vec3f({ -0.5f, 0.5f, 0.f }));
+  CHECK(quad.computeProjection(Raz::Vec3f({ 3.f, 0.f, 0.f })) == Raz::Vec3f({ 1.f, 0.f, 0.f }));
+  CHECK(quad.computeProjection(Raz::Vec3f({ -3.f, -3.f, 1.f })) == Raz::Vec3f({ -1.f, -1.f, 0.f }));
+}
+
+TEST_CASE("Convex shapes intersection") {
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, 0.f, -1.f }), Raz::Vec3f({ 1.f, 0.f, -1.f }), Raz::Vec3f({ 0.f, 0.f, 1.f }));
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ -1.f, -1.f, 0.f }));
+
+  CHECK(line1.intersects(line2));
+  CHECK_FALSE(line1.intersects(Raz::Line(Raz::Vec3f({ 0.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }))));
+  CHECK(line1.intersects(aabb1));
+  CHECK_FALSE(line1.intersects(aabb2));
+  CHECK_FALSE(line3.intersects(aabb2));
+  CHECK(line2.intersects(triangle));
+  CHECK(line2.intersects(quad));
+
+  CHECK(triangle.intersects(quad));
+  CHECK(triangle.intersects(aabb1));
+  CHECK_FALSE(triangle.intersects(aabb2));
+  CHECK_FALSE(triangle.intersects(Raz::Triangle(Raz::Vec3f({ -1.f, 0.1f, -1.f }), Raz::Vec3f({ 1.f, 0.1f, -1.f }), Raz::Vec3f({ 0.f, 0.1f, 1.f }))));
+  CHECK(triangle.intersects(Raz::Triangle(Raz::Vec3f({ 0.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 2.f })))); // Crossing
+  CHECK_FALSE(triangle.intersects(Raz::Triangle(Raz::Vec3f({ 0.f, -1.f, 2.f }), Raz::Vec3f({ 0.f, 1.f, 2.f }), Raz::Vec3f({ 0.f, 1.f, 3.f }))));
+  CHECK(triangle.intersects(Raz::Triangle(Raz::Vec3f({ 1.f, 0.f, -1.f }), Raz::Vec3f({ 2.f, 1.f, -1.f }), Raz::Vec3f({ 2.f, -1.f, 0.f })))); // Touching by a vertex
+  CHECK(triangle.intersects(Raz::Triangle(Raz::Vec3f({ -0.5f, 0.f, 0.f }), Raz::Vec3f({ 0.5f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 2.f })))); // Coplanar
+  CHECK(triangle.intersects(Raz::Triangle(Raz::Vec3f({ -0.1f, 0.f, -0.5f }), Raz::Vec3f({ 0.1f, 0.f, -0.5f }), Raz::Vec3f({ 0.f, 0.f, -0.4f })))); // Coplanar & contained
+  CHECK_FALSE(triangle.intersects(Raz::Triangle(Raz::Vec3f({ 1.f, 0.f, 1.f }), Raz::Vec3f({ 2.f, 0.f, 1.f }), Raz::Vec3f({ 2.f, 0.f, 2.f })))); // Coplanar & apart
+
+  CHECK(quad.intersects(aabb1));
+  CHECK_FALSE(quad.intersects(aabb3));
+  CHECK_FALSE(quad.intersects(Raz::Quad(Raz::Vec3f({ -1.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, 1.f, 1.f }),
+                                        Raz::Vec3f({ 1.f, -1.f, 1.f }), Raz::Vec3f({ -1.f, -1.f, 1.f }))));
+
+  CHECK_FALSE(plane1.intersects(triangle));
+  CHECK(plane1.intersects(quad));
+  CHECK(plane2.intersects(quad));
+  CHECK(Raz::Plane(0.f).intersects(triangle));
+}
+
 TEST_CASE("AABB basic") {
   REQUIRE(aabb1.computeCentroid() == Raz::Vec3f(0.f));
   REQUIRE(aabb2.computeCentroid() == Raz::Vec3f({ 4.f, 4.f, 0.f }));
@@ -120,3 +185,20 @@ TEST_CASE("AABB basic") {
   REQUIRE(aabb2.computeHalfExtents() == Raz::Vec3f({ 1.f, 1.f, 5.f }));
   REQUIRE(aabb3.computeHalfExtents() == Raz::Vec3f({ 2.5f, 2.5f, 5.f }));
 }
+
+TEST_CASE("AABB transformation") {
+  // Translating & scaling keep the box exact
+  const Raz::Transform transform(Raz::Vec3f({ 1.f, 2.f, 3.f }), Raz::Quaternionf::identity(), Raz::Vec3f({ 2.f, 1.f, 0.5f }));
+  const Raz::AABB movedAabb = aabb2.computeTransformed(transform.getTransformMatrix());
+
+  REQUIRE(movedAabb.getLeftBottomBackPos() == Raz::Vec3f({ 7.f, 5.f, 0.5f }));
+  REQUIRE(movedAabb.getRightTopFrontPos() == Raz::Vec3f({ 11.f, 7.f, 5.5f }));
+
+  // Rotating by 90 degrees around Y swaps the X & Z extents, while 45 degrees enlarges them
+  const Raz::AABB rotatedAabb = aabb2.computeTransformed(Raz::Transform(Raz::Vec3f(0.f), Raz::Quaternionf(90.f, Raz::Axis::Y)).getTransformMatrix());
+  REQUIRE(rotatedAabb.computeHalfExtents() == Raz::Vec3f({ 5.f, 1.f, 1.f }));
+  REQUIRE(rotatedAabb.computeCentroid() == Raz::Vec3f({ 0.f, 4.f, -4.f }));
+
+  const Raz::AABB diagonalAabb = aabb1.computeTransformed(Raz::Transform(Raz::Vec3f(0.f), Raz::Quaternionf(45.f, Raz::Axis::Y)).getTransformMatrix());
+  REQUIRE(diagonalAabb.computeHalfExtents() == Raz::Vec3f({ std::sqrt(2.f), 1.f, std::sqrt(2.f) }));
+}
@@ -0,0 +1,133 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/ShapeArray.hpp"
+
+#include <random>
+
+namespace {
+
+// Boxes & spheres scattered around the origin, in a number not being a multiple of any SIMD width to test the remaining elements
+constexpr std::size_t ShapeCount = 1003;
+
+std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp, cert-err58-cpp): deterministic on purpose
+std::uniform_real_distribution<float> posDistrib(-10.f, 10.f);
+std::uniform_real_distribution<float> sizeDistrib(0.1f, 2.f);
+
+Raz::Vec3f generatePosition() {
+  return Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+}
+
+Raz::AABB generateAabb() {
+  const Raz::Vec3f minPos = generatePosition();
+  return Raz::AABB(minPos + Raz::Vec3f({ sizeDistrib(randGenerator), sizeDistrib(randGenerator), sizeDistrib(randGenerator) }), minPos);
+}
+
+Raz::Sphere generateSphere() {
+  return Raz::Sphere(generatePosition(), sizeDistrib(randGenerator));
+}
+
+} // namespace
+
+TEST_CASE("ShapeArray basic") {
+  const Raz::AABB aabb(Raz::Vec3f({ 1.f, 2.f, 3.f }), Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  const Raz::Sphere sphere(Raz::Vec3f({ 1.f, 2.f, 3.f }), 4.f);
+
+  Raz::AABBArray aabbs;
+  REQUIRE(aabbs.isEmpty());
+  aabbs.add(aabb);
+  REQUIRE(aabbs.getSize() == 1);
+  CHECK(aabbs[0].getRightTopFrontPos() == aabb.getRightTopFrontPos());
+  CHECK(aabbs[0].getLeftBottomBackPos() == aabb.getLeftBottomBackPos());
+
+  Raz::SphereArray spheres(std::vector<Raz::Sphere>({ sphere, sphere }));
+  REQUIRE(spheres.getSize() == 2);
+  spheres.set(1, Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  CHECK(spheres[0].getCenter() == sphere.getCenter());
+  CHECK(spheres[0].getRadius() == sphere.getRadius());
+  CHECK(spheres[1].getRadius() == 1.f);
+
+  spheres.clear();
+  CHECK(spheres.isEmpty());
+
+  // Empty arrays give empty results
+  Raz::BitMask result(5);
+  Raz::Batch::intersects(sphere, spheres, result);
+  CHECK(result.getSize() == 0);
+}
+
+TEST_CASE("ShapeArray intersections") {
+  std::vector<Raz::AABB> aabbList;
+  std::vector<Raz::Sphere> sphereList;
+
+  for (std::size_t i = 0; i < ShapeCount; ++i) {
+    aabbList.push_back(generateAabb());
+    sphereList.push_back(generateSphere());
+  }
+
+  const Raz::AABBArray aabbs(aabbList);
+  const Raz::SphereArray spheres(sphereList);
+
+  Raz::BitMask result;
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    const Raz::Sphere sphere(generatePosition(), sizeDistrib(randGenerator) * 2.f);
+    const Raz::AABB aabb = generateAabb();
+
+    Raz::Batch::intersects(sphere, aabbs, result);
+    REQUIRE(result.getSize() == ShapeCount);
+    for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex)
+      CHECK(result.isSet(shapeIndex) == sphere.intersects(aabbList[shapeIndex]));
+
+    Raz::Batch::intersects(sphere, spheres, result);
+    for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex)
+      CHECK(result.isSet(shapeIndex) == sphere.intersects(sphereList[shapeIndex]));
+
+    Raz::Batch::intersects(aabb, aabbs, result);
+    for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex)
+      CHECK(result.isSet(shapeIndex) == aabb.intersects(aabbList[shapeIndex]));
+
+    Raz::Batch::intersects(aabb, spheres, result);
+    for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex)
+      CHECK(result.isSet(shapeIndex) == aabb.intersects(sphereList[shapeIndex]));
+  }
+}
+
+TEST_CASE("ShapeArray frustum intersections") {
+  // Box-shaped frustum in [ -5; 5 ] on all axes, whose normals point inwards
+  const std::array<Raz::Plane, 6> frustumPlanes = {
+    Raz::Plane(-5.f, Raz::Axis::X), Raz::Plane(-5.f, -Raz::Axis::X),
+    Raz::Plane(-5.f, Raz::Axis::Y), Raz::Plane(-5.f, -Raz::Axis::Y),
+    Raz::Plane(-5.f, Raz::Axis::Z), Raz::Plane(-5.f, -Raz::Axis::Z)
+  };
+  const Raz::AABB frustumBox(Raz::Vec3f(5.f), Raz::Vec3f(-5.f));
+
+  std::vector<Raz::AABB> aabbList;
+  std::vector<Raz::Sphere> sphereList;
+
+  for (std::size_t i = 0; i < ShapeCount; ++i) {
+    aabbList.push_back(generateAabb());
+    sphereList.push_back(generateSphere());
+  }
+
+  Raz::BitMask result;
+
+  // Against an axis-aligned box-shaped frustum, the test on boxes is exact
+  Raz::Batch::intersects(frustumPlanes, Raz::AABBArray(aabbList), result);
+  REQUIRE(result.getSize() == ShapeCount);
+
+  for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex)
+    CHECK(result.isSet(shapeIndex) == frustumBox.intersects(aabbList[shapeIndex]));
+
+  // Spheres may be reported inside near the frustum's edges & corners, but none intersecting it can be missed
+  Raz::Batch::intersects(frustumPlanes, Raz::SphereArray(sphereList), result);
+  REQUIRE(result.getSize() == ShapeCount);
+
+  for (std::size_t shapeIndex = 0; shapeIndex < ShapeCount; ++shapeIndex) {
+    if (frustumBox.intersects(sphereList[shapeIndex]))
+      CHECK(result.isSet(shapeIndex));
+
+    const Raz::Vec3f& center = sphereList[shapeIndex].getCenter();
+    const float radius       = sphereList[shapeIndex].getRadius();
+    const bool isNearFrustum = (std::abs(center[0]) <= 5.f + radius && std::abs(center[1]) <= 5.f + radius && std::abs(center[2]) <= 5.f + radius);
+    CHECK(result.isSet(shapeIndex) == isNearFrustum);
+  }
+}
@@ -0,0 +1,204 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Utils/SignedDistanceField.hpp"
+
+#include <random>
+
+namespace {
+
+// Cube of half extent 1 centered on the origin, made of 12 triangles facing outwards
+void createCube(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  vertices.resize(8);
+
+  for (unsigned int i = 0; i < 8; ++i)
+    vertices[i].position = Raz::Vec3f({ (i & 1u ? 1.f : -1.f), (i & 2u ? 1.f : -1.f), (i & 4u ? 1.f : -1.f) });
+
+  indices = { 0, 2, 1,  1, 2, 3,   // Back (-Z)
+              4, 5, 6,  5, 7, 6,   // Front (+Z)
+              0, 1, 4,  1, 5, 4,   // Bottom (-Y)
+              2, 6, 3,  3, 6, 7,   // Top (+Y)
+              0, 4, 2,  2, 4, 6,   // Left (-X)
+              1, 3, 5,  3, 7, 5 }; // Right (+X)
+}
+
+// Unit sphere made of rings of vertices; those on the seam & at the poles are duplicated, as texture coordinates would require
+void createSphere(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  constexpr unsigned int ringCount    = 24;
+  constexpr unsigned int segmentCount = 48;
+
+  for (unsigned int ring = 0; ring <= ringCount; ++ring) {
+    const float polarAngle = Raz::PI<float> * static_cast<float>(ring) / ringCount;
+
+    for (unsigned int segment = 0; segment <= segmentCount; ++segment) {
+      const float azimuth = 2.f * Raz::PI<float> * static_cast<float>(segment) / segmentCount;
+
+      Raz::Vertex vertex;
+      vertex.position = Raz::Vec3f({ std::sin(polarAngle) * std::cos(azimuth), std::cos(polarAngle), -std::sin(polarAngle) * std::sin(azimuth) });
+      vertices.push_back(vertex);
+    }
+  }
+
+  for (unsigned int ring = 0; ring < ringCount; ++ring) {
+    for (unsigned int segment = 0; segment < segmentCount; ++segment) {
+      const unsigned int topLeft    = ring * (segmentCount + 1) + segment;
+      const unsigned int bottomLeft = topLeft + segmentCount + 1;
+
+      indices.insert(indices.end(), { topLeft, bottomLeft, topLeft + 1, topLeft + 1, bottomLeft, bottomLeft + 1 });
+    }
+  }
+}
+
+void checkVectors(const Raz::Vec3f& vec1, const Raz::Vec3f& vec2, float margin = 0.00001f) {
+  CHECK(vec1[0] == Approx(vec2[0]).margin(margin));
+  CHECK(vec1[1] == Approx(vec2[1]).margin(margin));
+  CHECK(vec1[2] == Approx(vec2[2]).margin(margin));
+}
+
+float computeCubeDistance(const Raz::Vec3f& point) {
+  float sqOutsideDistance = 0.f;
+  float maxCoord = std::numeric_limits<float>::lowest();
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    const float coord = std::abs(point[i]) - 1.f;
+    sqOutsideDistance += std::max(coord, 0.f) * std::max(coord, 0.f);
+    maxCoord = std::max(maxCoord, coord);
+  }
+
+  return std::sqrt(sqOutsideDistance) + std::min(maxCoord, 0.f);
+}
+
+} // namespace
+
+TEST_CASE("SignedDistanceField basic") {
+  const Raz::SignedDistanceField emptyField;
+  REQUIRE(emptyField.isEmpty());
+  CHECK(emptyField.computeDistance(Raz::Vec3f(0.f)) == std::numeric_limits<float>::max());
+  CHECK(emptyField.computeNormal(Raz::Vec3f(0.f)) == Raz::Vec3f(0.f));
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createCube(vertices, indices);
+
+  const Raz::SignedDistanceField field(vertices, indices, 0.1f);
+
+  // The grid covers the cube expanded by a cell, rounded up to whole bricks of 8 cells: 2.2 / 0.8 gives 3 bricks along each axis
+  CHECK(field.getMinBounds() == Raz::Vec3f(-1.1f));
+  CHECK(field.getCellSize() == 0.1f);
+  CHECK(field.getCellCounts() == std::array<std::size_t, 3>({ 24, 24, 24 }));
+  CHECK(field.getBrickCount() == 27);
+  // Only the central brick is too far from the surface to be stored at full resolution
+  CHECK(field.getFineBrickCount() == 26);
+
+  // Along the faces, the field is linear & thus exactly interpolated
+  CHECK(field.computeDistance(Raz::Vec3f({ 1.05f, 0.2f, -0.3f })) == Approx(0.05f).margin(0.0001f));
+  CHECK(field.computeDistance(Raz::Vec3f({ 0.3f, -0.85f, 0.4f })) == Approx(-0.15f).margin(0.0001f));
+  CHECK(field.computeDistance(Raz::Vec3f({ -0.5f, 0.1f, -1.f })) == Approx(0.f).margin(0.0001f));
+
+  // Out of the grid, the distance to it is added
+  CHECK(field.computeDistance(Raz::Vec3f({ 5.f, 0.f, 0.f })) == Approx(4.f).margin(0.0001f));
+  CHECK(field.computeDistance(Raz::Vec3f({ 0.f, -2.1f, 0.f })) == Approx(1.1f).margin(0.0001f));
+
+  Raz::Vec3f normal;
+  CHECK(field.computeDistance(Raz::Vec3f({ 0.3f, 1.02f, 0.4f }), normal) == Approx(0.02f).margin(0.0001f));
+  checkVectors(normal, Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  checkVectors(field.computeNormal(Raz::Vec3f({ -0.9f, 0.1f, 0.2f })), Raz::Vec3f({ -1.f, 0.f, 0.f }));
+  checkVectors(field.computeNormal(Raz::Vec3f({ 1.5f, 1.5f, 0.f })), Raz::Vec3f({ 0.7071068f, 0.7071068f, 0.f }), 0.01f);
+
+  // Rebaking with no triangle empties the field
+  Raz::SignedDistanceField rebakedField = field;
+  rebakedField.bake(vertices, {}, 0.1f);
+  CHECK(rebakedField.isEmpty());
+  CHECK(rebakedField.getFineBrickCount() == 0);
+}
+
+TEST_CASE("SignedDistanceField cube") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createCube(vertices, indices);
+
+  const Raz::SignedDistanceField field(vertices, indices, 0.05f, 0.2f);
+
+  std::mt19937 randGenerator(3); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-1.5f, 1.5f);
+
+  for (std::size_t i = 0; i < 2000; ++i) {
+    const Raz::Vec3f point({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+    const float expectedDistance = computeCubeDistance(point);
+    const float distance         = field.computeDistance(point);
+
+    // Within the band, the error only comes from the interpolation across the field's creases & around the cube's edges;
+    //  further away, the distances are interpolated from the bricks' corners
+    if (std::abs(expectedDistance) <= 0.2f) {
+      CHECK(distance == Approx(expectedDistance).margin(0.02f));
+
+      if (std::abs(expectedDistance) > 0.02f)
+        CHECK((distance < 0.f) == (expectedDistance < 0.f));
+    } else {
+      CHECK(distance == Approx(expectedDistance).margin(0.15f));
+    }
+  }
+}
+
+TEST_CASE("SignedDistanceField sphere") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createSphere(vertices, indices);
+
+  const Raz::SignedDistanceField field(vertices, indices, 0.05f, 0.2f);
+
+  std::mt19937 randGenerator(5); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-1.3f, 1.3f);
+
+  for (std::size_t i = 0; i < 2000; ++i) {
+    const Raz::Vec3f point({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+    const float expectedDistance = point.computeLength() - 1.f;
+
+    if (std::abs(expectedDistance) > 0.2f || point.computeLength() < 0.1f)
+      continue;
+
+    // Seams & poles being welded, the sign is correct everywhere, even next to the surface
+    Raz::Vec3f normal;
+    CHECK(field.computeDistance(point, normal) == Approx(expectedDistance).margin(0.01f));
+    CHECK(normal.dot(point.normalize()) > 0.99f);
+  }
+}
+
+TEST_CASE("SignedDistanceField batch") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createCube(vertices, indices);
+
+  const Raz::SignedDistanceField field(vertices, indices, 0.1f);
+
+  // 101 points, so that both the SIMD & the remaining scalar parts are processed, some of them being out of the grid
+  std::mt19937 randGenerator(11); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-2.f, 2.f);
+
+  Raz::Vec3fArray points;
+
+  for (std::size_t i = 0; i < 101; ++i)
+    points.add(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }));
+
+  std::vector<float> distances;
+  field.computeDistances(points, distances);
+  REQUIRE(distances.size() == points.getSize());
+
+  std::vector<float> distancesWithNormals;
+  Raz::Vec3fArray normals;
+  field.computeDistances(points, distancesWithNormals, normals);
+  REQUIRE(normals.getSize() == points.getSize());
+
+  for (std::size_t i = 0; i < points.getSize(); ++i) {
+    Raz::Vec3f expectedNormal;
+    const float expectedDistance = field.computeDistance(points[i], expectedNormal);
+
+    CHECK(distances[i] == Approx(expectedDistance).margin(0.00001f));
+    CHECK(distancesWithNormals[i] == Approx(expectedDistance).margin(0.00001f));
+    checkVectors(normals[i], expectedNormal, 0.0001f);
+  }
+
+  std::vector<float> emptyDistances;
+  Raz::SignedDistanceField().computeDistances(points, emptyDistances);
+  REQUIRE(emptyDistances.size() == points.getSize());
+  CHECK(emptyDistances.front() == std::numeric_limits<float>::max());
+}
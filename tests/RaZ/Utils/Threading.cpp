@@ -0,0 +1,100 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Threading parallelize range") {
+  REQUIRE(Raz::Threading::getSystemThreadCount() >= 1);
+
+  std::vector<int> values(1000, 0);
+
+  Raz::Threading::parallelize(0, values.size(), [&values] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t i = beginIndex; i < endIndex; ++i)
+      values[i] += static_cast<int>(i);
+  }, 7);
+
+  // Each index must have been processed exactly once
+  for (std::size_t i = 0; i < values.size(); ++i)
+    REQUIRE(values[i] == static_cast<int>(i));
+
+  // More threads than elements
+  std::atomic<std::size_t> callCount(0);
+  std::atomic<std::size_t> singleCallCount(0);
+  Raz::Threading::parallelize(0, 3, [&callCount, &singleCallCount] (std::size_t beginIndex, std::size_t endIndex) {
+    // Assertions can't be made from other threads than the main one
+    singleCallCount += (endIndex == beginIndex + 1);
+    ++callCount;
+  }, 16);
+  REQUIRE(callCount == 3);
+  REQUIRE(singleCallCount == 3);
+
+  // Empty range
+  Raz::Threading::parallelize(5, 5, [&callCount] (std::size_t, std::size_t) { ++callCount; });
+  REQUIRE(callCount == 3);
+}
+
+TEST_CASE("Threading parallelize actions") {
+  std::atomic<int> sum(0);
+
+  Raz::Threading::parallelize({ [&sum] () { sum += 1; }, [&sum] () { sum += 10; }, [&sum] () { sum += 100; } });
+  REQUIRE(sum == 111);
+}
+
+TEST_CASE("Threading parallelize nested") {
+  std::atomic<std::size_t> callCount(0);
+
+  // Calls made from within a chunk run on the same threads, which must keep executing tasks while waiting for theirs
+  Raz::Threading::parallelize(0, 8, [&callCount] (std::size_t, std::size_t) {
+    Raz::Threading::parallelize(0, 8, [&callCount] (std::size_t, std::size_t) { ++callCount; }, 8);
+  }, 8);
+  REQUIRE(callCount == 64);
+}
+
+TEST_CASE("Threading parallelize exceptions") {
+  std::atomic<std::size_t> callCount(0);
+
+  // The exception thrown by a chunk is rethrown to the caller once all chunks have been processed
+  CHECK_THROWS_AS(Raz::Threading::parallelize(0, 8, [&callCount] (std::size_t beginIndex, std::size_t) {
+    ++callCount;
+
+    if (beginIndex == 2)
+      throw std::runtime_error("Error: Test exception.");
+  }, 8), std::runtime_error);
+  REQUIRE(callCount == 8);
+
+  CHECK_THROWS_AS(Raz::Threading::parallelize({ [] () { throw std::invalid_argument("Error: Test exception."); }, [] () {} }), std::invalid_argument);
+
+  // The threads remain usable afterward
+  Raz::Threading::parallelize(0, 8, [&callCount] (std::size_t, std::size_t) { ++callCount; }, 8);
+  REQUIRE(callCount == 16);
+}
+
+TEST_CASE("Threading parallelize dynamic") {
+  std::vector<int> values(1000, 0);
+  std::vector<std::size_t> threadCallCounts(7, 0);
+
+  Raz::Threading::parallelizeDynamic(values.size(), [&values, &threadCallCounts] (std::size_t index, std::size_t threadIndex) {
+    values[index] += static_cast<int>(index);
+    ++threadCallCounts[threadIndex]; // Each thread has its own counter, thus needing no synchronization
+  }, 7);
+
+  // Each index must have been processed exactly once, by any of the threads
+  for (std::size_t i = 0; i < values.size(); ++i)
+    REQUIRE(values[i] == static_cast<int>(i));
+
+  std::size_t totalCallCount = 0;
+  for (std::size_t callCount : threadCallCounts)
+    totalCallCount += callCount;
+  REQUIRE(totalCallCount == values.size());
+
+  // Empty range
+  Raz::Threading::parallelizeDynamic(0, [&values] (std::size_t, std::size_t) { values.front() = -1; });
+  REQUIRE(values.front() == 0);
+
+  CHECK_THROWS_AS(Raz::Threading::parallelizeDynamic(10, [] (std::size_t index, std::size_t) {
+    if (index == 5)
+      throw std::runtime_error("Error: Test exception.");
+  }), std::runtime_error);
+}
@@ -0,0 +1,549 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/TriangleBvh.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+// Brute-force reference, testing every triangle in order
+bool intersectBruteForce(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices,
+                         const Raz::Ray& ray, float& closestDistance) {
+  bool hasHit = false;
+
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const Raz::Vec3f& firstPos = vertices[indices[i]].position;
+    const Raz::Vec3f firstEdge  = vertices[indices[i + 1]].position - firstPos;
+    const Raz::Vec3f secondEdge = vertices[indices[i + 2]].position - firstPos;
+
+    const Raz::Vec3f pVec   = ray.getDirection().cross(secondEdge);
+    const float determinant = firstEdge.dot(pVec);
+
+    if (determinant == 0.f)
+      continue;
+
+    const Raz::Vec3f invPlaneDir = ray.getOrigin() - firstPos;
+    const float firstBaryCoord   = invPlaneDir.dot(pVec) / determinant;
+
+    if (firstBaryCoord < 0.f || firstBaryCoord > 1.f)
+      continue;
+
+    const Raz::Vec3f qVec       = invPlaneDir.cross(firstEdge);
+    const float secondBaryCoord = ray.getDirection().dot(qVec) / determinant;
+
+    if (secondBaryCoord < 0.f || firstBaryCoord + secondBaryCoord > 1.f)
+      continue;
+
+    const float hitDistance = secondEdge.dot(qVec) / determinant;
+
+    if (hitDistance > 0.f && hitDistance < closestDistance) {
+      closestDistance = hitDistance;
+      hasHit = true;
+    }
+  }
+
+  return hasHit;
+}
+
+void checkRays(const Raz::TriangleBvh& bvh, const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices,
+               const std::vector<Raz::Ray>& rays) {
+  for (const Raz::Ray& ray : rays) {
+    float expectedDistance = std::numeric_limits<float>::max();
+    const bool expectedHit = intersectBruteForce(vertices, indices, ray, expectedDistance);
+
+    Raz::RayHit hit;
+    REQUIRE(bvh.intersect(ray, hit) == expectedHit);
+    REQUIRE(bvh.intersects(ray) == expectedHit);
+
+    if (!expectedHit)
+      continue;
+
+    CHECK(hit.distance == Approx(expectedDistance));
+    CHECK(hit.position == ray.getOrigin() + ray.getDirection() * hit.distance);
+
+    // The hit triangle's vertices interpolated with the barycentric coordinates must give back the hit point
+    const Raz::Vec3f& firstPos  = vertices[indices[hit.triangleIndex * 3]].position;
+    const Raz::Vec3f& secondPos = vertices[indices[hit.triangleIndex * 3 + 1]].position;
+    const Raz::Vec3f& thirdPos  = vertices[indices[hit.triangleIndex * 3 + 2]].position;
+    const Raz::Vec3f interpPos  = firstPos * (1.f - hit.barycentricCoords[0] - hit.barycentricCoords[1])
+                                + secondPos * hit.barycentricCoords[0]
+                                + thirdPos * hit.barycentricCoords[1];
+
+    CHECK(interpPos[0] == Approx(hit.position[0]).margin(0.0001f));
+    CHECK(interpPos[1] == Approx(hit.position[1]).margin(0.0001f));
+    CHECK(interpPos[2] == Approx(hit.position[2]).margin(0.0001f));
+
+    // Hits beyond the maximal distance must be ignored
+    REQUIRE_FALSE(bvh.intersect(ray, hit, expectedDistance * 0.99f));
+    REQUIRE_FALSE(bvh.intersects(ray, expectedDistance * 0.99f));
+  }
+}
+
+} // namespace
+
+TEST_CASE("TriangleBvh basic") {
+  Raz::TriangleBvh bvh;
+  REQUIRE(bvh.isEmpty());
+  REQUIRE_FALSE(bvh.intersects(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z)));
+
+  // Single triangle facing the Z axis
+  std::vector<Raz::Vertex> vertices(3);
+  vertices[0].position = Raz::Vec3f({ -1.f, -1.f, 0.f });
+  vertices[1].position = Raz::Vec3f({ 1.f, -1.f, 0.f });
+  vertices[2].position = Raz::Vec3f({ 0.f, 1.f, 0.f });
+
+  bvh.build(vertices, { 0, 1, 2 });
+  REQUIRE(bvh.getNodes().size() == 1);
+  REQUIRE(bvh.getTriangleCount() == 1);
+
+  Raz::RayHit hit;
+  REQUIRE(bvh.intersect(Raz::Ray(Raz::Vec3f({ 0.f, 0.f, 5.f }), -Raz::Axis::Z), hit));
+  REQUIRE(hit.distance == 5.f);
+  REQUIRE(hit.position == Raz::Vec3f(0.f));
+  REQUIRE(hit.normal == Raz::Axis::Z);
+  REQUIRE(hit.triangleIndex == 0);
+
+  REQUIRE_FALSE(bvh.intersect(Raz::Ray(Raz::Vec3f({ 0.f, 0.f, 5.f }), Raz::Axis::Z), hit));
+  REQUIRE_FALSE(bvh.intersects(Raz::Ray(Raz::Vec3f({ 2.f, 0.f, 5.f }), -Raz::Axis::Z)));
+}
+
+TEST_CASE("TriangleBvh height field") {
+  // Noisy grid of 2 * 150 * 150 triangles, large enough for subtrees to be built in parallel
+  constexpr unsigned int gridSize = 150;
+
+  std::mt19937 randGenerator(42); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> heightDistrib(-0.5f, 0.5f);
+
+  std::vector<Raz::Vertex> vertices((gridSize + 1) * (gridSize + 1));
+
+  for (unsigned int j = 0; j <= gridSize; ++j) {
+    for (unsigned int i = 0; i <= gridSize; ++i)
+      vertices[j * (gridSize + 1) + i].position = Raz::Vec3f({ static_cast<float>(i), heightDistrib(randGenerator), static_cast<float>(j) });
+  }
+
+  std::vector<unsigned int> indices;
+
+  for (unsigned int j = 0; j < gridSize; ++j) {
+    for (unsigned int i = 0; i < gridSize; ++i) {
+      const unsigned int topLeft = j * (gridSize + 1) + i;
+      indices.insert(indices.end(), { topLeft, topLeft + 1, topLeft + gridSize + 1 });
+      indices.insert(indices.end(), { topLeft + 1, topLeft + gridSize + 2, topLeft + gridSize + 1 });
+    }
+  }
+
+  const Raz::TriangleBvh bvh(vertices, indices);
+  REQUIRE(bvh.getTriangleCount() == gridSize * gridSize * 2);
+
+  std::uniform_real_distribution<float> posDistrib(-10.f, static_cast<float>(gridSize) + 10.f);
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Ray> rays;
+
+  for (std::size_t i = 0; i < 300; ++i) {
+    const Raz::Vec3f origin({ posDistrib(randGenerator), 5.f, posDistrib(randGenerator) });
+    const Raz::Vec3f direction = Raz::Vec3f({ dirDistrib(randGenerator), -1.f, dirDistrib(randGenerator) }).normalize();
+    rays.emplace_back(origin, direction);
+  }
+
+  // Grazing rays, travelling almost parallel to the grid
+  for (std::size_t i = 0; i < 100; ++i) {
+    const Raz::Vec3f origin({ -1.f, 0.f, posDistrib(randGenerator) });
+    rays.emplace_back(origin, Raz::Vec3f({ 1.f, dirDistrib(randGenerator) * 0.01f, dirDistrib(randGenerator) * 0.1f }).normalize());
+  }
+
+  checkRays(bvh, vertices, indices, rays);
+}
+
+TEST_CASE("TriangleBvh triangle soup") {
+  std::mt19937 randGenerator(1337); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-10.f, 10.f);
+  std::uniform_real_distribution<float> offsetDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+
+  for (unsigned int i = 0; i < 2000; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    for (unsigned int j = 0; j < 3; ++j) {
+      Raz::Vertex vertex;
+      vertex.position = center + Raz::Vec3f({ offsetDistrib(randGenerator), offsetDistrib(randGenerator), offsetDistrib(randGenerator) });
+      vertices.push_back(vertex);
+      indices.push_back(i * 3 + j);
+    }
+  }
+
+  // Adding a few triangles sharing the same centroid, which can't be separated by the heuristic
+  for (unsigned int i = 0; i < 20; ++i) {
+    const auto firstIndex = static_cast<unsigned int>(vertices.size());
+    const float offset    = static_cast<float>(i) * 0.05f + 0.1f;
+
+    Raz::Vertex vertex;
+    vertex.position = Raz::Vec3f({ -offset, -offset, 0.f });
+    vertices.push_back(vertex);
+    vertex.position = Raz::Vec3f({ offset, -offset, 0.f });
+    vertices.push_back(vertex);
+    vertex.position = Raz::Vec3f({ 0.f, 2.f * offset, 0.f });
+    vertices.push_back(vertex);
+
+    indices.insert(indices.end(), { firstIndex, firstIndex + 1, firstIndex + 2 });
+  }
+
+  const Raz::TriangleBvh bvh(vertices, indices);
+
+  std::vector<Raz::Ray> rays;
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  for (std::size_t i = 0; i < 300; ++i) {
+    const Raz::Vec3f origin({ posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f });
+    const Raz::Vec3f direction = Raz::Vec3f({ dirDistrib(randGenerator), dirDistrib(randGenerator), dirDistrib(randGenerator) }).normalize();
+    rays.emplace_back(origin, direction);
+  }
+
+  // Axis-aligned rays, having infinite inverse direction components
+  rays.emplace_back(Raz::Vec3f({ 0.f, 0.f, 5.f }), -Raz::Axis::Z);
+  rays.emplace_back(Raz::Vec3f({ 0.1f, 0.2f, -5.f }), Raz::Axis::Z);
+  rays.emplace_back(Raz::Vec3f({ -15.f, 1.f, 1.f }), Raz::Axis::X);
+
+  checkRays(bvh, vertices, indices, rays);
+}
+
+TEST_CASE("TriangleBvh closest point") {
+  std::mt19937 randGenerator(7); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-10.f, 10.f);
+  std::uniform_real_distribution<float> offsetDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+
+  for (unsigned int i = 0; i < 1000; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    for (unsigned int j = 0; j < 3; ++j) {
+      Raz::Vertex vertex;
+      vertex.position = center + Raz::Vec3f({ offsetDistrib(randGenerator), offsetDistrib(randGenerator), offsetDistrib(randGenerator) });
+      vertices.push_back(vertex);
+      indices.push_back(i * 3 + j);
+    }
+  }
+
+  const Raz::TriangleBvh bvh(vertices, indices);
+  Raz::TriangleBvh::ClosestPoint closestPoint;
+
+  REQUIRE_FALSE(Raz::TriangleBvh().findClosestPoint(Raz::Vec3f(0.f), closestPoint));
+
+  for (std::size_t i = 0; i < 200; ++i) {
+    const Raz::Vec3f position({ posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f });
+
+    float expectedDistance = std::numeric_limits<float>::max();
+
+    for (std::size_t triIndex = 0; triIndex < indices.size(); triIndex += 3) {
+      const Raz::Triangle triangle(vertices[indices[triIndex]].position,
+                                   vertices[indices[triIndex + 1]].position,
+                                   vertices[indices[triIndex + 2]].position);
+      expectedDistance = std::min(expectedDistance, (triangle.computeProjection(position) - position).computeLength());
+    }
+
+    REQUIRE(bvh.findClosestPoint(position, closestPoint));
+    CHECK(closestPoint.distance == Approx(expectedDistance));
+    CHECK((closestPoint.position - position).computeLength() == Approx(closestPoint.distance));
+
+    // The point must lie on the triangle it has been found on
+    const Raz::Triangle triangle(vertices[indices[closestPoint.triangleIndex * 3]].position,
+                                 vertices[indices[closestPoint.triangleIndex * 3 + 1]].position,
+                                 vertices[indices[closestPoint.triangleIndex * 3 + 2]].position);
+    CHECK((triangle.computeProjection(closestPoint.position) - closestPoint.position).computeLength() == Approx(0.f).margin(0.0001f));
+
+    REQUIRE_FALSE(bvh.findClosestPoint(position, closestPoint, expectedDistance * 0.99f));
+  }
+}
+
+TEST_CASE("TriangleBvh sphere sweep") {
+  // Single triangle facing the Z axis
+  std::vector<Raz::Vertex> vertices(3);
+  vertices[0].position = Raz::Vec3f({ -1.f, -1.f, 0.f });
+  vertices[1].position = Raz::Vec3f({ 1.f, -1.f, 0.f });
+  vertices[2].position = Raz::Vec3f({ 0.f, 1.f, 0.f });
+
+  const Raz::TriangleBvh bvh(vertices, { 0, 1, 2 });
+  Raz::TriangleBvh::SweepHit hit;
+
+  REQUIRE_FALSE(Raz::TriangleBvh().sweep(Raz::Sphere(Raz::Vec3f(0.f), 1.f), Raz::Axis::X, hit));
+
+  // Touching the face, from both sides
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, -10.f }), hit));
+  CHECK(hit.time == Approx(0.4f));
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK(hit.triangleIndex == 0);
+
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, -5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, 8.f }), hit));
+  CHECK(hit.time == Approx(0.5f));
+  CHECK(hit.normal == -Raz::Axis::Z);
+
+  // Touching an edge & a vertex, the sphere passing beside the face
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, -2.f, 5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, -10.f }), hit));
+  CHECK(hit.time == Approx(0.5f));
+  CHECK(hit.normal[1] == Approx(-1.f));
+
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 2.f, 5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, -10.f }), hit));
+  CHECK(hit.time == Approx(0.5f));
+  CHECK(hit.normal[1] == Approx(1.f));
+
+  // Stopping before the triangle, or passing by it
+  CHECK_FALSE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, -3.f }), hit));
+  CHECK_FALSE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 2.5f, 5.f }), 1.f), Raz::Vec3f({ 0.f, 0.f, -10.f }), hit));
+
+  // A small & fast sphere cannot tunnel through the triangle, which it would have jumped over with discrete tests
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 5.f }), 0.1f), Raz::Vec3f({ 0.f, 0.f, -100.f }), hit));
+  CHECK(hit.time == Approx(0.049f));
+
+  // An overlapping sphere is stopped immediately if moving towards the triangle, but can freely escape it
+  REQUIRE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 0.5f }), 1.f), Raz::Vec3f({ 0.5f, 0.f, -1.f }), hit));
+  CHECK(hit.time == 0.f);
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK_FALSE(bvh.sweep(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 0.5f }), 1.f), Raz::Vec3f({ 0.f, 0.f, 1.f }), hit));
+}
+
+TEST_CASE("TriangleBvh sphere sweep soup") {
+  std::mt19937 randGenerator(21); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-5.f, 5.f);
+  std::uniform_real_distribution<float> offsetDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+
+  for (unsigned int i = 0; i < 100; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    for (unsigned int j = 0; j < 3; ++j) {
+      Raz::Vertex vertex;
+      vertex.position = center + Raz::Vec3f({ offsetDistrib(randGenerator), offsetDistrib(randGenerator), offsetDistrib(randGenerator) });
+      vertices.push_back(vertex);
+      indices.push_back(i * 3 + j);
+    }
+  }
+
+  const Raz::TriangleBvh bvh(vertices, indices);
+  constexpr float radius = 0.3f;
+  constexpr std::size_t stepCount = 200;
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f });
+    const Raz::Vec3f displacement({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    Raz::TriangleBvh::ClosestPoint closestPoint;
+
+    // Starting positions overlapping a triangle are skipped, as they may be let free
+    if (bvh.findClosestPoint(center, closestPoint, radius))
+      continue;
+
+    Raz::TriangleBvh::SweepHit hit;
+    const bool hasHit = bvh.sweep(Raz::Sphere(center, radius), displacement, hit);
+    const float hitTime = (hasHit ? hit.time : 1.f);
+
+    // Along the way up to the contact, the sphere never gets closer to any triangle than its radius
+    for (std::size_t step = 0; step < stepCount; ++step) {
+      const float time = hitTime * static_cast<float>(step) / stepCount;
+      CHECK_FALSE(bvh.findClosestPoint(center + displacement * time, closestPoint, radius * 0.999f));
+    }
+
+    if (!hasHit)
+      continue;
+
+    // At the contact, the sphere touches the triangle in the direction opposite to the normal
+    REQUIRE(bvh.findClosestPoint(center + displacement * hit.time, closestPoint));
+    CHECK(closestPoint.distance == Approx(radius).margin(0.0001f));
+
+    const Raz::Vec3f contactPos = center + displacement * hit.time - hit.normal * radius;
+    CHECK((contactPos - closestPoint.position).computeLength() == Approx(0.f).margin(0.001f));
+    CHECK(hit.normal.dot(displacement) < 0.f);
+  }
+}
+
+TEST_CASE("TriangleBvh box sweep") {
+  std::vector<Raz::Vertex> vertices(3);
+  vertices[0].position = Raz::Vec3f({ -1.f, -1.f, 0.f });
+  vertices[1].position = Raz::Vec3f({ 1.f, -1.f, 0.f });
+  vertices[2].position = Raz::Vec3f({ 0.f, 1.f, 0.f });
+
+  const Raz::TriangleBvh bvh(vertices, { 0, 1, 2 });
+  Raz::TriangleBvh::SweepHit hit;
+
+  const Raz::AABB box(Raz::Vec3f({ 0.5f, 0.5f, 5.5f }), Raz::Vec3f({ -0.5f, -0.5f, 4.5f }));
+
+  REQUIRE(bvh.sweep(box, Raz::Vec3f({ 0.f, 0.f, -10.f }), hit));
+  CHECK(hit.time == Approx(0.45f));
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK(hit.triangleIndex == 0);
+
+  CHECK_FALSE(bvh.sweep(box, Raz::Vec3f({ 0.f, 0.f, -4.f }), hit));
+  CHECK_FALSE(bvh.sweep(box, Raz::Vec3f({ 0.f, 0.f, 10.f }), hit));
+
+  // Coming from the side, the box's face touches the triangle's tip
+  const Raz::AABB sideBox(Raz::Vec3f({ 0.5f, 4.f, 0.5f }), Raz::Vec3f({ -0.5f, 3.f, -0.5f }));
+  REQUIRE(bvh.sweep(sideBox, Raz::Vec3f({ 0.f, -4.f, 0.f }), hit));
+  CHECK(hit.time == Approx(0.5f));
+  CHECK(hit.normal == Raz::Axis::Y);
+
+  // Moving diagonally, the box's edge touches the triangle's edge
+  const Raz::AABB edgeBox(Raz::Vec3f({ 0.5f, -1.5f, 2.f }), Raz::Vec3f({ -0.5f, -2.5f, 1.f }));
+  REQUIRE(bvh.sweep(edgeBox, Raz::Vec3f({ 0.f, 1.f, -2.f }), hit));
+  CHECK(hit.time == Approx(0.5f));
+  CHECK(hit.normal.dot(Raz::Vec3f({ 0.f, -1.f, 1.f }).normalize()) > 0.f);
+
+  // Overlapping boxes are stopped if moving towards the triangle, the normal being the direction of least penetration
+  const Raz::AABB overlappingBox(Raz::Vec3f({ 0.5f, 0.5f, 0.2f }), Raz::Vec3f({ -0.5f, -0.5f, -0.8f }));
+  REQUIRE(bvh.sweep(overlappingBox, Raz::Vec3f({ 0.f, 0.f, 1.f }), hit));
+  CHECK(hit.time == 0.f);
+  CHECK(hit.normal == -Raz::Axis::Z);
+  CHECK_FALSE(bvh.sweep(overlappingBox, Raz::Vec3f({ 0.f, 0.f, -1.f }), hit));
+}
+
+TEST_CASE("TriangleBvh box sweep soup") {
+  std::mt19937 randGenerator(23); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-5.f, 5.f);
+  std::uniform_real_distribution<float> offsetDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  std::vector<Raz::Triangle> triangles;
+
+  for (unsigned int i = 0; i < 50; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    for (unsigned int j = 0; j < 3; ++j) {
+      Raz::Vertex vertex;
+      vertex.position = center + Raz::Vec3f({ offsetDistrib(randGenerator), offsetDistrib(randGenerator), offsetDistrib(randGenerator) });
+      vertices.push_back(vertex);
+      indices.push_back(i * 3 + j);
+    }
+
+    triangles.emplace_back(vertices[i * 3].position, vertices[i * 3 + 1].position, vertices[i * 3 + 2].position);
+  }
+
+  const Raz::TriangleBvh bvh(vertices, indices);
+  const Raz::Vec3f halfExtents({ 0.3f, 0.2f, 0.4f });
+  constexpr std::size_t stepCount = 50;
+
+  const auto overlapsAny = [&triangles] (const Raz::AABB& box) {
+    return std::any_of(triangles.cbegin(), triangles.cend(), [&box] (const Raz::Triangle& triangle) { return box.intersects(triangle); });
+  };
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    const Raz::Vec3f center({ posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f, posDistrib(randGenerator) * 1.5f });
+    const Raz::Vec3f displacement({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+    if (overlapsAny(Raz::AABB(center + halfExtents, center - halfExtents)))
+      continue;
+
+    Raz::TriangleBvh::SweepHit hit;
+    const bool hasHit = bvh.sweep(Raz::AABB(center + halfExtents, center - halfExtents), displacement, hit);
+    const float hitTime = (hasHit ? hit.time : 1.f);
+
+    // Up to the contact, a slightly shrunk box never overlaps any triangle
+    for (std::size_t step = 0; step < stepCount; ++step) {
+      const Raz::Vec3f stepCenter = center + displacement * (hitTime * static_cast<float>(step) / stepCount);
+      CHECK_FALSE(overlapsAny(Raz::AABB(stepCenter + halfExtents * 0.999f, stepCenter - halfExtents * 0.999f)));
+    }
+
+    if (!hasHit)
+      continue;
+
+    // At the contact, a slightly grown box overlaps the touched triangle
+    const Raz::Vec3f hitCenter = center + displacement * hit.time;
+    CHECK(Raz::AABB(hitCenter + halfExtents * 1.001f, hitCenter - halfExtents * 1.001f).intersects(triangles[hit.triangleIndex]));
+    CHECK(hit.normal.dot(displacement) < 0.f);
+  }
+}
+
+TEST_CASE("TriangleBvh mesh intersection") {
+  std::mt19937 randGenerator(99); // NOLINT(cert-msc51-cpp): deterministic on purpose
+  std::uniform_real_distribution<float> posDistrib(-5.f, 5.f);
+  std::uniform_real_distribution<float> offsetDistrib(-0.5f, 0.5f);
+
+  const auto createSoup = [&] (unsigned int triangleCount, std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+    for (unsigned int i = 0; i < triangleCount; ++i) {
+      const Raz::Vec3f center({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) });
+
+      for (unsigned int j = 0; j < 3; ++j) {
+        Raz::Vertex vertex;
+        vertex.position = center + Raz::Vec3f({ offsetDistrib(randGenerator), offsetDistrib(randGenerator), offsetDistrib(randGenerator) });
+        vertices.push_back(vertex);
+        indices.push_back(i * 3 + j);
+      }
+    }
+  };
+
+  std::vector<Raz::Vertex> firstVertices, secondVertices;
+  std::vector<unsigned int> firstIndices, secondIndices;
+  createSoup(600, firstVertices, firstIndices);
+  createSoup(400, secondVertices, secondIndices);
+
+  const Raz::TriangleBvh firstBvh(firstVertices, firstIndices);
+  const Raz::TriangleBvh secondBvh(secondVertices, secondIndices);
+
+  // Brute-force reference, testing every pair of triangles
+  const auto intersectBruteForce = [&firstBvh, &secondBvh] (const Raz::Mat4f& transform) {
+    const auto transformPoint = [&transform] (const Raz::Vec3f& point) {
+      return Raz::Vec3f({ point[0] * transform[0] + point[1] * transform[4] + point[2] * transform[8] + transform[12],
+                          point[0] * transform[1] + point[1] * transform[5] + point[2] * transform[9] + transform[13],
+                          point[0] * transform[2] + point[1] * transform[6] + point[2] * transform[10] + transform[14] });
+    };
+
+    std::vector<Raz::TriangleBvh::TrianglePair> trianglePairs;
+
+    for (const Raz::TriangleBvh::Triangle& secondTri : secondBvh.getTriangles()) {
+      const Raz::Triangle transformedTri(transformPoint(secondTri.firstPos),
+                                         transformPoint(secondTri.firstPos + secondTri.firstEdge),
+                                         transformPoint(secondTri.firstPos + secondTri.secondEdge));
+
+      for (const Raz::TriangleBvh::Triangle& firstTri : firstBvh.getTriangles()) {
+        if (Raz::Triangle(firstTri.firstPos, firstTri.firstPos + firstTri.firstEdge, firstTri.firstPos + firstTri.secondEdge).intersects(transformedTri))
+          trianglePairs.emplace_back(firstTri.index, secondTri.index);
+      }
+    }
+
+    std::sort(trianglePairs.begin(), trianglePairs.end());
+    return trianglePairs;
+  };
+
+  std::uniform_real_distribution<float> angleDistrib(0.f, 6.28f);
+  std::uniform_real_distribution<float> scaleDistrib(0.5f, 1.5f);
+  std::vector<Raz::TriangleBvh::TrianglePair> trianglePairs;
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    const Raz::Vec3f axis = Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }).normalize();
+    const Raz::Transform transform(Raz::Vec3f({ posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator) }) * 0.5f,
+                                   Raz::Quaternionf(angleDistrib(randGenerator), axis),
+                                   Raz::Vec3f({ scaleDistrib(randGenerator), scaleDistrib(randGenerator), scaleDistrib(randGenerator) }));
+    const Raz::Mat4f& transformMatrix = transform.getTransformMatrix();
+
+    const std::vector<Raz::TriangleBvh::TrianglePair> expectedPairs = intersectBruteForce(transformMatrix);
+    REQUIRE_FALSE(expectedPairs.empty());
+
+    // The pairs are returned sorted, whichever thread has found them
+    CHECK(firstBvh.intersect(secondBvh, trianglePairs, transformMatrix));
+    CHECK(trianglePairs == expectedPairs);
+
+    CHECK(firstBvh.intersects(secondBvh, transformMatrix));
+  }
+
+  // Once moved away, the meshes don't touch anymore
+  const Raz::Mat4f distantTransform = Raz::Transform(Raz::Vec3f({ 20.f, 0.f, 0.f })).getTransformMatrix();
+  CHECK_FALSE(firstBvh.intersects(secondBvh, distantTransform));
+  CHECK_FALSE(firstBvh.intersect(secondBvh, trianglePairs, distantTransform));
+  CHECK(trianglePairs.empty());
+
+  // A mesh intersects itself, each triangle at least touching its own copy
+  CHECK(firstBvh.intersect(firstBvh, trianglePairs));
+
+  for (std::size_t triIndex = 0; triIndex < firstBvh.getTriangleCount(); ++triIndex)
+    CHECK(std::find(trianglePairs.cbegin(), trianglePairs.cend(), Raz::TriangleBvh::TrianglePair(triIndex, triIndex)) != trianglePairs.cend());
+
+  // Empty hierarchies never intersect anything
+  const Raz::TriangleBvh emptyBvh;
+  CHECK_FALSE(firstBvh.intersects(emptyBvh));
+  CHECK_FALSE(emptyBvh.intersect(firstBvh, trianglePairs));
+}